@@ -0,0 +1,70 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "accesslog.hpp"
+
+#include <string>
+
+#include "logging.hpp"
+
+namespace ovms {
+
+AccessLogRecord::AccessLogRecord(AccessLogApi api, std::string_view servableName, model_version_t version) :
+    enabled(access_logger->should_log(spdlog::level::info)),
+    api(api),
+    servableName(servableName),
+    version(version) {
+    if (enabled) {
+        start = clock::now();
+        lastStageEnd = start;
+    }
+}
+
+void AccessLogRecord::stageFinished(const char* stage) {
+    if (!enabled || stagesCount == MAX_STAGES) {
+        return;
+    }
+    auto now = clock::now();
+    stages[stagesCount++] = {stage, now - lastStageEnd};
+    lastStageEnd = now;
+}
+
+void AccessLogRecord::finish(const Status& status) {
+    if (!enabled) {
+        return;
+    }
+    using std::chrono::duration_cast;
+    using std::chrono::microseconds;
+    std::string timings;
+    for (size_t i = 0; i < stagesCount; i++) {
+        timings += " ";
+        timings += stages[i].first;
+        timings += "_us=";
+        timings += std::to_string(duration_cast<microseconds>(stages[i].second).count());
+    }
+    const bool grpc = api == AccessLogApi::GRPC;
+    const int code = grpc ? static_cast<int>(status.grpc().error_code()) : static_cast<int>(status.http());
+    access_logger->info("{} model={} version={} status={} total_us={}{}{}{}",
+        grpc ? "grpc" : "rest",
+        servableName,
+        version,
+        code,
+        duration_cast<microseconds>(clock::now() - start).count(),
+        timings,
+        status.ok() ? "" : " error=",
+        status.ok() ? "" : status.string());
+}
+
+}  // namespace ovms
@@ -0,0 +1,72 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <string_view>
+#include <utility>
+
+#include "model_version_policy.hpp"
+#include "status.hpp"
+
+namespace ovms {
+
+enum class AccessLogApi {
+    GRPC,
+    REST
+};
+
+/**
+ * @brief Collects timings of stages of a single predict request and writes them as one line of access log.
+ * When access log is disabled nothing is measured.
+ */
+class AccessLogRecord {
+public:
+    using clock = std::chrono::steady_clock;
+    static constexpr size_t MAX_STAGES = 4;
+
+    /**
+     * @param servableName has to outlive the record
+     */
+    AccessLogRecord(AccessLogApi api, std::string_view servableName, model_version_t version);
+
+    bool isEnabled() const { return enabled; }
+
+    void setVersion(model_version_t version) { this->version = version; }
+
+    /**
+     * @brief Records time elapsed since previous stage finished or since the record was created
+     */
+    void stageFinished(const char* stage);
+
+    /**
+     * @brief Writes the line, status is reported as gRPC or HTTP code returned to the client
+     */
+    void finish(const Status& status);
+
+private:
+    const bool enabled;
+    const AccessLogApi api;
+    const std::string_view servableName;
+    model_version_t version;
+    clock::time_point start;
+    clock::time_point lastStageEnd;
+    std::array<std::pair<const char*, clock::duration>, MAX_STAGES> stages;
+    size_t stagesCount = 0;
+};
+
+}  // namespace ovms
@@ -0,0 +1,114 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+// Measures peak resident memory of reading IR network from buffers provided by custom loader.
+// Each mode runs in a separate process, so that peaks do not affect each other.
+// Usage: customloader_benchmark <model.xml> <weights.bin> [target device]
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <inference_engine.hpp>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "../customloaderinterface.hpp"
+
+using namespace ovms;
+using namespace InferenceEngine;
+
+using load_fn_t = std::function<std::pair<std::unique_ptr<CustomLoaderBuffer>, std::unique_ptr<CustomLoaderBuffer>>()>;
+
+static size_t readStatusKb(const std::string& field) {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.rfind(field + ":", 0) == 0) {
+            return std::stoull(line.substr(field.size() + 1));
+        }
+    }
+    return 0;
+}
+
+static std::vector<uint8_t> readFile(const std::string& path) {
+    // Same way as sample custom loader read files before version 2 interface
+    std::vector<uint8_t> content;
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+    std::for_each(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>(),
+        [&content](const char c) { content.push_back(c); });
+    return content;
+}
+
+static int measure(const std::string& name, const load_fn_t& load, const std::string& device) {
+    pid_t pid = fork();
+    if (pid < 0) {
+        std::cerr << "fork failed" << std::endl;
+        return 1;
+    }
+    if (pid > 0) {
+        int status = 0;
+        waitpid(pid, &status, 0);
+        return WIFEXITED(status) ? WEXITSTATUS(status) : 1;
+    }
+    Core core;
+    core.GetVersions(device);  // plugin is loaded before baseline is taken
+    const size_t baselineKb = readStatusKb("VmRSS");
+    auto start = std::chrono::steady_clock::now();
+    auto [model, weights] = load();
+    if (!model || !weights) {
+        std::cerr << name << ": cannot read model files" << std::endl;
+        _exit(1);
+    }
+    std::string xml(reinterpret_cast<const char*>(model->data()), model->size());
+    model.reset();
+    auto network = core.ReadNetwork(xml,
+        make_shared_blob<uint8_t>({Precision::U8, {weights->size()}, C}, const_cast<uint8_t*>(weights->data()), weights->size()));
+    auto readSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    auto executableNetwork = core.LoadNetwork(network, device);
+    auto totalSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << std::left << std::setw(24) << name
+              << std::right << std::fixed << std::setprecision(1)
+              << "peak RSS increase: " << std::setw(10) << (readStatusKb("VmHWM") - baselineKb) / 1024.0 << " MB"
+              << std::setprecision(3)
+              << ", read network: " << readSeconds << " s"
+              << ", load to " << device << ": " << totalSeconds << " s" << std::endl;
+    _exit(0);
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        std::cerr << "Usage: " << argv[0] << " <model.xml> <weights.bin> [target device]" << std::endl;
+        return 1;
+    }
+    const std::string xmlPath = argv[1];
+    const std::string binPath = argv[2];
+    const std::string device = argc > 3 ? argv[3] : "CPU";
+
+    int result = measure("vectors (interface v1)", [&]() {
+        return std::make_pair(CustomLoaderBuffer::fromVector(readFile(xmlPath)), CustomLoaderBuffer::fromVector(readFile(binPath)));
+    }, device);
+    result |= measure("mapped (interface v2)", [&]() {
+        return std::make_pair(CustomLoaderBuffer::mapFile(xmlPath), CustomLoaderBuffer::mapFile(binPath));
+    }, device);
+    return result;
+}
@@ -0,0 +1,470 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+// Google Benchmark suite of components on the request path: REST routing, parsing and response json, (de)serialization
+// of tensors, blob copies, infer requests queue, thread safe queue and pipeline execution.
+// No model is inferred: deserialization sets blobs on an infer request which only stores them and pipelines
+// are built of nodes passing their inputs through. Only infer requests queue benchmark reads the dummy model.
+// Usage: run from repository root, e.g. hotpath_benchmark --benchmark_filter=Deserialize
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <inference_engine.hpp>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wall"
+#include "tensorflow_serving/apis/prediction_service.grpc.pb.h"
+#pragma GCC diagnostic pop
+
+#include "../deserialization.hpp"
+#include "../ov_utils.hpp"
+#include "../ovinferrequestsqueue.hpp"
+#include "../pipeline.hpp"
+#include "../rest_parser.hpp"
+#include "../rest_router.hpp"
+#include "../rest_utils.hpp"
+#include "../serialization.hpp"
+#include "../threadsafequeue.hpp"
+
+using namespace ovms;
+using namespace InferenceEngine;
+
+using tensorflow::serving::PredictRequest;
+using tensorflow::serving::PredictResponse;
+
+namespace {
+
+const std::string DUMMY_MODEL_PATH = std::filesystem::current_path().u8string() + "/src/test/dummy/1/dummy.xml";
+const char* INPUT_NAME = "b";
+const char* OUTPUT_NAME = "a";
+
+/**
+ * @brief Infer request without a network, keeps blobs set by deserialization and returns them to serialization
+ */
+class BlobStoreInferRequest : public IInferRequest {
+    std::unordered_map<std::string, Blob::Ptr> blobs;
+
+public:
+    InferenceEngine::StatusCode SetBlob(const char* name, const Blob::Ptr& data, ResponseDesc*) noexcept override {
+        blobs[name] = data;
+        return InferenceEngine::StatusCode::OK;
+    }
+    InferenceEngine::StatusCode SetBlob(const char* name, const Blob::Ptr& data, const PreProcessInfo&, ResponseDesc* resp) noexcept override {
+        return SetBlob(name, data, resp);
+    }
+    InferenceEngine::StatusCode GetBlob(const char* name, Blob::Ptr& data, ResponseDesc*) noexcept override {
+        auto it = blobs.find(name);
+        if (it == blobs.end()) {
+            return InferenceEngine::StatusCode::NOT_FOUND;
+        }
+        data = it->second;
+        return InferenceEngine::StatusCode::OK;
+    }
+    InferenceEngine::StatusCode GetPreProcess(const char*, const PreProcessInfo**, ResponseDesc*) const noexcept override {
+        return InferenceEngine::StatusCode::NOT_IMPLEMENTED;
+    }
+    InferenceEngine::StatusCode Infer(ResponseDesc*) noexcept override {
+        return InferenceEngine::StatusCode::OK;
+    }
+    InferenceEngine::StatusCode GetPerformanceCounts(std::map<std::string, InferenceEngineProfileInfo>&, ResponseDesc*) const noexcept override {
+        return InferenceEngine::StatusCode::NOT_IMPLEMENTED;
+    }
+    InferenceEngine::StatusCode Wait(int64_t, ResponseDesc*) noexcept override {
+        return InferenceEngine::StatusCode::OK;
+    }
+    InferenceEngine::StatusCode StartAsync(ResponseDesc*) noexcept override {
+        return InferenceEngine::StatusCode::OK;
+    }
+    InferenceEngine::StatusCode SetCompletionCallback(IInferRequest::CompletionCallback) noexcept override {
+        return InferenceEngine::StatusCode::NOT_IMPLEMENTED;
+    }
+    InferenceEngine::StatusCode GetUserData(void**, ResponseDesc*) noexcept override {
+        return InferenceEngine::StatusCode::NOT_IMPLEMENTED;
+    }
+    InferenceEngine::StatusCode SetUserData(void*, ResponseDesc*) noexcept override {
+        return InferenceEngine::StatusCode::NOT_IMPLEMENTED;
+    }
+    InferenceEngine::StatusCode SetBatch(int, ResponseDesc*) noexcept override {
+        return InferenceEngine::StatusCode::NOT_IMPLEMENTED;
+    }
+    InferenceEngine::StatusCode QueryState(IVariableState::Ptr&, size_t, ResponseDesc*) noexcept override {
+        return InferenceEngine::StatusCode::OUT_OF_BOUNDS;
+    }
+    void Release() noexcept override {}
+};
+
+/**
+ * @brief Node of mock pipelines, passes its inputs to the next nodes without any processing
+ */
+class PassThroughNode : public Node {
+public:
+    PassThroughNode(const std::string& nodeName) :
+        Node(nodeName) {}
+
+    Status execute(ThreadSafeQueue<std::reference_wrapper<Node>>& notifyEndQueue) override {
+        notifyEndQueue.push(*this);
+        return StatusCode::OK;
+    }
+
+    Status fetchResults(BlobMap& outputs) override {
+        outputs = std::move(inputBlobs);
+        inputBlobs.clear();
+        return StatusCode::OK;
+    }
+};
+
+tensorflow::DataType getDataType(Precision::ePrecision precision) {
+    switch (precision) {
+    case Precision::FP32:
+        return tensorflow::DataType::DT_FLOAT;
+    case Precision::FP16:
+        return tensorflow::DataType::DT_HALF;
+    case Precision::I32:
+        return tensorflow::DataType::DT_INT32;
+    case Precision::U8:
+    default:
+        return tensorflow::DataType::DT_UINT8;
+    }
+}
+
+// Tensor of shape [1, count], FP16 values are sent in half_val as model server expects
+tensorflow::TensorProto createTensorProto(Precision::ePrecision precision, size_t count) {
+    tensorflow::TensorProto proto;
+    proto.set_dtype(getDataType(precision));
+    proto.mutable_tensor_shape()->add_dim()->set_size(1);
+    proto.mutable_tensor_shape()->add_dim()->set_size(count);
+    if (precision == Precision::FP16) {
+        // 1.0 in half precision
+        proto.mutable_half_val()->Resize(count, 0x3C00);
+        return proto;
+    }
+    std::string content(count * Precision(precision).size(), '\0');
+    if (precision == Precision::FP32) {
+        float* values = reinterpret_cast<float*>(content.data());
+        std::iota(values, values + count, 0.5f);
+    } else {
+        for (size_t i = 0; i < content.size(); i++) {
+            content[i] = static_cast<char>(i % 100);
+        }
+    }
+    proto.set_tensor_content(content);
+    return proto;
+}
+
+tensor_map_t createTensorMap(const std::string& name, Precision::ePrecision precision, size_t count) {
+    return {{name, std::make_shared<TensorInfo>(name, precision, shape_t{1, count}, Layout::NC)}};
+}
+
+Blob::Ptr createFilledBlob(Precision::ePrecision precision, size_t count) {
+    Blob::Ptr blob;
+    createBlob(blob, TensorDesc(precision, {1, count}, Layout::NC));
+    std::fill_n(blob->buffer().as<uint8_t*>(), blob->byteSize(), 1);
+    return blob;
+}
+
+std::string createRestRequest(Precision::ePrecision precision, size_t count) {
+    std::stringstream json;
+    json << R"({"inputs": {")" << INPUT_NAME << R"(": [[)";
+    for (size_t i = 0; i < count; i++) {
+        json << (i > 0 ? "," : "");
+        if (precision == Precision::FP32 || precision == Precision::FP16) {
+            json << (i % 100) + 0.5;
+        } else {
+            json << (i % 100);
+        }
+    }
+    json << "]]}}";
+    return json.str();
+}
+
+void setProcessed(benchmark::State& state, Precision::ePrecision precision, size_t count) {
+    state.SetItemsProcessed(state.iterations() * count);
+    state.SetBytesProcessed(state.iterations() * count * Precision(precision).size());
+}
+
+const std::vector<std::pair<std::string_view, std::string_view>> REST_REQUESTS = {
+    {"POST", "/v1/models/resnet:predict"},
+    {"POST", "/v1/models/resnet/versions/2:predict"},
+    {"GET", "/v1/models/resnet/metadata"},
+    {"GET", "/v1/models/resnet/versions/2"},
+};
+
+/**
+ * @brief Routing of REST handler before routeRestRequest, kept as a baseline
+ */
+class RegexRestRouter {
+    const std::regex sanityRegex{R"((.?)\/v1\/models\/.*)"};
+    const std::regex predictionRegex{R"((.?)\/v1\/models\/([^\/:]+)(?:(?:\/versions\/(\d+))|(?:\/labels\/(\w+)))?:(classify|regress|predict))"};
+    const std::regex modelstatusRegex{R"((.?)\/v1\/models(?:\/([^\/:]+))?(?:(?:\/versions\/(\d+))|(?:\/labels\/(\w+)))?(?:\/(metadata|stats))?)"};
+    const std::regex sharedMemoryRegex{R"((.?)\/v1\/shared_memory\/region\/([^\/:]+)\/(register|unregister))"};
+    const std::regex schedulerStatsRegex{R"((.?)\/v1\/scheduler\/stats)"};
+    const std::regex tracesRegex{R"((.?)\/v1\/traces)"};
+
+    static bool isPathEscaped(const std::string& path) {
+        return std::string::npos != path.find("../") || std::string::npos != path.find("/..");
+    }
+
+public:
+    Status route(std::string_view method, std::string_view path, std::string& modelName, std::optional<int64_t>& version) const {
+        std::smatch sm;
+        std::string pathStr(path);
+        if (isPathEscaped(pathStr)) {
+            return StatusCode::PATH_INVALID;
+        }
+        if (std::regex_match(pathStr, sm, sharedMemoryRegex) || std::regex_match(pathStr, sm, schedulerStatsRegex) ||
+            std::regex_match(pathStr, sm, tracesRegex)) {
+            return StatusCode::OK;
+        }
+        if (isPathEscaped(pathStr) || !std::regex_match(pathStr, sm, sanityRegex)) {
+            return StatusCode::REST_INVALID_URL;
+        }
+        if (!std::regex_match(pathStr, sm, method == "POST" ? predictionRegex : modelstatusRegex)) {
+            return StatusCode::REST_INVALID_URL;
+        }
+        modelName = sm[2];
+        std::string versionStr = sm[3];
+        std::string labelStr = sm[4];
+        std::string methodStr = sm[5];
+        if (!versionStr.empty()) {
+            version = std::stoll(versionStr);
+        }
+        return StatusCode::OK;
+    }
+};
+
+void tensorSizes(benchmark::internal::Benchmark* benchmark) {
+    benchmark->Arg(10)->Arg(1000)->Arg(3 * 224 * 224)->Arg(1 << 20);
+}
+
+}  // namespace
+
+template <Precision::ePrecision PRECISION>
+static void BM_RestParserParse(benchmark::State& state) {
+    const size_t count = state.range(0);
+    const std::string json = createRestRequest(PRECISION, count);
+    const auto tensors = createTensorMap(INPUT_NAME, PRECISION, count);
+    for (auto _ : state) {
+        RestParser parser(tensors);
+        auto status = parser.parse(json.c_str());
+        if (!status.ok()) {
+            state.SkipWithError(status.string().c_str());
+            break;
+        }
+        benchmark::DoNotOptimize(parser.getProto());
+    }
+    setProcessed(state, PRECISION, count);
+}
+BENCHMARK_TEMPLATE(BM_RestParserParse, Precision::FP32)->Apply(tensorSizes);
+BENCHMARK_TEMPLATE(BM_RestParserParse, Precision::FP16)->Apply(tensorSizes);
+BENCHMARK_TEMPLATE(BM_RestParserParse, Precision::I32)->Apply(tensorSizes);
+BENCHMARK_TEMPLATE(BM_RestParserParse, Precision::U8)->Apply(tensorSizes);
+
+template <Precision::ePrecision PRECISION>
+static void BM_MakeJsonFromPredictResponse(benchmark::State& state) {
+    const size_t count = state.range(0);
+    PredictResponse response;
+    (*response.mutable_outputs())[OUTPUT_NAME] = createTensorProto(PRECISION, count);
+    std::string json;
+    for (auto _ : state) {
+        auto status = makeJsonFromPredictResponse(response, &json, Order::COLUMN);
+        if (!status.ok()) {
+            state.SkipWithError(status.string().c_str());
+            break;
+        }
+        benchmark::DoNotOptimize(json);
+    }
+    setProcessed(state, PRECISION, count);
+}
+BENCHMARK_TEMPLATE(BM_MakeJsonFromPredictResponse, Precision::FP32)->Apply(tensorSizes);
+BENCHMARK_TEMPLATE(BM_MakeJsonFromPredictResponse, Precision::I32)->Apply(tensorSizes);
+BENCHMARK_TEMPLATE(BM_MakeJsonFromPredictResponse, Precision::U8)->Apply(tensorSizes);
+
+static void BM_RestRoutingRegex(benchmark::State& state) {
+    const RegexRestRouter router;
+    for (auto _ : state) {
+        for (const auto& [method, path] : REST_REQUESTS) {
+            std::string modelName;
+            std::optional<int64_t> version;
+            auto status = router.route(method, path, modelName, version);
+            benchmark::DoNotOptimize(status);
+            benchmark::DoNotOptimize(modelName);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * REST_REQUESTS.size());
+}
+BENCHMARK(BM_RestRoutingRegex);
+
+static void BM_RestRouting(benchmark::State& state) {
+    for (auto _ : state) {
+        for (const auto& [method, path] : REST_REQUESTS) {
+            HttpRequestComponents components;
+            auto status = routeRestRequest(method, path, components);
+            benchmark::DoNotOptimize(status);
+            benchmark::DoNotOptimize(components);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * REST_REQUESTS.size());
+}
+BENCHMARK(BM_RestRouting);
+
+template <Precision::ePrecision PRECISION>
+static void BM_DeserializePredictRequest(benchmark::State& state) {
+    const size_t count = state.range(0);
+    PredictRequest request;
+    (*request.mutable_inputs())[INPUT_NAME] = createTensorProto(PRECISION, count);
+    const auto inputs = createTensorMap(INPUT_NAME, PRECISION, count);
+    InferRequest inferRequest(std::make_shared<BlobStoreInferRequest>());
+    for (auto _ : state) {
+        auto status = deserializePredictRequest<ConcreteTensorProtoDeserializator>(request, inputs, inferRequest);
+        if (!status.ok()) {
+            state.SkipWithError(status.string().c_str());
+            break;
+        }
+    }
+    setProcessed(state, PRECISION, count);
+}
+BENCHMARK_TEMPLATE(BM_DeserializePredictRequest, Precision::FP32)->Apply(tensorSizes);
+BENCHMARK_TEMPLATE(BM_DeserializePredictRequest, Precision::FP16)->Apply(tensorSizes);
+BENCHMARK_TEMPLATE(BM_DeserializePredictRequest, Precision::I32)->Apply(tensorSizes);
+BENCHMARK_TEMPLATE(BM_DeserializePredictRequest, Precision::U8)->Apply(tensorSizes);
+
+template <Precision::ePrecision PRECISION>
+static void BM_SerializePredictResponse(benchmark::State& state) {
+    const size_t count = state.range(0);
+    const auto outputs = createTensorMap(OUTPUT_NAME, PRECISION, count);
+    InferRequest inferRequest(std::make_shared<BlobStoreInferRequest>());
+    inferRequest.SetBlob(OUTPUT_NAME, createFilledBlob(PRECISION, count));
+    for (auto _ : state) {
+        PredictResponse response;
+        auto status = serializePredictResponse(inferRequest, outputs, &response);
+        if (!status.ok()) {
+            state.SkipWithError(status.string().c_str());
+            break;
+        }
+        benchmark::DoNotOptimize(response);
+    }
+    setProcessed(state, PRECISION, count);
+}
+BENCHMARK_TEMPLATE(BM_SerializePredictResponse, Precision::FP32)->Apply(tensorSizes);
+BENCHMARK_TEMPLATE(BM_SerializePredictResponse, Precision::FP16)->Apply(tensorSizes);
+BENCHMARK_TEMPLATE(BM_SerializePredictResponse, Precision::I32)->Apply(tensorSizes);
+BENCHMARK_TEMPLATE(BM_SerializePredictResponse, Precision::U8)->Apply(tensorSizes);
+
+template <Precision::ePrecision PRECISION>
+static void BM_BlobClone(benchmark::State& state) {
+    const size_t count = state.range(0);
+    auto source = createFilledBlob(PRECISION, count);
+    for (auto _ : state) {
+        Blob::Ptr destination;
+        auto status = blobClone(destination, source);
+        if (!status.ok()) {
+            state.SkipWithError(status.string().c_str());
+            break;
+        }
+        benchmark::DoNotOptimize(destination);
+    }
+    setProcessed(state, PRECISION, count);
+}
+BENCHMARK_TEMPLATE(BM_BlobClone, Precision::FP32)->Apply(tensorSizes);
+BENCHMARK_TEMPLATE(BM_BlobClone, Precision::U8)->Apply(tensorSizes);
+
+// Queues are shared by threads of a benchmark run, one per number of streams
+static OVInferRequestsQueue& getInferRequestsQueue(int streams) {
+    static std::mutex mutex;
+    static std::map<int, std::unique_ptr<OVInferRequestsQueue>> queues;
+    std::unique_lock<std::mutex> lock(mutex);
+    auto& queue = queues[streams];
+    if (!queue) {
+        static Core engine;
+        static ExecutableNetwork network = engine.LoadNetwork(engine.ReadNetwork(DUMMY_MODEL_PATH), "CPU");
+        queue = std::make_unique<OVInferRequestsQueue>(network, streams);
+    }
+    return *queue;
+}
+
+static void BM_OVInferRequestsQueue(benchmark::State& state) {
+    auto& queue = getInferRequestsQueue(state.range(0));
+    for (auto _ : state) {
+        int streamId = queue.getIdleStream().get();
+        benchmark::DoNotOptimize(queue.getInferRequest(streamId));
+        queue.returnStream(streamId);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_OVInferRequestsQueue)->Arg(1)->Arg(4)->Arg(16)->ThreadRange(1, 32)->UseRealTime();
+
+static void BM_ThreadSafeQueuePushPull(benchmark::State& state) {
+    static ThreadSafeQueue<int> queue;
+    const uint waitMicroseconds = 1'000'000;
+    for (auto _ : state) {
+        queue.push(1);
+        // Each thread pushed before pulling, so there is always an element to take
+        benchmark::DoNotOptimize(queue.tryPull(waitMicroseconds));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ThreadSafeQueuePushPull)->ThreadRange(1, 32)->UseRealTime();
+
+// Pipeline of serially connected nodes, built per request as pipeline factory does
+static void BM_PipelineExecute(benchmark::State& state) {
+    const size_t depth = state.range(0);
+    const size_t count = state.range(1);
+    PredictRequest request;
+    (*request.mutable_inputs())[INPUT_NAME] = createTensorProto(Precision::FP32, count);
+    for (auto _ : state) {
+        PredictResponse response;
+        auto entry = std::make_unique<EntryNode>(&request);
+        auto exit = std::make_unique<ExitNode>(&response);
+        Pipeline pipeline(*entry, *exit);
+        Node* previous = entry.get();
+        for (size_t i = 0; i < depth; i++) {
+            auto node = std::make_unique<PassThroughNode>("node_" + std::to_string(i));
+            pipeline.connect(*previous, *node, {{INPUT_NAME, INPUT_NAME}});
+            previous = node.get();
+            pipeline.push(std::move(node));
+        }
+        pipeline.connect(*previous, *exit, {{INPUT_NAME, OUTPUT_NAME}});
+        pipeline.push(std::move(entry));
+        pipeline.push(std::move(exit));
+        auto status = pipeline.execute();
+        if (!status.ok()) {
+            state.SkipWithError(status.string().c_str());
+            break;
+        }
+        benchmark::DoNotOptimize(response);
+    }
+    setProcessed(state, Precision::FP32, count);
+}
+BENCHMARK(BM_PipelineExecute)->Apply([](benchmark::internal::Benchmark* benchmark) {
+    for (int depth : {1, 4, 16}) {
+        for (int count : {10, 3 * 224 * 224}) {
+            benchmark->Args({depth, count});
+        }
+    }
+});
+
+BENCHMARK_MAIN();
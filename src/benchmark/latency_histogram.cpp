@@ -0,0 +1,91 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "latency_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ovms {
+
+LatencyHistogram::LatencyHistogram() :
+    counts(getBucketIndex(MAX_TRACKABLE_VALUE) + 1, 0) {}
+
+// Values below SUB_BUCKET_COUNT have own buckets. Each next power of two range is split into
+// SUB_BUCKET_HALF_COUNT buckets, so bucket width is at most 1/SUB_BUCKET_HALF_COUNT of its values.
+size_t LatencyHistogram::getBucketIndex(uint64_t value) {
+    if (value < SUB_BUCKET_COUNT) {
+        return static_cast<size_t>(value);
+    }
+    const uint32_t shift = (63 - __builtin_clzll(value)) - (SUB_BUCKET_BITS - 1);
+    return static_cast<size_t>(SUB_BUCKET_COUNT + (shift - 1) * SUB_BUCKET_HALF_COUNT + ((value >> shift) - SUB_BUCKET_HALF_COUNT));
+}
+
+uint64_t LatencyHistogram::getHighestEquivalentValue(size_t index) {
+    if (index < SUB_BUCKET_COUNT) {
+        return index;
+    }
+    const uint64_t shift = (index - SUB_BUCKET_COUNT) / SUB_BUCKET_HALF_COUNT + 1;
+    const uint64_t subBucket = (index - SUB_BUCKET_COUNT) % SUB_BUCKET_HALF_COUNT + SUB_BUCKET_HALF_COUNT;
+    return ((subBucket + 1) << shift) - 1;
+}
+
+void LatencyHistogram::record(uint64_t value) {
+    value = std::min(value, MAX_TRACKABLE_VALUE);
+    counts[getBucketIndex(value)]++;
+    min = count > 0 ? std::min(min, value) : value;
+    max = std::max(max, value);
+    sum += value;
+    count++;
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+    if (other.count == 0) {
+        return;
+    }
+    for (size_t i = 0; i < counts.size(); i++) {
+        counts[i] += other.counts[i];
+    }
+    min = count > 0 ? std::min(min, other.min) : other.min;
+    max = std::max(max, other.max);
+    sum += other.sum;
+    count += other.count;
+}
+
+void LatencyHistogram::reset() {
+    std::fill(counts.begin(), counts.end(), 0);
+    count = 0;
+    sum = 0;
+    min = 0;
+    max = 0;
+}
+
+uint64_t LatencyHistogram::getValueAtPercentile(double percentile) const {
+    if (count == 0) {
+        return 0;
+    }
+    percentile = std::clamp(percentile, 0.0, 100.0);
+    const uint64_t target = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(percentile / 100.0 * count)));
+    uint64_t cumulative = 0;
+    for (size_t i = 0; i < counts.size(); i++) {
+        cumulative += counts[i];
+        if (cumulative >= target) {
+            return std::min(getHighestEquivalentValue(i), max);
+        }
+    }
+    return max;
+}
+
+}  // namespace ovms
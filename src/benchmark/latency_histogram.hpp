@@ -0,0 +1,85 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ovms {
+
+/**
+ * @brief Histogram of latencies with log-linear buckets in the manner of HdrHistogram. Values below 2048 are
+ * counted exactly, larger ones with relative error below 1/1024 (under 0.1%), so percentiles keep 3 significant digits
+ * over the whole range. Recording is a few arithmetic operations, histograms of threads are merged for reports.
+ */
+class LatencyHistogram {
+public:
+    static constexpr uint32_t SUB_BUCKET_BITS = 11;
+    static constexpr uint64_t SUB_BUCKET_COUNT = 1ULL << SUB_BUCKET_BITS;
+    static constexpr uint64_t SUB_BUCKET_HALF_COUNT = SUB_BUCKET_COUNT / 2;
+
+    // Larger values are recorded as this one, about 12 days in microseconds
+    static constexpr uint64_t MAX_TRACKABLE_VALUE = (1ULL << 40) - 1;
+
+    LatencyHistogram();
+
+    void record(uint64_t value);
+
+    void merge(const LatencyHistogram& other);
+
+    void reset();
+
+    uint64_t getCount() const {
+        return count;
+    }
+
+    uint64_t getMin() const {
+        return count > 0 ? min : 0;
+    }
+
+    uint64_t getMax() const {
+        return max;
+    }
+
+    double getMean() const {
+        return count > 0 ? static_cast<double>(sum) / count : 0.0;
+    }
+
+    /**
+     * @brief Value below or equal to which given percent of recorded values fall, reported as the highest
+     * value equivalent to the bucket, but never above the maximum recorded value
+     *
+     * @param percentile from 0 to 100
+     */
+    uint64_t getValueAtPercentile(double percentile) const;
+
+    static size_t getBucketIndex(uint64_t value);
+
+    /**
+     * @brief Highest value counted in the same bucket
+     */
+    static uint64_t getHighestEquivalentValue(size_t index);
+
+private:
+    std::vector<uint64_t> counts;
+    uint64_t count = 0;
+    uint64_t sum = 0;
+    uint64_t min = 0;
+    uint64_t max = 0;
+};
+
+}  // namespace ovms
@@ -0,0 +1,713 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+// Load generator for the TensorFlow Serving API of model server, over gRPC or REST.
+// Inputs are random, generated from model metadata. In closed loop each connection keeps a fixed number of
+// requests in flight, in open loop requests are sent at a constant rate and latency is measured from the time
+// a request was scheduled, so that a slow server does not hide its queueing delay by slowing down the client.
+// Usage: loadgen --model_name resnet --port 9178 --connections 4 --streams 8 --duration 30
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cxxopts.hpp>
+#include <grpcpp/grpcpp.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+#include <sysexits.h>
+
+#include "latency_histogram.hpp"
+#include "loadgen_utils.hpp"
+
+using namespace ovms;
+
+using tensorflow::serving::GetModelMetadataRequest;
+using tensorflow::serving::GetModelMetadataResponse;
+using tensorflow::serving::PredictionService;
+using tensorflow::serving::PredictRequest;
+using tensorflow::serving::PredictResponse;
+
+using steady_clock = std::chrono::steady_clock;
+
+static const std::chrono::seconds REQUEST_TIMEOUT(60);
+static const std::chrono::seconds METADATA_TIMEOUT(10);
+
+struct Settings {
+    std::string protocol;
+    std::string address;
+    uint64_t port;
+    std::string modelName;
+    int64_t modelVersion;
+    uint64_t connections;
+    uint64_t streams;
+    uint64_t threads;
+    double rate;
+    std::chrono::seconds warmup;
+    std::chrono::seconds duration;
+    shapes_map_t shapes;
+    uint64_t requestPool;
+    uint64_t seed;
+    std::chrono::seconds reportInterval;
+    std::string jsonOutput;
+
+    bool isOpenLoop() const {
+        return rate > 0;
+    }
+
+    // gRPC target or host of HTTP requests
+    std::string getTarget() const {
+        if (address.rfind(UNIX_SOCKET_PREFIX, 0) == 0) {
+            return address;
+        }
+        return address + ":" + std::to_string(port);
+    }
+};
+
+/**
+ * @brief Warmup, measurement window and times at which requests are due in open loop
+ */
+class Schedule {
+public:
+    Schedule(const Settings& settings) :
+        rate(settings.rate),
+        start(steady_clock::now()),
+        measureStart(start + settings.warmup),
+        measureEnd(measureStart + settings.duration) {}
+
+    /**
+     * @brief Time at which next request is due, no value after measurement ends
+     */
+    std::optional<steady_clock::time_point> nextOpenLoopSend() {
+        const uint64_t ticket = nextTicket.fetch_add(1, std::memory_order_relaxed);
+        auto due = start + std::chrono::duration_cast<steady_clock::duration>(std::chrono::duration<double>(ticket / rate));
+        if (due >= measureEnd) {
+            return std::nullopt;
+        }
+        return due;
+    }
+
+    bool isMeasured(steady_clock::time_point intended) const {
+        return intended >= measureStart && intended < measureEnd;
+    }
+
+    const double rate;
+    const steady_clock::time_point start;
+    const steady_clock::time_point measureStart;
+    const steady_clock::time_point measureEnd;
+
+private:
+    std::atomic<uint64_t> nextTicket{0};
+};
+
+/**
+ * @brief Results of a single worker, read by reporter
+ */
+class Stats {
+public:
+    void record(const Schedule& schedule, steady_clock::time_point intended, const std::string& error) {
+        auto now = steady_clock::now();
+        if (!schedule.isMeasured(intended)) {
+            return;
+        }
+        const uint64_t latencyUs = std::chrono::duration_cast<std::chrono::microseconds>(now - intended).count();
+        std::unique_lock<std::mutex> lock(mutex);
+        if (!error.empty()) {
+            errors[error]++;
+            intervalErrors++;
+            return;
+        }
+        total.record(latencyUs);
+        interval.record(latencyUs);
+    }
+
+    // Moves interval results to given histogram
+    uint64_t takeInterval(LatencyHistogram& histogram) {
+        std::unique_lock<std::mutex> lock(mutex);
+        histogram.merge(interval);
+        interval.reset();
+        uint64_t intervalErrorsCount = intervalErrors;
+        intervalErrors = 0;
+        return intervalErrorsCount;
+    }
+
+    void addTotal(LatencyHistogram& histogram, std::map<std::string, uint64_t>& allErrors) {
+        std::unique_lock<std::mutex> lock(mutex);
+        histogram.merge(total);
+        for (const auto& [name, count] : errors) {
+            allErrors[name] += count;
+        }
+    }
+
+private:
+    std::mutex mutex;
+    LatencyHistogram total;
+    LatencyHistogram interval;
+    std::map<std::string, uint64_t> errors;
+    uint64_t intervalErrors = 0;
+};
+
+static std::string getModelPath(const Settings& settings) {
+    std::string path = "/v1/models/" + settings.modelName;
+    if (settings.modelVersion > 0) {
+        path += "/versions/" + std::to_string(settings.modelVersion);
+    }
+    return path;
+}
+
+static std::string createHttpRequest(const Settings& settings, const std::string& method, const std::string& path, const std::string& body) {
+    std::string request = method + " " + path + " HTTP/1.1\r\nHost: " + settings.getTarget() + "\r\n";
+    if (!body.empty()) {
+        request += "Content-Type: application/json\r\nContent-Length: " + std::to_string(body.size()) + "\r\n";
+    }
+    return request + "\r\n" + body;
+}
+
+static bool getInputs(const Settings& settings, std::vector<LoadgenInput>& inputs, std::string& error) {
+    if (settings.protocol == "rest") {
+        HttpConnection connection(settings.address, settings.port);
+        HttpResponse response;
+        if (!connection.roundTrip(createHttpRequest(settings, "GET", getModelPath(settings) + "/metadata", ""), response, error)) {
+            return false;
+        }
+        if (response.statusCode != 200) {
+            error = "model metadata request failed with HTTP " + std::to_string(response.statusCode) + ": " + response.body;
+            return false;
+        }
+        return parseModelMetadataJson(response.body, settings.shapes, inputs, error);
+    }
+    auto stub = PredictionService::NewStub(grpc::CreateChannel(settings.getTarget(), grpc::InsecureChannelCredentials()));
+    GetModelMetadataRequest request;
+    request.mutable_model_spec()->set_name(settings.modelName);
+    if (settings.modelVersion > 0) {
+        request.mutable_model_spec()->mutable_version()->set_value(settings.modelVersion);
+    }
+    request.add_metadata_field("signature_def");
+    GetModelMetadataResponse response;
+    grpc::ClientContext context;
+    context.set_deadline(std::chrono::system_clock::now() + METADATA_TIMEOUT);
+    auto status = stub->GetModelMetadata(&context, request, &response);
+    if (!status.ok()) {
+        error = "model metadata request failed with " + getGrpcErrorName(status.error_code()) + ": " + status.error_message();
+        return false;
+    }
+    return parseModelMetadata(response, settings.shapes, inputs, error);
+}
+
+/**
+ * @brief Load of asynchronous gRPC calls. Connections are assigned to completion queue threads round robin,
+ * a completed call is followed by the next one on the same connection in closed loop.
+ */
+class GrpcLoad {
+public:
+    GrpcLoad(const Settings& settings, Schedule& schedule, const std::vector<PredictRequest>& requests) :
+        settings(settings),
+        schedule(schedule),
+        requests(requests),
+        outstanding(settings.connections),
+        stats(settings.threads) {
+        for (uint64_t i = 0; i < settings.threads; i++) {
+            queues.push_back(std::make_unique<grpc::CompletionQueue>());
+        }
+        for (uint64_t i = 0; i < settings.connections; i++) {
+            grpc::ChannelArguments arguments;
+            // Without local pool channels with the same arguments share one connection
+            arguments.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+            arguments.SetMaxReceiveMessageSize(-1);
+            arguments.SetMaxSendMessageSize(-1);
+            stubs.push_back(PredictionService::NewStub(grpc::CreateCustomChannel(settings.getTarget(), grpc::InsecureChannelCredentials(), arguments)));
+        }
+    }
+
+    std::vector<Stats>& getStats() {
+        return stats;
+    }
+
+    void start() {
+        for (uint64_t i = 0; i < settings.threads; i++) {
+            workers.emplace_back([this, i]() { processCompletions(i); });
+        }
+        if (settings.isOpenLoop()) {
+            issuer = std::thread([this]() { issueOpenLoop(); });
+            return;
+        }
+        auto now = steady_clock::now();
+        for (uint64_t connection = 0; connection < settings.connections; connection++) {
+            for (uint64_t stream = 0; stream < settings.streams; stream++) {
+                outstanding[connection]++;
+                inFlight++;
+                issue(connection, now);
+            }
+        }
+    }
+
+    // Called after measurement ends, waits for calls in flight
+    void stop() {
+        if (issuer.joinable()) {
+            issuer.join();
+        }
+        while (inFlight.load() > 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        for (auto& queue : queues) {
+            queue->Shutdown();
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+private:
+    struct Call {
+        grpc::ClientContext context;
+        PredictResponse response;
+        grpc::Status status;
+        std::unique_ptr<grpc::ClientAsyncResponseReader<PredictResponse>> reader;
+        steady_clock::time_point intended;
+        uint64_t connection;
+    };
+
+    void issue(uint64_t connection, steady_clock::time_point intended) {
+        auto call = new Call();
+        call->intended = intended;
+        call->connection = connection;
+        call->context.set_deadline(std::chrono::system_clock::now() + REQUEST_TIMEOUT);
+        const auto& request = requests[nextRequest.fetch_add(1, std::memory_order_relaxed) % requests.size()];
+        call->reader = stubs[connection]->AsyncPredict(&call->context, request, queues[connection % queues.size()].get());
+        call->reader->Finish(&call->response, &call->status, call);
+    }
+
+    void processCompletions(uint64_t index) {
+        void* tag;
+        bool ok;
+        while (queues[index]->Next(&tag, &ok)) {
+            std::unique_ptr<Call> call(static_cast<Call*>(tag));
+            const bool succeeded = ok && call->status.ok();
+            stats[index].record(schedule, call->intended, succeeded ? "" : getGrpcErrorName(call->status.error_code()));
+            auto now = steady_clock::now();
+            if (!settings.isOpenLoop() && now < schedule.measureEnd) {
+                issue(call->connection, now);
+                continue;
+            }
+            outstanding[call->connection]--;
+            inFlight--;
+        }
+    }
+
+    // Requests over the limit of streams wait for a free one, their latency still counts from the scheduled time
+    void issueOpenLoop() {
+        uint64_t connection = 0;
+        while (auto intended = schedule.nextOpenLoopSend()) {
+            std::this_thread::sleep_until(intended.value());
+            while (true) {
+                bool found = false;
+                for (uint64_t i = 0; i < settings.connections; i++) {
+                    connection = (connection + 1) % settings.connections;
+                    if (outstanding[connection].load() < settings.streams) {
+                        found = true;
+                        break;
+                    }
+                }
+                if (found) {
+                    break;
+                }
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
+            outstanding[connection]++;
+            inFlight++;
+            issue(connection, intended.value());
+        }
+    }
+
+    const Settings& settings;
+    Schedule& schedule;
+    const std::vector<PredictRequest>& requests;
+    std::vector<std::unique_ptr<PredictionService::Stub>> stubs;
+    std::vector<std::unique_ptr<grpc::CompletionQueue>> queues;
+    std::vector<std::atomic<uint64_t>> outstanding;
+    std::atomic<uint64_t> inFlight{0};
+    std::atomic<uint64_t> nextRequest{0};
+    std::vector<Stats> stats;
+    std::vector<std::thread> workers;
+    std::thread issuer;
+};
+
+/**
+ * @brief Load of blocking REST requests, one thread per connection. HTTP/1.1 has no multiplexing,
+ * so concurrency is the number of connections.
+ */
+class RestLoad {
+public:
+    RestLoad(const Settings& settings, Schedule& schedule, const std::vector<std::string>& requests) :
+        settings(settings),
+        schedule(schedule),
+        requests(requests),
+        stats(settings.connections) {}
+
+    std::vector<Stats>& getStats() {
+        return stats;
+    }
+
+    void start() {
+        for (uint64_t i = 0; i < settings.connections; i++) {
+            workers.emplace_back([this, i]() { run(i); });
+        }
+    }
+
+    void stop() {
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+private:
+    void run(uint64_t index) {
+        HttpConnection connection(settings.address, settings.port);
+        HttpResponse response;
+        std::string error;
+        uint64_t requestIndex = index;
+        while (true) {
+            steady_clock::time_point intended;
+            if (settings.isOpenLoop()) {
+                auto due = schedule.nextOpenLoopSend();
+                if (!due) {
+                    break;
+                }
+                std::this_thread::sleep_until(due.value());
+                intended = due.value();
+            } else {
+                intended = steady_clock::now();
+                if (intended >= schedule.measureEnd) {
+                    break;
+                }
+            }
+            const bool connected = connection.roundTrip(requests[requestIndex++ % requests.size()], response, error);
+            if (!connected) {
+                stats[index].record(schedule, intended, "connection_error");
+                // Do not spin while server is not reachable
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                continue;
+            }
+            stats[index].record(schedule, intended, response.statusCode == 200 ? "" : "http_" + std::to_string(response.statusCode));
+        }
+    }
+
+    const Settings& settings;
+    Schedule& schedule;
+    const std::vector<std::string>& requests;
+    std::vector<Stats> stats;
+    std::vector<std::thread> workers;
+};
+
+static double toMs(uint64_t us) {
+    return us / 1000.0;
+}
+
+static void printLatency(const LatencyHistogram& histogram) {
+    std::cout << std::fixed << std::setprecision(3)
+              << "Latency [ms]: min " << toMs(histogram.getMin())
+              << ", mean " << histogram.getMean() / 1000.0
+              << ", p50 " << toMs(histogram.getValueAtPercentile(50))
+              << ", p90 " << toMs(histogram.getValueAtPercentile(90))
+              << ", p99 " << toMs(histogram.getValueAtPercentile(99))
+              << ", p99.9 " << toMs(histogram.getValueAtPercentile(99.9))
+              << ", max " << toMs(histogram.getMax()) << std::endl;
+}
+
+static bool writeJson(const Settings& settings, const LatencyHistogram& histogram, const std::map<std::string, uint64_t>& errors, uint64_t errorsCount) {
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    const double seconds = settings.duration.count();
+    writer.StartObject();
+    writer.Key("protocol");
+    writer.String(settings.protocol.c_str());
+    writer.Key("model_name");
+    writer.String(settings.modelName.c_str());
+    writer.Key("mode");
+    writer.String(settings.isOpenLoop() ? "open_loop" : "closed_loop");
+    writer.Key("rate");
+    writer.Double(settings.rate);
+    writer.Key("connections");
+    writer.Uint64(settings.connections);
+    writer.Key("streams");
+    writer.Uint64(settings.streams);
+    writer.Key("duration_s");
+    writer.Double(seconds);
+    writer.Key("requests");
+    writer.Uint64(histogram.getCount());
+    writer.Key("errors");
+    writer.Uint64(errorsCount);
+    writer.Key("throughput_rps");
+    writer.Double(histogram.getCount() / seconds);
+    writer.Key("latency_us");
+    writer.StartObject();
+    writer.Key("min");
+    writer.Uint64(histogram.getMin());
+    writer.Key("mean");
+    writer.Double(histogram.getMean());
+    for (auto [name, percentile] : std::vector<std::pair<const char*, double>>{{"p50", 50}, {"p90", 90}, {"p99", 99}, {"p99.9", 99.9}}) {
+        writer.Key(name);
+        writer.Uint64(histogram.getValueAtPercentile(percentile));
+    }
+    writer.Key("max");
+    writer.Uint64(histogram.getMax());
+    writer.EndObject();
+    writer.Key("errors_by_status");
+    writer.StartObject();
+    for (const auto& [name, count] : errors) {
+        writer.Key(name.c_str());
+        writer.Uint64(count);
+    }
+    writer.EndObject();
+    writer.EndObject();
+    std::ofstream file(settings.jsonOutput);
+    file << buffer.GetString() << std::endl;
+    return file.good();
+}
+
+static Settings parseSettings(int argc, char** argv) {
+    Settings settings;
+    try {
+        cxxopts::Options options(argv[0], "Load generator for OpenVINO Model Server");
+
+        // clang-format off
+        options.add_options()
+            ("h, help",
+                "show this help message and exit")
+            ("protocol",
+                "API to use: grpc or rest",
+                cxxopts::value<std::string>()->default_value("grpc"),
+                "PROTOCOL")
+            ("address",
+                "server address, unix:PATH for unix domain socket",
+                cxxopts::value<std::string>()->default_value("localhost"),
+                "ADDRESS")
+            ("port",
+                "server port of selected API",
+                cxxopts::value<uint64_t>()->default_value("9178"),
+                "PORT")
+            ("model_name",
+                "name of the model or pipeline",
+                cxxopts::value<std::string>(),
+                "MODEL_NAME")
+            ("model_version",
+                "version of the model, 0 for default version",
+                cxxopts::value<int64_t>()->default_value("0"),
+                "MODEL_VERSION")
+            ("connections",
+                "number of connections",
+                cxxopts::value<uint64_t>()->default_value("1"),
+                "CONNECTIONS")
+            ("streams",
+                "requests in flight per gRPC connection, in open loop the limit of them",
+                cxxopts::value<uint64_t>()->default_value("1"),
+                "STREAMS")
+            ("threads",
+                "gRPC completion queue threads, 0 for one per connection up to number of cores",
+                cxxopts::value<uint64_t>()->default_value("0"),
+                "THREADS")
+            ("rate",
+                "requests per second sent in open loop, 0 for closed loop",
+                cxxopts::value<double>()->default_value("0"),
+                "RATE")
+            ("warmup",
+                "seconds of load before measurement",
+                cxxopts::value<uint64_t>()->default_value("2"),
+                "WARMUP")
+            ("duration",
+                "seconds of measurement",
+                cxxopts::value<uint64_t>()->default_value("10"),
+                "DURATION")
+            ("shape",
+                "shapes of inputs overriding metadata, e.g. input1:1,3,224,224;input2:1,10",
+                cxxopts::value<std::string>()->default_value(""),
+                "SHAPE")
+            ("request_pool",
+                "number of distinct random requests sent in turn",
+                cxxopts::value<uint64_t>()->default_value("16"),
+                "REQUEST_POOL")
+            ("seed",
+                "seed of random inputs",
+                cxxopts::value<uint64_t>()->default_value("0"),
+                "SEED")
+            ("report_interval",
+                "seconds between intermediate reports, 0 disables them",
+                cxxopts::value<uint64_t>()->default_value("1"),
+                "REPORT_INTERVAL")
+            ("json_output",
+                "path of file to write results to in json",
+                cxxopts::value<std::string>()->default_value(""),
+                "JSON_OUTPUT");
+        // clang-format on
+
+        auto result = options.parse(argc, argv);
+        if (result.count("help") || !result.count("model_name")) {
+            std::cout << options.help() << std::endl;
+            exit(result.count("help") ? EX_OK : EX_USAGE);
+        }
+        settings.protocol = result["protocol"].as<std::string>();
+        settings.address = result["address"].as<std::string>();
+        settings.port = result["port"].as<uint64_t>();
+        settings.modelName = result["model_name"].as<std::string>();
+        settings.modelVersion = result["model_version"].as<int64_t>();
+        settings.connections = result["connections"].as<uint64_t>();
+        settings.streams = result["streams"].as<uint64_t>();
+        settings.threads = result["threads"].as<uint64_t>();
+        settings.rate = result["rate"].as<double>();
+        settings.warmup = std::chrono::seconds(result["warmup"].as<uint64_t>());
+        settings.duration = std::chrono::seconds(result["duration"].as<uint64_t>());
+        settings.requestPool = result["request_pool"].as<uint64_t>();
+        settings.seed = result["seed"].as<uint64_t>();
+        settings.reportInterval = std::chrono::seconds(result["report_interval"].as<uint64_t>());
+        settings.jsonOutput = result["json_output"].as<std::string>();
+        std::string error;
+        if (!parseShapes(result["shape"].as<std::string>(), settings.shapes, error)) {
+            std::cerr << error << std::endl;
+            exit(EX_USAGE);
+        }
+    } catch (const cxxopts::OptionException& e) {
+        std::cerr << "error parsing options: " << e.what() << std::endl;
+        exit(EX_USAGE);
+    }
+    if (settings.protocol != "grpc" && settings.protocol != "rest") {
+        std::cerr << "protocol should be grpc or rest" << std::endl;
+        exit(EX_USAGE);
+    }
+    if (settings.connections == 0 || settings.streams == 0 || settings.requestPool == 0 || settings.duration.count() == 0 || settings.rate < 0) {
+        std::cerr << "connections, streams, request_pool and duration should be positive, rate should not be negative" << std::endl;
+        exit(EX_USAGE);
+    }
+    if (settings.threads == 0) {
+        settings.threads = std::min<uint64_t>(settings.connections, std::max(1u, std::thread::hardware_concurrency()));
+    }
+    settings.threads = std::min(settings.threads, settings.connections);
+    return settings;
+}
+
+int main(int argc, char** argv) {
+    Settings settings = parseSettings(argc, argv);
+
+    std::vector<LoadgenInput> inputs;
+    std::string error;
+    if (!getInputs(settings, inputs, error)) {
+        std::cerr << error << std::endl;
+        return EX_UNAVAILABLE;
+    }
+    for (const auto& input : inputs) {
+        std::cout << "Input " << input.name << " " << tensorflow::DataType_Name(input.dtype) << " [";
+        for (size_t i = 0; i < input.shape.size(); i++) {
+            std::cout << (i > 0 ? "," : "") << input.shape[i];
+        }
+        std::cout << "]" << std::endl;
+    }
+
+    std::mt19937_64 generator(settings.seed);
+    std::vector<PredictRequest> requests(settings.requestPool);
+    std::vector<std::string> httpRequests;
+    for (auto& request : requests) {
+        request.mutable_model_spec()->set_name(settings.modelName);
+        if (settings.modelVersion > 0) {
+            request.mutable_model_spec()->mutable_version()->set_value(settings.modelVersion);
+        }
+        if (!fillRandomInputs(inputs, generator, request, error)) {
+            std::cerr << error << std::endl;
+            return EX_DATAERR;
+        }
+        if (settings.protocol == "rest") {
+            std::string body;
+            if (!createRestBody(request, body, error)) {
+                std::cerr << error << std::endl;
+                return EX_DATAERR;
+            }
+            httpRequests.push_back(createHttpRequest(settings, "POST", getModelPath(settings) + ":predict", body));
+        }
+    }
+
+    std::cout << "Running " << (settings.isOpenLoop() ? "open loop at " + std::to_string(settings.rate) + " requests/s" : std::string("closed loop"))
+              << " over " << settings.protocol << " for " << settings.warmup.count() << "s warmup and " << settings.duration.count() << "s measurement" << std::endl;
+
+    Schedule schedule(settings);
+    std::unique_ptr<GrpcLoad> grpcLoad;
+    std::unique_ptr<RestLoad> restLoad;
+    std::vector<Stats>* stats;
+    if (settings.protocol == "rest") {
+        restLoad = std::make_unique<RestLoad>(settings, schedule, httpRequests);
+        stats = &restLoad->getStats();
+        restLoad->start();
+    } else {
+        grpcLoad = std::make_unique<GrpcLoad>(settings, schedule, requests);
+        stats = &grpcLoad->getStats();
+        grpcLoad->start();
+    }
+
+    std::this_thread::sleep_until(schedule.measureStart);
+    auto reportTime = schedule.measureStart;
+    while (settings.reportInterval.count() > 0) {
+        auto nextReport = std::min(reportTime + settings.reportInterval, schedule.measureEnd);
+        std::this_thread::sleep_until(nextReport);
+        LatencyHistogram interval;
+        uint64_t intervalErrors = 0;
+        for (auto& workerStats : *stats) {
+            intervalErrors += workerStats.takeInterval(interval);
+        }
+        const double seconds = std::chrono::duration<double>(nextReport - reportTime).count();
+        std::cout << std::fixed << std::setprecision(1)
+                  << "[" << std::setw(6) << std::chrono::duration<double>(nextReport - schedule.measureStart).count() << "s] "
+                  << interval.getCount() / seconds << " req/s, p50 " << std::setprecision(3) << toMs(interval.getValueAtPercentile(50))
+                  << " ms, p99 " << toMs(interval.getValueAtPercentile(99)) << " ms, errors " << intervalErrors << std::endl;
+        reportTime = nextReport;
+        if (reportTime >= schedule.measureEnd) {
+            break;
+        }
+    }
+    std::this_thread::sleep_until(schedule.measureEnd);
+
+    if (grpcLoad) {
+        grpcLoad->stop();
+    } else {
+        restLoad->stop();
+    }
+
+    LatencyHistogram total;
+    std::map<std::string, uint64_t> errors;
+    for (auto& workerStats : *stats) {
+        workerStats.addTotal(total, errors);
+    }
+    uint64_t errorsCount = 0;
+    for (const auto& [name, count] : errors) {
+        errorsCount += count;
+    }
+    std::cout << "Requests: " << total.getCount() << ", errors: " << errorsCount << ", throughput: " << std::fixed << std::setprecision(1)
+              << total.getCount() / static_cast<double>(settings.duration.count()) << " req/s" << std::endl;
+    printLatency(total);
+    for (const auto& [name, count] : errors) {
+        std::cout << "Errors " << name << ": " << count << std::endl;
+    }
+    if (!settings.jsonOutput.empty() && !writeJson(settings, total, errors, errorsCount)) {
+        std::cerr << "Failed to write results to " << settings.jsonOutput << std::endl;
+        return EX_CANTCREAT;
+    }
+    return errorsCount > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
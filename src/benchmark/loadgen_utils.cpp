@@ -0,0 +1,585 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "loadgen_utils.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <sstream>
+
+#include <google/protobuf/util/json_util.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+using tensorflow::DataType;
+using tensorflow::serving::GetModelMetadataResponse;
+using tensorflow::serving::PredictRequest;
+
+namespace ovms {
+
+static const char* SIGNATURE_DEF_KEY = "signature_def";
+static const char* DEFAULT_SIGNATURE = "serving_default";
+
+// Responses without length are not expected from model server
+static const size_t MAX_HTTP_HEADER_SIZE = 64 * 1024;
+
+static std::string trim(const std::string& text) {
+    auto begin = text.find_first_not_of(" \t");
+    if (begin == std::string::npos) {
+        return "";
+    }
+    auto end = text.find_last_not_of(" \t");
+    return text.substr(begin, end - begin + 1);
+}
+
+static std::string toLower(std::string text) {
+    std::transform(text.begin(), text.end(), text.begin(), [](unsigned char c) { return std::tolower(c); });
+    return text;
+}
+
+bool parseShapes(const std::string& text, shapes_map_t& shapes, std::string& error) {
+    std::stringstream inputs(text);
+    std::string entry;
+    while (std::getline(inputs, entry, ';')) {
+        entry = trim(entry);
+        if (entry.empty()) {
+            continue;
+        }
+        auto separator = entry.rfind(':');
+        if (separator == std::string::npos || separator == 0) {
+            error = "Shape should be given as name:d1,d2,..., got: " + entry;
+            return false;
+        }
+        std::vector<int64_t> shape;
+        std::stringstream dims(entry.substr(separator + 1));
+        std::string dim;
+        while (std::getline(dims, dim, ',')) {
+            dim = trim(dim);
+            if (dim.empty() || !std::all_of(dim.begin(), dim.end(), [](unsigned char c) { return std::isdigit(c); })) {
+                error = "Invalid dimension in shape: " + entry;
+                return false;
+            }
+            shape.push_back(std::stoll(dim));
+        }
+        if (shape.empty()) {
+            error = "Empty shape: " + entry;
+            return false;
+        }
+        shapes[trim(entry.substr(0, separator))] = shape;
+    }
+    return true;
+}
+
+static size_t getElementsCount(const tensorflow::TensorProto& proto) {
+    size_t count = 1;
+    for (const auto& dim : proto.tensor_shape().dim()) {
+        count *= dim.size();
+    }
+    return count;
+}
+
+bool parseModelMetadata(const GetModelMetadataResponse& response, const shapes_map_t& shapes,
+    std::vector<LoadgenInput>& inputs, std::string& error) {
+    auto it = response.metadata().find(SIGNATURE_DEF_KEY);
+    if (it == response.metadata().end()) {
+        error = "Model metadata has no signature_def";
+        return false;
+    }
+    tensorflow::serving::SignatureDefMap signatures;
+    if (!it->second.UnpackTo(&signatures)) {
+        error = "Model metadata signature_def could not be unpacked";
+        return false;
+    }
+    auto signature = signatures.signature_def().find(DEFAULT_SIGNATURE);
+    if (signature == signatures.signature_def().end()) {
+        error = "Model metadata has no serving_default signature";
+        return false;
+    }
+    inputs.clear();
+    for (const auto& [name, info] : signature->second.inputs()) {
+        LoadgenInput input;
+        input.name = name;
+        input.dtype = info.dtype();
+        auto shape = shapes.find(name);
+        if (shape != shapes.end()) {
+            input.shape = shape->second;
+        } else {
+            for (const auto& dim : info.tensor_shape().dim()) {
+                input.shape.push_back(dim.size() < 0 ? 1 : dim.size());
+            }
+        }
+        inputs.push_back(std::move(input));
+    }
+    // Order of map is not specified, keep requests reproducible for a given seed
+    std::sort(inputs.begin(), inputs.end(), [](const auto& lhs, const auto& rhs) { return lhs.name < rhs.name; });
+    for (const auto& [name, shape] : shapes) {
+        if (std::none_of(inputs.begin(), inputs.end(), [&name = name](const auto& input) { return input.name == name; })) {
+            error = "Shape given for input not present in model: " + name;
+            return false;
+        }
+    }
+    if (inputs.empty()) {
+        error = "Model has no inputs";
+        return false;
+    }
+    return true;
+}
+
+bool parseModelMetadataJson(const std::string& json, const shapes_map_t& shapes,
+    std::vector<LoadgenInput>& inputs, std::string& error) {
+    GetModelMetadataResponse response;
+    google::protobuf::util::JsonParseOptions options;
+    options.ignore_unknown_fields = true;
+    auto status = google::protobuf::util::JsonStringToMessage(json, &response, options);
+    if (!status.ok()) {
+        error = "Invalid model metadata: " + status.ToString();
+        return false;
+    }
+    return parseModelMetadata(response, shapes, inputs, error);
+}
+
+template <typename T>
+static void fillContent(tensorflow::TensorProto& proto, size_t count, const std::function<T()>& next) {
+    auto* content = proto.mutable_tensor_content();
+    content->resize(count * sizeof(T));
+    char* data = content->data();
+    for (size_t i = 0; i < count; i++) {
+        T value = next();
+        std::memcpy(data + i * sizeof(T), &value, sizeof(T));
+    }
+}
+
+// Value k / 1024 for k in range [0, 1024) is exact in half precision
+static uint16_t halfFromFraction(uint32_t k) {
+    if (k == 0) {
+        return 0;
+    }
+    int msb = 31 - __builtin_clz(k);
+    uint32_t exponent = msb + 5;
+    uint32_t mantissa = (k << (10 - msb)) & 0x3FF;
+    return static_cast<uint16_t>((exponent << 10) | mantissa);
+}
+
+static float halfToFloat(uint16_t half) {
+    int exponent = (half >> 10) & 0x1F;
+    float mantissa = half & 0x3FF;
+    float value = exponent == 0 ? std::ldexp(mantissa, -24) : std::ldexp(1.0f + mantissa / 1024.0f, exponent - 15);
+    return (half & 0x8000) ? -value : value;
+}
+
+bool fillRandomInputs(const std::vector<LoadgenInput>& inputs, std::mt19937_64& generator,
+    PredictRequest& request, std::string& error) {
+    std::uniform_real_distribution<double> real(0.0, 1.0);
+    std::uniform_int_distribution<int> integer(0, 99);
+    std::uniform_int_distribution<uint32_t> fraction(0, 1023);
+    auto nextInt = [&]() { return integer(generator); };
+    for (const auto& input : inputs) {
+        auto& proto = (*request.mutable_inputs())[input.name];
+        proto.Clear();
+        proto.set_dtype(input.dtype);
+        for (auto dim : input.shape) {
+            proto.mutable_tensor_shape()->add_dim()->set_size(dim);
+        }
+        const size_t count = getElementsCount(proto);
+        switch (input.dtype) {
+        case DataType::DT_FLOAT:
+            fillContent<float>(proto, count, [&]() { return static_cast<float>(real(generator)); });
+            break;
+        case DataType::DT_DOUBLE:
+            fillContent<double>(proto, count, [&]() { return real(generator); });
+            break;
+        case DataType::DT_INT8:
+            fillContent<int8_t>(proto, count, nextInt);
+            break;
+        case DataType::DT_UINT8:
+            fillContent<uint8_t>(proto, count, nextInt);
+            break;
+        case DataType::DT_INT16:
+            fillContent<int16_t>(proto, count, nextInt);
+            break;
+        case DataType::DT_INT32:
+            fillContent<int32_t>(proto, count, nextInt);
+            break;
+        case DataType::DT_INT64:
+            fillContent<int64_t>(proto, count, nextInt);
+            break;
+        case DataType::DT_UINT32:
+            fillContent<uint32_t>(proto, count, nextInt);
+            break;
+        case DataType::DT_UINT64:
+            fillContent<uint64_t>(proto, count, nextInt);
+            break;
+        // Model server reads these precisions from typed fields only
+        case DataType::DT_HALF:
+            proto.mutable_half_val()->Reserve(count);
+            for (size_t i = 0; i < count; i++) {
+                proto.add_half_val(halfFromFraction(fraction(generator)));
+            }
+            break;
+        case DataType::DT_UINT16:
+            proto.mutable_int_val()->Reserve(count);
+            for (size_t i = 0; i < count; i++) {
+                proto.add_int_val(nextInt());
+            }
+            break;
+        default:
+            error = "Input " + input.name + " has unsupported precision: " + DataType_Name(input.dtype);
+            return false;
+        }
+    }
+    return true;
+}
+
+using value_writer_t = std::function<void(rapidjson::Writer<rapidjson::StringBuffer>&, size_t)>;
+
+template <typename T>
+static value_writer_t contentReader(const tensorflow::TensorProto& proto, const std::function<void(rapidjson::Writer<rapidjson::StringBuffer>&, T)>& write) {
+    const char* data = proto.tensor_content().data();
+    return [data, write](rapidjson::Writer<rapidjson::StringBuffer>& writer, size_t index) {
+        T value;
+        std::memcpy(&value, data + index * sizeof(T), sizeof(T));
+        write(writer, value);
+    };
+}
+
+static void writeNested(rapidjson::Writer<rapidjson::StringBuffer>& writer, const tensorflow::TensorShapeProto& shape,
+    int dim, size_t offset, size_t stride, const value_writer_t& writeValue) {
+    writer.StartArray();
+    const size_t size = shape.dim(dim).size();
+    const size_t innerStride = stride / std::max<size_t>(size, 1);
+    for (size_t i = 0; i < size; i++) {
+        if (dim + 1 == shape.dim_size()) {
+            writeValue(writer, offset + i);
+        } else {
+            writeNested(writer, shape, dim + 1, offset + i * innerStride, innerStride, writeValue);
+        }
+    }
+    writer.EndArray();
+}
+
+bool createRestBody(const PredictRequest& request, std::string& body, std::string& error) {
+    using writer_t = rapidjson::Writer<rapidjson::StringBuffer>;
+    auto asDouble = [](writer_t& writer, double value) { writer.Double(value); };
+    auto asInt = [](writer_t& writer, int64_t value) { writer.Int64(value); };
+    auto asUint = [](writer_t& writer, uint64_t value) { writer.Uint64(value); };
+
+    std::vector<std::string> names;
+    for (const auto& [name, proto] : request.inputs()) {
+        names.push_back(name);
+    }
+    std::sort(names.begin(), names.end());
+
+    rapidjson::StringBuffer buffer;
+    writer_t writer(buffer);
+    writer.StartObject();
+    writer.Key("inputs");
+    writer.StartObject();
+    for (const auto& name : names) {
+        const auto& proto = request.inputs().at(name);
+        const size_t count = getElementsCount(proto);
+        value_writer_t writeValue;
+        size_t available = 0;
+        switch (proto.dtype()) {
+        case DataType::DT_FLOAT:
+            writeValue = contentReader<float>(proto, asDouble);
+            available = proto.tensor_content().size() / sizeof(float);
+            break;
+        case DataType::DT_DOUBLE:
+            writeValue = contentReader<double>(proto, asDouble);
+            available = proto.tensor_content().size() / sizeof(double);
+            break;
+        case DataType::DT_INT8:
+            writeValue = contentReader<int8_t>(proto, asInt);
+            available = proto.tensor_content().size();
+            break;
+        case DataType::DT_UINT8:
+            writeValue = contentReader<uint8_t>(proto, asUint);
+            available = proto.tensor_content().size();
+            break;
+        case DataType::DT_INT16:
+            writeValue = contentReader<int16_t>(proto, asInt);
+            available = proto.tensor_content().size() / sizeof(int16_t);
+            break;
+        case DataType::DT_INT32:
+            writeValue = contentReader<int32_t>(proto, asInt);
+            available = proto.tensor_content().size() / sizeof(int32_t);
+            break;
+        case DataType::DT_INT64:
+            writeValue = contentReader<int64_t>(proto, asInt);
+            available = proto.tensor_content().size() / sizeof(int64_t);
+            break;
+        case DataType::DT_UINT32:
+            writeValue = contentReader<uint32_t>(proto, asUint);
+            available = proto.tensor_content().size() / sizeof(uint32_t);
+            break;
+        case DataType::DT_UINT64:
+            writeValue = contentReader<uint64_t>(proto, asUint);
+            available = proto.tensor_content().size() / sizeof(uint64_t);
+            break;
+        case DataType::DT_HALF:
+            writeValue = [&proto](writer_t& writer, size_t index) { writer.Double(halfToFloat(proto.half_val(index))); };
+            available = proto.half_val_size();
+            break;
+        case DataType::DT_UINT16:
+            writeValue = [&proto](writer_t& writer, size_t index) { writer.Uint(proto.int_val(index)); };
+            available = proto.int_val_size();
+            break;
+        default:
+            error = "Input " + name + " has unsupported precision: " + DataType_Name(proto.dtype());
+            return false;
+        }
+        if (available != count || proto.tensor_shape().dim_size() == 0) {
+            error = "Input " + name + " content does not match its shape";
+            return false;
+        }
+        writer.Key(name.c_str());
+        writeNested(writer, proto.tensor_shape(), 0, 0, count, writeValue);
+    }
+    writer.EndObject();
+    writer.EndObject();
+    body.assign(buffer.GetString(), buffer.GetSize());
+    return true;
+}
+
+HttpParseResult parseHttpResponse(std::string& buffer, HttpResponse& response) {
+    const size_t headerEnd = buffer.find("\r\n\r\n");
+    if (headerEnd == std::string::npos) {
+        return buffer.size() > MAX_HTTP_HEADER_SIZE ? HttpParseResult::INVALID : HttpParseResult::INCOMPLETE;
+    }
+    std::stringstream headers(buffer.substr(0, headerEnd));
+    std::string line;
+    std::getline(headers, line);
+    if (line.rfind("HTTP/1.", 0) != 0 || line.size() < 12) {
+        return HttpParseResult::INVALID;
+    }
+    response.keepAlive = line.compare(0, 8, "HTTP/1.1") == 0;
+    response.statusCode = std::atoi(line.c_str() + 9);
+    if (response.statusCode < 100) {
+        return HttpParseResult::INVALID;
+    }
+    bool chunked = false;
+    bool hasLength = false;
+    size_t contentLength = 0;
+    while (std::getline(headers, line)) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        auto separator = line.find(':');
+        if (separator == std::string::npos) {
+            continue;
+        }
+        auto name = toLower(trim(line.substr(0, separator)));
+        auto value = toLower(trim(line.substr(separator + 1)));
+        if (name == "content-length") {
+            hasLength = true;
+            contentLength = std::strtoull(value.c_str(), nullptr, 10);
+        } else if (name == "transfer-encoding") {
+            chunked = value.find("chunked") != std::string::npos;
+        } else if (name == "connection") {
+            if (value == "close") {
+                response.keepAlive = false;
+            } else if (value == "keep-alive") {
+                response.keepAlive = true;
+            }
+        }
+    }
+
+    size_t position = headerEnd + 4;
+    response.body.clear();
+    if (chunked) {
+        while (true) {
+            const size_t lineEnd = buffer.find("\r\n", position);
+            if (lineEnd == std::string::npos) {
+                return HttpParseResult::INCOMPLETE;
+            }
+            char* parsedEnd = nullptr;
+            const size_t chunkSize = std::strtoull(buffer.c_str() + position, &parsedEnd, 16);
+            if (parsedEnd == buffer.c_str() + position) {
+                return HttpParseResult::INVALID;
+            }
+            if (chunkSize == 0) {
+                // Optional trailers end with an empty line
+                const size_t trailersEnd = buffer.find("\r\n\r\n", lineEnd);
+                if (trailersEnd == std::string::npos) {
+                    return HttpParseResult::INCOMPLETE;
+                }
+                position = trailersEnd + 4;
+                break;
+            }
+            const size_t dataStart = lineEnd + 2;
+            if (buffer.size() < dataStart + chunkSize + 2) {
+                return HttpParseResult::INCOMPLETE;
+            }
+            if (buffer.compare(dataStart + chunkSize, 2, "\r\n") != 0) {
+                return HttpParseResult::INVALID;
+            }
+            response.body.append(buffer, dataStart, chunkSize);
+            position = dataStart + chunkSize + 2;
+        }
+    } else if (hasLength) {
+        if (buffer.size() < position + contentLength) {
+            return HttpParseResult::INCOMPLETE;
+        }
+        response.body.assign(buffer, position, contentLength);
+        position += contentLength;
+    } else if (!(response.statusCode < 200 || response.statusCode == 204 || response.statusCode == 304)) {
+        return HttpParseResult::INVALID;
+    }
+    buffer.erase(0, position);
+    return HttpParseResult::COMPLETE;
+}
+
+bool HttpConnection::roundTrip(const std::string& request, HttpResponse& response, std::string& error) {
+    if (fd < 0 && !connect(error)) {
+        return false;
+    }
+    size_t sent = 0;
+    while (sent < request.size()) {
+        ssize_t count = ::send(fd, request.data() + sent, request.size() - sent, MSG_NOSIGNAL);
+        if (count <= 0) {
+            error = std::string("send failed: ") + std::strerror(errno);
+            disconnect();
+            return false;
+        }
+        sent += count;
+    }
+    char chunk[64 * 1024];
+    while (true) {
+        auto result = parseHttpResponse(buffer, response);
+        if (result == HttpParseResult::COMPLETE) {
+            break;
+        }
+        if (result == HttpParseResult::INVALID) {
+            error = "invalid HTTP response";
+            disconnect();
+            return false;
+        }
+        ssize_t count = ::recv(fd, chunk, sizeof(chunk), 0);
+        if (count <= 0) {
+            error = count == 0 ? "connection closed by server" : std::string("recv failed: ") + std::strerror(errno);
+            disconnect();
+            return false;
+        }
+        buffer.append(chunk, count);
+    }
+    if (!response.keepAlive) {
+        disconnect();
+    }
+    return true;
+}
+
+bool HttpConnection::connect(std::string& error) {
+    buffer.clear();
+    if (address.rfind(UNIX_SOCKET_PREFIX, 0) == 0) {
+        const std::string path = address.substr(std::strlen(UNIX_SOCKET_PREFIX));
+        sockaddr_un socketAddress{};
+        if (path.size() >= sizeof(socketAddress.sun_path)) {
+            error = "unix socket path too long";
+            return false;
+        }
+        socketAddress.sun_family = AF_UNIX;
+        std::strncpy(socketAddress.sun_path, path.c_str(), sizeof(socketAddress.sun_path) - 1);
+        fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd >= 0 && ::connect(fd, reinterpret_cast<sockaddr*>(&socketAddress), sizeof(socketAddress)) == 0) {
+            return true;
+        }
+        error = std::string("connect failed: ") + std::strerror(errno);
+        disconnect();
+        return false;
+    }
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo* addresses = nullptr;
+    int status = ::getaddrinfo(address.c_str(), std::to_string(port).c_str(), &hints, &addresses);
+    if (status != 0) {
+        error = std::string("address resolution failed: ") + gai_strerror(status);
+        return false;
+    }
+    error = "connect failed";
+    for (addrinfo* candidate = addresses; candidate != nullptr; candidate = candidate->ai_next) {
+        fd = ::socket(candidate->ai_family, candidate->ai_socktype, candidate->ai_protocol);
+        if (fd < 0) {
+            continue;
+        }
+        if (::connect(fd, candidate->ai_addr, candidate->ai_addrlen) == 0) {
+            int noDelay = 1;
+            ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+            break;
+        }
+        error = std::string("connect failed: ") + std::strerror(errno);
+        disconnect();
+    }
+    ::freeaddrinfo(addresses);
+    return fd >= 0;
+}
+
+void HttpConnection::disconnect() {
+    if (fd >= 0) {
+        ::close(fd);
+        fd = -1;
+    }
+    buffer.clear();
+}
+
+std::string getGrpcErrorName(grpc::StatusCode code) {
+    switch (code) {
+    case grpc::StatusCode::CANCELLED:
+        return "grpc_CANCELLED";
+    case grpc::StatusCode::UNKNOWN:
+        return "grpc_UNKNOWN";
+    case grpc::StatusCode::INVALID_ARGUMENT:
+        return "grpc_INVALID_ARGUMENT";
+    case grpc::StatusCode::DEADLINE_EXCEEDED:
+        return "grpc_DEADLINE_EXCEEDED";
+    case grpc::StatusCode::NOT_FOUND:
+        return "grpc_NOT_FOUND";
+    case grpc::StatusCode::ALREADY_EXISTS:
+        return "grpc_ALREADY_EXISTS";
+    case grpc::StatusCode::PERMISSION_DENIED:
+        return "grpc_PERMISSION_DENIED";
+    case grpc::StatusCode::RESOURCE_EXHAUSTED:
+        return "grpc_RESOURCE_EXHAUSTED";
+    case grpc::StatusCode::FAILED_PRECONDITION:
+        return "grpc_FAILED_PRECONDITION";
+    case grpc::StatusCode::ABORTED:
+        return "grpc_ABORTED";
+    case grpc::StatusCode::OUT_OF_RANGE:
+        return "grpc_OUT_OF_RANGE";
+    case grpc::StatusCode::UNIMPLEMENTED:
+        return "grpc_UNIMPLEMENTED";
+    case grpc::StatusCode::INTERNAL:
+        return "grpc_INTERNAL";
+    case grpc::StatusCode::UNAVAILABLE:
+        return "grpc_UNAVAILABLE";
+    case grpc::StatusCode::DATA_LOSS:
+        return "grpc_DATA_LOSS";
+    case grpc::StatusCode::UNAUTHENTICATED:
+        return "grpc_UNAUTHENTICATED";
+    default:
+        return "grpc_" + std::to_string(static_cast<int>(code));
+    }
+}
+
+}  // namespace ovms
@@ -0,0 +1,123 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <grpcpp/grpcpp.h>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wall"
+#include "tensorflow_serving/apis/prediction_service.grpc.pb.h"
+#pragma GCC diagnostic pop
+
+namespace ovms {
+
+const char* const UNIX_SOCKET_PREFIX = "unix:";
+
+using shapes_map_t = std::map<std::string, std::vector<int64_t>>;
+
+struct LoadgenInput {
+    std::string name;
+    tensorflow::DataType dtype = tensorflow::DataType::DT_INVALID;
+    std::vector<int64_t> shape;
+};
+
+/**
+ * @brief Parses shapes given as "input1:1,3,224,224;input2:1,10"
+ */
+bool parseShapes(const std::string& text, shapes_map_t& shapes, std::string& error);
+
+/**
+ * @brief Reads inputs of serving_default signature. Shapes given explicitly take precedence over
+ * metadata, remaining dynamic dimensions (-1) are set to 1.
+ */
+bool parseModelMetadata(const tensorflow::serving::GetModelMetadataResponse& response, const shapes_map_t& shapes,
+    std::vector<LoadgenInput>& inputs, std::string& error);
+
+/**
+ * @brief Same as above for metadata returned by REST API
+ */
+bool parseModelMetadataJson(const std::string& json, const shapes_map_t& shapes,
+    std::vector<LoadgenInput>& inputs, std::string& error);
+
+/**
+ * @brief Fills request with inputs of random content. Floating point values are in range [0, 1),
+ * integers in range [0, 100), so that inputs used as indexes or class ids stay in sensible bounds.
+ */
+bool fillRandomInputs(const std::vector<LoadgenInput>& inputs, std::mt19937_64& generator,
+    tensorflow::serving::PredictRequest& request, std::string& error);
+
+/**
+ * @brief Serializes request inputs to REST API column format: {"inputs": {"name": [[...]]}}
+ */
+bool createRestBody(const tensorflow::serving::PredictRequest& request, std::string& body, std::string& error);
+
+struct HttpResponse {
+    int statusCode = 0;
+    bool keepAlive = true;
+    std::string body;
+};
+
+enum class HttpParseResult {
+    INCOMPLETE,
+    COMPLETE,
+    INVALID
+};
+
+/**
+ * @brief Parses single HTTP/1.1 response from the beginning of buffer, supporting Content-Length and chunked
+ * transfer encoding. On completion parsed bytes are removed from buffer.
+ */
+HttpParseResult parseHttpResponse(std::string& buffer, HttpResponse& response);
+
+/**
+ * @brief Blocking HTTP/1.1 client connection kept alive between requests, reconnecting after errors.
+ * Address unix:PATH connects to unix domain socket.
+ */
+class HttpConnection {
+public:
+    HttpConnection(std::string address, uint64_t port) :
+        address(std::move(address)),
+        port(port) {}
+
+    ~HttpConnection() {
+        disconnect();
+    }
+
+    bool roundTrip(const std::string& request, HttpResponse& response, std::string& error);
+
+private:
+    bool connect(std::string& error);
+    void disconnect();
+
+    const std::string address;
+    const uint64_t port;
+    int fd = -1;
+    std::string buffer;
+};
+
+/**
+ * @brief Name of gRPC status used to count errors, e.g. grpc_UNAVAILABLE
+ */
+std::string getGrpcErrorName(grpc::StatusCode code);
+
+}  // namespace ovms
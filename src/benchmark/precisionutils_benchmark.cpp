@@ -0,0 +1,108 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+// Measures throughput of precision conversion kernels used in (de)serialization.
+// Usage: precisionutils_benchmark [element count] [iterations]
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wall"
+#include "tensorflow/core/framework/tensor.pb.h"
+#pragma GCC diagnostic pop
+
+#include "../precisionutils.hpp"
+
+using namespace ovms;
+
+static void measure(const std::string& name, size_t count, size_t iterations, const std::function<void()>& function) {
+    function();  // warm up
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; i++) {
+        function();
+    }
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << std::left << std::setw(40) << name
+              << std::right << std::setw(10) << std::fixed << std::setprecision(3)
+              << (count * iterations) / elapsed / 1e9 << " Gelements/s" << std::endl;
+}
+
+static const char* isaName(ConversionIsa isa) {
+    switch (isa) {
+    case ConversionIsa::AVX512:
+        return "avx512";
+    case ConversionIsa::AVX2:
+        return "avx2";
+    case ConversionIsa::SCALAR:
+    default:
+        return "scalar";
+    }
+}
+
+int main(int argc, char** argv) {
+    const size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1 << 20;
+    const size_t iterations = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 200;
+
+    tensorflow::TensorProto proto;
+    for (size_t i = 0; i < count; i++) {
+        proto.add_half_val(static_cast<int32_t>(i & 0x7bff));
+    }
+    std::vector<uint16_t> half(count), packed(count);
+    std::vector<float> single(count);
+    std::vector<uint32_t> wide(count);
+    std::vector<int64_t> int64(count, -1);
+    std::vector<int32_t> int32(count);
+    for (size_t i = 0; i < count; i++) {
+        half[i] = static_cast<uint16_t>(i & 0x7bff);
+    }
+
+    std::cout << "Elements: " << count << ", iterations: " << iterations << ", best instruction set: " << isaName(getBestConversionIsa()) << std::endl;
+
+    // Loop previously used in ConcreteTensorProtoDeserializator
+    measure("half_val pack, proto accessor loop", count, iterations, [&]() {
+        auto size = static_cast<size_t>(proto.half_val_size());
+        for (size_t i = 0; i < size; i++) {
+            packed[i] = proto.half_val(i);
+        }
+    });
+    for (auto isa : {ConversionIsa::SCALAR, ConversionIsa::AVX2, ConversionIsa::AVX512}) {
+        if (!isConversionIsaSupported(isa)) {
+            continue;
+        }
+        const auto& kernels = getConversionKernels(isa);
+        const std::string suffix = std::string(", ") + isaName(isa);
+        measure("half_val pack" + suffix, count, iterations, [&]() {
+            kernels.u32ToU16(reinterpret_cast<const uint32_t*>(proto.half_val().data()), packed.data(), count);
+        });
+        measure("FP16 -> FP32" + suffix, count, iterations, [&]() {
+            kernels.fp16ToFp32(half.data(), single.data(), count);
+        });
+        measure("FP32 -> FP16" + suffix, count, iterations, [&]() {
+            kernels.fp32ToFp16(single.data(), half.data(), count);
+        });
+        measure("U16 -> U32" + suffix, count, iterations, [&]() {
+            kernels.u16ToU32(packed.data(), wide.data(), count);
+        });
+        measure("I64 -> I32" + suffix, count, iterations, [&]() {
+            kernels.i64ToI32(int64.data(), int32.data(), count);
+        });
+    }
+    return 0;
+}
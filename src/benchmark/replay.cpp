@@ -0,0 +1,424 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+// Replays predict requests recorded by model server started with --capture_path. Requests are sent at their
+// original arrival times, scaled by speed, and latency is measured from the time a request was due, so that
+// a server slower than the recorded traffic shows its queueing delay.
+// Usage: replay --capture_path capture.bin --grpc_port 9178 --rest_port 8000 --speed 2
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <cxxopts.hpp>
+#include <grpcpp/grpcpp.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+#include <sysexits.h>
+
+#include "../capture.hpp"
+#include "latency_histogram.hpp"
+#include "loadgen_utils.hpp"
+
+using namespace ovms;
+
+using tensorflow::serving::PredictionService;
+using tensorflow::serving::PredictRequest;
+using tensorflow::serving::PredictResponse;
+
+using steady_clock = std::chrono::steady_clock;
+
+static const std::chrono::seconds REQUEST_TIMEOUT(60);
+// Requests sent later than this after their due time are reported, as replay could not keep up
+static const std::chrono::milliseconds LATE_SEND_THRESHOLD(10);
+
+struct Settings {
+    std::string capturePath;
+    std::string address;
+    uint64_t grpcPort;
+    uint64_t restPort;
+    double speed;
+    uint64_t loops;
+    uint64_t connections;
+    std::string modelName;
+    std::string jsonOutput;
+
+    std::string getGrpcTarget() const {
+        if (address.rfind(UNIX_SOCKET_PREFIX, 0) == 0) {
+            return address;
+        }
+        return address + ":" + std::to_string(grpcPort);
+    }
+
+    std::string getRestHost() const {
+        if (address.rfind(UNIX_SOCKET_PREFIX, 0) == 0) {
+            return "localhost";
+        }
+        return address + ":" + std::to_string(restPort);
+    }
+};
+
+struct ReplayRequest {
+    std::chrono::microseconds offset;
+    CaptureApi api;
+    PredictRequest grpcRequest;
+    std::string httpRequest;
+};
+
+/**
+ * @brief Results of a single worker
+ */
+struct Stats {
+    LatencyHistogram latency;
+    std::map<std::string, uint64_t> errors;
+    uint64_t lateSends = 0;
+};
+
+static bool loadRequests(const Settings& settings, std::vector<ReplayRequest>& requests, std::string& error) {
+    CaptureReader reader;
+    auto status = reader.open(settings.capturePath);
+    if (!status.ok()) {
+        error = "cannot read capture file " + settings.capturePath + ": " + status.string();
+        return false;
+    }
+    CaptureRecord record;
+    uint64_t firstTimestampUs = 0;
+    while (reader.next(record)) {
+        if (requests.empty()) {
+            firstTimestampUs = record.timestampUs;
+        }
+        ReplayRequest request;
+        request.offset = std::chrono::microseconds(record.timestampUs - firstTimestampUs);
+        request.api = record.api;
+        const std::string& modelName = settings.modelName.empty() ? record.modelName : settings.modelName;
+        if (record.api == CaptureApi::GRPC) {
+            if (!request.grpcRequest.ParseFromString(record.payload)) {
+                error = "invalid gRPC request in record " + std::to_string(requests.size());
+                return false;
+            }
+            request.grpcRequest.mutable_model_spec()->set_name(modelName);
+        } else if (record.api == CaptureApi::REST) {
+            if (settings.restPort == 0 && settings.address.rfind(UNIX_SOCKET_PREFIX, 0) != 0) {
+                error = "capture contains REST requests, rest_port is required";
+                return false;
+            }
+            std::string path = "/v1/models/" + modelName;
+            if (record.modelVersion > 0) {
+                path += "/versions/" + std::to_string(record.modelVersion);
+            }
+            request.httpRequest = "POST " + path + ":predict HTTP/1.1\r\nHost: " + settings.getRestHost() +
+                                  "\r\nContent-Type: application/json\r\nContent-Length: " + std::to_string(record.payload.size()) + "\r\n\r\n" + record.payload;
+        } else {
+            error = "unknown API of record " + std::to_string(requests.size());
+            return false;
+        }
+        requests.push_back(std::move(request));
+    }
+    if (reader.isTruncated()) {
+        std::cout << "Capture file ends with incomplete record, it is skipped" << std::endl;
+    }
+    if (requests.empty()) {
+        error = "capture file has no requests";
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Sends requests due at scheduled times. Each worker has its own connection and takes the next request
+ * when it is free, so with too few connections requests are sent late and their latency includes the delay.
+ */
+class Replay {
+public:
+    Replay(const Settings& settings, const std::vector<ReplayRequest>& requests) :
+        settings(settings),
+        requests(requests),
+        stats(settings.connections) {
+        const auto recorded = requests.back().offset;
+        // Next loop starts after average gap between requests
+        loopDuration = recorded + (requests.size() > 1 ? recorded / static_cast<int64_t>(requests.size() - 1) : std::chrono::microseconds(0));
+    }
+
+    void run() {
+        start = steady_clock::now();
+        std::vector<std::thread> workers;
+        for (uint64_t i = 0; i < settings.connections; i++) {
+            workers.emplace_back([this, i]() { work(stats[i]); });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        end = steady_clock::now();
+    }
+
+    std::vector<Stats>& getStats() {
+        return stats;
+    }
+
+    double getSeconds() const {
+        return std::chrono::duration<double>(end - start).count();
+    }
+
+private:
+    steady_clock::time_point getDueTime(uint64_t index) const {
+        if (settings.speed <= 0) {
+            return steady_clock::now();
+        }
+        const auto offset = loopDuration * (index / requests.size()) + requests[index % requests.size()].offset;
+        return start + std::chrono::duration_cast<steady_clock::duration>(std::chrono::duration<double, std::micro>(offset.count() / settings.speed));
+    }
+
+    void work(Stats& workerStats) {
+        grpc::ChannelArguments arguments;
+        // Without local pool channels with the same arguments share one connection
+        arguments.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+        arguments.SetMaxReceiveMessageSize(-1);
+        arguments.SetMaxSendMessageSize(-1);
+        auto stub = PredictionService::NewStub(grpc::CreateCustomChannel(settings.getGrpcTarget(), grpc::InsecureChannelCredentials(), arguments));
+        HttpConnection connection(settings.address, settings.restPort);
+        const uint64_t total = requests.size() * settings.loops;
+        while (true) {
+            const uint64_t index = next.fetch_add(1, std::memory_order_relaxed);
+            if (index >= total) {
+                return;
+            }
+            const auto due = getDueTime(index);
+            std::this_thread::sleep_until(due);
+            if (steady_clock::now() - due > LATE_SEND_THRESHOLD) {
+                workerStats.lateSends++;
+            }
+            const auto& request = requests[index % requests.size()];
+            std::string error;
+            if (request.api == CaptureApi::GRPC) {
+                grpc::ClientContext context;
+                context.set_deadline(std::chrono::system_clock::now() + REQUEST_TIMEOUT);
+                PredictResponse response;
+                auto status = stub->Predict(&context, request.grpcRequest, &response);
+                if (!status.ok()) {
+                    error = getGrpcErrorName(status.error_code());
+                }
+            } else {
+                HttpResponse response;
+                std::string connectionError;
+                if (!connection.roundTrip(request.httpRequest, response, connectionError)) {
+                    error = "connection_error";
+                } else if (response.statusCode != 200) {
+                    error = "http_" + std::to_string(response.statusCode);
+                }
+            }
+            if (!error.empty()) {
+                workerStats.errors[error]++;
+                continue;
+            }
+            workerStats.latency.record(std::chrono::duration_cast<std::chrono::microseconds>(steady_clock::now() - due).count());
+        }
+    }
+
+    const Settings& settings;
+    const std::vector<ReplayRequest>& requests;
+    std::vector<Stats> stats;
+    std::chrono::microseconds loopDuration;
+    std::atomic<uint64_t> next{0};
+    steady_clock::time_point start;
+    steady_clock::time_point end;
+};
+
+static double toMs(uint64_t us) {
+    return us / 1000.0;
+}
+
+static bool writeJson(const Settings& settings, double seconds, const LatencyHistogram& histogram, const std::map<std::string, uint64_t>& errors,
+    uint64_t errorsCount, uint64_t lateSends) {
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    writer.StartObject();
+    writer.Key("capture_path");
+    writer.String(settings.capturePath.c_str());
+    writer.Key("speed");
+    writer.Double(settings.speed);
+    writer.Key("loops");
+    writer.Uint64(settings.loops);
+    writer.Key("connections");
+    writer.Uint64(settings.connections);
+    writer.Key("duration_s");
+    writer.Double(seconds);
+    writer.Key("requests");
+    writer.Uint64(histogram.getCount());
+    writer.Key("errors");
+    writer.Uint64(errorsCount);
+    writer.Key("late_sends");
+    writer.Uint64(lateSends);
+    writer.Key("throughput_rps");
+    writer.Double(histogram.getCount() / seconds);
+    writer.Key("latency_us");
+    writer.StartObject();
+    writer.Key("min");
+    writer.Uint64(histogram.getMin());
+    writer.Key("mean");
+    writer.Double(histogram.getMean());
+    for (auto [name, percentile] : std::vector<std::pair<const char*, double>>{{"p50", 50}, {"p90", 90}, {"p99", 99}, {"p99.9", 99.9}}) {
+        writer.Key(name);
+        writer.Uint64(histogram.getValueAtPercentile(percentile));
+    }
+    writer.Key("max");
+    writer.Uint64(histogram.getMax());
+    writer.EndObject();
+    writer.Key("errors_by_status");
+    writer.StartObject();
+    for (const auto& [name, count] : errors) {
+        writer.Key(name.c_str());
+        writer.Uint64(count);
+    }
+    writer.EndObject();
+    writer.EndObject();
+    std::ofstream file(settings.jsonOutput);
+    file << buffer.GetString() << std::endl;
+    return file.good();
+}
+
+static Settings parseSettings(int argc, char** argv) {
+    Settings settings;
+    try {
+        cxxopts::Options options(argv[0], "Replay of requests captured by OpenVINO Model Server");
+
+        // clang-format off
+        options.add_options()
+            ("h, help",
+                "show this help message and exit")
+            ("capture_path",
+                "path of file written by model server with --capture_path",
+                cxxopts::value<std::string>(),
+                "CAPTURE_PATH")
+            ("address",
+                "server address, unix:PATH for unix domain socket",
+                cxxopts::value<std::string>()->default_value("localhost"),
+                "ADDRESS")
+            ("grpc_port",
+                "server port of gRPC API",
+                cxxopts::value<uint64_t>()->default_value("9178"),
+                "GRPC_PORT")
+            ("rest_port",
+                "server port of REST API, required when capture contains REST requests",
+                cxxopts::value<uint64_t>()->default_value("0"),
+                "REST_PORT")
+            ("speed",
+                "rate of replay relative to recorded traffic, e.g. 2 sends requests twice as fast, 0 sends them without delays",
+                cxxopts::value<double>()->default_value("1"),
+                "SPEED")
+            ("loops",
+                "number of times captured requests are replayed",
+                cxxopts::value<uint64_t>()->default_value("1"),
+                "LOOPS")
+            ("connections",
+                "number of connections, each sends one request at a time",
+                cxxopts::value<uint64_t>()->default_value("16"),
+                "CONNECTIONS")
+            ("model_name",
+                "name of model or pipeline to send all requests to instead of the recorded one",
+                cxxopts::value<std::string>()->default_value(""),
+                "MODEL_NAME")
+            ("json_output",
+                "path of file to write results to in json",
+                cxxopts::value<std::string>()->default_value(""),
+                "JSON_OUTPUT");
+        // clang-format on
+
+        auto result = options.parse(argc, argv);
+        if (result.count("help") || !result.count("capture_path")) {
+            std::cout << options.help() << std::endl;
+            exit(result.count("help") ? EX_OK : EX_USAGE);
+        }
+        settings.capturePath = result["capture_path"].as<std::string>();
+        settings.address = result["address"].as<std::string>();
+        settings.grpcPort = result["grpc_port"].as<uint64_t>();
+        settings.restPort = result["rest_port"].as<uint64_t>();
+        settings.speed = result["speed"].as<double>();
+        settings.loops = result["loops"].as<uint64_t>();
+        settings.connections = result["connections"].as<uint64_t>();
+        settings.modelName = result["model_name"].as<std::string>();
+        settings.jsonOutput = result["json_output"].as<std::string>();
+    } catch (const cxxopts::OptionException& e) {
+        std::cerr << "error parsing options: " << e.what() << std::endl;
+        exit(EX_USAGE);
+    }
+    if (settings.connections == 0 || settings.loops == 0 || settings.speed < 0) {
+        std::cerr << "connections and loops should be positive, speed should not be negative" << std::endl;
+        exit(EX_USAGE);
+    }
+    return settings;
+}
+
+int main(int argc, char** argv) {
+    Settings settings = parseSettings(argc, argv);
+
+    std::vector<ReplayRequest> requests;
+    std::string error;
+    if (!loadRequests(settings, requests, error)) {
+        std::cerr << error << std::endl;
+        return EX_DATAERR;
+    }
+    std::cout << "Replaying " << requests.size() << " requests recorded over " << std::fixed << std::setprecision(1)
+              << std::chrono::duration<double>(requests.back().offset).count() << "s, " << settings.loops << " times at speed "
+              << (settings.speed > 0 ? std::to_string(settings.speed) : std::string("unlimited")) << std::endl;
+
+    Replay replay(settings, requests);
+    replay.run();
+
+    LatencyHistogram total;
+    std::map<std::string, uint64_t> errors;
+    uint64_t lateSends = 0;
+    for (const auto& workerStats : replay.getStats()) {
+        total.merge(workerStats.latency);
+        lateSends += workerStats.lateSends;
+        for (const auto& [name, count] : workerStats.errors) {
+            errors[name] += count;
+        }
+    }
+    uint64_t errorsCount = 0;
+    for (const auto& [name, count] : errors) {
+        errorsCount += count;
+    }
+    const double seconds = replay.getSeconds();
+    std::cout << "Requests: " << total.getCount() << ", errors: " << errorsCount << ", sent late: " << lateSends << ", throughput: "
+              << std::fixed << std::setprecision(1) << total.getCount() / seconds << " req/s" << std::endl;
+    std::cout << std::setprecision(3)
+              << "Latency [ms]: min " << toMs(total.getMin())
+              << ", mean " << total.getMean() / 1000.0
+              << ", p50 " << toMs(total.getValueAtPercentile(50))
+              << ", p90 " << toMs(total.getValueAtPercentile(90))
+              << ", p99 " << toMs(total.getValueAtPercentile(99))
+              << ", p99.9 " << toMs(total.getValueAtPercentile(99.9))
+              << ", max " << toMs(total.getMax()) << std::endl;
+    for (const auto& [name, count] : errors) {
+        std::cout << "Errors " << name << ": " << count << std::endl;
+    }
+    if (lateSends > 0) {
+        std::cout << "Some requests were sent late, use more connections to keep up with recorded traffic" << std::endl;
+    }
+    if (!settings.jsonOutput.empty() && !writeJson(settings, seconds, total, errors, errorsCount, lateSends)) {
+        std::cerr << "Failed to write results to " << settings.jsonOutput << std::endl;
+        return EX_CANTCREAT;
+    }
+    return errorsCount > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
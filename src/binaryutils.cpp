@@ -0,0 +1,162 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "binaryutils.hpp"
+
+#include <atomic>
+#include <exception>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <opencv2/core.hpp>
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/imgproc.hpp>
+#include <spdlog/spdlog.h>
+
+namespace ovms {
+
+namespace {
+struct ImageDimensions {
+    size_t channels;
+    size_t height;
+    size_t width;
+    bool planar;
+};
+
+ImageDimensions getImageDimensions(const TensorInfo& tensorInfo) {
+    const auto& shape = tensorInfo.getShape();
+    if (tensorInfo.getLayout() == InferenceEngine::Layout::NHWC) {
+        return {shape[3], shape[1], shape[2], false};
+    }
+    return {shape[1], shape[2], shape[3], true};
+}
+
+int getOpenCVDepth(const InferenceEngine::Precision& precision) {
+    return precision == InferenceEngine::Precision::FP32 ? CV_32F : CV_8U;
+}
+
+Status convertImage(const std::string& encoded, const ImageDimensions& dims, int depth, uint8_t* destination) {
+    const cv::Mat buffer(1, static_cast<int>(encoded.size()), CV_8UC1, const_cast<char*>(encoded.data()));
+    cv::Mat image = cv::imdecode(buffer, dims.channels == 1 ? cv::IMREAD_GRAYSCALE : cv::IMREAD_COLOR);
+    if (image.empty()) {
+        return StatusCode::IMAGE_PARSING_FAILED;
+    }
+
+    const cv::Size size(static_cast<int>(dims.width), static_cast<int>(dims.height));
+    if (image.size() != size) {
+        cv::resize(image, image, size, 0, 0, cv::INTER_LINEAR);
+    }
+
+    const int channels = static_cast<int>(dims.channels);
+    if (!dims.planar) {
+        // Convert directly into blob memory
+        cv::Mat output(size, CV_MAKETYPE(depth, channels), destination);
+        image.convertTo(output, depth);
+        return StatusCode::OK;
+    }
+    cv::Mat converted;
+    image.convertTo(converted, depth);
+    std::vector<cv::Mat> planes;
+    const size_t planeSize = dims.height * dims.width * CV_ELEM_SIZE(depth);
+    for (int c = 0; c < channels; c++) {
+        planes.emplace_back(size, CV_MAKETYPE(depth, 1), destination + c * planeSize);
+    }
+    cv::split(converted, planes.data());
+    return StatusCode::OK;
+}
+
+Status decodeImage(const std::string& encoded, const ImageDimensions& dims, int depth, uint8_t* destination) {
+    // Any step may throw on malformed or degenerate images, exception must not leave cv::parallel_for_ body
+    try {
+        return convertImage(encoded, dims, depth, destination);
+    } catch (const cv::Exception& e) {
+        SPDLOG_DEBUG("Image conversion failed: {}", e.what());
+    } catch (const std::exception& e) {
+        SPDLOG_DEBUG("Image conversion failed: {}", e.what());
+    }
+    return StatusCode::IMAGE_PARSING_FAILED;
+}
+}  // namespace
+
+Status validateBinaryInput(const TensorInfo& tensorInfo, const tensorflow::TensorProto& proto) {
+    const auto& shape = tensorInfo.getShape();
+    const auto& layout = tensorInfo.getLayout();
+    if (shape.size() != 4 ||
+        (layout != InferenceEngine::Layout::NCHW && layout != InferenceEngine::Layout::NHWC && layout != InferenceEngine::Layout::ANY) ||
+        (tensorInfo.getPrecision() != InferenceEngine::Precision::FP32 && tensorInfo.getPrecision() != InferenceEngine::Precision::U8)) {
+        std::stringstream ss;
+        ss << "Binary input requires 4 dimensional NCHW or NHWC FP32/U8 input; Actual shape: " << TensorInfo::shapeToString(shape)
+           << " precision: " << tensorInfo.getPrecisionAsString();
+        const std::string details = ss.str();
+        SPDLOG_DEBUG("[Input: {}] {}", tensorInfo.getName(), details);
+        return Status(StatusCode::BINARY_INPUT_NOT_IMAGE, details);
+    }
+    const auto dims = getImageDimensions(tensorInfo);
+    if (dims.channels != 1 && dims.channels != 3) {
+        std::stringstream ss;
+        ss << "Binary input requires 1 or 3 channels; Actual: " << dims.channels;
+        const std::string details = ss.str();
+        SPDLOG_DEBUG("[Input: {}] {}", tensorInfo.getName(), details);
+        return Status(StatusCode::BINARY_INPUT_NOT_IMAGE, details);
+    }
+    if (proto.string_val_size() == 0 || proto.tensor_shape().dim_size() != 1 || proto.tensor_shape().dim(0).size() != proto.string_val_size()) {
+        std::stringstream ss;
+        ss << "Expected shape: [" << proto.string_val_size() << "]; Actual: " << TensorInfo::tensorShapeToString(proto.tensor_shape());
+        const std::string details = ss.str();
+        SPDLOG_DEBUG("[Input: {}] Invalid shape of binary input - {}", tensorInfo.getName(), details);
+        return Status(StatusCode::INVALID_SHAPE, details);
+    }
+    return StatusCode::OK;
+}
+
+Status convertBinaryInputToBlob(const tensorflow::TensorProto& proto, const std::shared_ptr<TensorInfo>& tensorInfo, InferenceEngine::Blob::Ptr& blob) {
+    auto status = validateBinaryInput(*tensorInfo, proto);
+    if (!status.ok()) {
+        return status;
+    }
+    const auto dims = getImageDimensions(*tensorInfo);
+    const size_t batchSize = proto.string_val_size();
+    InferenceEngine::SizeVector blobShape = tensorInfo->getShape();
+    blobShape[0] = batchSize;
+    const auto layout = dims.planar ? InferenceEngine::Layout::NCHW : InferenceEngine::Layout::NHWC;
+    InferenceEngine::TensorDesc desc(tensorInfo->getPrecision(), blobShape, layout);
+    if (tensorInfo->getPrecision() == InferenceEngine::Precision::FP32) {
+        blob = InferenceEngine::make_shared_blob<float>(desc);
+    } else {
+        blob = InferenceEngine::make_shared_blob<uint8_t>(desc);
+    }
+    blob->allocate();
+
+    const int depth = getOpenCVDepth(tensorInfo->getPrecision());
+    const size_t imageSize = blob->byteSize() / batchSize;
+    uint8_t* data = blob->buffer().as<uint8_t*>();
+    std::atomic<bool> failed{false};
+    cv::parallel_for_(cv::Range(0, static_cast<int>(batchSize)), [&](const cv::Range& range) {
+        for (int i = range.start; i < range.end; i++) {
+            if (!decodeImage(proto.string_val(i), dims, depth, data + i * imageSize).ok()) {
+                failed = true;
+            }
+        }
+    });
+    if (failed) {
+        SPDLOG_DEBUG("[Input: {}] Decoding of binary input failed", tensorInfo->getName());
+        blob = nullptr;
+        return StatusCode::IMAGE_PARSING_FAILED;
+    }
+    return StatusCode::OK;
+}
+
+}  // namespace ovms
@@ -0,0 +1,51 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <memory>
+
+#include <inference_engine.hpp>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wall"
+#include "tensorflow_serving/apis/prediction_service.grpc.pb.h"
+#pragma GCC diagnostic pop
+
+#include "status.hpp"
+#include "tensorinfo.hpp"
+
+namespace ovms {
+
+/**
+ * @brief Checks whether tensor proto holds encoded images (JPEG/PNG) in string_val, one per batch element
+ */
+inline bool isBinaryInput(const tensorflow::TensorProto& proto) {
+    return proto.dtype() == tensorflow::DataType::DT_STRING;
+}
+
+/**
+ * @brief Validates that encoded images can be converted to the input described by tensorInfo:
+ * 4 dimensional NCHW or NHWC input with 1 or 3 channels of FP32 or U8 precision.
+ */
+Status validateBinaryInput(const TensorInfo& tensorInfo, const tensorflow::TensorProto& proto);
+
+/**
+ * @brief Decodes images, resizes them to the spatial dimensions of tensorInfo and converts
+ * to its layout and precision. Batch elements are processed in parallel.
+ */
+Status convertBinaryInputToBlob(const tensorflow::TensorProto& proto, const std::shared_ptr<TensorInfo>& tensorInfo, InferenceEngine::Blob::Ptr& blob);
+
+}  // namespace ovms
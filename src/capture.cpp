@@ -0,0 +1,223 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "capture.hpp"
+
+#include <cstring>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <spdlog/spdlog.h>
+
+#include "logging.hpp"
+
+using tensorflow::serving::PredictRequest;
+
+namespace ovms {
+
+// Size of record fields following record size: timestamp, API, model version, model name size
+static const size_t RECORD_HEADER_SIZE = sizeof(uint64_t) + sizeof(uint8_t) + sizeof(int64_t) + sizeof(uint16_t);
+
+template <typename T>
+static void appendValue(std::string& buffer, T value) {
+    buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename T>
+static T readValue(const char*& data) {
+    T value;
+    std::memcpy(&value, data, sizeof(value));
+    data += sizeof(value);
+    return value;
+}
+
+static size_t getRecordSize(const CaptureRecord& record) {
+    return sizeof(uint32_t) + RECORD_HEADER_SIZE + record.modelName.size() + record.payload.size();
+}
+
+Status TrafficCapture::start(const std::string& path, uint32_t samplingInterval, size_t queueSize, size_t queueBytes) {
+    stop();
+    file.open(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        SPDLOG_ERROR("Cannot open traffic capture file: {}", path);
+        return StatusCode::FILE_INVALID;
+    }
+    file.write(CAPTURE_FILE_MAGIC.data(), CAPTURE_FILE_MAGIC.size());
+    this->samplingInterval = samplingInterval > 0 ? samplingInterval : 1;
+    this->queueSize = queueSize;
+    this->queueBytes = queueBytes;
+    startTime = clock::now();
+    requestsCount = 0;
+    captured = 0;
+    dropped = 0;
+    queue.clear();
+    pendingBytes = 0;
+    stopping = false;
+    writer = std::thread([this]() { run(); });
+    enabled = true;
+    SPDLOG_INFO("Capturing every {} predict request to {}", this->samplingInterval, path);
+    return StatusCode::OK;
+}
+
+void TrafficCapture::stop() {
+    if (!writer.joinable()) {
+        return;
+    }
+    enabled = false;
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    queueChanged.notify_one();
+    writer.join();
+    file.close();
+    SPDLOG_INFO("Traffic capture finished with {} requests captured, {} dropped", getCapturedCount(), getDroppedCount());
+}
+
+bool TrafficCapture::sample() {
+    return requestsCount.fetch_add(1, std::memory_order_relaxed) % samplingInterval == 0;
+}
+
+void TrafficCapture::captureGrpc(const PredictRequest& request) {
+    if (!isEnabled() || !sample()) {
+        return;
+    }
+    CaptureRecord record;
+    record.timestampUs = std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - startTime).count();
+    record.api = CaptureApi::GRPC;
+    record.modelName = request.model_spec().name();
+    record.modelVersion = request.model_spec().version().value();
+    if (!request.SerializeToString(&record.payload)) {
+        OVMS_DEBUG("Failed to serialize captured request for model: {}", record.modelName);
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    push(std::move(record));
+}
+
+void TrafficCapture::captureRest(const std::string& modelName, int64_t modelVersion, const std::string& body) {
+    if (!isEnabled() || !sample()) {
+        return;
+    }
+    CaptureRecord record;
+    record.timestampUs = std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - startTime).count();
+    record.api = CaptureApi::REST;
+    record.modelName = modelName;
+    record.modelVersion = modelVersion;
+    record.payload = body;
+    push(std::move(record));
+}
+
+void TrafficCapture::push(CaptureRecord&& record) {
+    if (record.modelName.size() > std::numeric_limits<uint16_t>::max() ||
+        RECORD_HEADER_SIZE + record.modelName.size() + record.payload.size() > std::numeric_limits<uint32_t>::max()) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    const size_t recordSize = getRecordSize(record);
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (queue.size() >= queueSize || pendingBytes + recordSize > queueBytes) {
+            lock.unlock();
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        queue.push_back(std::move(record));
+        pendingBytes += recordSize;
+    }
+    captured.fetch_add(1, std::memory_order_relaxed);
+    queueChanged.notify_one();
+}
+
+void TrafficCapture::run() {
+    std::vector<CaptureRecord> batch;
+    size_t batchBytes = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            // Memory of written records is released only now, so it is counted until then
+            pendingBytes -= batchBytes;
+            queueChanged.wait(lock, [this]() { return stopping || !queue.empty(); });
+            if (queue.empty()) {
+                break;
+            }
+            batch.assign(std::make_move_iterator(queue.begin()), std::make_move_iterator(queue.end()));
+            queue.clear();
+        }
+        batchBytes = 0;
+        for (const auto& record : batch) {
+            write(record);
+            batchBytes += getRecordSize(record);
+        }
+        batch.clear();
+        // Records of a batch are complete in the file, so capture can be read while server is running
+        file.flush();
+    }
+}
+
+void TrafficCapture::write(const CaptureRecord& record) {
+    std::string header;
+    header.reserve(sizeof(uint32_t) + RECORD_HEADER_SIZE + record.modelName.size());
+    appendValue<uint32_t>(header, RECORD_HEADER_SIZE + record.modelName.size() + record.payload.size());
+    appendValue<uint64_t>(header, record.timestampUs);
+    appendValue<uint8_t>(header, static_cast<uint8_t>(record.api));
+    appendValue<int64_t>(header, record.modelVersion);
+    appendValue<uint16_t>(header, record.modelName.size());
+    header.append(record.modelName);
+    file.write(header.data(), header.size());
+    file.write(record.payload.data(), record.payload.size());
+}
+
+Status CaptureReader::open(const std::string& path) {
+    file.open(path, std::ios::binary);
+    if (!file.is_open()) {
+        return StatusCode::FILE_INVALID;
+    }
+    std::string magic(CAPTURE_FILE_MAGIC.size(), '\0');
+    if (!file.read(magic.data(), magic.size()) || magic != CAPTURE_FILE_MAGIC) {
+        return StatusCode::FILE_INVALID;
+    }
+    truncated = false;
+    return StatusCode::OK;
+}
+
+bool CaptureReader::next(CaptureRecord& record) {
+    uint32_t size;
+    if (!file.read(reinterpret_cast<char*>(&size), sizeof(size))) {
+        truncated = file.gcount() > 0;
+        return false;
+    }
+    std::string buffer(size, '\0');
+    if (size < RECORD_HEADER_SIZE || !file.read(buffer.data(), size)) {
+        truncated = true;
+        return false;
+    }
+    const char* data = buffer.data();
+    record.timestampUs = readValue<uint64_t>(data);
+    record.api = static_cast<CaptureApi>(readValue<uint8_t>(data));
+    record.modelVersion = readValue<int64_t>(data);
+    const uint16_t nameSize = readValue<uint16_t>(data);
+    if (RECORD_HEADER_SIZE + nameSize > size) {
+        truncated = true;
+        return false;
+    }
+    record.modelName.assign(data, nameSize);
+    data += nameSize;
+    record.payload.assign(data, buffer.data() + size - data);
+    return true;
+}
+
+}  // namespace ovms
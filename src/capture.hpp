@@ -0,0 +1,144 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wall"
+#include "tensorflow_serving/apis/prediction_service.grpc.pb.h"
+#pragma GCC diagnostic pop
+
+#include "status.hpp"
+
+namespace ovms {
+
+const std::string CAPTURE_FILE_MAGIC = "OVMSCAP1";
+
+enum class CaptureApi : uint8_t {
+    GRPC = 0,
+    REST = 1
+};
+
+/**
+ * @brief Single captured predict request. Payload is serialized PredictRequest for gRPC and request body for REST.
+ */
+struct CaptureRecord {
+    uint64_t timestampUs = 0;
+    CaptureApi api = CaptureApi::GRPC;
+    std::string modelName;
+    int64_t modelVersion = 0;
+    std::string payload;
+};
+
+/**
+ * @brief Records sampled predict requests with their arrival time to a binary file. Requests are serialized in the
+ * request thread and written by a background thread, records over the queue limits of record count or bytes
+ * are dropped rather than delaying requests.
+ *
+ * File starts with CAPTURE_FILE_MAGIC followed by records, integers are in host byte order:
+ * uint32 size of the rest of record, uint64 microseconds since start of capture, uint8 API,
+ * int64 model version, uint16 size of model name, model name, payload.
+ */
+class TrafficCapture {
+public:
+    using clock = std::chrono::steady_clock;
+
+    static TrafficCapture& getInstance() {
+        static TrafficCapture instance;
+        return instance;
+    }
+
+    ~TrafficCapture() { stop(); }
+
+    /**
+     * @brief Must not be called while requests are captured
+     *
+     * @param path file to write, overwritten if exists
+     * @param samplingInterval every N-th request is captured, 0 is treated as 1
+     * @param queueSize maximum number of records waiting to be written
+     * @param queueBytes maximum size of records waiting or being written, bounds memory taken by large payloads
+     */
+    Status start(const std::string& path, uint32_t samplingInterval, size_t queueSize, size_t queueBytes);
+
+    /**
+     * @brief Writes remaining records and closes the file
+     */
+    void stop();
+
+    bool isEnabled() const { return enabled.load(std::memory_order_relaxed); }
+
+    void captureGrpc(const tensorflow::serving::PredictRequest& request);
+
+    void captureRest(const std::string& modelName, int64_t modelVersion, const std::string& body);
+
+    uint64_t getCapturedCount() const { return captured.load(std::memory_order_relaxed); }
+    uint64_t getDroppedCount() const { return dropped.load(std::memory_order_relaxed); }
+
+private:
+    bool sample();
+    void push(CaptureRecord&& record);
+    void run();
+    void write(const CaptureRecord& record);
+
+    std::atomic<bool> enabled{false};
+    uint32_t samplingInterval = 1;
+    size_t queueSize = 0;
+    size_t queueBytes = 0;
+    clock::time_point startTime;
+    std::atomic<uint64_t> requestsCount{0};
+    std::atomic<uint64_t> captured{0};
+    std::atomic<uint64_t> dropped{0};
+
+    std::mutex mutex;
+    std::condition_variable queueChanged;
+    std::deque<CaptureRecord> queue;
+    // Size of records in queue and in batch being written by writer thread
+    size_t pendingBytes = 0;
+    bool stopping = false;
+    std::thread writer;
+    std::ofstream file;
+};
+
+/**
+ * @brief Reads records of capture file in order
+ */
+class CaptureReader {
+public:
+    Status open(const std::string& path);
+
+    /**
+     * @brief Returns false at the end of file. Record cut by server termination is treated as the end of file
+     * and reported by isTruncated.
+     */
+    bool next(CaptureRecord& record);
+
+    bool isTruncated() const { return truncated; }
+
+private:
+    std::ifstream file;
+    bool truncated = false;
+};
+
+}  // namespace ovms
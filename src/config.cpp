@@ -34,6 +34,8 @@ const uint MAX_PORT_NUMBER = std::numeric_limits<ushort>::max();
 const uint64_t DEFAULT_REST_WORKERS = AVAILABLE_CORES * 4.0;
 const std::string DEFAULT_REST_WORKERS_STRING{std::to_string(DEFAULT_REST_WORKERS)};
 const uint64_t MAX_REST_WORKERS = 10'000;
+// sizeof(sockaddr_un::sun_path) including terminating null
+const size_t MAX_UNIX_SOCKET_PATH_LENGTH = 108;
 
 Config& Config::parse(int argc, char** argv) {
     try {
@@ -61,6 +63,14 @@ Config& Config::parse(int argc, char** argv) {
                 "Network interface address to bind to for the REST API",
                 cxxopts::value<std::string>()->default_value("0.0.0.0"),
                 "REST_BIND_ADDRESS")
+            ("grpc_unix_socket_path",
+                "optional path of unix domain socket to serve the gRPC API on, in addition to the TCP port",
+                cxxopts::value<std::string>(),
+                "GRPC_UNIX_SOCKET_PATH")
+            ("rest_unix_socket_path",
+                "optional path of unix domain socket to serve the REST API on, in addition to rest_port - has no effect if rest_port is not set",
+                cxxopts::value<std::string>(),
+                "REST_UNIX_SOCKET_PATH")
             ("grpc_workers",
                 "number of gRPC servers. Default 1. Increase for multi client, high throughput scenarios",
                 cxxopts::value<uint>()->default_value("1"),
@@ -75,13 +85,51 @@ Config& Config::parse(int argc, char** argv) {
             ("log_path",
                 "optional path to the log file",
                 cxxopts::value<std::string>(), "LOG_PATH")
+            ("log_async_queue_size",
+                "Size of queue of messages written by a dedicated logging thread. When full, oldest messages are dropped. Default 0 writes messages synchronously in threads producing them.",
+                cxxopts::value<uint>()->default_value("0"),
+                "LOG_ASYNC_QUEUE_SIZE")
+            ("access_log_path",
+                "optional path to the file with one line per predict request - model, version, status and timings of processing stages",
+                cxxopts::value<std::string>(), "ACCESS_LOG_PATH")
             ("grpc_channel_arguments",
                 "A comma separated list of arguments to be passed to the grpc server. (e.g. grpc.max_connection_age_ms=2000)",
                 cxxopts::value<std::string>(), "GRPC_CHANNEL_ARGUMENTS")
             ("file_system_poll_wait_seconds",
                 "Time interval between config and model versions changes detection. Default is 1. Zero or negative value disables changes monitoring.",
                 cxxopts::value<uint>()->default_value("1"),
-                "SECONDS");
+                "SECONDS")
+            ("shared_memory_key_prefix",
+                "Only POSIX shared memory segments with names starting with this prefix can be registered as shared memory regions through REST API. Default /ovms_.",
+                cxxopts::value<std::string>()->default_value("/ovms_"),
+                "SHARED_MEMORY_KEY_PREFIX")
+            ("inference_slots",
+                "Maximum number of inferences executed concurrently across all models. Waiting requests are ordered by priority classes of models. Default 0 disables the limit.",
+                cxxopts::value<uint>()->default_value("0"),
+                "INFERENCE_SLOTS")
+            ("trace_buffer_size",
+                "Maximum number of spans of sampled request traces kept in memory and returned by REST /v1/traces endpoint. Default 0 disables tracing.",
+                cxxopts::value<uint>()->default_value("0"),
+                "TRACE_BUFFER_SIZE")
+            ("trace_sampling_interval",
+                "Every N-th predict request is traced. Requests with ovms-trace-id header are always traced. Default 0 traces only requests with the header.",
+                cxxopts::value<uint>()->default_value("0"),
+                "TRACE_SAMPLING_INTERVAL")
+            ("capture_path",
+                "Path of file to which sampled predict requests are recorded with their arrival time, for replay with replay tool. Default empty disables capture.",
+                cxxopts::value<std::string>(), "CAPTURE_PATH")
+            ("capture_sampling_interval",
+                "Every N-th predict request is captured. Default 1 captures all requests.",
+                cxxopts::value<uint>()->default_value("1"),
+                "CAPTURE_SAMPLING_INTERVAL")
+            ("capture_queue_size",
+                "Maximum number of captured requests waiting to be written, requests captured over the limit are dropped. Default 1000.",
+                cxxopts::value<uint>()->default_value("1000"),
+                "CAPTURE_QUEUE_SIZE")
+            ("capture_queue_size_mb",
+                "Maximum size in megabytes of captured requests waiting to be written, requests captured over the limit are dropped. Default 64.",
+                cxxopts::value<uint>()->default_value("64"),
+                "CAPTURE_QUEUE_SIZE_MB");
         options->add_options("multi model")
             ("config_path",
                 "absolute path to json configuration file",
@@ -171,6 +219,10 @@ bool Config::check_hostname_or_ip(const std::string& input) {
     }
 }
 
+bool Config::check_unix_socket_path(const std::string& input) {
+    return !input.empty() && input.size() < MAX_UNIX_SOCKET_PATH_LENGTH;
+}
+
 void Config::validate() {
     // cannot set both config path & model_name/model_path
     if (result->count("config_path") && (result->count("model_name") || result->count("model_path"))) {
@@ -231,6 +283,25 @@ void Config::validate() {
         exit(EX_USAGE);
     }
 
+    // check unix socket paths
+    if (result->count("grpc_unix_socket_path") && !check_unix_socket_path(this->grpcUnixSocketPath())) {
+        std::cerr << "grpc_unix_socket_path has invalid format: non empty path shorter than " << MAX_UNIX_SOCKET_PATH_LENGTH << " characters expected." << std::endl;
+        exit(EX_USAGE);
+    }
+    if (result->count("rest_unix_socket_path") && !check_unix_socket_path(this->restUnixSocketPath())) {
+        std::cerr << "rest_unix_socket_path has invalid format: non empty path shorter than " << MAX_UNIX_SOCKET_PATH_LENGTH << " characters expected." << std::endl;
+        exit(EX_USAGE);
+    }
+    if (result->count("rest_unix_socket_path") && this->restPort() == 0) {
+        std::cerr << "rest_unix_socket_path is set but rest_port is not set. rest_port is required to start rest servers" << std::endl;
+        exit(EX_USAGE);
+    }
+    if (result->count("grpc_unix_socket_path") && result->count("rest_unix_socket_path") &&
+        this->grpcUnixSocketPath() == this->restUnixSocketPath()) {
+        std::cerr << "grpc_unix_socket_path and rest_unix_socket_path cannot have the same values" << std::endl;
+        exit(EX_USAGE);
+    }
+
     // port and rest_port cannot be the same
     if (this->port() == this->restPort()) {
         std::cerr << "port and rest_port cannot have the same values" << std::endl;
@@ -85,6 +85,13 @@ public:
          */
     bool check_hostname_or_ip(const std::string& input);
 
+    /**
+         * @brief checks if input is a valid unix domain socket path
+         *
+         * @return bool
+         */
+    bool check_unix_socket_path(const std::string& input);
+
     /**
          * @brief Get the config path
          * 
@@ -147,6 +154,28 @@ public:
         return "0.0.0.0";
     }
 
+    /**
+         * @brief Get the gRPC unix domain socket path, empty if not set
+         * 
+         * @return const std::string
+         */
+    const std::string grpcUnixSocketPath() {
+        if (result->count("grpc_unix_socket_path"))
+            return result->operator[]("grpc_unix_socket_path").as<std::string>();
+        return "";
+    }
+
+    /**
+         * @brief Get the REST unix domain socket path, empty if not set
+         * 
+         * @return const std::string
+         */
+    const std::string restUnixSocketPath() {
+        if (result->count("rest_unix_socket_path"))
+            return result->operator[]("rest_unix_socket_path").as<std::string>();
+        return "";
+    }
+
     /**
          * @brief Gets the gRPC workers count
          * 
@@ -276,6 +305,26 @@ public:
         return empty;
     }
 
+    /**
+     * @brief Get the size of asynchronous logging queue, 0 means synchronous logging
+     * 
+     * @return uint 
+     */
+    uint logAsyncQueueSize() {
+        return result->operator[]("log_async_queue_size").as<uint>();
+    }
+
+    /**
+     * @brief Get the access log path
+     *
+     * @return const std::string&
+     */
+    const std::string& accessLogPath() {
+        if (result->count("access_log_path"))
+            return result->operator[]("access_log_path").as<std::string>();
+        return empty;
+    }
+
     /**
         * @brief Get the plugin config
         *
@@ -295,5 +344,79 @@ public:
     uint filesystemPollWaitSeconds() {
         return result->operator[]("file_system_poll_wait_seconds").as<uint>();
     }
+
+    /**
+     * @brief Get the name prefix of shared memory segments allowed to be registered
+     * 
+     * @return const std::string& 
+     */
+    const std::string& sharedMemoryKeyPrefix() {
+        return result->operator[]("shared_memory_key_prefix").as<std::string>();
+    }
+
+    /**
+     * @brief Get the maximum number of concurrent inferences across all models, 0 means no limit
+     * 
+     * @return uint 
+     */
+    uint inferenceSlots() {
+        return result->operator[]("inference_slots").as<uint>();
+    }
+
+    /**
+     * @brief Get the maximum number of spans of traces kept in memory, 0 means tracing is disabled
+     * 
+     * @return uint 
+     */
+    uint traceBufferSize() {
+        return result->operator[]("trace_buffer_size").as<uint>();
+    }
+
+    /**
+     * @brief Get the interval of traced requests, 0 means only requests with trace id are traced
+     * 
+     * @return uint 
+     */
+    uint traceSamplingInterval() {
+        return result->operator[]("trace_sampling_interval").as<uint>();
+    }
+
+    /**
+     * @brief Get the path of traffic capture file, empty means capture is disabled
+     * 
+     * @return const std::string& 
+     */
+    const std::string& capturePath() {
+        if (result->count("capture_path"))
+            return result->operator[]("capture_path").as<std::string>();
+        return empty;
+    }
+
+    /**
+     * @brief Get the interval of captured requests
+     * 
+     * @return uint 
+     */
+    uint captureSamplingInterval() {
+        return result->operator[]("capture_sampling_interval").as<uint>();
+    }
+
+    /**
+     * @brief Get the maximum number of captured requests waiting to be written
+     * 
+     * @return uint 
+     */
+    uint captureQueueSize() {
+        return result->operator[]("capture_queue_size").as<uint>();
+    }
+
+    /**
+     * @brief Get the maximum size in megabytes of captured requests waiting to be written
+     * 
+     * @return uint 
+     */
+    uint captureQueueSizeMb() {
+        return result->operator[]("capture_queue_size_mb").as<uint>();
+    }
 };
 }  // namespace ovms
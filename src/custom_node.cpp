@@ -0,0 +1,275 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "custom_node.hpp"
+
+#include <algorithm>
+#include <thread>
+#include <utility>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wall"
+#include "tensorflow_serving/util/threadpool_executor.h"
+#pragma GCC diagnostic pop
+
+#include "logging.hpp"
+
+namespace ovms {
+
+/**
+ * @brief Custom nodes are executed on dedicated thread pool so that long running
+ * library calls do not block pipeline event loop nor OpenVINO inference threads.
+ */
+static tensorflow::serving::ThreadPoolExecutor& getCustomNodesExecutor() {
+    static tensorflow::serving::ThreadPoolExecutor executor(tensorflow::Env::Default(), "customnodes",
+        std::max(1u, std::thread::hardware_concurrency()));
+    return executor;
+}
+
+CustomNode::CustomNode(const std::string& nodeName, const NodeLibrary& library, const parameters_t& parameters,
+    std::unordered_map<std::string, std::string> nodeOutputNameAlias) :
+    Node(nodeName),
+    library(library),
+    parameters(parameters),
+    nodeOutputNameAlias(nodeOutputNameAlias) {
+    // Parameters map is constant, pointers to its strings stay valid for node lifetime
+    libraryParameters.reserve(this->parameters.size());
+    for (const auto& [key, value] : this->parameters) {
+        libraryParameters.push_back({key.c_str(), value.c_str()});
+    }
+}
+
+Status CustomNode::execute(ThreadSafeQueue<std::reference_wrapper<Node>>& notifyEndQueue) {
+    OVMS_LOGGER_DEBUG(dag_executor_logger, "Scheduling custom node: {} execution", getName());
+    getCustomNodesExecutor().Schedule([this, &notifyEndQueue]() {
+        this->executionStatus = this->executeLibrary();
+        // After library execution is completed, input blobs are not needed anymore
+        this->inputBlobs.clear();
+        notifyEndQueue.push(*this);
+    });
+    return StatusCode::OK;
+}
+
+Status CustomNode::executeLibrary() {
+    std::vector<struct CustomNodeTensor> inputs;
+    std::vector<std::vector<uint64_t>> inputsDims;
+    inputs.reserve(this->inputBlobs.size());
+    inputsDims.reserve(this->inputBlobs.size());
+    for (const auto& [name, blob] : this->inputBlobs) {
+        const auto& desc = blob->getTensorDesc();
+        struct CustomNodeTensor tensor;
+        auto status = toCustomNodeTensorPrecision(desc.getPrecision(), tensor.precision);
+        if (!status.ok()) {
+            OVMS_LOGGER_DEBUG(dag_executor_logger, "[Node: {}] Unsupported input: {} precision: {}", getName(), name, desc.getPrecision().name());
+            return status;
+        }
+        inputsDims.emplace_back(desc.getDims().begin(), desc.getDims().end());
+        tensor.name = name.c_str();
+        tensor.data = blob->buffer().as<uint8_t*>();
+        tensor.dataBytes = blob->byteSize();
+        tensor.dims = inputsDims.back().data();
+        tensor.dimsCount = inputsDims.back().size();
+        inputs.push_back(tensor);
+    }
+
+    struct CustomNodeTensor* outputs = nullptr;
+    int outputsCount = 0;
+    int result = library.execute(inputs.data(), static_cast<int>(inputs.size()), &outputs, &outputsCount,
+        libraryParameters.data(), static_cast<int>(libraryParameters.size()));
+    if (result != 0) {
+        SPDLOG_LOGGER_ERROR(dag_executor_logger, "[Node: {}] Custom node library execution failed with code: {}", getName(), result);
+        return StatusCode::NODE_LIBRARY_EXECUTION_FAILED;
+    }
+    if (outputs == nullptr || outputsCount <= 0) {
+        SPDLOG_LOGGER_ERROR(dag_executor_logger, "[Node: {}] Custom node library did not return any outputs", getName());
+        if (outputs != nullptr) {
+            library.release(outputs);
+        }
+        return StatusCode::NODE_LIBRARY_OUTPUTS_CORRUPTED;
+    }
+
+    // Each output has to be either wrapped into a blob or released, even if previous ones failed
+    Status status = StatusCode::OK;
+    for (int i = 0; i < outputsCount; i++) {
+        auto& tensor = outputs[i];
+        if (status.ok()) {
+            InferenceEngine::Blob::Ptr blob;
+            status = createOutputBlob(tensor, blob);
+            if (status.ok()) {
+                resultBlobs.emplace(tensor.name, std::move(blob));
+            }
+        } else if (tensor.data != nullptr) {
+            library.release(tensor.data);
+        }
+        if (tensor.dims != nullptr) {
+            library.release(tensor.dims);
+        }
+        if (tensor.name != nullptr) {
+            library.release(const_cast<char*>(tensor.name));
+        }
+    }
+    library.release(outputs);
+    return status;
+}
+
+template <typename T>
+static InferenceEngine::Blob::Ptr makeOutputBlob(const InferenceEngine::TensorDesc& desc, uint8_t* data, size_t byteSize, release_fn releaseFn) {
+    return std::make_shared<CustomNodeOutputBlob<T>>(desc, reinterpret_cast<T*>(data), byteSize / sizeof(T), releaseFn);
+}
+
+Status CustomNode::createOutputBlob(const struct CustomNodeTensor& tensor, InferenceEngine::Blob::Ptr& blob) {
+    if (tensor.name == nullptr || tensor.data == nullptr || tensor.dims == nullptr || tensor.dimsCount == 0) {
+        SPDLOG_LOGGER_ERROR(dag_executor_logger, "[Node: {}] Custom node library returned incomplete output", getName());
+        if (tensor.data != nullptr) {
+            library.release(tensor.data);
+        }
+        return StatusCode::NODE_LIBRARY_OUTPUTS_CORRUPTED;
+    }
+
+    InferenceEngine::Precision precision;
+    auto status = toInferenceEnginePrecision(tensor.precision, precision);
+    if (!status.ok()) {
+        SPDLOG_LOGGER_ERROR(dag_executor_logger, "[Node: {}] Custom node library returned output: {} with unsupported precision", getName(), tensor.name);
+        library.release(tensor.data);
+        return status;
+    }
+    InferenceEngine::SizeVector dims(tensor.dims, tensor.dims + tensor.dimsCount);
+    size_t expectedBytes = precision.size();
+    for (const auto& dim : dims) {
+        expectedBytes *= dim;
+    }
+    if (expectedBytes != tensor.dataBytes) {
+        SPDLOG_LOGGER_ERROR(dag_executor_logger, "[Node: {}] Custom node library returned output: {} with {} bytes while shape and precision require {}",
+            getName(), tensor.name, tensor.dataBytes, expectedBytes);
+        library.release(tensor.data);
+        return StatusCode::NODE_LIBRARY_OUTPUTS_CORRUPTED;
+    }
+
+    InferenceEngine::TensorDesc desc(precision, dims, InferenceEngine::TensorDesc::getLayoutByDims(dims));
+    switch (precision) {
+    case InferenceEngine::Precision::FP32:
+        blob = makeOutputBlob<float>(desc, tensor.data, tensor.dataBytes, library.release);
+        break;
+    case InferenceEngine::Precision::FP16:
+    case InferenceEngine::Precision::U16:
+        blob = makeOutputBlob<uint16_t>(desc, tensor.data, tensor.dataBytes, library.release);
+        break;
+    case InferenceEngine::Precision::U8:
+        blob = makeOutputBlob<uint8_t>(desc, tensor.data, tensor.dataBytes, library.release);
+        break;
+    case InferenceEngine::Precision::I8:
+        blob = makeOutputBlob<int8_t>(desc, tensor.data, tensor.dataBytes, library.release);
+        break;
+    case InferenceEngine::Precision::I16:
+        blob = makeOutputBlob<int16_t>(desc, tensor.data, tensor.dataBytes, library.release);
+        break;
+    case InferenceEngine::Precision::I32:
+        blob = makeOutputBlob<int32_t>(desc, tensor.data, tensor.dataBytes, library.release);
+        break;
+    default:
+        library.release(tensor.data);
+        return StatusCode::NODE_LIBRARY_INVALID_PRECISION;
+    }
+    return StatusCode::OK;
+}
+
+Status CustomNode::fetchResults(BlobMap& outputs) {
+    if (!this->executionStatus.ok()) {
+        OVMS_LOGGER_DEBUG(dag_executor_logger, "[Node: {}] Fetching results failed due to earlier execution failure", getName());
+        this->release();
+        return this->executionStatus;
+    }
+
+    // Fill outputs map with result blobs. Fetch only those that are required in following nodes.
+    for (const auto& node : this->next) {
+        for (const auto& pair : node.get().getMappingByDependency(*this)) {
+            const auto& outputName = pair.first;
+            if (outputs.count(outputName) == 1) {
+                continue;
+            }
+            const auto& realOutputName = getRealOutputName(outputName);
+            auto it = resultBlobs.find(realOutputName);
+            if (it == resultBlobs.end()) {
+                SPDLOG_LOGGER_ERROR(dag_executor_logger, "[Node: {}] Custom node library did not return output: {}", getName(), realOutputName);
+                this->release();
+                return StatusCode::NODE_LIBRARY_MISSING_OUTPUT;
+            }
+            outputs.emplace(outputName, it->second);
+            OVMS_LOGGER_DEBUG(dag_executor_logger, "[Node: {}]: Blob with name {} has been prepared", getName(), outputName);
+        }
+    }
+    this->release();
+    return StatusCode::OK;
+}
+
+Status CustomNode::toCustomNodeTensorPrecision(const InferenceEngine::Precision& precision, CustomNodeTensorPrecision& result) {
+    switch (precision) {
+    case InferenceEngine::Precision::FP32:
+        result = CUSTOM_NODE_TENSOR_PRECISION_FP32;
+        break;
+    case InferenceEngine::Precision::FP16:
+        result = CUSTOM_NODE_TENSOR_PRECISION_FP16;
+        break;
+    case InferenceEngine::Precision::U8:
+        result = CUSTOM_NODE_TENSOR_PRECISION_U8;
+        break;
+    case InferenceEngine::Precision::I8:
+        result = CUSTOM_NODE_TENSOR_PRECISION_I8;
+        break;
+    case InferenceEngine::Precision::U16:
+        result = CUSTOM_NODE_TENSOR_PRECISION_U16;
+        break;
+    case InferenceEngine::Precision::I16:
+        result = CUSTOM_NODE_TENSOR_PRECISION_I16;
+        break;
+    case InferenceEngine::Precision::I32:
+        result = CUSTOM_NODE_TENSOR_PRECISION_I32;
+        break;
+    default:
+        return StatusCode::NODE_LIBRARY_INVALID_PRECISION;
+    }
+    return StatusCode::OK;
+}
+
+Status CustomNode::toInferenceEnginePrecision(CustomNodeTensorPrecision precision, InferenceEngine::Precision& result) {
+    switch (precision) {
+    case CUSTOM_NODE_TENSOR_PRECISION_FP32:
+        result = InferenceEngine::Precision::FP32;
+        break;
+    case CUSTOM_NODE_TENSOR_PRECISION_FP16:
+        result = InferenceEngine::Precision::FP16;
+        break;
+    case CUSTOM_NODE_TENSOR_PRECISION_U8:
+        result = InferenceEngine::Precision::U8;
+        break;
+    case CUSTOM_NODE_TENSOR_PRECISION_I8:
+        result = InferenceEngine::Precision::I8;
+        break;
+    case CUSTOM_NODE_TENSOR_PRECISION_U16:
+        result = InferenceEngine::Precision::U16;
+        break;
+    case CUSTOM_NODE_TENSOR_PRECISION_I16:
+        result = InferenceEngine::Precision::I16;
+        break;
+    case CUSTOM_NODE_TENSOR_PRECISION_I32:
+        result = InferenceEngine::Precision::I32;
+        break;
+    default:
+        return StatusCode::NODE_LIBRARY_INVALID_PRECISION;
+    }
+    return StatusCode::OK;
+}
+
+}  // namespace ovms
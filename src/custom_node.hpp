@@ -0,0 +1,93 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <inference_engine.hpp>
+#include <spdlog/spdlog.h>
+
+#include "custom_node_interface.h"
+#include "node.hpp"
+#include "node_library.hpp"
+
+namespace ovms {
+
+using parameters_t = std::unordered_map<std::string, std::string>;
+
+/**
+ * @brief Blob wrapping custom node library output, data is handed back to the library on destruction
+ */
+template <typename T>
+class CustomNodeOutputBlob : public InferenceEngine::TBlob<T> {
+public:
+    CustomNodeOutputBlob(const InferenceEngine::TensorDesc& tensorDesc, T* ptr, size_t size, release_fn releaseFn) :
+        InferenceEngine::TBlob<T>(tensorDesc, ptr, size),
+        ptr(ptr),
+        releaseFn(releaseFn) {}
+
+    ~CustomNodeOutputBlob() {
+        releaseFn(ptr);
+    }
+
+private:
+    T* ptr;
+    release_fn releaseFn;
+};
+
+class CustomNode : public Node {
+    NodeLibrary library;
+    const parameters_t parameters;
+    const std::unordered_map<std::string, std::string> nodeOutputNameAlias;
+
+    std::vector<struct CustomNodeParam> libraryParameters;
+
+    Status executionStatus;
+    BlobMap resultBlobs;
+
+public:
+    CustomNode(const std::string& nodeName, const NodeLibrary& library, const parameters_t& parameters,
+        std::unordered_map<std::string, std::string> nodeOutputNameAlias = {});
+
+    /**
+     * @brief Schedules library execution on custom nodes thread pool.
+     * Node is pushed to notifyEndQueue once execution is finished.
+     */
+    Status execute(ThreadSafeQueue<std::reference_wrapper<Node>>& notifyEndQueue) override;
+
+    Status fetchResults(BlobMap& outputs) override;
+
+    void release() override {
+        SPDLOG_DEBUG("Releasing resources for node {}", getName());
+        this->resultBlobs.clear();
+    }
+
+    static Status toCustomNodeTensorPrecision(const InferenceEngine::Precision& precision, CustomNodeTensorPrecision& result);
+    static Status toInferenceEnginePrecision(CustomNodeTensorPrecision precision, InferenceEngine::Precision& result);
+
+private:
+    Status executeLibrary();
+    Status createOutputBlob(const struct CustomNodeTensor& tensor, InferenceEngine::Blob::Ptr& blob);
+
+    const std::string& getRealOutputName(const std::string& alias) const {
+        return nodeOutputNameAlias.count(alias) == 1 ? nodeOutputNameAlias.at(alias) : alias;
+    }
+};
+
+}  // namespace ovms
@@ -0,0 +1,73 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Stable C interface of custom pipeline nodes.
+ * Custom node library has to export execute and release symbols.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    CUSTOM_NODE_TENSOR_PRECISION_UNSPECIFIED,
+    CUSTOM_NODE_TENSOR_PRECISION_FP32,
+    CUSTOM_NODE_TENSOR_PRECISION_FP16,
+    CUSTOM_NODE_TENSOR_PRECISION_U8,
+    CUSTOM_NODE_TENSOR_PRECISION_I8,
+    CUSTOM_NODE_TENSOR_PRECISION_U16,
+    CUSTOM_NODE_TENSOR_PRECISION_I16,
+    CUSTOM_NODE_TENSOR_PRECISION_I32,
+} CustomNodeTensorPrecision;
+
+struct CustomNodeTensor {
+    const char* name;
+    uint8_t* data;
+    uint64_t dataBytes;
+    uint64_t* dims;
+    uint64_t dimsCount;
+    CustomNodeTensorPrecision precision;
+};
+
+struct CustomNodeParam {
+    const char* key;
+    const char* value;
+};
+
+/**
+ * @brief Executes custom node logic.
+ * Input tensors are owned by the server and valid only during the call.
+ * Outputs array, output names, data and dims buffers are allocated by the library
+ * and handed back to it through release once server does not need them anymore.
+ *
+ * @return 0 on success
+ */
+int execute(const struct CustomNodeTensor* inputs, int inputsCount, struct CustomNodeTensor** outputs, int* outputsCount, const struct CustomNodeParam* params, int paramsCount);
+
+/**
+ * @brief Releases memory allocated by the library in execute
+ *
+ * @return 0 on success
+ */
+int release(void* ptr);
+
+#ifdef __cplusplus
+}
+#endif
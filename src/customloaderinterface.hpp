@@ -15,9 +15,18 @@
 //*****************************************************************************
 #pragma once
 
+#include <cstdint>
+#include <functional>
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 namespace ovms {
 
 enum class CustomLoaderStatus {
@@ -111,6 +120,127 @@ public:
     virtual CustomLoaderStatus loaderDeInit() = 0;
 };
 
+/**
+     * @brief Model or weights data owned by custom loader, e.g. memory mapped file or decrypted pages.
+     * Model server does not copy the data and runs release callback once it is no longer used,
+     * which happens when model version is unloaded or loading fails.
+     */
+class CustomLoaderBuffer {
+public:
+    using release_fn_t = std::function<void()>;
+
+    CustomLoaderBuffer(const uint8_t* data, size_t size, release_fn_t release = release_fn_t()) :
+        bufferData(data),
+        bufferSize(size),
+        release(std::move(release)) {}
+
+    CustomLoaderBuffer(const CustomLoaderBuffer&) = delete;
+    CustomLoaderBuffer& operator=(const CustomLoaderBuffer&) = delete;
+
+    ~CustomLoaderBuffer() {
+        if (release) {
+            release();
+        }
+    }
+
+    const uint8_t* data() const {
+        return bufferData;
+    }
+
+    size_t size() const {
+        return bufferSize;
+    }
+
+    /**
+         * @brief Wraps vector without copying its content
+         */
+    static std::unique_ptr<CustomLoaderBuffer> fromVector(std::vector<uint8_t>&& content) {
+        auto owned = std::make_shared<std::vector<uint8_t>>(std::move(content));
+        return std::make_unique<CustomLoaderBuffer>(owned->data(), owned->size(), [owned]() mutable { owned.reset(); });
+    }
+
+    /**
+         * @brief Maps file read only, pages are read from disk when used and may be dropped by kernel under memory pressure
+         *
+         * @return buffer or nullptr if file cannot be mapped
+         */
+    static std::unique_ptr<CustomLoaderBuffer> mapFile(const std::string& path) {
+        int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            return nullptr;
+        }
+        struct stat fileStat;
+        if (fstat(fd, &fileStat) != 0) {
+            close(fd);
+            return nullptr;
+        }
+        const size_t size = static_cast<size_t>(fileStat.st_size);
+        if (size == 0) {
+            close(fd);
+            return std::make_unique<CustomLoaderBuffer>(nullptr, 0);
+        }
+        void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (mapped == MAP_FAILED) {
+            return nullptr;
+        }
+        return std::make_unique<CustomLoaderBuffer>(static_cast<const uint8_t*>(mapped), size, [mapped, size]() { munmap(mapped, size); });
+    }
+
+private:
+    const uint8_t* bufferData;
+    size_t bufferSize;
+    release_fn_t release;
+};
+
+/**
+     * @brief Version 2 of custom loader interface returning buffers owned by the loader instead of vectors,
+     * so that large weights are neither read nor held twice.
+     * Loader implementing it still exports createCustomLoader, model server detects the version from
+     * the type of created object, while loaders built against version 1 keep working unchanged.
+     */
+class CustomLoaderInterfaceV2 : public CustomLoaderInterface {
+public:
+    /**
+         * @brief Load the model by the custom loader
+         *
+         * @param model name required to be loaded - defined under model config in the config file
+         * @param base path where the required model files are present
+         * @param version of the model
+         * @param loader config parameters json as string
+         * @param buffer with model
+         * @param buffer with weights, may be left empty for models without weights file
+         * @return status (On success, the return value will specify the type of model (IR,ONNX,BLOB) in buffers)
+         */
+    virtual CustomLoaderStatus loadModelBuffers(const std::string& modelName,
+        const std::string& basePath,
+        const int version,
+        const std::string& loaderOptions,
+        std::unique_ptr<CustomLoaderBuffer>& modelBuffer,
+        std::unique_ptr<CustomLoaderBuffer>& weights) = 0;
+
+    /**
+         * @brief Copies buffers into vectors, used only by model server versions not aware of version 2 interface
+         */
+    CustomLoaderStatus loadModel(const std::string& modelName,
+        const std::string& basePath,
+        const int version,
+        const std::string& loaderOptions,
+        std::vector<uint8_t>& modelBuffer,
+        std::vector<uint8_t>& weights) override {
+        std::unique_ptr<CustomLoaderBuffer> modelData;
+        std::unique_ptr<CustomLoaderBuffer> weightsData;
+        auto status = loadModelBuffers(modelName, basePath, version, loaderOptions, modelData, weightsData);
+        if (modelData) {
+            modelBuffer.assign(modelData->data(), modelData->data() + modelData->size());
+        }
+        if (weightsData) {
+            weights.assign(weightsData->data(), weightsData->data() + weightsData->size());
+        }
+        return status;
+    }
+};
+
 // the types of the class factories
 typedef CustomLoaderInterface* createCustomLoader_t();
 
@@ -16,6 +16,8 @@
 
 #include "customloaders.hpp"
 
+#include <dlfcn.h>
+
 #include <spdlog/spdlog.h>
 
 #include "customloaderinterface.hpp"
@@ -23,7 +25,12 @@
 namespace ovms {
 
 Status CustomLoaders::add(std::string name, std::shared_ptr<CustomLoaderInterface> loaderInterface, void* library) {
-    auto loaderIt = newCustomLoaderInterfacePtrs.emplace(name, std::make_pair(library, loaderInterface));
+    std::shared_ptr<void> libraryPtr(library, [](void* handle) {
+        if (handle) {
+            dlclose(handle);
+        }
+    });
+    auto loaderIt = newCustomLoaderInterfacePtrs.emplace(name, std::make_pair(libraryPtr, loaderInterface));
     // if the loader already exists, print an error message
     if (!loaderIt.second) {
         SPDLOG_ERROR("The loader {} already exists in the config file", name);
@@ -56,6 +63,16 @@ std::shared_ptr<CustomLoaderInterface> CustomLoaders::find(const std::string& na
     return (loaderIt->second).second;
 }
 
+std::shared_ptr<void> CustomLoaders::findLibrary(const std::string& name) {
+    auto loaderIt = customLoaderInterfacePtrs.find(name);
+
+    if (loaderIt == customLoaderInterfacePtrs.end()) {
+        return nullptr;
+    }
+
+    return (loaderIt->second).first;
+}
+
 Status CustomLoaders::move(const std::string& name) {
     SPDLOG_INFO("Moving loder {} from old to new loaders list", name);
     auto loaderIt = customLoaderInterfacePtrs.find(name);
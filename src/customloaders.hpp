@@ -40,8 +40,12 @@ private:
          */
     CustomLoaders(const CustomLoaders&) = delete;
 
-    std::map<std::string, std::pair<void*, std::shared_ptr<CustomLoaderInterface>>> customLoaderInterfacePtrs;
-    std::map<std::string, std::pair<void*, std::shared_ptr<CustomLoaderInterface>>> newCustomLoaderInterfacePtrs;
+    /**
+         * @brief Library is closed when the last of loader entry and buffers provided by the loader is released,
+         * as the loader object and release callbacks of buffers are its code
+         */
+    std::map<std::string, std::pair<std::shared_ptr<void>, std::shared_ptr<CustomLoaderInterface>>> customLoaderInterfacePtrs;
+    std::map<std::string, std::pair<std::shared_ptr<void>, std::shared_ptr<CustomLoaderInterface>>> newCustomLoaderInterfacePtrs;
 
     std::vector<std::string> currentCustomLoaderNames;
 
@@ -75,6 +79,13 @@ public:
          */
     std::shared_ptr<CustomLoaderInterface> find(const std::string& name);
 
+    /**
+         * @brief find library of an existing customLoader referenced by it's name, holding it keeps the library open
+         * 
+         * @return library handle if found, else NULL
+         */
+    std::shared_ptr<void> findLibrary(const std::string& name);
+
     /**
          * @brief move the existing loader from serviced map to new map.
          * 
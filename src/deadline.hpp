@@ -0,0 +1,107 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <optional>
+#include <utility>
+
+#include "status.hpp"
+
+namespace ovms {
+
+/**
+ * @brief Point in time after which the client no longer waits for the response,
+ * optionally combined with a check whether the client cancelled the request.
+ * Default constructed deadline never expires.
+ */
+class Deadline {
+public:
+    using clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Cancellation is not signalled, so waiting for it is split into intervals
+     */
+    static constexpr std::chrono::milliseconds CANCELLATION_CHECK_INTERVAL{10};
+
+    Deadline() = default;
+
+    Deadline(std::optional<clock::time_point> expiry, std::function<bool()> cancelled = {}) :
+        expiry(std::move(expiry)),
+        cancelled(std::move(cancelled)) {}
+
+    static Deadline fromNow(std::chrono::milliseconds timeout) {
+        return Deadline(clock::now() + timeout);
+    }
+
+    /**
+     * @brief Converts wall clock deadline, like the one of gRPC server context, to monotonic one.
+     * Maximum time point means no deadline.
+     */
+    static Deadline fromSystemClock(std::chrono::system_clock::time_point systemExpiry, std::function<bool()> cancelled = {}) {
+        if (systemExpiry == std::chrono::system_clock::time_point::max()) {
+            return Deadline(std::nullopt, std::move(cancelled));
+        }
+        auto remaining = std::chrono::duration_cast<clock::duration>(systemExpiry - std::chrono::system_clock::now());
+        return Deadline(clock::now() + std::max(remaining, clock::duration::zero()), std::move(cancelled));
+    }
+
+    const std::optional<clock::time_point>& getExpiry() const {
+        return expiry;
+    }
+
+    bool isCancellable() const {
+        return static_cast<bool>(cancelled);
+    }
+
+    /**
+     * @brief Returns the earliest of the limit, expiry and next cancellation check.
+     * No value means waiting without limit.
+     */
+    std::optional<clock::time_point> nextCheck(std::optional<clock::time_point> limit = std::nullopt) const {
+        if (expiry && (!limit || expiry.value() < limit.value())) {
+            limit = expiry;
+        }
+        if (cancelled) {
+            auto nextCancellationCheck = clock::now() + CANCELLATION_CHECK_INTERVAL;
+            if (!limit || nextCancellationCheck < limit.value()) {
+                limit = nextCancellationCheck;
+            }
+        }
+        return limit;
+    }
+
+    /**
+     * @brief Returns DEADLINE_EXCEEDED or REQUEST_CANCELLED when the client no longer waits for the response
+     */
+    Status check() const {
+        if (cancelled && cancelled()) {
+            return StatusCode::REQUEST_CANCELLED;
+        }
+        if (expiry && clock::now() >= expiry.value()) {
+            return StatusCode::DEADLINE_EXCEEDED;
+        }
+        return StatusCode::OK;
+    }
+
+private:
+    std::optional<clock::time_point> expiry;
+    std::function<bool()> cancelled;
+};
+
+}  // namespace ovms
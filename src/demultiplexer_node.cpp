@@ -0,0 +1,104 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "demultiplexer_node.hpp"
+
+#include <optional>
+#include <sstream>
+#include <string>
+
+#include "logging.hpp"
+#include "ov_utils.hpp"
+#include "tensorinfo.hpp"
+
+namespace ovms {
+
+Status DemultiplexerNode::getPartsCount(const BlobMap& blobs, size_t maxCount, size_t& count) {
+    std::optional<size_t> partsCount;
+    for (const auto& [name, blob] : blobs) {
+        const auto& dims = blob->getTensorDesc().getDims();
+        if (dims.size() < 2 || dims[0] > maxCount || (partsCount && dims[0] != partsCount.value())) {
+            std::stringstream ss;
+            ss << "Expected: " << (partsCount ? std::to_string(partsCount.value()) : "up to " + std::to_string(maxCount))
+               << " as first of at least 2 dimensions; Actual: " << TensorInfo::shapeToString(dims) << "; blob: " << name;
+            const std::string details = ss.str();
+            OVMS_LOGGER_DEBUG(dag_executor_logger, "Cannot demultiplex blob - {}", details);
+            return Status(StatusCode::PIPELINE_WRONG_DEMULTIPLEXER_DIMENSION, details);
+        }
+        partsCount = dims[0];
+    }
+    count = partsCount.value_or(0);
+    return StatusCode::OK;
+}
+
+Status DemultiplexerNode::slice(const InferenceEngine::Blob::Ptr& blob, size_t index, InferenceEngine::Blob::Ptr& result) {
+    const auto& desc = blob->getTensorDesc();
+    const auto& dims = desc.getDims();
+    if (dims.size() < 2 || index >= dims[0]) {
+        std::stringstream ss;
+        ss << "Expected more than: " << index << " as first of at least 2 dimensions; Actual: " << TensorInfo::shapeToString(dims);
+        const std::string details = ss.str();
+        OVMS_LOGGER_DEBUG(dag_executor_logger, "Cannot demultiplex blob - {}", details);
+        return Status(StatusCode::PIPELINE_WRONG_DEMULTIPLEXER_DIMENSION, details);
+    }
+    InferenceEngine::SizeVector sliceDims(dims.begin() + 1, dims.end());
+    InferenceEngine::TensorDesc sliceDesc(desc.getPrecision(), sliceDims, InferenceEngine::TensorDesc::getLayoutByDims(sliceDims));
+    const size_t offset = index * (blob->byteSize() / dims[0]);
+    return createBlobSlice(result, sliceDesc, blob, offset);
+}
+
+Status DemultiplexerNode::execute(ThreadSafeQueue<std::reference_wrapper<Node>>& notifyEndQueue) {
+    size_t partsCount = 0;
+    this->executionStatus = getPartsCount(this->inputBlobs, this->maxCount, partsCount);
+    if (this->executionStatus.ok() && this->index >= partsCount) {
+        OVMS_LOGGER_DEBUG(dag_executor_logger, "[Node: {}] Demultiplexed outputs have only: {} parts, replica is skipped", getName(), partsCount);
+        this->skipped = true;
+        this->inputBlobs.clear();
+    }
+    notifyEndQueue.push(*this);
+    return StatusCode::OK;
+}
+
+Status DemultiplexerNode::fetchResults(BlobMap& outputs) {
+    if (!this->executionStatus.ok()) {
+        OVMS_LOGGER_DEBUG(dag_executor_logger, "[Node: {}] Demultiplexing failed: {}", getName(), this->executionStatus.string());
+        this->inputBlobs.clear();
+        return this->executionStatus;
+    }
+    for (const auto& node : this->next) {
+        for (const auto& pair : node.get().getMappingByDependency(*this)) {
+            const auto& outputName = pair.first;
+            if (outputs.count(outputName) == 1) {
+                continue;
+            }
+            auto it = this->inputBlobs.find(outputName);
+            if (it == this->inputBlobs.end()) {
+                SPDLOG_LOGGER_WARN(dag_executor_logger, "[Node: {}] Missing blob to demultiplex: {}", getName(), outputName);
+                return StatusCode::INVALID_MISSING_OUTPUT;
+            }
+            InferenceEngine::Blob::Ptr slice;
+            auto status = DemultiplexerNode::slice(it->second, this->index, slice);
+            if (!status.ok()) {
+                OVMS_LOGGER_DEBUG(dag_executor_logger, "[Node: {}] Demultiplexing blob: {} failed", getName(), outputName);
+                return status;
+            }
+            outputs.emplace(outputName, std::move(slice));
+        }
+    }
+    this->inputBlobs.clear();
+    return StatusCode::OK;
+}
+
+}  // namespace ovms
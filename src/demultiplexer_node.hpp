@@ -0,0 +1,51 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <string>
+
+#include <inference_engine.hpp>
+
+#include "node.hpp"
+
+namespace ovms {
+
+/**
+ * @brief Auxiliary node created for each demultiplexed subgraph replica.
+ * Passes index-th part (along first dimension) of its inputs to the replica, without copying.
+ * Number of parts is the first dimension of inputs, replicas with index above it are skipped.
+ */
+class DemultiplexerNode : public Node {
+    const size_t index;
+    const size_t maxCount;
+    Status executionStatus;
+
+public:
+    DemultiplexerNode(const std::string& nodeName, size_t index, size_t maxCount) :
+        Node(nodeName),
+        index(index),
+        maxCount(maxCount) {}
+
+    Status execute(ThreadSafeQueue<std::reference_wrapper<Node>>& notifyEndQueue) override;
+
+    Status fetchResults(BlobMap& outputs) override;
+
+    static Status getPartsCount(const BlobMap& blobs, size_t maxCount, size_t& count);
+
+    static Status slice(const InferenceEngine::Blob::Ptr& blob, size_t index, InferenceEngine::Blob::Ptr& result);
+};
+
+}  // namespace ovms
@@ -15,8 +15,10 @@
 //*****************************************************************************
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <string>
+#include <unordered_map>
 
 #include <inference_engine.hpp>
 #include <spdlog/spdlog.h>
@@ -27,6 +29,11 @@
 #include "tensorflow_serving/apis/prediction_service.grpc.pb.h"
 #pragma GCC diagnostic pop
 
+#include "binaryutils.hpp"
+#include "logging.hpp"
+#include "ov_utils.hpp"
+#include "precisionutils.hpp"
+#include "shared_memory.hpp"
 #include "status.hpp"
 #include "tensorinfo.hpp"
 
@@ -40,6 +47,55 @@ InferenceEngine::Blob::Ptr makeBlob(const tensorflow::TensorProto& requestInput,
         const_cast<T*>(reinterpret_cast<const T*>(requestInput.tensor_content().data())));
 }
 
+/**
+ * @brief Creates 2 byte precision blob from values padded to 4 bytes in repeated proto field
+ */
+inline InferenceEngine::Blob::Ptr makePackedBlob(const google::protobuf::RepeatedField<int32_t>& values,
+    const std::shared_ptr<TensorInfo>& tensorInfo) {
+    auto blob = InferenceEngine::make_shared_blob<uint16_t>(tensorInfo->getTensorDesc());
+    blob->allocate();
+    const size_t count = std::min(static_cast<size_t>(values.size()), blob->size());
+    convertU32ToU16(reinterpret_cast<const uint32_t*>(values.data()), blob->buffer().as<uint16_t*>(), count);
+    return blob;
+}
+
+/**
+ * @brief Creates blob of network input precision from request data of other precision.
+ * FP16 and U16 values padded to 4 bytes are packed in chunks on the stack before conversion.
+ */
+inline Status convertTensorProtoPrecision(const tensorflow::TensorProto& requestInput,
+    const std::shared_ptr<TensorInfo>& tensorInfo, InferenceEngine::Blob::Ptr& blob) {
+    auto status = createBlob(blob, tensorInfo->getTensorDesc());
+    if (!status.ok()) {
+        return status;
+    }
+    const auto sourcePrecision = TensorInfo::getPrecisionFromDataType(requestInput.dtype());
+    const auto destinationPrecision = tensorInfo->getPrecision();
+    const size_t count = blob->size();
+    auto destination = blob->buffer().as<uint8_t*>();
+    if (requestInput.dtype() == tensorflow::DataType::DT_HALF || requestInput.dtype() == tensorflow::DataType::DT_UINT16) {
+        const auto& values = requestInput.dtype() == tensorflow::DataType::DT_HALF ? requestInput.half_val() : requestInput.int_val();
+        if (static_cast<size_t>(values.size()) != count) {
+            return StatusCode::INVALID_VALUE_COUNT;
+        }
+        const size_t CHUNK_SIZE = 1024;
+        uint16_t packed[CHUNK_SIZE];
+        for (size_t offset = 0; offset < count; offset += CHUNK_SIZE) {
+            const size_t chunk = std::min(CHUNK_SIZE, count - offset);
+            convertU32ToU16(reinterpret_cast<const uint32_t*>(values.data()) + offset, packed, chunk);
+            status = convertPrecision(packed, sourcePrecision, destination + offset * destinationPrecision.size(), destinationPrecision, chunk);
+            if (!status.ok()) {
+                return status;
+            }
+        }
+        return StatusCode::OK;
+    }
+    if (requestInput.tensor_content().size() != count * sourcePrecision.size()) {
+        return StatusCode::INVALID_CONTENT_SIZE;
+    }
+    return convertPrecision(requestInput.tensor_content().data(), sourcePrecision, destination, destinationPrecision, count);
+}
+
 class ConcreteTensorProtoDeserializator {
 public:
     static InferenceEngine::Blob::Ptr deserializeTensorProto(
@@ -48,34 +104,18 @@ public:
         switch (tensorInfo->getPrecision()) {
         case InferenceEngine::Precision::FP32:
             return makeBlob<float>(requestInput, tensorInfo);
-        case InferenceEngine::Precision::FP16: {
+        case InferenceEngine::Precision::FP16:
             // Needs conversion due to zero padding for each value:
             // https://github.com/tensorflow/tensorflow/blob/v2.2.0/tensorflow/core/framework/tensor.proto#L45
-            auto blob = InferenceEngine::make_shared_blob<uint16_t>(tensorInfo->getTensorDesc());
-            blob->allocate();
-            uint16_t* ptr = blob->buffer().as<uint16_t*>();
-            auto size = static_cast<size_t>(requestInput.half_val_size());
-            for (size_t i = 0; i < size; i++) {
-                ptr[i] = requestInput.half_val(i);
-            }
-            return blob;
-        }
+            return makePackedBlob(requestInput.half_val(), tensorInfo);
         case InferenceEngine::Precision::U8:
             return makeBlob<uint8_t>(requestInput, tensorInfo);
         case InferenceEngine::Precision::I8:
             return makeBlob<int8_t>(requestInput, tensorInfo);
-        case InferenceEngine::Precision::U16: {
+        case InferenceEngine::Precision::U16:
             // Needs conversion due to zero padding for each value:
             // https://github.com/tensorflow/tensorflow/blob/v2.2.0/tensorflow/core/framework/tensor.proto#L55
-            auto blob = InferenceEngine::make_shared_blob<uint16_t>(tensorInfo->getTensorDesc());
-            blob->allocate();
-            uint16_t* ptr = blob->buffer().as<uint16_t*>();
-            auto size = static_cast<size_t>(requestInput.int_val_size());
-            for (size_t i = 0; i < size; i++) {
-                ptr[i] = requestInput.int_val(i);
-            }
-            return blob;
-        }
+            return makePackedBlob(requestInput.int_val(), tensorInfo);
         case InferenceEngine::Precision::I16:
             return makeBlob<int16_t>(requestInput, tensorInfo);
         case InferenceEngine::Precision::I32:
@@ -101,46 +141,94 @@ InferenceEngine::Blob::Ptr deserializeTensorProto(
     return TensorProtoDeserializator::deserializeTensorProto(requestInput, tensorInfo);
 }
 
-template <class TensorProtoDeserializator>
-Status deserializePredictRequest(
+/**
+ * @brief Deserializes request inputs, passing blob of each input with its network name to setBlob
+ */
+template <class TensorProtoDeserializator, class BlobSetter>
+Status deserializePredictRequestInputs(
     const tensorflow::serving::PredictRequest& request,
     const tensor_map_t& inputMap,
-    InferenceEngine::InferRequest& inferRequest) {
+    BlobSetter setBlob) {
     try {
         for (const auto& pair : inputMap) {
             const auto& name = pair.first;
             auto tensorInfo = pair.second;
             auto requestInputItr = request.inputs().find(name);
             if (requestInputItr == request.inputs().end()) {
-                SPDLOG_DEBUG("Failed to deserialize request. Validation of request failed");
+                OVMS_DEBUG("Failed to deserialize request. Validation of request failed");
                 return Status(StatusCode::INTERNAL_ERROR, "Failed to deserialize request");
             }
             auto& requestInput = requestInputItr->second;
 
-            InferenceEngine::Blob::Ptr blob =
-                deserializeTensorProto<TensorProtoDeserializator>(
+            InferenceEngine::Blob::Ptr blob;
+            if (isSharedMemoryReference(requestInput)) {
+                // Wrap client memory without copying
+                auto status = SharedMemoryManager::getInstance().createBlob(requestInput, tensorInfo, blob);
+                if (!status.ok()) {
+                    return status;
+                }
+            } else if (isBinaryInput(requestInput)) {
+                auto status = convertBinaryInputToBlob(requestInput, tensorInfo, blob);
+                if (!status.ok()) {
+                    return status;
+                }
+            } else if (tensorInfo->isPrecisionConversionAllowed() &&
+                       requestInput.dtype() != tensorInfo->getPrecisionAsDataType()) {
+                auto status = convertTensorProtoPrecision(requestInput, tensorInfo, blob);
+                if (!status.ok()) {
+                    OVMS_DEBUG("Precision conversion of input: {} failed", name);
+                    return status;
+                }
+            } else {
+                blob = deserializeTensorProto<TensorProtoDeserializator>(
                     requestInput, tensorInfo);
+            }
 
             if (blob == nullptr) {
                 Status status = StatusCode::OV_UNSUPPORTED_DESERIALIZATION_PRECISION;
-                SPDLOG_DEBUG(status.string());
+                OVMS_DEBUG(status.string());
                 return status;
             }
-            inferRequest.SetBlob(tensorInfo->getName(), blob);
+            setBlob(tensorInfo->getName(), blob);
         }
         // OV implementation the InferenceEngineException is not
         // a base class for all other exceptions thrown from OV.
         // OV can throw exceptions derived from std::logic_error.
     } catch (const InferenceEngine::details::InferenceEngineException& e) {
         Status status = StatusCode::OV_INTERNAL_DESERIALIZATION_ERROR;
-        SPDLOG_DEBUG("{}: {}", status.string(), e.what());
+        OVMS_DEBUG("{}: {}", status.string(), e.what());
         return status;
     } catch (std::logic_error& e) {
         Status status = StatusCode::OV_INTERNAL_DESERIALIZATION_ERROR;
-        SPDLOG_DEBUG("{}: {}", status.string(), e.what());
+        OVMS_DEBUG("{}: {}", status.string(), e.what());
         return status;
     }
 
     return StatusCode::OK;
 }
+
+template <class TensorProtoDeserializator>
+Status deserializePredictRequest(
+    const tensorflow::serving::PredictRequest& request,
+    const tensor_map_t& inputMap,
+    InferenceEngine::InferRequest& inferRequest) {
+    return deserializePredictRequestInputs<TensorProtoDeserializator>(request, inputMap,
+        [&inferRequest](const std::string& name, const InferenceEngine::Blob::Ptr& blob) {
+            inferRequest.SetBlob(name, blob);
+        });
+}
+
+/**
+ * @brief Deserializes request inputs into blobs keyed with network input names, without setting them in infer request
+ */
+template <class TensorProtoDeserializator>
+Status deserializePredictRequest(
+    const tensorflow::serving::PredictRequest& request,
+    const tensor_map_t& inputMap,
+    std::unordered_map<std::string, InferenceEngine::Blob::Ptr>& blobs) {
+    return deserializePredictRequestInputs<TensorProtoDeserializator>(request, inputMap,
+        [&blobs](const std::string& name, const InferenceEngine::Blob::Ptr& blob) {
+            blobs[name] = blob;
+        });
+}
 }  // namespace ovms
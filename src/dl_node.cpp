@@ -21,6 +21,7 @@
 #include <inference_engine.hpp>
 #include <spdlog/spdlog.h>
 
+#include "logging.hpp"
 #include "modelmanager.hpp"
 #include "ov_utils.hpp"
 #include "ovinferrequestsqueue.hpp"
@@ -41,7 +42,7 @@ Status DLNode::execute(ThreadSafeQueue<std::reference_wrapper<Node>>& notifyEndQ
     }
     auto streamId = this->nodeStreamIdGuard->tryGetId(WAIT_FOR_STREAM_ID_TIMEOUT_MICROSECONDS);
     if (!streamId) {
-        SPDLOG_DEBUG("[Node: {}] Could not acquire stream Id right away", getName());
+        OVMS_DEBUG("[Node: {}] Could not acquire stream Id right away", getName());
         return StatusCode::PIPELINE_STREAM_ID_NOT_READY_YET;
     }
     auto& inferRequestsQueue = this->model->getInferRequestsQueue();
@@ -69,7 +70,7 @@ Status DLNode::requestExecuteRequiredResources() {
         this->modelUnloadGuard);
 
     if (!status.ok()) {
-        SPDLOG_DEBUG("Getting modelInstance failed for node: {} with: {}", getName(), status.string());
+        OVMS_DEBUG("Getting modelInstance failed for node: {} with: {}", getName(), status.string());
         return status;
     }
 
@@ -99,39 +100,39 @@ Status DLNode::setInputsForInference(InferenceEngine::InferRequest& infer_reques
         // OV can throw exceptions derived from std::logic_error.
     } catch (const InferenceEngine::details::InferenceEngineException& e) {
         status = StatusCode::OV_INTERNAL_DESERIALIZATION_ERROR;
-        SPDLOG_DEBUG("[Node: {}] {}; exception message: {}", getName(), status.string(), e.what());
+        OVMS_DEBUG("[Node: {}] {}; exception message: {}", getName(), status.string(), e.what());
     } catch (std::logic_error& e) {
         status = StatusCode::OV_INTERNAL_DESERIALIZATION_ERROR;
-        SPDLOG_DEBUG("[Node: {}] {}; exception message: {}", getName(), status.string(), e.what());
+        OVMS_DEBUG("[Node: {}] {}; exception message: {}", getName(), status.string(), e.what());
     } catch (...) {
         status = StatusCode::OV_INTERNAL_DESERIALIZATION_ERROR;
-        SPDLOG_DEBUG("[Node: {}] {}; with unknown exception", getName(), status.string());
+        OVMS_DEBUG("[Node: {}] {}; with unknown exception", getName(), status.string());
     }
     return status;
 }
 
 Status DLNode::executeInference(ThreadSafeQueue<std::reference_wrapper<Node>>& notifyEndQueue, InferenceEngine::InferRequest& infer_request) {
     try {
-        SPDLOG_DEBUG("Setting completion callback for node name: {}", this->getName());
+        OVMS_DEBUG("Setting completion callback for node name: {}", this->getName());
         infer_request.SetCompletionCallback([this, &notifyEndQueue, &infer_request]() {
-            SPDLOG_DEBUG("Completion callback received for node name: {}", this->getName());
+            OVMS_DEBUG("Completion callback received for node name: {}", this->getName());
             // After inference is completed, input blobs are not needed anymore
             this->inputBlobs.clear();
             notifyEndQueue.push(*this);
             infer_request.SetCompletionCallback([]() {});  // reset callback on infer request
         });
-        SPDLOG_DEBUG("Starting infer async for node name: {}", getName());
+        OVMS_DEBUG("Starting infer async for node name: {}", getName());
         infer_request.StartAsync();
     } catch (const InferenceEngine::details::InferenceEngineException& e) {
-        SPDLOG_DEBUG("[Node: {}] Exception occured when starting async inference or setting completion callback on model: {}, error: {}",
+        OVMS_DEBUG("[Node: {}] Exception occured when starting async inference or setting completion callback on model: {}, error: {}",
             getName(), modelName, e.what());
         return StatusCode::OV_INTERNAL_INFERENCE_ERROR;
     } catch (const std::exception& e) {
-        SPDLOG_DEBUG("[Node: {}] Exception occured when starting async inference or setting completion callback on  model: {}, error: {}",
+        OVMS_DEBUG("[Node: {}] Exception occured when starting async inference or setting completion callback on  model: {}, error: {}",
             getName(), modelName, e.what());
         return StatusCode::OV_INTERNAL_INFERENCE_ERROR;
     } catch (...) {
-        SPDLOG_DEBUG("[Node: {}] Unknown exception occured when starting async inference or setting completion callback on model: {}",
+        OVMS_DEBUG("[Node: {}] Unknown exception occured when starting async inference or setting completion callback on model: {}",
             getName(), modelName);
         return StatusCode::OV_INTERNAL_INFERENCE_ERROR;
     }
@@ -141,25 +142,25 @@ Status DLNode::executeInference(ThreadSafeQueue<std::reference_wrapper<Node>>& n
 Status DLNode::fetchResults(BlobMap& outputs) {
     // ::execute needs to be executed before ::fetchResults
     if (this->model == nullptr) {
-        SPDLOG_DEBUG("[Node: {}] Fetching results failed due to earlier execution failure", getName());
+        OVMS_DEBUG("[Node: {}] Fetching results failed due to earlier execution failure", getName());
         return StatusCode::UNKNOWN_ERROR;
     }
 
     // Get infer request corresponding to this node model
     auto streamId = this->nodeStreamIdGuard->tryGetId();
     if (!streamId) {
-        SPDLOG_DEBUG("[Node: {}] Fetching results failed - node had stream Id never assigned", getName());
+        OVMS_DEBUG("[Node: {}] Fetching results failed - node had stream Id never assigned", getName());
         return StatusCode::UNKNOWN_ERROR;
     }
     auto& infer_request = this->model->getInferRequestsQueue().getInferRequest(streamId.value());
     // Wait for blob results
-    SPDLOG_DEBUG("[Node: {}] Waiting for infer request with streamId: {} to finish", getName(), streamId.value());
+    OVMS_DEBUG("[Node: {}] Waiting for infer request with streamId: {} to finish", getName(), streamId.value());
     auto ov_status = infer_request.Wait(InferenceEngine::IInferRequest::RESULT_READY);
-    SPDLOG_DEBUG("[Node: {}] Infer request with streamId: {} finished", getName(), streamId.value());
+    OVMS_DEBUG("[Node: {}] Infer request with streamId: {} finished", getName(), streamId.value());
     this->inputBlobs.clear();
     if (ov_status != InferenceEngine::StatusCode::OK) {
         Status status = StatusCode::OV_INTERNAL_INFERENCE_ERROR;
-        SPDLOG_DEBUG("[Node: {}] Async infer failed: {}; OV StatusCode: {}", getName(), status.string(), ov_status);
+        OVMS_DEBUG("[Node: {}] Async infer failed: {}; OV StatusCode: {}", getName(), status.string(), ov_status);
         return status;
     }
 
@@ -177,15 +178,15 @@ Status DLNode::fetchResults(BlobMap& outputs) {
                     SPDLOG_WARN("[Node: {}] Cannot find real model output name for alias{}", getName(), output_name);
                     return StatusCode::INTERNAL_ERROR;
                 }
-                SPDLOG_DEBUG("[Node: {}] Getting blob from model: {}, inferRequestStreamId: {}, blobName: {}",
+                OVMS_DEBUG("[Node: {}] Getting blob from model: {}, inferRequestStreamId: {}, blobName: {}",
                     getName(), modelName, streamId.value(), realModelOutputName);
                 const auto blob = infer_request.GetBlob(realModelOutputName);
-                SPDLOG_DEBUG("[Node: {}] Creating copy of blob from model: {}, inferRequestStreamId: {}, blobName: {}",
+                OVMS_DEBUG("[Node: {}] Creating copy of blob from model: {}, inferRequestStreamId: {}, blobName: {}",
                     getName(), modelName, streamId.value(), realModelOutputName);
                 InferenceEngine::Blob::Ptr copiedBlob;
                 auto status = blobClone(copiedBlob, blob);
                 if (!status.ok()) {
-                    SPDLOG_DEBUG("Could not clone result blob; node name: {}; model name: {}; output: {}",
+                    OVMS_DEBUG("Could not clone result blob; node name: {}; model name: {}; output: {}",
                         getName(),
                         this->modelName,
                         realModelOutputName);
@@ -194,10 +195,10 @@ Status DLNode::fetchResults(BlobMap& outputs) {
                 outputs.emplace(std::make_pair(output_name, std::move(copiedBlob)));
             } catch (const InferenceEngine::details::InferenceEngineException& e) {
                 Status status = StatusCode::OV_INTERNAL_SERIALIZATION_ERROR;
-                SPDLOG_DEBUG("[Node: {}] Error during getting blob {}; exception message: {}", getName(), status.string(), e.what());
+                OVMS_DEBUG("[Node: {}] Error during getting blob {}; exception message: {}", getName(), status.string(), e.what());
                 return status;
             }
-            SPDLOG_DEBUG("[Node: {}]: Blob with name {} has been prepared", getName(), output_name);
+            OVMS_DEBUG("[Node: {}]: Blob with name {} has been prepared", getName(), output_name);
         }
     }
     // After results are fetched, model and inference request are not needed anymore
@@ -211,7 +212,7 @@ Status DLNode::validate(const InferenceEngine::Blob::Ptr& blob, const TensorInfo
         ss << "Expected: " << info.getPrecisionAsString()
            << "; Actual: " << TensorInfo::getPrecisionAsString(blob->getTensorDesc().getPrecision());
         const std::string details = ss.str();
-        SPDLOG_DEBUG("[Node: {}] Invalid precision - {}", getName(), details);
+        OVMS_DEBUG("[Node: {}] Invalid precision - {}", getName(), details);
         return Status(StatusCode::INVALID_PRECISION, details);
     }
 
@@ -222,14 +223,14 @@ Status DLNode::validate(const InferenceEngine::Blob::Ptr& blob, const TensorInfo
         if (std::equal(info.getShape().begin() + 1, info.getShape().end(), blob->getTensorDesc().getDims().begin() + 1)) {
             ss << "Expected: " << info.getShape()[0] << "; Actual: " << blob->getTensorDesc().getDims()[0];
             const std::string details = ss.str();
-            SPDLOG_DEBUG("[Node: {}] Invalid batch size - {}", getName(), details);
+            OVMS_DEBUG("[Node: {}] Invalid batch size - {}", getName(), details);
             return Status(StatusCode::INVALID_BATCH_SIZE, details);
         } else {
             // Otherwise whole shape is incorrect
             ss << "Expected: " << TensorInfo::shapeToString(info.getShape())
                << "; Actual: " << TensorInfo::shapeToString(blob->getTensorDesc().getDims());
             const std::string details = ss.str();
-            SPDLOG_DEBUG("Node: {}] Invalid shape - {}", getName(), details);
+            OVMS_DEBUG("Node: {}] Invalid shape - {}", getName(), details);
             return Status(StatusCode::INVALID_SHAPE, details);
         }
     }
@@ -239,7 +240,7 @@ Status DLNode::validate(const InferenceEngine::Blob::Ptr& blob, const TensorInfo
         ss << "Expected: " << TensorInfo::shapeToString(info.getShape())
            << "; Actual: " << TensorInfo::shapeToString(blob->getTensorDesc().getDims());
         const std::string details = ss.str();
-        SPDLOG_DEBUG("Node: {}] Invalid shape - {}", getName(), details);
+        OVMS_DEBUG("Node: {}] Invalid shape - {}", getName(), details);
         return Status(StatusCode::INVALID_SHAPE, details);
     }
 
@@ -252,7 +253,7 @@ Status DLNode::prepareInputsAndModelForInference() {
 
     // Validate each blob against its OV tensor info
     const auto& inputsInfo = this->model->getInputsInfo();
-    for (const auto& kv : this->inputBlobs) {
+    for (auto& kv : this->inputBlobs) {
         const auto& name = kv.first;
         auto& blob = kv.second;
 
@@ -260,16 +261,32 @@ Status DLNode::prepareInputsAndModelForInference() {
             std::stringstream ss;
             ss << "Required input: " << name;
             const std::string details = ss.str();
-            SPDLOG_DEBUG("[Node: {}] Missing input with specific name - {}", getName(), details);
+            OVMS_DEBUG("[Node: {}] Missing input with specific name - {}", getName(), details);
             return Status(StatusCode::INVALID_MISSING_INPUT, details);
         }
         auto& inputInfo = *inputsInfo.at(name);
+
+        // Convert data of other precision if enabled for the input
+        const auto blobPrecision = blob->getTensorDesc().getPrecision();
+        if (inputInfo.isPrecisionConversionAllowed() &&
+            inputInfo.getPrecision() != blobPrecision &&
+            isPrecisionConversionSupported(blobPrecision, inputInfo.getPrecision())) {
+            OVMS_DEBUG("[Node: {}] Converting input: {} from: {} to: {}", getName(), name,
+                TensorInfo::getPrecisionAsString(blobPrecision), inputInfo.getPrecisionAsString());
+            InferenceEngine::Blob::Ptr convertedBlob;
+            auto status = convertBlobPrecision(convertedBlob, blob, inputInfo.getPrecision());
+            if (!status.ok()) {
+                return status;
+            }
+            blob = std::move(convertedBlob);
+        }
+
         auto status = validate(blob, inputInfo);
         if (status.ok()) {
             continue;
         }
 
-        // If precision is incorrect, perform conversion
+        // Precision mismatch without enabled or supported conversion
         if (status == StatusCode::INVALID_PRECISION) {
             return status;
         }
@@ -26,6 +26,10 @@
 #include "tensorflow/core/framework/tensor.h"
 #pragma GCC diagnostic pop
 
+#include "binaryutils.hpp"
+#include "logging.hpp"
+#include "precisionutils.hpp"
+
 namespace ovms {
 
 Status EntryNode::fetchResults(BlobMap& outputs) {
@@ -41,41 +45,85 @@ Status EntryNode::fetchResults(BlobMap& outputs) {
                 std::stringstream ss;
                 ss << "Required input: " << output_name;
                 const std::string details = ss.str();
-                SPDLOG_DEBUG("[Node: {}] Missing input with specific name", getName(), details);
+                OVMS_DEBUG("[Node: {}] Missing input with specific name", getName(), details);
                 return Status(StatusCode::INVALID_MISSING_INPUT, details);
             }
             const auto& tensor_proto = request->inputs().at(output_name);
             InferenceEngine::Blob::Ptr blob;
-            SPDLOG_DEBUG("[Node: {}] Deserializing input: {}", getName(), output_name);
-            auto status = deserialize(tensor_proto, blob);
+            OVMS_DEBUG("[Node: {}] Deserializing input: {}", getName(), output_name);
+            auto status = isBinaryInput(tensor_proto) ? deserializeBinaryInput(output_name, tensor_proto, blob) : deserialize(tensor_proto, blob);
             if (!status.ok()) {
                 return status;
             }
 
             outputs[output_name] = blob;
 
-            SPDLOG_DEBUG("[Node: {}]: blob with name {} has been prepared", getName(), output_name);
+            OVMS_DEBUG("[Node: {}]: blob with name {} has been prepared", getName(), output_name);
         }
     }
 
     return StatusCode::OK;
 }
 
+Status EntryNode::deserializeBinaryInput(const std::string& name, const tensorflow::TensorProto& proto, InferenceEngine::Blob::Ptr& blob) {
+    if (!inputsInfo) {
+        SPDLOG_DEBUG("[Node: {}] Missing metadata of binary input: {}", getName(), name);
+        return StatusCode::BINARY_INPUT_NOT_IMAGE;
+    }
+    auto it = inputsInfo->find(name);
+    if (it == inputsInfo->end()) {
+        OVMS_DEBUG("[Node: {}] Missing metadata of binary input: {}", getName(), name);
+        return StatusCode::BINARY_INPUT_NOT_IMAGE;
+    }
+    return convertBinaryInputToBlob(proto, it->second, blob);
+}
+
+Status EntryNode::deserializePaddedValues(const tensorflow::TensorProto& proto, const InferenceEngine::SizeVector& shape, InferenceEngine::Blob::Ptr& blob) {
+    const auto& values = proto.dtype() == tensorflow::DataType::DT_HALF ? proto.half_val() : proto.int_val();
+    size_t tensor_count = std::accumulate(shape.begin(), shape.end(), 1, std::multiplies<size_t>());
+    if (static_cast<size_t>(values.size()) != tensor_count) {
+        std::stringstream ss;
+        ss << "Expected: " << tensor_count << "; Actual: " << values.size();
+        const std::string details = ss.str();
+        OVMS_DEBUG("[Node {}] Invalid number of values in tensor proto - {}", getName(), details);
+        return Status(StatusCode::INVALID_VALUE_COUNT, details);
+    }
+    auto precision = proto.dtype() == tensorflow::DataType::DT_HALF ? InferenceEngine::Precision::FP16 : InferenceEngine::Precision::U16;
+    InferenceEngine::TensorDesc description(precision, shape, InferenceEngine::TensorDesc::getLayoutByDims(shape));
+    try {
+        blob = InferenceEngine::make_shared_blob<uint16_t>(description);
+        blob->allocate();
+    } catch (const InferenceEngine::details::InferenceEngineException& e) {
+        Status status = StatusCode::OV_INTERNAL_DESERIALIZATION_ERROR;
+        OVMS_DEBUG("[Node: {}] Exception thrown during deserialization from make_shared_blob; {}; exception message: {}",
+            getName(), status.string(), e.what());
+        return status;
+    }
+    convertU32ToU16(reinterpret_cast<const uint32_t*>(values.data()), blob->buffer().as<uint16_t*>(), tensor_count);
+    return StatusCode::OK;
+}
+
 Status EntryNode::deserialize(const tensorflow::TensorProto& proto, InferenceEngine::Blob::Ptr& blob) {
     InferenceEngine::TensorDesc description;
+
+    InferenceEngine::SizeVector shape;
+    for (int i = 0; i < proto.tensor_shape().dim_size(); i++) {
+        shape.emplace_back(proto.tensor_shape().dim(i).size());
+    }
+
     if (proto.tensor_content().size() == 0) {
+        // FP16 and U16 data may be sent as values padded to 4 bytes
+        if ((proto.dtype() == tensorflow::DataType::DT_HALF && proto.half_val_size() > 0) ||
+            (proto.dtype() == tensorflow::DataType::DT_UINT16 && proto.int_val_size() > 0)) {
+            return deserializePaddedValues(proto, shape, blob);
+        }
         const std::string details = "Tensor content size can't be 0";
-        SPDLOG_DEBUG("[Node: {}] {}", getName(), details);
+        OVMS_DEBUG("[Node: {}] {}", getName(), details);
         return Status(StatusCode::INVALID_CONTENT_SIZE, details);
     }
 
     // Assuming content is in proto.tensor_content
 
-    InferenceEngine::SizeVector shape;
-    for (int i = 0; i < proto.tensor_shape().dim_size(); i++) {
-        shape.emplace_back(proto.tensor_shape().dim(i).size());
-    }
-
     description.setDims(shape);
 
     size_t tensor_count = std::accumulate(shape.begin(), shape.end(), 1, std::multiplies<size_t>());
@@ -84,7 +132,7 @@ Status EntryNode::deserialize(const tensorflow::TensorProto& proto, InferenceEng
         std::stringstream ss;
         ss << "Expected: " << tensor_count * tensorflow::DataTypeSize(proto.dtype()) << "; Actual: " << proto.tensor_content().size();
         const std::string details = ss.str();
-        SPDLOG_DEBUG("[Node {}] Invalid size of tensor proto - {}", getName(), details);
+        OVMS_DEBUG("[Node {}] Invalid size of tensor proto - {}", getName(), details);
         return Status(StatusCode::INVALID_CONTENT_SIZE, details);
     }
 
@@ -112,24 +160,30 @@ Status EntryNode::deserialize(const tensorflow::TensorProto& proto, InferenceEng
             blob = InferenceEngine::make_shared_blob<int32_t>(description, (int32_t*)proto.tensor_content().data());
             break;
         case tensorflow::DataType::DT_HALF:
+            description.setPrecision(InferenceEngine::Precision::FP16);
+            blob = InferenceEngine::make_shared_blob<uint16_t>(description, (uint16_t*)proto.tensor_content().data());
+            break;
         case tensorflow::DataType::DT_UINT16:
+            description.setPrecision(InferenceEngine::Precision::U16);
+            blob = InferenceEngine::make_shared_blob<uint16_t>(description, (uint16_t*)proto.tensor_content().data());
+            break;
         case tensorflow::DataType::DT_INT64:
         default: {
             std::stringstream ss;
             ss << "Actual: " << TensorInfo::getDataTypeAsString(proto.dtype());
             const std::string details = ss.str();
-            SPDLOG_DEBUG("[Node: {}] Unsupported deserialization precision - {}", getName(), details);
+            OVMS_DEBUG("[Node: {}] Unsupported deserialization precision - {}", getName(), details);
             return Status(StatusCode::OV_UNSUPPORTED_DESERIALIZATION_PRECISION, details);
         }
         }
     } catch (const InferenceEngine::details::InferenceEngineException& e) {
         Status status = StatusCode::OV_INTERNAL_DESERIALIZATION_ERROR;
-        SPDLOG_DEBUG("[Node: {}] Exception thrown during deserialization from make_shared_blob; {}; exception message: {}",
+        OVMS_DEBUG("[Node: {}] Exception thrown during deserialization from make_shared_blob; {}; exception message: {}",
             getName(), status.string(), e.what());
         return status;
     } catch (std::logic_error& e) {
         Status status = StatusCode::OV_INTERNAL_DESERIALIZATION_ERROR;
-        SPDLOG_DEBUG("[Node: {}] Exception thrown during deserialization from make_shared_blob; {}; exception message: {}",
+        OVMS_DEBUG("[Node: {}] Exception thrown during deserialization from make_shared_blob; {}; exception message: {}",
             getName(), status.string(), e.what());
         return status;
     }
@@ -14,7 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 #pragma once
+#include <memory>
 #include <string>
+#include <utility>
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wall"
@@ -31,10 +33,14 @@ const std::string ENTRY_NODE_NAME = "request";
 class EntryNode : public Node {
     const tensorflow::serving::PredictRequest* request;
 
+    // Metadata of inputs shared with pipeline definition, required only to decode binary inputs
+    const std::shared_ptr<const tensor_map_t> inputsInfo;
+
 public:
-    EntryNode(const tensorflow::serving::PredictRequest* request) :
+    EntryNode(const tensorflow::serving::PredictRequest* request, std::shared_ptr<const tensor_map_t> inputsInfo = nullptr) :
         Node(ENTRY_NODE_NAME),
-        request(request) {}
+        request(request),
+        inputsInfo(std::move(inputsInfo)) {}
 
     Status execute(ThreadSafeQueue<std::reference_wrapper<Node>>& notifyEndQueue) override {
         notifyEndQueue.push(*this);
@@ -50,6 +56,12 @@ public:
 
     // Deserialize proto to blob
     Status deserialize(const tensorflow::TensorProto& proto, InferenceEngine::Blob::Ptr& blob);
+
+    // Pack FP16 and U16 values sent in half_val and int_val fields
+    Status deserializePaddedValues(const tensorflow::TensorProto& proto, const InferenceEngine::SizeVector& shape, InferenceEngine::Blob::Ptr& blob);
+
+    // Decode images according to metadata of the input
+    Status deserializeBinaryInput(const std::string& name, const tensorflow::TensorProto& proto, InferenceEngine::Blob::Ptr& blob);
 };
 
 }  // namespace ovms
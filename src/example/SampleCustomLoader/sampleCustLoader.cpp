@@ -34,6 +34,7 @@
 #include <fstream>
 #include <iostream>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
@@ -68,15 +69,15 @@ typedef std::pair<std::string, int> model_id_t;
  * usage of various APIs defined in base class, parse loader specific
  * parameters from the config file. 
  *
- * It reads the model files and returns the buffers to be loaded by the 
- * model server.  
+ * It maps the model files into memory and returns the buffers to be loaded
+ * by the model server without copying.
  *
  * Also, based on the contents on <model>.status file, it black lists the model
  * or removes the model from blacklisting. During the periodic check on model 
  * loader will unload/reload model based on blacklist.
  */
 
-class custSampleLoader : public CustomLoaderInterface {
+class custSampleLoader : public CustomLoaderInterfaceV2 {
 private:
     std::vector<model_id_t> models_loaded;
     std::map<model_id_t, std::string> models_watched;
@@ -89,7 +90,7 @@ protected:
         std::string& binFile, std::string& modelFile, std::string& enableFile, int& modelType);
 
     int load_files(std::string& binFile, std::string& modelFile, int modelType,
-        std::vector<uint8_t>& model, std::vector<uint8_t>& weghts);
+        std::unique_ptr<CustomLoaderBuffer>& model, std::unique_ptr<CustomLoaderBuffer>& weights);
 
     // Variables needed to manage the periodic thread.
     std::mutex cv_m;
@@ -106,8 +107,8 @@ public:
     CustomLoaderStatus loaderInit(const std::string& loader_path);
     CustomLoaderStatus loaderDeInit();
     CustomLoaderStatus unloadModel(const std::string& modelName, const int version);
-    CustomLoaderStatus loadModel(const std::string& modelName, const std::string& basePath, const int version,
-        const std::string& loaderOptions, std::vector<uint8_t>& model, std::vector<uint8_t>& weights);
+    CustomLoaderStatus loadModelBuffers(const std::string& modelName, const std::string& basePath, const int version,
+        const std::string& loaderOptions, std::unique_ptr<CustomLoaderBuffer>& model, std::unique_ptr<CustomLoaderBuffer>& weights);
     CustomLoaderStatus getModelBlacklistStatus(const std::string& modelName, const int version);
     CustomLoaderStatus retireModel(const std::string& modelName);
 
@@ -140,32 +141,22 @@ CustomLoaderStatus custSampleLoader::loaderInit(const std::string& loader_path)
     return CustomLoaderStatus::OK;
 }
 
-// Helper function to load the binary files
+// Helper function to map the binary files
 int custSampleLoader::load_files(std::string& binFile, std::string& modelFile, int modelType,
-    std::vector<uint8_t>& model, std::vector<uint8_t>& weights) {
-
-    std::streampos size;
+    std::unique_ptr<CustomLoaderBuffer>& model, std::unique_ptr<CustomLoaderBuffer>& weights) {
 
     // if the model is a onnx or blob type, the bin file will not be present.
-    // skip parsing the bin file and return empty weights
+    // skip mapping the bin file and return empty weights
     if (modelType == SAMPLE_LOADER_IR_MODEL) {
-        std::ifstream bfile(binFile, std::ios::in | std::ios::binary);
-        if (bfile.is_open()) {
-            weights.clear();
-            std::for_each(std::istreambuf_iterator<char>(bfile), std::istreambuf_iterator<char>(),
-                [&weights](const char c) { weights.push_back(c); });
-        } else {
+        weights = CustomLoaderBuffer::mapFile(binFile);
+        if (!weights) {
             std::cout << "Unable to open bin file: " << binFile << std::endl;
             return SAMPLE_LOADER_ERROR;
         }
     }
 
-    std::ifstream xfile(modelFile, std::ios::in | std::ios::binary);
-    if (xfile.is_open()) {
-        model.clear();
-        std::for_each(std::istreambuf_iterator<char>(xfile), std::istreambuf_iterator<char>(),
-            [&model](const char c) { model.push_back(c); });
-    } else {
+    model = CustomLoaderBuffer::mapFile(modelFile);
+    if (!model) {
         std::cout << "Unable to open model file: " << modelFile << std::endl;
         return SAMPLE_LOADER_ERROR;
     }
@@ -312,8 +303,8 @@ void custSampleLoader::watcherJoin() {
  * From the custom loader options extract the model file name and other needed information and
  * load the model and optional bin file into buffers and return
  */
-CustomLoaderStatus custSampleLoader::loadModel(const std::string& modelName, const std::string& basePath, const int version,
-    const std::string& loaderOptions, std::vector<uint8_t>& model, std::vector<uint8_t>& weights) {
+CustomLoaderStatus custSampleLoader::loadModelBuffers(const std::string& modelName, const std::string& basePath, const int version,
+    const std::string& loaderOptions, std::unique_ptr<CustomLoaderBuffer>& model, std::unique_ptr<CustomLoaderBuffer>& weights) {
     std::cout << "custSampleLoader: Custom loadModel loading model: " << modelName << std::endl;
 
     std::string binFile;
@@ -0,0 +1,83 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "../../custom_node_interface.h"
+
+/*
+ * Example custom node adding add_value and subtracting sub_value parameters
+ * from each element of FP32 input tensor "input_numbers".
+ * Result is returned as FP32 tensor "output_numbers" of the same shape.
+ */
+
+static const char* INPUT_NAME = "input_numbers";
+static const char* OUTPUT_NAME = "output_numbers";
+
+static float getParam(const struct CustomNodeParam* params, int paramsCount, const char* key, float defaultValue) {
+    for (int i = 0; i < paramsCount; i++) {
+        if (std::strcmp(params[i].key, key) == 0) {
+            return std::stof(params[i].value);
+        }
+    }
+    return defaultValue;
+}
+
+int execute(const struct CustomNodeTensor* inputs, int inputsCount, struct CustomNodeTensor** outputs, int* outputsCount, const struct CustomNodeParam* params, int paramsCount) {
+    const struct CustomNodeTensor* input = nullptr;
+    for (int i = 0; i < inputsCount; i++) {
+        if (std::strcmp(inputs[i].name, INPUT_NAME) == 0) {
+            input = &inputs[i];
+        }
+    }
+    if (input == nullptr || input->precision != CUSTOM_NODE_TENSOR_PRECISION_FP32) {
+        return 1;
+    }
+
+    float addValue = 0.0f;
+    float subValue = 0.0f;
+    try {
+        addValue = getParam(params, paramsCount, "add_value", 0.0f);
+        subValue = getParam(params, paramsCount, "sub_value", 0.0f);
+    } catch (...) {
+        return 2;
+    }
+
+    struct CustomNodeTensor* output = static_cast<struct CustomNodeTensor*>(std::malloc(sizeof(struct CustomNodeTensor)));
+    output->name = strdup(OUTPUT_NAME);
+    output->data = static_cast<uint8_t*>(std::malloc(input->dataBytes));
+    output->dataBytes = input->dataBytes;
+    output->dims = static_cast<uint64_t*>(std::malloc(input->dimsCount * sizeof(uint64_t)));
+    output->dimsCount = input->dimsCount;
+    output->precision = CUSTOM_NODE_TENSOR_PRECISION_FP32;
+    std::memcpy(output->dims, input->dims, input->dimsCount * sizeof(uint64_t));
+
+    const float* inputData = reinterpret_cast<const float*>(input->data);
+    float* outputData = reinterpret_cast<float*>(output->data);
+    for (uint64_t i = 0; i < input->dataBytes / sizeof(float); i++) {
+        outputData[i] = inputData[i] + addValue - subValue;
+    }
+
+    *outputs = output;
+    *outputsCount = 1;
+    return 0;
+}
+
+int release(void* ptr) {
+    std::free(ptr);
+    return 0;
+}
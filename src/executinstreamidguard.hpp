@@ -19,16 +19,24 @@
 
 namespace ovms {
 struct ExecutingStreamIdGuard {
-    ExecutingStreamIdGuard(ovms::OVInferRequestsQueue& inferRequestsQueue) :
+    ExecutingStreamIdGuard(ovms::OVInferRequestsQueue& inferRequestsQueue, const Deadline& deadline = Deadline()) :
         inferRequestsQueue_(inferRequestsQueue),
-        id_(inferRequestsQueue_.getIdleStream().get()) {}
+        status_(inferRequestsQueue_.acquireIdleStream(id_, deadline)) {}
     ~ExecutingStreamIdGuard() {
-        inferRequestsQueue_.returnStream(id_);
+        if (status_.ok()) {
+            inferRequestsQueue_.returnStream(id_);
+        }
     }
     int getId() { return id_; }
 
+    /**
+     * @brief Not OK when request was rejected by admission control or its deadline and no stream is held
+     */
+    const Status& getStatus() const { return status_; }
+
 private:
     ovms::OVInferRequestsQueue& inferRequestsQueue_;
-    const int id_;
+    int id_ = -1;
+    const Status status_;
 };
 }  //  namespace ovms
@@ -0,0 +1,75 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "execution_condition.hpp"
+
+#include <algorithm>
+
+#include "logging.hpp"
+
+namespace ovms {
+
+Status toConditionPredicate(const std::string& str, ConditionPredicate& predicate) {
+    if (str == NOT_EMPTY_PREDICATE_CONFIG_NAME) {
+        predicate = ConditionPredicate::NOT_EMPTY;
+        return StatusCode::OK;
+    }
+    if (str == ANY_GREATER_PREDICATE_CONFIG_NAME) {
+        predicate = ConditionPredicate::ANY_GREATER;
+        return StatusCode::OK;
+    }
+    SPDLOG_LOGGER_ERROR(modelmanager_logger, "Unsupported condition predicate: {}", str);
+    return StatusCode::PIPELINE_CONDITION_WRONG_PREDICATE;
+}
+
+template <typename T>
+static bool anyGreater(const InferenceEngine::Blob::Ptr& blob, float threshold) {
+    const T* data = blob->cbuffer().as<const T*>();
+    return std::any_of(data, data + blob->size(), [threshold](T value) { return static_cast<float>(value) > threshold; });
+}
+
+Status ExecutionCondition::evaluate(const InferenceEngine::Blob::Ptr& blob, bool& result) const {
+    if (predicate == ConditionPredicate::NOT_EMPTY) {
+        result = blob->size() > 0;
+        return StatusCode::OK;
+    }
+    switch (blob->getTensorDesc().getPrecision()) {
+    case InferenceEngine::Precision::FP32:
+        result = anyGreater<float>(blob, threshold);
+        break;
+    case InferenceEngine::Precision::I32:
+        result = anyGreater<int32_t>(blob, threshold);
+        break;
+    case InferenceEngine::Precision::U16:
+        result = anyGreater<uint16_t>(blob, threshold);
+        break;
+    case InferenceEngine::Precision::I16:
+        result = anyGreater<int16_t>(blob, threshold);
+        break;
+    case InferenceEngine::Precision::U8:
+        result = anyGreater<uint8_t>(blob, threshold);
+        break;
+    case InferenceEngine::Precision::I8:
+        result = anyGreater<int8_t>(blob, threshold);
+        break;
+    default:
+        SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Condition on data item: {} of node: {} cannot be evaluated for precision: {}",
+            dataItem, dependencyName, blob->getTensorDesc().getPrecision().name());
+        return StatusCode::PIPELINE_CONDITION_UNSUPPORTED_PRECISION;
+    }
+    return StatusCode::OK;
+}
+
+}  // namespace ovms
@@ -0,0 +1,62 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <string>
+
+#include <inference_engine.hpp>
+
+#include "status.hpp"
+
+namespace ovms {
+
+// Reserved input name under which condition data item is passed to the dependant node
+const std::string EXECUTION_CONDITION_INPUT_NAME = "__execution_condition";
+
+enum class ConditionPredicate {
+    NOT_EMPTY,
+    ANY_GREATER
+};
+
+const std::string NOT_EMPTY_PREDICATE_CONFIG_NAME = "not_empty";
+const std::string ANY_GREATER_PREDICATE_CONFIG_NAME = "any_greater";
+
+Status toConditionPredicate(const std::string& str, ConditionPredicate& predicate);
+
+/**
+ * @brief Condition placed on the connection with dependency node.
+ * Dependant node is executed only if predicate is satisfied by dependency data item,
+ * otherwise it is skipped together with all nodes depending on it.
+ */
+struct ExecutionCondition {
+    std::string dependencyName;
+    std::string dataItem;
+    ConditionPredicate predicate;
+    float threshold;
+
+    ExecutionCondition(const std::string& dependencyName,
+        const std::string& dataItem,
+        ConditionPredicate predicate = ConditionPredicate::NOT_EMPTY,
+        float threshold = 0.0f) :
+        dependencyName(dependencyName),
+        dataItem(dataItem),
+        predicate(predicate),
+        threshold(threshold) {}
+
+    Status evaluate(const InferenceEngine::Blob::Ptr& blob, bool& result) const;
+};
+
+}  // namespace ovms
@@ -25,6 +25,9 @@
 #include "tensorflow/core/framework/tensor.h"
 #pragma GCC diagnostic pop
 
+#include "logging.hpp"
+#include "serialization.hpp"
+
 namespace ovms {
 
 Status ExitNode::fetchResults(BlobMap&) {
@@ -32,14 +35,18 @@ Status ExitNode::fetchResults(BlobMap&) {
     for (const auto& kv : this->inputBlobs) {
         const auto& output_name = kv.first;
         auto& blob = kv.second;
-        SPDLOG_DEBUG("[Node: {}] Serializing response from pipeline. Output name: {}", getName(), output_name);
+        if (!outputFilter.empty() && outputFilter.count(output_name) == 0) {
+            OVMS_DEBUG("[Node: {}] Skipping output not listed in output filter: {}", getName(), output_name);
+            continue;
+        }
+        OVMS_DEBUG("[Node: {}] Serializing response from pipeline. Output name: {}", getName(), output_name);
         auto& proto = (*this->response->mutable_outputs())[output_name];
         auto status = serialize(blob, proto);
         if (!status.ok()) {
             return status;
         }
 
-        SPDLOG_DEBUG("[Node: {}] Serialized blob to proto: blob name {}", getName(), output_name);
+        OVMS_DEBUG("[Node: {}] Serialized blob to proto: blob name {}", getName(), output_name);
     }
 
     return StatusCode::OK;
@@ -69,25 +76,25 @@ Status ExitNode::serialize(const InferenceEngine::Blob::Ptr& blob, tensorflow::T
         proto.set_dtype(tensorflow::DataTypeToEnum<int8_t>::value);
         break;
     case InferenceEngine::Precision::U16:
-        proto.set_dtype(tensorflow::DataTypeToEnum<uint32_t>::value);  // 2 byte padding [v1, v0, 0, 0, u1, u0, 0, 0, ...]
+        proto.set_dtype(tensorflow::DataTypeToEnum<uint32_t>::value);  // Converted to 4 byte values
         break;
     case InferenceEngine::Precision::FP16:
-        proto.set_dtype(tensorflow::DataTypeToEnum<float>::value);  // 2 byte padding [v1, v0, 0, 0, u1, u0, 0, 0, ...]
+        proto.set_dtype(tensorflow::DataTypeToEnum<float>::value);  // Converted to 4 byte values
         break;
     case InferenceEngine::Precision::I64:
-        proto.set_dtype(tensorflow::DataTypeToEnum<int32_t>::value);  // Manually tested that OV I64 = TF int32_t
+        proto.set_dtype(tensorflow::DataTypeToEnum<int32_t>::value);  // Narrowed to 4 byte values
         break;
     default:
         std::stringstream ss;
         ss << "Actual: " << TensorInfo::getPrecisionAsString(blob->getTensorDesc().getPrecision());
         const std::string details = ss.str();
-        SPDLOG_DEBUG("[Node: {}] Unsupported serialization precision - {}", getName(), details);
+        OVMS_DEBUG("[Node: {}] Unsupported serialization precision - {}", getName(), details);
         Status status = Status(StatusCode::OV_UNSUPPORTED_SERIALIZATION_PRECISION, details);
         return status;
     }
 
     // Set content
-    proto.mutable_tensor_content()->assign((char*)blob->buffer(), blob->byteSize());
+    serializeBlobContent(proto, blob->getTensorDesc().getPrecision(), blob);
 
     return StatusCode::OK;
 }
@@ -15,6 +15,7 @@
 //*****************************************************************************
 #pragma once
 
+#include <set>
 #include <string>
 
 #pragma GCC diagnostic push
@@ -32,10 +33,14 @@ const std::string EXIT_NODE_NAME = "response";
 class ExitNode : public Node {
     tensorflow::serving::PredictResponse* response;
 
+    // Names of outputs to serialize, all outputs are serialized when empty
+    const std::set<std::string> outputFilter;
+
 public:
-    ExitNode(tensorflow::serving::PredictResponse* response) :
+    ExitNode(tensorflow::serving::PredictResponse* response, const std::set<std::string>& outputFilter = {}) :
         Node(EXIT_NODE_NAME),
-        response(response) {
+        response(response),
+        outputFilter(outputFilter) {
     }
 
     // Exit node does not have execute logic.
@@ -47,6 +52,11 @@ public:
 
     Status fetchResults(BlobMap& outputs) override;
 
+    // Exit node is never skipped, outputs of skipped dependencies are missing in the response
+    void skipDependency(const Node& dependency) override {
+        finishedDependenciesCount++;
+    }
+
     // Exit nodes have no dependants
     void addDependant(Node& node) override {
         throw std::logic_error("This node cannot have dependant");
@@ -0,0 +1,136 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "gather_node.hpp"
+
+#include <cstring>
+#include <utility>
+
+#include "logging.hpp"
+#include "tensorinfo.hpp"
+
+namespace ovms {
+
+template <typename T>
+static InferenceEngine::Blob::Ptr makeBlob(const InferenceEngine::TensorDesc& desc) {
+    auto blob = InferenceEngine::make_shared_blob<T>(desc);
+    blob->allocate();
+    return blob;
+}
+
+Status GatherNode::concatenate(const std::vector<InferenceEngine::Blob::Ptr>& blobs, InferenceEngine::Blob::Ptr& result) {
+    if (blobs.empty()) {
+        return StatusCode::INTERNAL_ERROR;
+    }
+    const auto& firstDesc = blobs[0]->getTensorDesc();
+    for (const auto& blob : blobs) {
+        const auto& desc = blob->getTensorDesc();
+        if (desc.getPrecision() != firstDesc.getPrecision() || desc.getDims() != firstDesc.getDims()) {
+            OVMS_LOGGER_DEBUG(dag_executor_logger, "Cannot gather blobs of shape: {} and: {}",
+                TensorInfo::shapeToString(firstDesc.getDims()), TensorInfo::shapeToString(desc.getDims()));
+            return StatusCode::PIPELINE_INCONSISTENT_GATHER_SHAPES;
+        }
+    }
+
+    InferenceEngine::SizeVector dims{blobs.size()};
+    dims.insert(dims.end(), firstDesc.getDims().begin(), firstDesc.getDims().end());
+    InferenceEngine::TensorDesc desc(firstDesc.getPrecision(), dims, InferenceEngine::TensorDesc::getLayoutByDims(dims));
+    switch (desc.getPrecision()) {
+    case InferenceEngine::Precision::FP32:
+        result = makeBlob<float>(desc);
+        break;
+    case InferenceEngine::Precision::FP16:
+    case InferenceEngine::Precision::U16:
+        result = makeBlob<uint16_t>(desc);
+        break;
+    case InferenceEngine::Precision::U8:
+        result = makeBlob<uint8_t>(desc);
+        break;
+    case InferenceEngine::Precision::I8:
+        result = makeBlob<int8_t>(desc);
+        break;
+    case InferenceEngine::Precision::I16:
+        result = makeBlob<int16_t>(desc);
+        break;
+    case InferenceEngine::Precision::I32:
+        result = makeBlob<int32_t>(desc);
+        break;
+    default:
+        return StatusCode::INVALID_PRECISION;
+    }
+
+    const size_t sliceByteSize = blobs[0]->byteSize();
+    uint8_t* destination = result->buffer().as<uint8_t*>();
+    for (size_t i = 0; i < blobs.size(); i++) {
+        std::memcpy(destination + i * sliceByteSize, blobs[i]->cbuffer().as<const uint8_t*>(), sliceByteSize);
+    }
+    return StatusCode::OK;
+}
+
+void GatherNode::skipDependency(const Node& dependency) {
+    OVMS_LOGGER_DEBUG(dag_executor_logger, "[Node: {}] Replica node: {} was skipped", getName(), dependency.getName());
+    skippedDependenciesCount++;
+    finishedDependenciesCount++;
+    if (skippedDependenciesCount == previous.size()) {
+        this->skipped = true;
+    }
+}
+
+Status GatherNode::fetchResults(BlobMap& outputs) {
+    // Replica is gathered only if none of its nodes connected to this node was skipped
+    std::vector<size_t> replicas;
+    replicas.reserve(this->count);
+    for (size_t i = 0; i < this->count; i++) {
+        bool complete = true;
+        for (const auto& node : this->next) {
+            for (const auto& pair : node.get().getMappingByDependency(*this)) {
+                complete = complete && this->inputBlobs.count(getReplicaInputName(pair.first, i)) > 0;
+            }
+        }
+        if (complete) {
+            replicas.push_back(i);
+        } else {
+            OVMS_LOGGER_DEBUG(dag_executor_logger, "[Node: {}] Results of skipped replica: {} are not gathered", getName(), i);
+        }
+    }
+    if (replicas.empty()) {
+        SPDLOG_LOGGER_WARN(dag_executor_logger, "[Node: {}] Missing blobs from all replicas", getName());
+        return StatusCode::INVALID_MISSING_OUTPUT;
+    }
+    for (const auto& node : this->next) {
+        for (const auto& pair : node.get().getMappingByDependency(*this)) {
+            const auto& outputName = pair.first;
+            if (outputs.count(outputName) == 1) {
+                continue;
+            }
+            std::vector<InferenceEngine::Blob::Ptr> blobs;
+            blobs.reserve(replicas.size());
+            for (size_t i : replicas) {
+                blobs.emplace_back(this->inputBlobs.at(getReplicaInputName(outputName, i)));
+            }
+            InferenceEngine::Blob::Ptr gathered;
+            auto status = GatherNode::concatenate(blobs, gathered);
+            if (!status.ok()) {
+                OVMS_LOGGER_DEBUG(dag_executor_logger, "[Node: {}] Gathering blob: {} failed", getName(), outputName);
+                return status;
+            }
+            outputs.emplace(outputName, std::move(gathered));
+        }
+    }
+    this->inputBlobs.clear();
+    return StatusCode::OK;
+}
+
+}  // namespace ovms
@@ -0,0 +1,58 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <inference_engine.hpp>
+
+#include "node.hpp"
+
+namespace ovms {
+
+/**
+ * @brief Auxiliary node collecting results of demultiplexed subgraph replicas.
+ * Input received from index-th replica is expected under name "<input>/<index>".
+ * Concatenates them along new first dimension into single output "<input>".
+ * Replicas which were skipped are left out, node is skipped only when all of them were skipped.
+ */
+class GatherNode : public Node {
+    const size_t count;
+    size_t skippedDependenciesCount = 0;
+
+public:
+    GatherNode(const std::string& nodeName, size_t count) :
+        Node(nodeName),
+        count(count) {}
+
+    Status execute(ThreadSafeQueue<std::reference_wrapper<Node>>& notifyEndQueue) override {
+        notifyEndQueue.push(*this);
+        return StatusCode::OK;
+    }
+
+    Status fetchResults(BlobMap& outputs) override;
+
+    void skipDependency(const Node& dependency) override;
+
+    static std::string getReplicaInputName(const std::string& inputName, size_t index) {
+        return inputName + "/" + std::to_string(index);
+    }
+
+    static Status concatenate(const std::vector<InferenceEngine::Blob::Ptr>& blobs, InferenceEngine::Blob::Ptr& result);
+};
+
+}  // namespace ovms
@@ -17,6 +17,8 @@
 
 #include <google/protobuf/util/json_util.h>
 
+#include "serialization.hpp"
+
 using google::protobuf::util::JsonPrintOptions;
 using google::protobuf::util::MessageToJsonString;
 
@@ -125,7 +127,8 @@ Status GetModelMetadataImpl::buildResponse(
 
     tensorflow::serving::SignatureDefMap def;
     convert(instance->getInputsInfo(), ((*def.mutable_signature_def())["serving_default"]).mutable_inputs());
-    convert(instance->getOutputsInfo(), ((*def.mutable_signature_def())["serving_default"]).mutable_outputs());
+    // Outputs are described after post-processing, as they appear in predict responses
+    convert(getPostProcessedOutputsInfo(instance->getOutputsInfo()), ((*def.mutable_signature_def())["serving_default"]).mutable_outputs());
 
     (*response->mutable_metadata())["signature_def"].PackFrom(def);
     return StatusCode::OK;
@@ -21,15 +21,24 @@
 #include <utility>
 #include <vector>
 
+#include <rapidjson/document.h>
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
 #include <spdlog/spdlog.h>
 
-#include "filesystem.hpp"
+#include "capture.hpp"
 #include "get_model_metadata_impl.hpp"
+#include "logging.hpp"
 #include "model_service.hpp"
 #include "modelinstanceunloadguard.hpp"
 #include "prediction_service_utils.hpp"
+#include "priorityscheduler.hpp"
 #include "rest_parser.hpp"
+#include "rest_router.hpp"
 #include "rest_utils.hpp"
+#include "sequence.hpp"
+#include "shared_memory.hpp"
+#include "tracing.hpp"
 
 #define DEBUG
 #include "timer.hpp"
@@ -39,81 +48,36 @@ using tensorflow::serving::PredictResponse;
 
 namespace ovms {
 
-const std::string HttpRestApiHandler::kPathRegexExp = R"((.?)\/v1\/models\/.*)";
-const std::string HttpRestApiHandler::predictionRegexExp =
-    R"((.?)\/v1\/models\/([^\/:]+)(?:(?:\/versions\/(\d+))|(?:\/labels\/(\w+)))?:(classify|regress|predict))";
-const std::string HttpRestApiHandler::modelstatusRegexExp =
-    R"((.?)\/v1\/models(?:\/([^\/:]+))?(?:(?:\/versions\/(\d+))|(?:\/labels\/(\w+)))?(?:\/(metadata))?)";
-
-Status HttpRestApiHandler::validateUrlAndMethod(
-    const std::string_view http_method,
-    const std::string& request_path,
-    std::smatch* sm) {
-
-    if (http_method != "POST" && http_method != "GET") {
-        return StatusCode::REST_UNSUPPORTED_METHOD;
-    }
-
-    if (FileSystem::isPathEscaped(request_path)) {
-        SPDLOG_ERROR("Path {} escape with .. is forbidden.", request_path);
-        return StatusCode::PATH_INVALID;
-    }
-
-    if (!std::regex_match(request_path, *sm, sanityRegex)) {
-        return StatusCode::REST_INVALID_URL;
-    }
-
-    if (http_method == "POST") {
-        if (std::regex_match(request_path, *sm, predictionRegex)) {
-            return StatusCode::OK;
-        } else if (std::regex_match(request_path, *sm, modelstatusRegex)) {
-            return StatusCode::REST_UNSUPPORTED_METHOD;
-        }
-    } else if (http_method == "GET") {
-        if (std::regex_match(request_path, *sm, modelstatusRegex)) {
-            return StatusCode::OK;
-        } else if (std::regex_match(request_path, *sm, predictionRegex)) {
-            return StatusCode::REST_UNSUPPORTED_METHOD;
-        }
-    }
-    return StatusCode::REST_INVALID_URL;
-}
-
-Status HttpRestApiHandler::parseModelVersion(std::string& model_version_str, std::optional<int64_t>& model_version) {
-    if (!model_version_str.empty()) {
-        try {
-            model_version = std::stoll(model_version_str.c_str());
-        } catch (std::exception& e) {
-            SPDLOG_ERROR("Couldn't parse model version {}", model_version_str);
-            return StatusCode::REST_COULD_NOT_PARSE_VERSION;
-        }
-    }
-    return StatusCode::OK;
-}
-
 Status HttpRestApiHandler::dispatchToProcessor(
     const std::string_view request_path,
     const std::string& request_body,
     std::string* response,
     const HttpRequestComponents& request_components) {
 
-    if (FileSystem::isPathEscaped({request_path.begin(), request_path.end()})) {
-        SPDLOG_ERROR("Path {} escape with .. is forbidden.", request_path);
-        return StatusCode::PATH_INVALID;
+    switch (request_components.resource) {
+    case RestResource::SHARED_MEMORY:
+        return processSharedMemoryRequest(std::string(request_components.model_name), std::string(request_components.processing_method), request_body, response);
+    case RestResource::SCHEDULER_STATS:
+        return processSchedulerStatsRequest(response);
+    case RestResource::TRACES:
+        return processTracesRequest(response);
+    case RestResource::MODEL:
+        break;
     }
-
     if (request_components.http_method == "POST") {
         if (request_components.processing_method == "predict") {
-            return processPredictRequest(request_components.model_name, request_components.model_version,
-                request_components.model_version_label, request_body, response);
+            return processPredictRequest(std::string(request_components.model_name), request_components.model_version,
+                request_components.model_version_label, request_body, response, request_components.priority);
         } else {
-            SPDLOG_WARN("Requested REST resource {} not found", std::string(request_path));
+            SPDLOG_WARN("Requested REST resource {} not found", request_path);
             return StatusCode::REST_NOT_FOUND;
         }
     } else if (request_components.http_method == "GET") {
-        if (!request_components.model_subresource.empty() && request_components.model_subresource == "metadata") {
+        if (request_components.model_subresource == "metadata") {
             return processModelMetadataRequest(request_components.model_name, request_components.model_version,
                 request_components.model_version_label, response);
+        } else if (request_components.model_subresource == "stats") {
+            return processModelStatsRequest(request_components.model_name, request_components.model_version, response);
         } else {
             return processModelStatusRequest(request_components.model_name, request_components.model_version,
                 request_components.model_version_label, response);
@@ -122,21 +86,38 @@ Status HttpRestApiHandler::dispatchToProcessor(
     return StatusCode::UNKNOWN_ERROR;
 }
 
+Status HttpRestApiHandler::parseRequestComponents(
+    const std::string_view http_method,
+    const std::string_view request_path,
+    const std::string_view priority_header,
+    HttpRequestComponents& requestComponents) {
+    auto status = routeRestRequest(http_method, request_path, requestComponents);
+    if (!status.ok()) {
+        return status;
+    }
+    if (requestComponents.resource != RestResource::MODEL || priority_header.empty()) {
+        return StatusCode::OK;
+    }
+    PriorityClass priority;
+    status = parsePriorityClass(std::string(priority_header), priority);
+    if (!status.ok()) {
+        SPDLOG_DEBUG("Invalid {} header value: {}", PRIORITY_HEADER, priority_header);
+        return status;
+    }
+    requestComponents.priority = priority;
+    return StatusCode::OK;
+}
+
 Status HttpRestApiHandler::processRequest(
     const std::string_view http_method,
     const std::string_view request_path,
     const std::string& request_body,
     std::vector<std::pair<std::string, std::string>>* headers,
-    std::string* response) {
-
-    std::smatch sm;
-    std::string request_path_str(request_path);
-    if (FileSystem::isPathEscaped(request_path_str)) {
-        SPDLOG_ERROR("Path {} escape with .. is forbidden.", request_path);
-        return StatusCode::PATH_INVALID;
-    }
+    std::string* response,
+    const std::string_view priority_header) {
 
-    auto status = validateUrlAndMethod(http_method, request_path_str, &sm);
+    HttpRequestComponents requestComponents;
+    auto status = parseRequestComponents(http_method, request_path, priority_header, requestComponents);
     if (!status.ok()) {
         return status;
     }
@@ -144,26 +125,89 @@ Status HttpRestApiHandler::processRequest(
     headers->clear();
     response->clear();
     headers->push_back({"Content-Type", "application/json"});
+    return dispatchToProcessor(request_path, request_body, response, requestComponents);
+}
 
-    HttpRequestComponents requestComponents;
-    requestComponents.http_method = http_method;
+namespace {
+// REST predict request replied from completion of its inference, access log record refers to the model name
+struct AsyncPredictRequest {
+    AsyncPredictRequest(const std::string& modelName, int64_t modelVersion, HttpRestApiHandler::rest_reply_t reply) :
+        modelName(modelName),
+        accessLog(AccessLogApi::REST, this->modelName, modelVersion),
+        reply(std::move(reply)) {}
+
+    void complete(Status status, const PredictResponse& responseProto) {
+        std::string response;
+        if (status.ok()) {
+            status = makeJsonFromPredictResponse(responseProto, &response, requestOrder);
+            accessLog.stageFinished("serialization");
+        }
+        accessLog.finish(status);
+        reply(status, {{"Content-Type", "application/json"}}, response);
+    }
 
-    requestComponents.model_name = sm[2];
-    std::string model_version_str = sm[3];
-    std::string model_version_label_str = sm[4];
-    if (requestComponents.http_method == "POST")
-        requestComponents.processing_method = sm[5];
-    else
-        requestComponents.model_subresource = sm[5];
+    const std::string modelName;
+    AccessLogRecord accessLog;
+    Order requestOrder;
+    HttpRestApiHandler::rest_reply_t reply;
+};
+}  // namespace
 
-    status = parseModelVersion(model_version_str, requestComponents.model_version);
-    if (!status.ok())
-        return status;
+void HttpRestApiHandler::processRequestAsync(
+    const std::string_view http_method,
+    const std::string_view request_path,
+    const std::string& request_body,
+    const std::string_view priority_header,
+    rest_schedule_t schedule,
+    rest_reply_t reply) {
+    HttpRequestComponents requestComponents;
+    if (parseRequestComponents(http_method, request_path, priority_header, requestComponents).ok() &&
+        requestComponents.resource == RestResource::MODEL && requestComponents.processing_method == "predict") {
+        const std::string modelName(requestComponents.model_name);
+        if (ModelManager::getInstance().getServableRegistry().modelExists(modelName)) {
+            processSingleModelRequestAsync(modelName, requestComponents, request_body, std::move(schedule), std::move(reply));
+            return;
+        }
+    }
+    // Invalid requests are reported by synchronous processing
+    std::vector<std::pair<std::string, std::string>> headers;
+    std::string response;
+    auto status = processRequest(http_method, request_path, request_body, &headers, &response, priority_header);
+    reply(status, headers, response);
+}
+
+void HttpRestApiHandler::processSingleModelRequestAsync(
+    const std::string& modelName,
+    const HttpRequestComponents& requestComponents,
+    const std::string& request,
+    rest_schedule_t schedule,
+    rest_reply_t reply) {
+    const std::optional<int64_t>& modelVersion = requestComponents.model_version;
+    OVMS_DEBUG("Processing REST request for model: {}; version: {}",
+        modelName, modelVersion.value_or(0));
+    auto predictRequest = std::make_shared<AsyncPredictRequest>(modelName, modelVersion.value_or(0), std::move(reply));
+    TrafficCapture::getInstance().captureRest(modelName, modelVersion.value_or(0), request);
 
-    if (!model_version_label_str.empty()) {
-        requestComponents.model_version_label = model_version_label_str;
+    auto asyncInference = std::make_shared<AsyncInference>();
+    asyncInference->deadline = timeout_in_ms > 0 ? Deadline::fromNow(std::chrono::milliseconds(timeout_in_ms)) : Deadline();
+    auto status = prepareSingleModelRequest(modelName, modelVersion, request, predictRequest->requestOrder,
+        asyncInference->modelInstance, asyncInference->modelUnloadGuard, asyncInference->request, &predictRequest->accessLog);
+    if (!status.ok()) {
+        predictRequest->complete(status, asyncInference->response);
+        return;
+    }
+    // Inference owns the callback, so it refers to the inference without owning it
+    AsyncInference* inferencePtr = asyncInference.get();
+    asyncInference->schedule = std::move(schedule);
+    asyncInference->onCompletion = [predictRequest, inferencePtr](const Status& inferenceStatus) {
+        predictRequest->accessLog.stageFinished("inference");
+        predictRequest->complete(inferenceStatus, inferencePtr->response);
+    };
+    if (!startAsyncInference(asyncInference)) {
+        status = inference(*asyncInference->modelInstance, &asyncInference->request, &asyncInference->response,
+            asyncInference->modelUnloadGuard, asyncInference->deadline, requestComponents.priority);
+        asyncInference->onCompletion(status);
     }
-    return dispatchToProcessor(request_path, request_body, response, requestComponents);
 }
 
 Status HttpRestApiHandler::processPredictRequest(
@@ -171,110 +215,341 @@ Status HttpRestApiHandler::processPredictRequest(
     const std::optional<int64_t>& modelVersion,
     const std::optional<std::string_view>& modelVersionLabel,
     const std::string& request,
-    std::string* response) {
+    std::string* response,
+    std::optional<PriorityClass> priority) {
     // model_version_label currently is not in use
 
     Timer timer;
     timer.start("total");
     using std::chrono::microseconds;
 
-    SPDLOG_DEBUG("Processing REST request for model: {}; version: {}",
+    OVMS_DEBUG("Processing REST request for model: {}; version: {}",
         modelName, modelVersion.value_or(0));
+    AccessLogRecord accessLog(AccessLogApi::REST, modelName, modelVersion.value_or(0));
+    TrafficCapture::getInstance().captureRest(modelName, modelVersion.value_or(0), request);
 
+    // Work is not started after REST server timeout, when client no longer receives the response
+    const Deadline deadline = timeout_in_ms > 0 ? Deadline::fromNow(std::chrono::milliseconds(timeout_in_ms)) : Deadline();
     ModelManager& modelManager = ModelManager::getInstance();
     Order requestOrder;
     tensorflow::serving::PredictResponse responseProto;
     Status status;
 
-    if (modelManager.modelExists(modelName)) {
-        SPDLOG_DEBUG("Found model with name: {}. Searching for requested version...", modelName);
-        status = processSingleModelRequest(modelName, modelVersion, request, requestOrder, responseProto);
-    } else if (modelManager.pipelineDefinitionExists(modelName)) {
-        SPDLOG_DEBUG("Found pipeline with name: {}", modelName);
-        status = processPipelineRequest(modelName, request, requestOrder, responseProto);
+    const ServableRegistry& servables = modelManager.getServableRegistry();
+    if (servables.modelExists(modelName)) {
+        OVMS_DEBUG("Found model with name: {}. Searching for requested version...", modelName);
+        status = processSingleModelRequest(modelName, modelVersion, request, requestOrder, responseProto, deadline, priority, &accessLog);
+    } else if (servables.pipelineDefinitionExists(modelName)) {
+        OVMS_DEBUG("Found pipeline with name: {}", modelName);
+        status = processPipelineRequest(modelName, request, requestOrder, responseProto, deadline, &accessLog);
     } else {
         SPDLOG_WARN("Model or pipeline matching request parameters not found - name: {}, version: {}", modelName, modelVersion.value_or(0));
         status = StatusCode::MODEL_NAME_MISSING;
     }
-    if (!status.ok())
+    if (!status.ok()) {
+        accessLog.finish(status);
         return status;
+    }
 
+    ScopedSpan serializationSpan("serialize_response");
     status = makeJsonFromPredictResponse(responseProto, response, requestOrder);
+    serializationSpan.finish();
+    accessLog.stageFinished("serialization");
+    accessLog.finish(status);
     if (!status.ok())
         return status;
 
     timer.stop("total");
-    SPDLOG_DEBUG("Total REST request processing time: {} ms", timer.elapsed<std::chrono::microseconds>("total") / 1000);
+    OVMS_DEBUG("Total REST request processing time: {} ms", timer.elapsed<std::chrono::microseconds>("total") / 1000);
     return StatusCode::OK;
 }
 
-Status HttpRestApiHandler::processSingleModelRequest(const std::string& modelName,
+Status HttpRestApiHandler::prepareSingleModelRequest(const std::string& modelName,
     const std::optional<int64_t>& modelVersion,
     const std::string& request,
     Order& requestOrder,
-    tensorflow::serving::PredictResponse& responseProto) {
+    std::shared_ptr<ModelInstance>& modelInstance,
+    std::unique_ptr<ModelInstanceUnloadGuard>& modelInstanceUnloadGuard,
+    tensorflow::serving::PredictRequest& requestProto,
+    AccessLogRecord* accessLog) {
 
-    std::shared_ptr<ModelInstance> modelInstance;
-    std::unique_ptr<ModelInstanceUnloadGuard> modelInstanceUnloadGuard;
+    ScopedSpan lookupSpan("get_servable");
     auto status = getModelInstance(
         ModelManager::getInstance(),
         modelName,
         modelVersion.value_or(0),
         modelInstance,
         modelInstanceUnloadGuard);
+    lookupSpan.finish();
 
     if (!status.ok()) {
         SPDLOG_WARN("Requested model instance - name: {}, version: {} - does not exist.", modelName, modelVersion.value_or(0));
         return status;
     }
+    if (accessLog) {
+        accessLog->setVersion(modelInstance->getVersion());
+        accessLog->stageFinished("lookup");
+    }
     Timer timer;
     timer.start("parse");
+    ScopedSpan parseSpan("parse_request");
     RestParser requestParser(modelInstance->getInputsInfo());
+    if (modelInstance->getModelConfig().isStateful()) {
+        requestParser.setInputPrecision(SEQUENCE_ID_INPUT, InferenceEngine::Precision::U64);
+        requestParser.setInputPrecision(SEQUENCE_CONTROL_INPUT, InferenceEngine::Precision::I32);
+    }
     status = requestParser.parse(request.c_str());
+    parseSpan.finish();
     if (!status.ok()) {
         return status;
     }
     requestOrder = requestParser.getOrder();
     timer.stop("parse");
-    SPDLOG_DEBUG("JSON request parsing time: {} ms", timer.elapsed<std::chrono::microseconds>("parse") / 1000);
+    OVMS_DEBUG("JSON request parsing time: {} ms", timer.elapsed<std::chrono::microseconds>("parse") / 1000);
+    if (accessLog) {
+        accessLog->stageFinished("parse");
+    }
 
-    tensorflow::serving::PredictRequest& requestProto = requestParser.getProto();
+    requestProto = std::move(requestParser.getProto());
     requestProto.mutable_model_spec()->set_name(modelName);
     if (modelVersion.has_value()) {
         requestProto.mutable_model_spec()->mutable_version()->set_value(modelVersion.value());
     }
-    status = inference(*modelInstance, &requestProto, &responseProto, modelInstanceUnloadGuard);
+    return StatusCode::OK;
+}
+
+Status HttpRestApiHandler::processSingleModelRequest(const std::string& modelName,
+    const std::optional<int64_t>& modelVersion,
+    const std::string& request,
+    Order& requestOrder,
+    tensorflow::serving::PredictResponse& responseProto,
+    const Deadline& deadline,
+    std::optional<PriorityClass> priority,
+    AccessLogRecord* accessLog) {
+
+    std::shared_ptr<ModelInstance> modelInstance;
+    std::unique_ptr<ModelInstanceUnloadGuard> modelInstanceUnloadGuard;
+    tensorflow::serving::PredictRequest requestProto;
+    auto status = prepareSingleModelRequest(modelName, modelVersion, request, requestOrder, modelInstance, modelInstanceUnloadGuard, requestProto, accessLog);
+    if (!status.ok()) {
+        return status;
+    }
+    status = inference(*modelInstance, &requestProto, &responseProto, modelInstanceUnloadGuard, deadline, priority);
+    if (accessLog) {
+        accessLog->stageFinished("inference");
+    }
     return status;
 }
 
 Status HttpRestApiHandler::processPipelineRequest(const std::string& modelName,
     const std::string& request,
     Order& requestOrder,
-    tensorflow::serving::PredictResponse& responseProto) {
+    tensorflow::serving::PredictResponse& responseProto,
+    const Deadline& deadline,
+    AccessLogRecord* accessLog) {
 
     std::unique_ptr<Pipeline> pipelinePtr;
 
     Timer timer;
     timer.start("parse");
+    ScopedSpan parseSpan("parse_request");
     RestParser requestParser;
     auto status = requestParser.parse(request.c_str());
+    parseSpan.finish();
     if (!status.ok()) {
         return status;
     }
     requestOrder = requestParser.getOrder();
     timer.stop("parse");
-    SPDLOG_DEBUG("JSON request parsing time: {} ms", timer.elapsed<std::chrono::microseconds>("parse") / 1000);
+    OVMS_DEBUG("JSON request parsing time: {} ms", timer.elapsed<std::chrono::microseconds>("parse") / 1000);
+    if (accessLog) {
+        accessLog->stageFinished("parse");
+    }
 
     tensorflow::serving::PredictRequest& requestProto = requestParser.getProto();
     requestProto.mutable_model_spec()->set_name(modelName);
+    ScopedSpan lookupSpan("get_servable");
     status = getPipeline(ModelManager::getInstance(), pipelinePtr, &requestProto, &responseProto);
+    lookupSpan.finish();
     if (!status.ok()) {
         return status;
     }
-    status = pipelinePtr->execute();
+    if (accessLog) {
+        accessLog->stageFinished("lookup");
+    }
+    status = pipelinePtr->execute(deadline);
+    if (accessLog) {
+        accessLog->stageFinished("inference");
+    }
     return status;
 }
 
+Status HttpRestApiHandler::processSharedMemoryRequest(
+    const std::string& region_name,
+    const std::string& action,
+    const std::string& request_body,
+    std::string* response) {
+    SPDLOG_DEBUG("Processing shared memory {} request for region: {}", action, region_name);
+    auto& sharedMemoryManager = SharedMemoryManager::getInstance();
+    Status status;
+    if (action == "unregister") {
+        status = sharedMemoryManager.unregisterRegion(region_name);
+    } else {
+        rapidjson::Document doc;
+        if (doc.Parse(request_body.c_str()).HasParseError() || !doc.IsObject()) {
+            return StatusCode::REST_BODY_IS_NOT_AN_OBJECT;
+        }
+        auto key = doc.FindMember("key");
+        auto byteSize = doc.FindMember("byte_size");
+        auto offset = doc.FindMember("offset");
+        if (key == doc.MemberEnd() || !key->value.IsString() ||
+            byteSize == doc.MemberEnd() || !byteSize->value.IsUint64() ||
+            (offset != doc.MemberEnd() && !offset->value.IsUint64())) {
+            SPDLOG_DEBUG("Shared memory registration requires string key, numeric byte_size and optional numeric offset");
+            return StatusCode::REST_MALFORMED_REQUEST;
+        }
+        status = sharedMemoryManager.registerRegion(region_name,
+            key->value.GetString(),
+            offset != doc.MemberEnd() ? offset->value.GetUint64() : 0,
+            byteSize->value.GetUint64());
+    }
+    if (!status.ok()) {
+        return status;
+    }
+    *response = "{}";
+    return StatusCode::OK;
+}
+
+Status HttpRestApiHandler::processModelStatsRequest(
+    const std::string_view model_name,
+    const std::optional<int64_t>& model_version,
+    std::string* response) {
+    SPDLOG_DEBUG("Processing model stats request");
+    auto model = ModelManager::getInstance().findModelByName(std::string(model_name));
+    if (model == nullptr) {
+        return StatusCode::MODEL_NAME_MISSING;
+    }
+    std::vector<std::shared_ptr<ModelInstance>> instances;
+    if (model_version.has_value() && model_version.value() != 0) {
+        auto instance = model->getModelInstanceByVersion(model_version.value());
+        if (instance == nullptr) {
+            return StatusCode::MODEL_VERSION_MISSING;
+        }
+        instances.push_back(instance);
+    } else {
+        for (const auto& [version, instance] : model->getModelVersions()) {
+            instances.push_back(instance);
+        }
+    }
+
+    rapidjson::StringBuffer buffer;
+    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
+    writer.StartObject();
+    writer.Key("model_version_stats");
+    writer.StartArray();
+    for (const auto& instance : instances) {
+        // Counters live as long as the infer requests queue and response cache of a loaded version
+        std::unique_ptr<ModelInstanceUnloadGuard> unloadGuard;
+        if (!instance->waitForLoaded(0, unloadGuard).ok()) {
+            continue;
+        }
+        auto& queue = instance->getInferRequestsQueue();
+        writer.StartObject();
+        writer.Key("version");
+        writer.String(std::to_string(instance->getVersion()).c_str());
+        writer.Key("waiting_requests");
+        writer.Uint64(queue.getWaitingCount());
+        writer.Key("rejected_queue_full");
+        writer.Uint64(queue.getRejectedQueueFullCount());
+        writer.Key("rejected_queue_timeout");
+        writer.Uint64(queue.getRejectedQueueTimeoutCount());
+        auto responseCache = instance->getResponseCache();
+        if (responseCache) {
+            writer.Key("response_cache");
+            writer.StartObject();
+            writer.Key("hits");
+            writer.Uint64(responseCache->getHitsCount());
+            writer.Key("misses");
+            writer.Uint64(responseCache->getMissesCount());
+            writer.Key("coalesced");
+            writer.Uint64(responseCache->getCoalescedCount());
+            writer.Key("evictions");
+            writer.Uint64(responseCache->getEvictionsCount());
+            writer.Key("entries");
+            writer.Uint64(responseCache->getEntriesCount());
+            writer.Key("bytes");
+            writer.Uint64(responseCache->getBytes());
+            writer.EndObject();
+        }
+        auto sequenceManager = instance->getSequenceManager();
+        if (sequenceManager) {
+            writer.Key("sequences");
+            writer.Uint64(sequenceManager->getSequencesCount());
+        }
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.EndObject();
+    *response = buffer.GetString();
+    return StatusCode::OK;
+}
+
+Status HttpRestApiHandler::processSchedulerStatsRequest(std::string* response) {
+    SPDLOG_DEBUG("Processing scheduler stats request");
+    auto& scheduler = PriorityScheduler::getInstance();
+    rapidjson::StringBuffer buffer;
+    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
+    writer.StartObject();
+    writer.Key("inference_slots");
+    writer.Uint64(scheduler.getSlots());
+    writer.Key("running");
+    writer.Uint64(scheduler.getRunningCount());
+    writer.Key("waiting");
+    writer.Uint64(scheduler.getWaitingCount());
+    writer.Key("priority_classes");
+    writer.StartObject();
+    for (size_t i = 0; i < PRIORITY_CLASSES_COUNT; i++) {
+        const auto priority = static_cast<PriorityClass>(i);
+        const auto stats = scheduler.getStats(priority);
+        writer.Key(priorityClassToString(priority).c_str());
+        writer.StartObject();
+        writer.Key("weight");
+        writer.Uint(scheduler.getWeight(priority));
+        writer.Key("completed");
+        writer.Uint64(stats.completed);
+        writer.Key("rejected");
+        writer.Uint64(stats.rejected);
+        writer.Key("wait_us_total");
+        writer.Uint64(stats.waitUsTotal);
+        writer.Key("wait_us_max");
+        writer.Uint64(stats.waitUsMax);
+        writer.Key("latency_us_total");
+        writer.Uint64(stats.latencyUsTotal);
+        writer.Key("latency_histogram_ms");
+        writer.StartObject();
+        for (size_t bucket = 0; bucket < stats.latencyHistogram.size(); bucket++) {
+            writer.Key(bucket < PRIORITY_LATENCY_BUCKETS_MS.size() ? std::to_string(PRIORITY_LATENCY_BUCKETS_MS[bucket]).c_str() : "+Inf");
+            writer.Uint64(stats.latencyHistogram[bucket]);
+        }
+        writer.EndObject();
+        writer.EndObject();
+    }
+    writer.EndObject();
+    writer.EndObject();
+    *response = buffer.GetString();
+    return StatusCode::OK;
+}
+
+Status HttpRestApiHandler::processTracesRequest(std::string* response) {
+    SPDLOG_DEBUG("Processing traces request");
+    auto& tracer = Tracer::getInstance();
+    if (!tracer.isEnabled()) {
+        return StatusCode::REST_TRACING_DISABLED;
+    }
+    tracer.writeChromeTrace(*response);
+    return StatusCode::OK;
+}
+
 Status HttpRestApiHandler::processModelMetadataRequest(
     const std::string_view model_name,
     const std::optional<int64_t>& model_version,
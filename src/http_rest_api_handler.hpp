@@ -15,7 +15,8 @@
 //*****************************************************************************
 #pragma once
 
-#include <regex>
+#include <functional>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -25,25 +26,22 @@
 #include "tensorflow_serving/apis/prediction_service.grpc.pb.h"
 #pragma GCC diagnostic pop
 
+#include "accesslog.hpp"
+#include "deadline.hpp"
+#include "priorityscheduler.hpp"
 #include "rest_parser.hpp"
+#include "rest_router.hpp"
 #include "status.hpp"
 
 namespace ovms {
 
-struct HttpRequestComponents {
-    std::string_view http_method;
-    std::string model_name;
-    std::optional<int64_t> model_version;
-    std::optional<std::string_view> model_version_label;
-    std::string processing_method;
-    std::string model_subresource;
-};
+class ModelInstance;
+class ModelInstanceUnloadGuard;
 
 class HttpRestApiHandler {
 public:
-    static const std::string kPathRegexExp;
-    static const std::string predictionRegexExp;
-    static const std::string modelstatusRegexExp;
+    using rest_schedule_t = std::function<void(std::function<void()>)>;
+    using rest_reply_t = std::function<void(const Status& status, const std::vector<std::pair<std::string, std::string>>& headers, const std::string& response)>;
 
     /**
      * @brief Construct a new HttpRest Api Handler
@@ -51,18 +49,8 @@ public:
      * @param timeout_in_ms 
      */
     HttpRestApiHandler(int timeout_in_ms) :
-        sanityRegex(kPathRegexExp),
-        predictionRegex(predictionRegexExp),
-        modelstatusRegex(modelstatusRegexExp),
         timeout_in_ms(timeout_in_ms) {}
 
-    Status validateUrlAndMethod(
-        const std::string_view http_method,
-        const std::string& request_path,
-        std::smatch* sm);
-
-    Status parseModelVersion(std::string& model_version_str, std::optional<int64_t>& model_version);
-
     Status dispatchToProcessor(
         const std::string_view request_path,
         const std::string& request_body,
@@ -77,6 +65,7 @@ public:
      * @param request_body 
      * @param headers 
      * @param resposnse 
+     * @param priority_header value of priority class header, empty when not sent
      *
      * @return StatusCode 
      */
@@ -85,7 +74,27 @@ public:
         const std::string_view request_path,
         const std::string& request_body,
         std::vector<std::pair<std::string, std::string>>* headers,
-        std::string* response);
+        std::string* response,
+        const std::string_view priority_header = "");
+
+    /**
+     * @brief Process request without waiting for inference. Predict request of a single model is replied from completion
+     * of its inference, on a thread given by schedule. Other requests are processed on the calling thread.
+     *
+     * @param http_method
+     * @param request_path
+     * @param request_body only used before the call returns
+     * @param priority_header value of priority class header, empty when not sent
+     * @param schedule runs function on a thread never blocked by synchronous processing of requests
+     * @param reply called once with status, headers and response
+     */
+    void processRequestAsync(
+        const std::string_view http_method,
+        const std::string_view request_path,
+        const std::string& request_body,
+        const std::string_view priority_header,
+        rest_schedule_t schedule,
+        rest_reply_t reply);
 
     /**
      * @brief Process predict request
@@ -95,6 +104,7 @@ public:
      * @param modelVersionLabel 
      * @param request 
      * @param response 
+     * @param priority overrides priority class of the model
      *
      * @return StatusCode 
      */
@@ -103,20 +113,26 @@ public:
         const std::optional<int64_t>& modelVersion,
         const std::optional<std::string_view>& modelVersionLabel,
         const std::string& request,
-        std::string* response);
+        std::string* response,
+        std::optional<PriorityClass> priority = std::nullopt);
 
     Status processSingleModelRequest(
         const std::string& modelName,
         const std::optional<int64_t>& modelVersion,
         const std::string& request,
         Order& requestOrder,
-        tensorflow::serving::PredictResponse& responseProto);
+        tensorflow::serving::PredictResponse& responseProto,
+        const Deadline& deadline = Deadline(),
+        std::optional<PriorityClass> priority = std::nullopt,
+        AccessLogRecord* accessLog = nullptr);
 
     Status processPipelineRequest(
         const std::string& modelName,
         const std::string& request,
         Order& requestOrder,
-        tensorflow::serving::PredictResponse& responseProto);
+        tensorflow::serving::PredictResponse& responseProto,
+        const Deadline& deadline = Deadline(),
+        AccessLogRecord* accessLog = nullptr);
 
     /**
      * @brief Process Model Metadata request
@@ -149,10 +165,76 @@ public:
         const std::optional<std::string_view>& model_version_label,
         std::string* response);
 
+    /**
+     * @brief Process model stats request, reporting admission control counters of loaded versions
+     *
+     * @param model_name
+     * @param model_version
+     * @param response
+     * @return StatusCode
+     */
+    Status processModelStatsRequest(
+        const std::string_view model_name,
+        const std::optional<int64_t>& model_version,
+        std::string* response);
+
+    /**
+     * @brief Process scheduler stats request, reporting inference slots usage and latency of priority classes
+     *
+     * @param response
+     * @return StatusCode
+     */
+    Status processSchedulerStatsRequest(std::string* response);
+
+    /**
+     * @brief Process traces request, returning sampled request traces in Chrome trace event format
+     *
+     * @param response
+     * @return StatusCode
+     */
+    Status processTracesRequest(std::string* response);
+
+    /**
+     * @brief Process shared memory region registration request
+     *
+     * @param region_name
+     * @param action register or unregister
+     * @param request_body
+     * @param response
+     * @return StatusCode
+     */
+    Status processSharedMemoryRequest(
+        const std::string& region_name,
+        const std::string& action,
+        const std::string& request_body,
+        std::string* response);
+
 private:
-    const std::regex sanityRegex;
-    const std::regex predictionRegex;
-    const std::regex modelstatusRegex;
+    Status parseRequestComponents(
+        const std::string_view http_method,
+        const std::string_view request_path,
+        const std::string_view priority_header,
+        HttpRequestComponents& requestComponents);
+
+    /**
+     * @brief Finds model instance and parses request body into request proto
+     */
+    Status prepareSingleModelRequest(
+        const std::string& modelName,
+        const std::optional<int64_t>& modelVersion,
+        const std::string& request,
+        Order& requestOrder,
+        std::shared_ptr<ModelInstance>& modelInstance,
+        std::unique_ptr<ModelInstanceUnloadGuard>& modelInstanceUnloadGuard,
+        tensorflow::serving::PredictRequest& requestProto,
+        AccessLogRecord* accessLog);
+
+    void processSingleModelRequestAsync(
+        const std::string& modelName,
+        const HttpRequestComponents& requestComponents,
+        const std::string& request,
+        rest_schedule_t schedule,
+        rest_reply_t reply);
 
     int timeout_in_ms;
 };
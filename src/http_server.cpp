@@ -15,8 +15,16 @@
 //*****************************************************************************
 #include "http_server.hpp"
 
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <functional>
 #include <memory>
-#include <regex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -32,7 +40,10 @@
 #pragma GCC diagnostic pop
 
 #include "http_rest_api_handler.hpp"
+#include "logging.hpp"
+#include "priorityscheduler.hpp"
 #include "status.hpp"
+#include "tracing.hpp"
 
 namespace ovms {
 
@@ -51,8 +62,8 @@ private:
 
 class RestApiRequestDispatcher {
 public:
-    RestApiRequestDispatcher(int timeout_in_ms) :
-        regex_(HttpRestApiHandler::kPathRegexExp) {
+    RestApiRequestDispatcher(int timeout_in_ms, int num_threads) :
+        completionExecutor_(tensorflow::Env::Default(), "httprestcompletion", num_threads) {
         handler_ = std::make_unique<HttpRestApiHandler>(timeout_in_ms);
     }
 
@@ -64,7 +75,10 @@ public:
 
 private:
     void processRequest(net_http::ServerRequestInterface* req) {
-        SPDLOG_DEBUG("REST request {}", req->uri_path());
+        OVMS_DEBUG("REST request {}", req->uri_path());
+        const auto traceId = req->GetRequestHeader(TRACE_HEADER);
+        RequestTraceScope traceScope("rest_request", std::string_view(traceId.data(), traceId.size()));
+        ScopedSpan readSpan("read_request");
         std::string body;
         int64_t num_bytes = 0;
         auto request_chunk = req->ReadRequestBytes(&num_bytes);
@@ -72,24 +86,37 @@ private:
             body.append(std::string_view(request_chunk.get(), num_bytes));
             request_chunk = req->ReadRequestBytes(&num_bytes);
         }
+        readSpan.finish();
 
-        std::vector<std::pair<std::string, std::string>> headers;
-        std::string output;
-        SPDLOG_DEBUG("Processing HTTP request: {} {} body: {} bytes",
+        OVMS_DEBUG("Processing HTTP request: {} {} body: {} bytes",
             req->http_method(),
             req->uri_path(),
             body.size());
-        const auto status = handler_->processRequest(req->http_method(), req->uri_path(), body, &headers, &output);
-        if (!status.ok() && output.empty()) {
-            output.append("{\"error\": \"" + status.string() + "\"}");
-        }
+        const auto priorityHeader = req->GetRequestHeader(PRIORITY_HEADER);
+        // Request is replied after inference completes, worker thread is released in the meantime. Completions
+        // run on their own executor: they hand over and return infer requests, which workers blocked in
+        // synchronous requests may be waiting for.
+        handler_->processRequestAsync(req->http_method(), req->uri_path(), body,
+            std::string_view(priorityHeader.data(), priorityHeader.size()),
+            [this](std::function<void()> fn) { completionExecutor_.Schedule(std::move(fn)); },
+            [req](const Status& status, const std::vector<std::pair<std::string, std::string>>& headers, const std::string& response) {
+                reply(req, status, headers, response);
+            });
+    }
+
+    static void reply(net_http::ServerRequestInterface* req, const Status& status,
+        const std::vector<std::pair<std::string, std::string>>& headers, const std::string& response) {
         const auto http_status = status.http();
         for (const auto& kv : headers) {
             req->OverwriteResponseHeader(kv.first, kv.second);
         }
-        req->WriteResponseString(output);
+        if (!status.ok() && response.empty()) {
+            req->WriteResponseString("{\"error\": \"" + status.string() + "\"}");
+        } else {
+            req->WriteResponseString(response);
+        }
         if (http_status != net_http::HTTPStatusCode::OK) {
-            SPDLOG_DEBUG("Processing HTTP/REST request failed: {} {}. Reason: {}",
+            OVMS_DEBUG("Processing HTTP/REST request failed: {} {}. Reason: {}",
                 req->http_method(),
                 req->uri_path(),
                 status.string());
@@ -97,14 +124,53 @@ private:
         req->ReplyWithStatus(http_status);
     }
 
-    const std::regex regex_;
     std::unique_ptr<HttpRestApiHandler> handler_;
+    tensorflow::serving::ThreadPoolExecutor completionExecutor_;
 };
 
-std::unique_ptr<http_server> createAndStartHttpServer(const std::string& address, int port, int num_threads, int timeout_in_ms) {
+static int createUnixSocket(const std::string& path) {
+    struct sockaddr_un addr;
+    if (path.size() >= sizeof(addr.sun_path)) {
+        SPDLOG_ERROR("Unix socket path {} is too long", path);
+        return -1;
+    }
+    // Remove socket left by previous server run, never other kind of file
+    struct stat pathStat;
+    if (stat(path.c_str(), &pathStat) == 0) {
+        if (!S_ISSOCK(pathStat.st_mode)) {
+            SPDLOG_ERROR("Unix socket path {} exists and is not a socket", path);
+            return -1;
+        }
+        unlink(path.c_str());
+    }
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd == -1) {
+        SPDLOG_ERROR("Failed to create unix socket: {}", strerror(errno));
+        return -1;
+    }
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+    if (bind(fd, (struct sockaddr*)&addr, sizeof(addr)) < 0 || listen(fd, SOMAXCONN) < 0) {
+        SPDLOG_ERROR("Failed to bind unix socket {}: {}", path, strerror(errno));
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+std::unique_ptr<http_server> createAndStartHttpServer(const std::string& address, int port, int num_threads, int timeout_in_ms, const std::string& unix_socket_path) {
     auto options = std::make_unique<net_http::ServerOptions>();
     options->AddPort(static_cast<uint32_t>(port));
     options->SetAddress(address);
+    if (!unix_socket_path.empty()) {
+        int fd = createUnixSocket(unix_socket_path);
+        if (fd == -1) {
+            return nullptr;
+        }
+        // Server takes ownership of the socket
+        options->SetUnixSocketFd(fd);
+    }
     options->SetExecutor(std::make_unique<RequestExecutor>(num_threads));
 
     auto server = net_http::CreateEvHTTPServer(std::move(options));
@@ -114,7 +180,7 @@ std::unique_ptr<http_server> createAndStartHttpServer(const std::string& address
     }
 
     std::shared_ptr<RestApiRequestDispatcher> dispatcher =
-        std::make_shared<RestApiRequestDispatcher>(timeout_in_ms);
+        std::make_shared<RestApiRequestDispatcher>(timeout_in_ms, num_threads);
 
     net_http::RequestHandlerOptions handler_options;
     server->RegisterRequestDispatcher(
@@ -33,9 +33,10 @@ using http_server = tensorflow::serving::net_http::HTTPServerInterface;
  * @param port 
  * @param num_threads 
  * @param timeout_in_m
+ * @param unix_socket_path optional unix domain socket to accept requests on in addition to the port
  *  
  * @return std::unique_ptr<http_server> 
  */
-std::unique_ptr<http_server> createAndStartHttpServer(const std::string& address, int port, int num_threads, int timeout_in_ms);
+std::unique_ptr<http_server> createAndStartHttpServer(const std::string& address, int port, int num_threads, int timeout_in_ms, const std::string& unix_socket_path = "");
 
 }  // namespace ovms
@@ -17,15 +17,25 @@
 
 #include <vector>
 
+#include <spdlog/async.h>
+
 namespace ovms {
 
+static std::shared_ptr<spdlog::logger> make_disabled_logger(const std::string& name) {
+    auto logger = std::make_shared<spdlog::logger>(name);
+    logger->set_level(spdlog::level::off);
+    return logger;
+}
+
 std::shared_ptr<spdlog::logger> gcs_logger = std::make_shared<spdlog::logger>("gcs");
 std::shared_ptr<spdlog::logger> azurestorage_logger = std::make_shared<spdlog::logger>("azurestorage");
 std::shared_ptr<spdlog::logger> s3_logger = std::make_shared<spdlog::logger>("s3");
 std::shared_ptr<spdlog::logger> modelmanager_logger = std::make_shared<spdlog::logger>("modelmanager");
 std::shared_ptr<spdlog::logger> dag_executor_logger = std::make_shared<spdlog::logger>("dag_executor");
+std::shared_ptr<spdlog::logger> access_logger = make_disabled_logger("access");
 
 const std::string default_pattern = "[%Y-%m-%d %T.%e][%t][%n][%l][%s:%#] %v";
+const std::string access_log_pattern = "[%Y-%m-%d %T.%e] %v";
 
 void set_log_level(const std::string log_level, std::shared_ptr<spdlog::logger> logger) {
     logger->set_level(spdlog::level::info);
@@ -40,37 +50,50 @@ void set_log_level(const std::string log_level, std::shared_ptr<spdlog::logger>
     }
 }
 
-void register_loggers(const std::string log_level, std::vector<spdlog::sink_ptr> sinks) {
-    auto serving_logger = std::make_shared<spdlog::logger>("serving", begin(sinks), end(sinks));
-    serving_logger->set_pattern(default_pattern);
-    gcs_logger->set_pattern(default_pattern);
-    azurestorage_logger->set_pattern(default_pattern);
-    s3_logger->set_pattern(default_pattern);
-    modelmanager_logger->set_pattern(default_pattern);
-    dag_executor_logger->set_pattern(default_pattern);
-    for (auto sink : sinks) {
-        gcs_logger->sinks().push_back(sink);
-        azurestorage_logger->sinks().push_back(sink);
-        s3_logger->sinks().push_back(sink);
-        modelmanager_logger->sinks().push_back(sink);
-        dag_executor_logger->sinks().push_back(sink);
+static std::shared_ptr<spdlog::logger> make_logger(const std::string& name, const std::vector<spdlog::sink_ptr>& sinks, size_t async_queue_size) {
+    if (async_queue_size == 0) {
+        return std::make_shared<spdlog::logger>(name, begin(sinks), end(sinks));
+    }
+    // Request threads only enqueue messages, when writer thread falls behind oldest messages are dropped instead of blocking them
+    return std::make_shared<spdlog::async_logger>(name, begin(sinks), end(sinks), spdlog::thread_pool(), spdlog::async_overflow_policy::overrun_oldest);
+}
+
+void register_loggers(const std::string log_level, std::vector<spdlog::sink_ptr> sinks, size_t async_queue_size) {
+    if (async_queue_size > 0) {
+        spdlog::init_thread_pool(async_queue_size, 1);
+    }
+    auto serving_logger = make_logger("serving", sinks, async_queue_size);
+    gcs_logger = make_logger("gcs", sinks, async_queue_size);
+    azurestorage_logger = make_logger("azurestorage", sinks, async_queue_size);
+    s3_logger = make_logger("s3", sinks, async_queue_size);
+    modelmanager_logger = make_logger("modelmanager", sinks, async_queue_size);
+    dag_executor_logger = make_logger("dag_executor", sinks, async_queue_size);
+    for (auto logger : {serving_logger, gcs_logger, azurestorage_logger, s3_logger, modelmanager_logger, dag_executor_logger}) {
+        logger->set_pattern(default_pattern);
+        set_log_level(log_level, logger);
     }
-    set_log_level(log_level, serving_logger);
-    set_log_level(log_level, gcs_logger);
-    set_log_level(log_level, azurestorage_logger);
-    set_log_level(log_level, s3_logger);
-    set_log_level(log_level, modelmanager_logger);
-    set_log_level(log_level, dag_executor_logger);
     spdlog::set_default_logger(serving_logger);
 }
 
-void configure_logger(const std::string log_level, const std::string log_path) {
+void register_access_logger(const std::string access_log_path, size_t async_queue_size) {
+    if (access_log_path.empty()) {
+        return;
+    }
+    std::vector<spdlog::sink_ptr> sinks{std::make_shared<spdlog::sinks::basic_file_sink_mt>(access_log_path)};
+    access_logger = make_logger("access", sinks, async_queue_size);
+    access_logger->set_pattern(access_log_pattern);
+    access_logger->set_level(spdlog::level::info);
+}
+
+void configure_logger(const std::string log_level, const std::string log_path, size_t async_queue_size, const std::string access_log_path) {
     std::vector<spdlog::sink_ptr> sinks;
-    sinks.push_back(std::make_shared<spdlog::sinks::stdout_sink_st>());
+    // Sinks are shared by loggers used from many threads
+    sinks.push_back(std::make_shared<spdlog::sinks::stdout_sink_mt>());
     if (!log_path.empty()) {
         sinks.push_back(std::make_shared<spdlog::sinks::basic_file_sink_mt>(log_path));
     }
-    register_loggers(log_level, sinks);
+    register_loggers(log_level, sinks, async_queue_size);
+    register_access_logger(access_log_path, async_queue_size);
 }
 
 }  // namespace ovms
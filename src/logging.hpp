@@ -29,7 +29,34 @@ extern std::shared_ptr<spdlog::logger> azurestorage_logger;
 extern std::shared_ptr<spdlog::logger> s3_logger;
 extern std::shared_ptr<spdlog::logger> modelmanager_logger;
 extern std::shared_ptr<spdlog::logger> dag_executor_logger;
+extern std::shared_ptr<spdlog::logger> access_logger;
 
-void configure_logger(const std::string log_level, const std::string log_path);
+/**
+ * @brief Debug statements of request processing path. Unlike SPDLOG_DEBUG, arguments are not evaluated
+ * unless debug level is enabled, so that building them does not slow down serving with default log level.
+ */
+#define OVMS_DEBUG(...)                                                         \
+    do {                                                                        \
+        if (spdlog::default_logger_raw()->should_log(spdlog::level::debug)) {   \
+            SPDLOG_DEBUG(__VA_ARGS__);                                          \
+        }                                                                       \
+    } while (0)
+
+#define OVMS_LOGGER_DEBUG(logger, ...)                                          \
+    do {                                                                        \
+        if ((logger)->should_log(spdlog::level::debug)) {                       \
+            SPDLOG_LOGGER_DEBUG(logger, __VA_ARGS__);                           \
+        }                                                                       \
+    } while (0)
+
+/**
+ * @brief Configures sinks and levels of loggers
+ *
+ * @param log_level DEBUG, INFO or ERROR
+ * @param log_path optional file written in addition to stdout
+ * @param async_queue_size size of queue of messages written by a dedicated thread, 0 means synchronous logging
+ * @param access_log_path optional file of access log, access log is disabled when empty
+ */
+void configure_logger(const std::string log_level, const std::string log_path, size_t async_queue_size = 0, const std::string access_log_path = "");
 
 }  // namespace ovms
@@ -79,6 +79,13 @@ const std::map<model_version_t, std::shared_ptr<ModelInstance>>& Model::getModel
     return modelVersions;
 }
 
+std::shared_ptr<ModelInstance> Model::getModelInstancesCopy(std::unordered_map<model_version_t, std::shared_ptr<ModelInstance>>& instances) const {
+    std::shared_lock lock(modelVersionsMtx);
+    instances.insert(modelVersions.begin(), modelVersions.end());
+    auto defaultIt = modelVersions.find(defaultVersion);
+    return defaultIt != modelVersions.end() ? defaultIt->second : nullptr;
+}
+
 void Model::updateDefaultVersion(int ignoredVersion) {
     model_version_t newDefaultVersion = 0;
     SPDLOG_INFO("Updating default version for model: {}, from: {}", getName(), defaultVersion);
@@ -126,6 +133,7 @@ Status Model::addVersion(const ModelConfig& config) {
     modelVersions[version] = std::move(modelInstance);
     lock.unlock();
     updateDefaultVersion();
+    versionsChanged();
     subscriptionManager.notifySubscribers();
     return StatusCode::OK;
 }
@@ -170,6 +178,7 @@ Status Model::retireVersions(std::shared_ptr<model_versions_t> versionsToRetire)
         updateDefaultVersion(version);
         modelVersion->unloadModel();
     }
+    versionsChanged();
     subscriptionManager.notifySubscribers();
     return result;
 }
@@ -191,6 +200,7 @@ void Model::retireAllVersions() {
         versionModelInstancePair.second->unloadModel();
         updateDefaultVersion();
     }
+    versionsChanged();
     subscriptionManager.notifySubscribers();
 }
 
@@ -231,6 +241,7 @@ Status Model::reloadVersions(std::shared_ptr<model_versions_t> versionsToReload,
         }
         updateDefaultVersion();
     }
+    versionsChanged();
     subscriptionManager.notifySubscribers();
     return result;
 }
@@ -15,10 +15,12 @@
 //*****************************************************************************
 #pragma once
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <shared_mutex>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -44,6 +46,17 @@ private:
       */
     void updateDefaultVersion(int ignoredVersion = 0);
 
+    /**
+      * @brief Called after versions or default version change, before subscribers are notified
+      */
+    std::function<void()> versionsChangedCallback;
+
+    void versionsChanged() {
+        if (versionsChangedCallback) {
+            versionsChangedCallback();
+        }
+    }
+
 protected:
     /**
          * @brief Model name
@@ -140,6 +153,22 @@ public:
      */
     const std::map<model_version_t, const ModelInstance&> getModelVersionsMapCopy() const;
 
+    /**
+     * @brief Copies versions instances and returns default one, both taken under the same lock
+     *
+     * @param instances map to fill with versions instances
+     *
+     * @return default ModelInstance or nullptr if there is no default version
+     */
+    std::shared_ptr<ModelInstance> getModelInstancesCopy(std::unordered_map<model_version_t, std::shared_ptr<ModelInstance>>& instances) const;
+
+    /**
+     * @brief Sets function called after each change of versions
+     */
+    void setVersionsChangedCallback(std::function<void()> callback) {
+        versionsChangedCallback = std::move(callback);
+    }
+
     /**
          * @brief Finds ModelInstance with specific version
          *
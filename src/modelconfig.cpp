@@ -74,6 +74,35 @@ bool ModelConfig::isReloadRequired(const ModelConfig& rhs) const {
         SPDLOG_DEBUG("ModelConfig {} reload required due to named layout mismatch", this->name);
         return true;
     }
+    if (this->precisionConversionInputs != rhs.precisionConversionInputs) {
+        SPDLOG_DEBUG("ModelConfig {} reload required due to precision conversion mismatch", this->name);
+        return true;
+    }
+    if (this->postProcessing != rhs.postProcessing) {
+        SPDLOG_DEBUG("ModelConfig {} reload required due to post-processing mismatch", this->name);
+        return true;
+    }
+    if (this->batchSplitting != rhs.batchSplitting) {
+        SPDLOG_DEBUG("ModelConfig {} reload required due to batch splitting mismatch", this->name);
+        return true;
+    }
+    if (this->maxQueueSize != rhs.maxQueueSize || this->maxQueueWaitMs != rhs.maxQueueWaitMs) {
+        SPDLOG_DEBUG("ModelConfig {} reload required due to queue limits mismatch", this->name);
+        return true;
+    }
+    if (this->priority != rhs.priority) {
+        SPDLOG_DEBUG("ModelConfig {} reload required due to priority mismatch", this->name);
+        return true;
+    }
+    if (this->responseCache != rhs.responseCache) {
+        SPDLOG_DEBUG("ModelConfig {} reload required due to response cache mismatch", this->name);
+        return true;
+    }
+    if (this->stateful != rhs.stateful || this->maxSequenceNumber != rhs.maxSequenceNumber ||
+        this->idleSequenceTimeoutS != rhs.idleSequenceTimeoutS) {
+        SPDLOG_DEBUG("ModelConfig {} reload required due to stateful configuration mismatch", this->name);
+        return true;
+    }
     if (!isShapeConfigurationEqual(rhs)) {
         SPDLOG_DEBUG("ModelConfig {} reload required due to shape configuration mismatch", this->name);
         return true;
@@ -409,6 +438,88 @@ Status ModelConfig::parseNode(const rapidjson::Value& v) {
         }
     }
 
+    if (v.HasMember("precision_conversion")) {
+        if (v["precision_conversion"].IsBool()) {
+            this->setPrecisionConversion(v["precision_conversion"].GetBool());
+        } else {
+            for (auto& input : v["precision_conversion"].GetArray()) {
+                this->addPrecisionConversionInput(input.GetString());
+            }
+        }
+    }
+
+    if (v.HasMember("post_processing")) {
+        for (auto& output : v["post_processing"].GetObject()) {
+            PostProcessingConfig config;
+            const std::string type = output.value["type"].GetString();
+            if (type == "argmax") {
+                config.kind = PostProcessingKind::ARGMAX;
+            } else if (type == "detections") {
+                config.kind = PostProcessingKind::DETECTIONS;
+            }
+            if (output.value.HasMember("k")) {
+                config.k = output.value["k"].GetUint64();
+            }
+            if (output.value.HasMember("score_threshold")) {
+                config.scoreThreshold = output.value["score_threshold"].GetFloat();
+            }
+            if (output.value.HasMember("iou_threshold")) {
+                config.iouThreshold = output.value["iou_threshold"].GetFloat();
+            }
+            if (output.value.HasMember("max_detections")) {
+                config.maxDetections = output.value["max_detections"].GetUint64();
+            }
+            this->addPostProcessing(output.name.GetString(), config);
+        }
+    }
+
+    if (v.HasMember("batch_splitting")) {
+        this->setBatchSplitting(v["batch_splitting"].GetBool());
+    }
+
+    if (v.HasMember("max_queue_size")) {
+        this->setMaxQueueSize(v["max_queue_size"].GetUint64());
+    }
+
+    if (v.HasMember("max_queue_wait_ms")) {
+        this->setMaxQueueWaitMs(v["max_queue_wait_ms"].GetUint64());
+    }
+
+    if (v.HasMember("priority")) {
+        PriorityClass priority;
+        auto status = parsePriorityClass(v["priority"].GetString(), priority);
+        if (!status.ok()) {
+            SPDLOG_ERROR("Invalid priority of model {}: {}", this->name, v["priority"].GetString());
+            return status;
+        }
+        this->setPriority(priority);
+    }
+
+    if (v.HasMember("response_cache")) {
+        ResponseCacheConfig responseCache;
+        responseCache.enabled = true;
+        const auto& cache = v["response_cache"];
+        if (cache.HasMember("max_size_mb")) {
+            responseCache.maxSizeMb = cache["max_size_mb"].GetUint64();
+        }
+        if (cache.HasMember("ttl_ms")) {
+            responseCache.ttlMs = cache["ttl_ms"].GetUint64();
+        }
+        this->setResponseCache(responseCache);
+    }
+
+    if (v.HasMember("stateful")) {
+        this->setStateful(v["stateful"].GetBool());
+    }
+
+    if (v.HasMember("max_sequence_number")) {
+        this->setMaxSequenceNumber(v["max_sequence_number"].GetUint());
+    }
+
+    if (v.HasMember("idle_sequence_timeout_s")) {
+        this->setIdleSequenceTimeoutS(v["idle_sequence_timeout_s"].GetUint());
+    }
+
     if (v.HasMember("plugin_config")) {
         if (!parsePluginConfig(v["plugin_config"]).ok()) {
             SPDLOG_WARN("Couldn't parse plugin config");
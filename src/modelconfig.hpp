@@ -18,6 +18,7 @@
 #include <fstream>
 #include <map>
 #include <memory>
+#include <set>
 #include <string>
 #include <tuple>
 #include <unordered_map>
@@ -26,6 +27,7 @@
 #include <rapidjson/document.h>
 
 #include "model_version_policy.hpp"
+#include "priorityscheduler.hpp"
 #include "status.hpp"
 
 namespace ovms {
@@ -49,11 +51,67 @@ struct ShapeInfo {
     }
 };
 
+enum class PostProcessingKind {
+    TOP_K,
+    ARGMAX,
+    DETECTIONS
+};
+
+/**
+     * @brief Post-processing applied to model output before serialization
+     */
+struct PostProcessingConfig {
+    PostProcessingKind kind = PostProcessingKind::TOP_K;
+
+    // Number of largest values kept along the last dimension (top_k)
+    size_t k = 1;
+
+    // Detections with lower confidence are dropped (detections)
+    float scoreThreshold = 0.0f;
+
+    // Detections of the same class overlapping more are suppressed, 1 disables suppression (detections)
+    float iouThreshold = 1.0f;
+
+    // Limit of detections per image, 0 means no limit (detections)
+    size_t maxDetections = 0;
+
+    bool operator==(const PostProcessingConfig& rhs) const {
+        return this->kind == rhs.kind && this->k == rhs.k && this->scoreThreshold == rhs.scoreThreshold &&
+               this->iouThreshold == rhs.iouThreshold && this->maxDetections == rhs.maxDetections;
+    }
+
+    bool operator!=(const PostProcessingConfig& rhs) const {
+        return !(*this == rhs);
+    }
+};
+
 using shapes_map_t = std::unordered_map<std::string, ShapeInfo>;
 using layouts_map_t = std::unordered_map<std::string, std::string>;
 using mapping_config_t = std::unordered_map<std::string, std::string>;
 using plugin_config_t = std::map<std::string, std::string>;
 using custom_loader_options_config_t = std::map<std::string, std::string>;
+using post_processing_map_t = std::map<std::string, PostProcessingConfig>;
+
+struct ResponseCacheConfig {
+    bool enabled = false;
+
+    // Limit of cached responses size, 0 keeps only coalescing of identical in-flight requests
+    size_t maxSizeMb = 0;
+
+    // Time after which cached response is not used, 0 means no expiration
+    uint64_t ttlMs = 0;
+
+    bool operator==(const ResponseCacheConfig& rhs) const {
+        return this->enabled == rhs.enabled && this->maxSizeMb == rhs.maxSizeMb && this->ttlMs == rhs.ttlMs;
+    }
+
+    bool operator!=(const ResponseCacheConfig& rhs) const {
+        return !(*this == rhs);
+    }
+};
+
+const uint32_t DEFAULT_MAX_SEQUENCE_NUMBER = 500;
+const uint32_t DEFAULT_IDLE_SEQUENCE_TIMEOUT_S = 60;
 
 const std::string ANONYMOUS_INPUT_NAME = "ANONYMOUS_INPUT_NAME";
 const std::string MAPPING_CONFIG_JSON = "mapping_config.json";
@@ -123,6 +181,56 @@ private:
          */
     layouts_map_t layouts;
 
+    /**
+         * @brief Inputs accepting request data of other precision than network precision
+         */
+    std::set<std::string> precisionConversionInputs;
+
+    /**
+         * @brief Post-processing of outputs keyed by output name
+         */
+    post_processing_map_t postProcessing;
+
+    /**
+         * @brief Allows splitting requests with batch larger than the network batch size across infer requests
+         */
+    bool batchSplitting = false;
+
+    /**
+         * @brief Maximum number of requests waiting for infer request, 0 means no limit
+         */
+    size_t maxQueueSize = 0;
+
+    /**
+         * @brief Maximum time in milliseconds a request waits for infer request, 0 means no limit
+         */
+    uint64_t maxQueueWaitMs = 0;
+
+    /**
+         * @brief Priority class of model requests when inference slots are scheduled
+         */
+    PriorityClass priority = PriorityClass::NORMAL;
+
+    /**
+         * @brief Response cache and coalescing of identical requests
+         */
+    ResponseCacheConfig responseCache;
+
+    /**
+         * @brief Model keeps memory state of each sequence of requests between inferences
+         */
+    bool stateful = false;
+
+    /**
+         * @brief Maximum number of concurrent sequences of stateful model
+         */
+    uint32_t maxSequenceNumber = DEFAULT_MAX_SEQUENCE_NUMBER;
+
+    /**
+         * @brief Time in seconds after which sequence without requests is removed, 0 means no removal
+         */
+    uint32_t idleSequenceTimeoutS = DEFAULT_IDLE_SEQUENCE_TIMEOUT_S;
+
     /**
          * @brief Model version
          */
@@ -537,6 +645,202 @@ public:
         return it->second.shapeMode == Mode::AUTO;
     }
 
+    /**
+         * @brief Get inputs with enabled precision conversion
+         *
+         * @return const std::set<std::string>&
+         */
+    const std::set<std::string>& getPrecisionConversionInputs() const {
+        return this->precisionConversionInputs;
+    }
+
+    /**
+         * @brief Enable precision conversion for all inputs
+         */
+    void setPrecisionConversion(bool enabled) {
+        this->precisionConversionInputs.clear();
+        if (enabled) {
+            this->precisionConversionInputs.insert(ANONYMOUS_INPUT_NAME);
+        }
+    }
+
+    /**
+         * @brief Enable precision conversion for a named input
+         *
+         * @param name
+         */
+    void addPrecisionConversionInput(const std::string& name) {
+        this->precisionConversionInputs.insert(name);
+    }
+
+    bool isPrecisionConversionAllowed(const std::string& name) const {
+        return this->precisionConversionInputs.count(name) > 0 ||
+               this->precisionConversionInputs.count(ANONYMOUS_INPUT_NAME) > 0;
+    }
+
+    /**
+         * @brief Get post-processing of outputs
+         *
+         * @return const post_processing_map_t&
+         */
+    const post_processing_map_t& getPostProcessing() const {
+        return this->postProcessing;
+    }
+
+    /**
+         * @brief Set post-processing of a named output
+         *
+         * @param name
+         * @param config
+         */
+    void addPostProcessing(const std::string& name, const PostProcessingConfig& config) {
+        this->postProcessing[name] = config;
+    }
+
+    /**
+         * @brief Check if requests with large batch may be split across infer requests
+         *
+         * @return bool
+         */
+    bool isBatchSplittingEnabled() const {
+        return this->batchSplitting;
+    }
+
+    /**
+         * @brief Enable splitting of requests with large batch across infer requests
+         *
+         * @param enabled
+         */
+    void setBatchSplitting(bool enabled) {
+        this->batchSplitting = enabled;
+    }
+
+    /**
+         * @brief Get maximum number of requests waiting for infer request
+         *
+         * @return size_t
+         */
+    size_t getMaxQueueSize() const {
+        return this->maxQueueSize;
+    }
+
+    /**
+         * @brief Set maximum number of requests waiting for infer request
+         *
+         * @param maxQueueSize
+         */
+    void setMaxQueueSize(size_t maxQueueSize) {
+        this->maxQueueSize = maxQueueSize;
+    }
+
+    /**
+         * @brief Get maximum time in milliseconds a request waits for infer request
+         *
+         * @return uint64_t
+         */
+    uint64_t getMaxQueueWaitMs() const {
+        return this->maxQueueWaitMs;
+    }
+
+    /**
+         * @brief Set maximum time in milliseconds a request waits for infer request
+         *
+         * @param maxQueueWaitMs
+         */
+    void setMaxQueueWaitMs(uint64_t maxQueueWaitMs) {
+        this->maxQueueWaitMs = maxQueueWaitMs;
+    }
+
+    /**
+         * @brief Get priority class of model requests
+         *
+         * @return PriorityClass
+         */
+    PriorityClass getPriority() const {
+        return this->priority;
+    }
+
+    /**
+         * @brief Set priority class of model requests
+         *
+         * @param priority
+         */
+    void setPriority(PriorityClass priority) {
+        this->priority = priority;
+    }
+
+    /**
+         * @brief Get response cache configuration
+         *
+         * @return const ResponseCacheConfig&
+         */
+    const ResponseCacheConfig& getResponseCache() const {
+        return this->responseCache;
+    }
+
+    /**
+         * @brief Set response cache configuration
+         *
+         * @param responseCache
+         */
+    void setResponseCache(const ResponseCacheConfig& responseCache) {
+        this->responseCache = responseCache;
+    }
+
+    /**
+         * @brief Check if model keeps memory state of sequences
+         *
+         * @return bool
+         */
+    bool isStateful() const {
+        return this->stateful;
+    }
+
+    /**
+         * @brief Set stateful flag
+         *
+         * @param stateful
+         */
+    void setStateful(bool stateful) {
+        this->stateful = stateful;
+    }
+
+    /**
+         * @brief Get maximum number of concurrent sequences
+         *
+         * @return uint32_t
+         */
+    uint32_t getMaxSequenceNumber() const {
+        return this->maxSequenceNumber;
+    }
+
+    /**
+         * @brief Set maximum number of concurrent sequences
+         *
+         * @param maxSequenceNumber
+         */
+    void setMaxSequenceNumber(uint32_t maxSequenceNumber) {
+        this->maxSequenceNumber = maxSequenceNumber;
+    }
+
+    /**
+         * @brief Get idle sequence timeout in seconds
+         *
+         * @return uint32_t
+         */
+    uint32_t getIdleSequenceTimeoutS() const {
+        return this->idleSequenceTimeoutS;
+    }
+
+    /**
+         * @brief Set idle sequence timeout in seconds
+         *
+         * @param idleSequenceTimeoutS
+         */
+    void setIdleSequenceTimeoutS(uint32_t idleSequenceTimeoutS) {
+        this->idleSequenceTimeoutS = idleSequenceTimeoutS;
+    }
+
     bool isShapeAnonymous() const {
         return getShapes().size() == 1 && getShapes().begin()->first == ANONYMOUS_INPUT_NAME;
     }
@@ -27,10 +27,15 @@
 #include <spdlog/spdlog.h>
 #include <sys/types.h>
 
+#include "binaryutils.hpp"
 #include "config.hpp"
 #include "customloaders.hpp"
 #include "filesystem.hpp"
 #include "logging.hpp"
+#include "ov_utils.hpp"
+#include "postprocessing.hpp"
+#include "serialization.hpp"
+#include "shared_memory.hpp"
 #include "stringutils.hpp"
 
 using namespace InferenceEngine;
@@ -112,6 +117,7 @@ Status ModelInstance::loadInputTensors(const ModelConfig& config, const DynamicM
 
         auto mappingName = config.getMappingInputByKey(name);
         auto tensor = std::make_shared<TensorInfo>(name, mappingName, precision, shape, layout);
+        tensor->setPrecisionConversionAllowed(config.isPrecisionConversionAllowed(name));
         std::string precision_str = tensor->getPrecisionAsString();
         this->inputsInfo[tensor->getMappedName()] = std::move(tensor);
         std::stringstream shape_stream;
@@ -137,7 +143,41 @@ Status ModelInstance::loadInputTensors(const ModelConfig& config, const DynamicM
     return StatusCode::OK;
 }
 
-void ModelInstance::loadOutputTensors(const ModelConfig& config) {
+Status ModelInstance::validatePostProcessing(const TensorInfo& tensor, const PostProcessingConfig& config) {
+    const auto& shape = tensor.getShape();
+    if (tensor.getPrecision() != InferenceEngine::Precision::FP32 &&
+        tensor.getPrecision() != InferenceEngine::Precision::FP16) {
+        SPDLOG_WARN("Post-processing of output: {} requires FP32 or FP16 precision, got: {}", tensor.getName(), tensor.getPrecisionAsString());
+        return StatusCode::POST_PROCESSING_NOT_SUPPORTED;
+    }
+    if (shape.empty()) {
+        SPDLOG_WARN("Post-processing of scalar output: {} is not supported", tensor.getName());
+        return StatusCode::POST_PROCESSING_NOT_SUPPORTED;
+    }
+    switch (config.kind) {
+    case PostProcessingKind::TOP_K:
+        if (config.k > shape.back()) {
+            SPDLOG_WARN("Post-processing of output: {} requests top {} values of dimension {}", tensor.getName(), config.k, shape.back());
+            return StatusCode::POST_PROCESSING_NOT_SUPPORTED;
+        }
+        if (this->outputsInfo.count(tensor.getMappedName() + TOP_K_INDICES_SUFFIX)) {
+            SPDLOG_WARN("Indices of top_k post-processing of output: {} would overwrite another output", tensor.getName());
+            return StatusCode::POST_PROCESSING_NOT_SUPPORTED;
+        }
+        break;
+    case PostProcessingKind::DETECTIONS:
+        if (shape.size() < 2 || shape.back() != DETECTION_SIZE) {
+            SPDLOG_WARN("Post-processing of output: {} requires detections of size {} in the last dimension", tensor.getName(), DETECTION_SIZE);
+            return StatusCode::POST_PROCESSING_NOT_SUPPORTED;
+        }
+        break;
+    case PostProcessingKind::ARGMAX:
+        break;
+    }
+    return StatusCode::OK;
+}
+
+Status ModelInstance::loadOutputTensors(const ModelConfig& config) {
     this->outputsInfo.clear();
     for (const auto& pair : network->getOutputsInfo()) {
         const auto& name = pair.first;
@@ -150,12 +190,29 @@ void ModelInstance::loadOutputTensors(const ModelConfig& config) {
         auto mappingName = config.getMappingOutputByKey(name);
         auto tensor = std::make_shared<TensorInfo>(name, mappingName, precision, shape, layout);
         std::string precision_str = tensor->getPrecisionAsString();
+        auto postProcessing = config.getPostProcessing().find(name);
+        if (postProcessing != config.getPostProcessing().end()) {
+            tensor->setPostProcessing(postProcessing->second);
+        }
         this->outputsInfo[tensor->getMappedName()] = std::move(tensor);
         std::stringstream shape_stream;
         std::copy(shape.begin(), shape.end(), std::ostream_iterator<size_t>(shape_stream, " "));
         SPDLOG_INFO("Output name: {} ; mapping name: {}; shape: {} ; precision: {}, layout:{}",
             name, mappingName, shape_stream.str(), precision_str, TensorInfo::getStringFromLayout(output->getLayout()));
     }
+    for (const auto& postProcessing : config.getPostProcessing()) {
+        auto it = std::find_if(this->outputsInfo.begin(), this->outputsInfo.end(),
+            [&postProcessing](const auto& pair) { return pair.second->getName() == postProcessing.first; });
+        if (it == this->outputsInfo.end()) {
+            SPDLOG_WARN("Post-processing configured for output: {} not found in network", postProcessing.first);
+            return StatusCode::POST_PROCESSING_NOT_SUPPORTED;
+        }
+        auto status = validatePostProcessing(*it->second, postProcessing.second);
+        if (!status.ok()) {
+            return status;
+        }
+    }
+    return StatusCode::OK;
 }
 
 // Temporary methods. To be replaces with proper storage class.
@@ -275,8 +332,10 @@ Status ModelInstance::loadOVCNNNetwork() {
 Status ModelInstance::loadOVCNNNetworkUsingCustomLoader() {
     SPDLOG_DEBUG("Try reading model using a custom loader");
     try {
-        std::vector<uint8_t> model;
-        std::vector<uint8_t> weights;
+        // Declared before buffers, so that loader library stays open until they are released
+        std::shared_ptr<void> library;
+        std::unique_ptr<CustomLoaderBuffer> model;
+        std::unique_ptr<CustomLoaderBuffer> weights;
 
         SPDLOG_INFO("loading CNNNetwork for model: {} basepath: {} <> {} version: {}", getName(), getPath(), this->config.getBasePath().c_str(), getVersion());
 
@@ -289,23 +348,51 @@ Status ModelInstance::loadOVCNNNetworkUsingCustomLoader() {
             SPDLOG_INFO("Loader {} is not in loaded customloaders list", loaderName);
             throw std::invalid_argument("customloader not exisiting");
         }
-
-        CustomLoaderStatus res = customLoaderInterfacePtr->loadModel(this->config.getName(),
-            this->config.getBasePath(),
-            getVersion(),
-            this->config.getCustomLoaderOptionsConfigStr(), model, weights);
+        library = customloaders.findLibrary(loaderName);
+
+        CustomLoaderStatus res;
+        auto bufferLoader = std::dynamic_pointer_cast<CustomLoaderInterfaceV2>(customLoaderInterfacePtr);
+        if (bufferLoader) {
+            res = bufferLoader->loadModelBuffers(this->config.getName(),
+                this->config.getBasePath(),
+                getVersion(),
+                this->config.getCustomLoaderOptionsConfigStr(), model, weights);
+        } else {
+            std::vector<uint8_t> modelVector;
+            std::vector<uint8_t> weightsVector;
+            res = customLoaderInterfacePtr->loadModel(this->config.getName(),
+                this->config.getBasePath(),
+                getVersion(),
+                this->config.getCustomLoaderOptionsConfigStr(), modelVector, weightsVector);
+            model = CustomLoaderBuffer::fromVector(std::move(modelVector));
+            weights = CustomLoaderBuffer::fromVector(std::move(weightsVector));
+        }
 
         if ((res == CustomLoaderStatus::MODEL_LOAD_ERROR) || (res == CustomLoaderStatus::INTERNAL_ERROR)) {
             return StatusCode::INTERNAL_ERROR;
         }
+        if (!model) {
+            SPDLOG_ERROR("Custom loader {} did not provide model: {} version: {}", loaderName, getName(), getVersion());
+            return StatusCode::INTERNAL_ERROR;
+        }
 
-        std::string strModel(model.begin(), model.end());
+        // Model description is small, weights are wrapped into blob without copying
+        std::string strModel(reinterpret_cast<const char*>(model->data()), model->size());
+        model.reset();
 
         if (res == CustomLoaderStatus::MODEL_TYPE_IR) {
+            if (!weights) {
+                SPDLOG_ERROR("Custom loader {} did not provide weights of model: {} version: {}", loaderName, getName(), getVersion());
+                return StatusCode::INTERNAL_ERROR;
+            }
             network = std::make_unique<InferenceEngine::CNNNetwork>(engine->ReadNetwork(strModel,
-                make_shared_blob<uint8_t>({Precision::U8, {weights.size()}, C}, weights.data())));
+                make_shared_blob<uint8_t>({Precision::U8, {weights->size()}, C}, const_cast<uint8_t*>(weights->data()), weights->size())));
+            customLoaderWeights = std::move(weights);
+            customLoaderLibrary = std::move(library);
         } else if (res == CustomLoaderStatus::MODEL_TYPE_ONNX) {
             network = std::make_unique<InferenceEngine::CNNNetwork>(engine->ReadNetwork(strModel, InferenceEngine::Blob::CPtr()));
+            customLoaderWeights.reset();
+            customLoaderLibrary.reset();
         } else if (res == CustomLoaderStatus::MODEL_TYPE_BLOB) {
             return StatusCode::INTERNAL_ERROR;
         }
@@ -405,15 +492,39 @@ Status ModelInstance::prepareInferenceRequestsQueue(const ModelConfig& config) {
     if (numberOfParallelInferRequests == 0) {
         return Status(StatusCode::INVALID_NIREQ, "Exceeded allowed nireq value");
     }
-    inferRequestsQueue = std::make_unique<OVInferRequestsQueue>(*execNetwork, numberOfParallelInferRequests);
-    SPDLOG_INFO("Loaded model {}; version: {}; batch size: {}; No of InferRequests: {}",
+    inferRequestsQueue = std::make_unique<OVInferRequestsQueue>(*execNetwork, numberOfParallelInferRequests,
+        config.getMaxQueueSize(), std::chrono::milliseconds(config.getMaxQueueWaitMs()));
+    SPDLOG_INFO("Loaded model {}; version: {}; batch size: {}; No of InferRequests: {}; max queue size: {}; max queue wait: {} ms",
         getName(),
         getVersion(),
         getBatchSize(),
-        numberOfParallelInferRequests);
+        numberOfParallelInferRequests,
+        config.getMaxQueueSize(),
+        config.getMaxQueueWaitMs());
     return StatusCode::OK;
 }
 
+void ModelInstance::prepareResponseCache(const ModelConfig& config) {
+    const auto& cacheConfig = config.getResponseCache();
+    if (!cacheConfig.enabled) {
+        responseCache.reset();
+        return;
+    }
+    responseCache = std::make_shared<ResponseCache>(cacheConfig.maxSizeMb * 1024 * 1024, std::chrono::milliseconds(cacheConfig.ttlMs));
+    SPDLOG_INFO("Response cache of model {}; version: {}; max size: {} MB; ttl: {} ms",
+        getName(), getVersion(), cacheConfig.maxSizeMb, cacheConfig.ttlMs);
+}
+
+void ModelInstance::prepareSequenceManager(const ModelConfig& config) {
+    if (!config.isStateful()) {
+        sequenceManager.reset();
+        return;
+    }
+    sequenceManager = std::make_shared<SequenceManager>(config.getMaxSequenceNumber(), std::chrono::seconds(config.getIdleSequenceTimeoutS()));
+    SPDLOG_INFO("Stateful model {}; version: {}; max sequence number: {}; idle sequence timeout: {} s",
+        getName(), getVersion(), config.getMaxSequenceNumber(), config.getIdleSequenceTimeoutS());
+}
+
 void ModelInstance::configureBatchSize(const ModelConfig& config, const DynamicModelParameter& parameter) {
     if (parameter.isBatchSizeRequested()) {
         network->setBatchSize(parameter.getBatchSize());
@@ -456,7 +567,11 @@ Status ModelInstance::loadModelImpl(const ModelConfig& config, const DynamicMode
             this->status.setLoading(ModelVersionStatusErrorCode::UNKNOWN);
             return status;
         }
-        loadOutputTensors(this->config);
+        status = loadOutputTensors(this->config);
+        if (!status.ok()) {
+            this->status.setLoading(ModelVersionStatusErrorCode::UNKNOWN);
+            return status;
+        }
         status = loadOVExecutableNetwork(this->config);
         if (!status.ok()) {
             this->status.setLoading(ModelVersionStatusErrorCode::UNKNOWN);
@@ -467,6 +582,8 @@ Status ModelInstance::loadModelImpl(const ModelConfig& config, const DynamicMode
             this->status.setLoading(ModelVersionStatusErrorCode::UNKNOWN);
             return status;
         }
+        prepareResponseCache(this->config);
+        prepareSequenceManager(this->config);
     } catch (const InferenceEngine::details::InferenceEngineException& e) {
         SPDLOG_ERROR("exception occurred while loading network: {}", e.what());
         this->status.setLoading(ModelVersionStatusErrorCode::UNKNOWN);
@@ -607,8 +724,12 @@ void ModelInstance::unloadModel(bool isPermanent) {
         std::this_thread::sleep_for(std::chrono::milliseconds(UNLOAD_AVAILABILITY_CHECKING_INTERVAL_MILLISECONDS));
     }
     inferRequestsQueue.reset();
+    responseCache.reset();
+    sequenceManager.reset();
     execNetwork.reset();
     network.reset();
+    customLoaderWeights.reset();
+    customLoaderLibrary.reset();
     engine.reset();
     outputsInfo.clear();
     inputsInfo.clear();
@@ -634,8 +755,13 @@ void ModelInstance::unloadModel(bool isPermanent) {
 
 const Status ModelInstance::validatePrecision(const ovms::TensorInfo& networkInput,
     const tensorflow::TensorProto& requestInput) {
-    // Network and request must have the same precision
+    // Network and request must have the same precision, unless conversion is enabled for the input
     if (requestInput.dtype() != networkInput.getPrecisionAsDataType()) {
+        if (networkInput.isPrecisionConversionAllowed() &&
+            !isSharedMemoryReference(requestInput) &&
+            isPrecisionConversionSupported(TensorInfo::getPrecisionFromDataType(requestInput.dtype()), networkInput.getPrecision())) {
+            return StatusCode::OK;
+        }
         std::stringstream ss;
         ss << "Expected: " << networkInput.getPrecisionAsString()
            << "; Actual: " << TensorInfo::getDataTypeAsString(requestInput.dtype());
@@ -663,8 +789,9 @@ const Status ModelInstance::validateNumberOfShapeDimensions(const ovms::TensorIn
 }
 
 const bool ModelInstance::checkBatchSizeMismatch(const ovms::TensorInfo& networkInput,
-    const tensorflow::TensorProto& requestInput) {
-    if (static_cast<size_t>(requestInput.tensor_shape().dim(0).size()) != getBatchSize())
+    const tensorflow::TensorProto& requestInput,
+    size_t chunksCount) {
+    if (static_cast<size_t>(requestInput.tensor_shape().dim(0).size()) != getBatchSize() * chunksCount)
         return true;
     return false;
 }
@@ -703,6 +830,11 @@ const Status ModelInstance::validateTensorContentSize(const ovms::TensorInfo& ne
     https://github.com/tensorflow/tensorflow/blob/903a6399aab19b549fefd0ead836af644f3d00f8/tensorflow/python/framework/tensor_util.py#L237
 */
 
+    // Data placed in shared memory is bounds checked when the region is accessed
+    if (isSharedMemoryReference(requestInput)) {
+        return StatusCode::OK;
+    }
+
     size_t expectedValueCount = 1;
     for (int i = 0; i < requestInput.tensor_shape().dim_size(); i++) {
         expectedValueCount *= requestInput.tensor_shape().dim(i).size();
@@ -728,7 +860,9 @@ const Status ModelInstance::validateTensorContentSize(const ovms::TensorInfo& ne
             return Status(StatusCode::INVALID_VALUE_COUNT, details);
         }
     } else {
-        size_t expectedContentSize = expectedValueCount * networkInput.getPrecision().size();
+        // Request data may differ in precision from network input if conversion is enabled
+        size_t elementSize = requestInput.dtype() == networkInput.getPrecisionAsDataType() ? networkInput.getPrecision().size() : tensorflow::DataTypeSize(requestInput.dtype());
+        size_t expectedContentSize = expectedValueCount * elementSize;
         if (expectedContentSize != requestInput.tensor_content().size()) {
             std::stringstream ss;
             ss << "Expected: " << expectedContentSize << " bytes; Actual: " << requestInput.tensor_content().size() << " bytes";
@@ -740,13 +874,47 @@ const Status ModelInstance::validateTensorContentSize(const ovms::TensorInfo& ne
     return StatusCode::OK;
 }
 
-const Status ModelInstance::validate(const tensorflow::serving::PredictRequest* request) {
+bool ModelInstance::isServedOutput(const std::string& name) const {
+    if (getOutputsInfo().count(name) > 0) {
+        return true;
+    }
+    // Indices of top_k post-processing are served as additional output
+    if (name.size() <= TOP_K_INDICES_SUFFIX.size() ||
+        name.compare(name.size() - TOP_K_INDICES_SUFFIX.size(), TOP_K_INDICES_SUFFIX.size(), TOP_K_INDICES_SUFFIX) != 0) {
+        return false;
+    }
+    auto it = getOutputsInfo().find(name.substr(0, name.size() - TOP_K_INDICES_SUFFIX.size()));
+    return it != getOutputsInfo().end() &&
+           it->second->getPostProcessing() &&
+           it->second->getPostProcessing()->kind == PostProcessingKind::TOP_K;
+}
+
+const Status ModelInstance::validateOutputFilter(const tensorflow::serving::PredictRequest& request) {
+    // Output filter may only reference outputs present in responses
+    for (const auto& name : request.output_filter()) {
+        if (!isServedOutput(name)) {
+            std::stringstream ss;
+            ss << "Unknown output: " << name;
+            const std::string details = ss.str();
+            SPDLOG_DEBUG("[Model: {} version: {}] Invalid output filter - {}", getName(), getVersion(), details);
+            return Status(StatusCode::INVALID_OUTPUT_FILTER, details);
+        }
+    }
+    return StatusCode::OK;
+}
+
+const Status ModelInstance::validate(const tensorflow::serving::PredictRequest* request, size_t chunksCount) {
     Status finalStatus = StatusCode::OK;
 
-    // Network and request must have the same amount of inputs
-    if (request->inputs_size() < 0 || getInputsInfo().size() != static_cast<size_t>(request->inputs_size())) {
+    auto outputFilterStatus = validateOutputFilter(*request);
+    if (!outputFilterStatus.ok())
+        return outputFilterStatus;
+
+    // Network and request must have the same amount of inputs, sequence inputs of stateful model are not network inputs
+    const size_t sequenceInputsCount = getModelConfig().isStateful() ? countSequenceInputs(*request) : 0;
+    if (request->inputs_size() < 0 || getInputsInfo().size() != static_cast<size_t>(request->inputs_size()) - sequenceInputsCount) {
         std::stringstream ss;
-        ss << "Expected: " << getInputsInfo().size() << "; Actual: " << request->inputs_size();
+        ss << "Expected: " << getInputsInfo().size() << "; Actual: " << request->inputs_size() - sequenceInputsCount;
         const std::string details = ss.str();
         SPDLOG_DEBUG("[Model: {} version: {}] Invalid number of inputs - {}", getName(), getVersion(), details);
         return Status(StatusCode::INVALID_NO_OF_INPUTS, details);
@@ -770,6 +938,25 @@ const Status ModelInstance::validate(const tensorflow::serving::PredictRequest*
         Mode batchingMode = getModelConfig().getBatchingMode();
         Mode shapeMode = getModelConfig().isShapeAuto(name) ? AUTO : FIXED;
 
+        if (isBinaryInput(requestInput)) {
+            // Encoded images are resized to the network input shape, only batch size needs to match
+            auto status = validateBinaryInput(*networkInput, requestInput);
+            if (!status.ok())
+                return status;
+            if (checkBatchSizeMismatch(*networkInput, requestInput, chunksCount)) {
+                if (batchingMode == AUTO) {
+                    finalStatus = StatusCode::BATCHSIZE_CHANGE_REQUIRED;
+                } else {
+                    std::stringstream ss;
+                    ss << "Expected: " << getBatchSize() * chunksCount << "; Actual: " << requestInput.tensor_shape().dim(0).size();
+                    const std::string details = ss.str();
+                    SPDLOG_DEBUG("[Model: {} version: {}] Invalid batch size - {}", getName(), getVersion(), details);
+                    return Status(StatusCode::INVALID_BATCH_SIZE, details);
+                }
+            }
+            continue;
+        }
+
         auto status = validatePrecision(*networkInput, requestInput);
         if (!status.ok())
             return status;
@@ -778,19 +965,20 @@ const Status ModelInstance::validate(const tensorflow::serving::PredictRequest*
         if (!status.ok())
             return status;
 
-        if (checkBatchSizeMismatch(*networkInput, requestInput)) {
+        if (checkBatchSizeMismatch(*networkInput, requestInput, chunksCount)) {
             if (batchingMode == AUTO) {
                 finalStatus = StatusCode::BATCHSIZE_CHANGE_REQUIRED;
             } else if (shapeMode != AUTO) {
                 std::stringstream ss;
-                ss << "Expected: " << getBatchSize() << "; Actual: " << requestInput.tensor_shape().dim(0).size();
+                ss << "Expected: " << getBatchSize() * chunksCount << "; Actual: " << requestInput.tensor_shape().dim(0).size();
                 const std::string details = ss.str();
                 SPDLOG_DEBUG("[Model: {} version: {}] Invalid batch size - {}", getName(), getVersion(), details);
                 return Status(StatusCode::INVALID_BATCH_SIZE, details);
             }
         }
 
-        if (checkShapeMismatch(*networkInput, requestInput, batchingMode)) {
+        // First dimension of split request was checked against batch size of all its chunks
+        if (checkShapeMismatch(*networkInput, requestInput, chunksCount > 1 ? AUTO : batchingMode)) {
             if (shapeMode == AUTO) {
                 finalStatus = StatusCode::RESHAPE_REQUIRED;
             } else {
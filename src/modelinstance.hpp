@@ -38,6 +38,8 @@
 #include "modelinstanceunloadguard.hpp"
 #include "modelversionstatus.hpp"
 #include "ovinferrequestsqueue.hpp"
+#include "responsecache.hpp"
+#include "sequence_manager.hpp"
 #include "status.hpp"
 #include "tensorinfo.hpp"
 
@@ -85,6 +87,16 @@ protected:
          */
     std::unique_ptr<InferenceEngine::CNNNetwork> network;
 
+    /**
+         * @brief Library of custom loader which provided weights, declared before them so that it is closed after they are released
+         */
+    std::shared_ptr<void> customLoaderLibrary;
+
+    /**
+         * @brief Weights provided by custom loader, network may refer to them without copying
+         */
+    std::unique_ptr<CustomLoaderBuffer> customLoaderWeights;
+
     /**
          * @brief Inference Engine device network
          */
@@ -156,6 +168,16 @@ protected:
          */
     Status prepareInferenceRequestsQueue(const ModelConfig& config);
 
+    /**
+         * @brief Creates empty response cache when enabled in config
+         */
+    void prepareResponseCache(const ModelConfig& config);
+
+    /**
+         * @brief Creates empty sequence manager when model is stateful
+         */
+    void prepareSequenceManager(const ModelConfig& config);
+
     /**
          * @brief Fetch model file paths
          *
@@ -219,6 +241,16 @@ private:
          */
     std::unique_ptr<OVInferRequestsQueue> inferRequestsQueue;
 
+    /**
+         * @brief Responses of currently loaded model, shared with requests which may reload the model
+         */
+    std::shared_ptr<ResponseCache> responseCache;
+
+    /**
+         * @brief Sequences of stateful model, shared with requests which may reload the model
+         */
+    std::shared_ptr<SequenceManager> sequenceManager;
+
     /**
          * @brief Holds current usage count in predict requests
          * 
@@ -243,7 +275,17 @@ private:
          *
          * @param config
          */
-    void loadOutputTensors(const ModelConfig& config);
+    Status loadOutputTensors(const ModelConfig& config);
+
+    /**
+         * @brief Internal method for validating post-processing requested for output
+         *
+         * @param tensor
+         * @param config
+         *
+         * @return Status
+         */
+    Status validatePostProcessing(const TensorInfo& tensor, const PostProcessingConfig& config);
 
     /**
          * @brief Performs model loading
@@ -260,11 +302,16 @@ private:
     const Status validatePrecision(const ovms::TensorInfo& networkInput,
         const tensorflow::TensorProto& requestInput);
 
+    bool isServedOutput(const std::string& name) const;
+
+    const Status validateOutputFilter(const tensorflow::serving::PredictRequest& request);
+
     const Status validateNumberOfShapeDimensions(const ovms::TensorInfo& networkInput,
         const tensorflow::TensorProto& requestInput);
 
     const bool checkBatchSizeMismatch(const ovms::TensorInfo& networkInput,
-        const tensorflow::TensorProto& requestInput);
+        const tensorflow::TensorProto& requestInput,
+        size_t chunksCount = 1);
 
     const bool checkShapeMismatch(const ovms::TensorInfo& networkInput,
         const tensorflow::TensorProto& requestInput,
@@ -414,6 +461,24 @@ public:
         return *inferRequestsQueue;
     }
 
+    /**
+         * @brief Get response cache, nullptr when disabled
+         *
+         * @return std::shared_ptr<ResponseCache>
+         */
+    std::shared_ptr<ResponseCache> getResponseCache() const {
+        return responseCache;
+    }
+
+    /**
+         * @brief Get sequence manager, nullptr when model is not stateful
+         *
+         * @return std::shared_ptr<SequenceManager>
+         */
+    std::shared_ptr<SequenceManager> getSequenceManager() const {
+        return sequenceManager;
+    }
+
     /**
          * @brief Combines plugin config from user with default config calculated at runtime
          *
@@ -474,6 +539,10 @@ public:
 
     const ModelChangeSubscription& getSubscribtionManager() const { return subscriptionManager; }
 
-    const Status validate(const tensorflow::serving::PredictRequest* request);
+    /**
+     * @brief Validates request against the model. Request split into chunksCount chunks of the model batch size
+     * is expected to have batch size of all its chunks.
+     */
+    const Status validate(const tensorflow::serving::PredictRequest* request, size_t chunksCount = 1);
 };
 }  // namespace ovms
@@ -190,10 +190,40 @@ void processPipelineConfig(rapidjson::Document& configJson, const rapidjson::Val
         std::string nodeName;
         nodeName = nodeConfig["name"].GetString();
 
+        const std::string nodeKindStr = nodeConfig["type"].GetString();
+        NodeKind nodeKind;
+        auto status = toNodeKind(nodeKindStr, nodeKind);
+        if (!status.ok()) {
+            SPDLOG_LOGGER_WARN(modelmanager_logger, "Parsing node kind failed: {}", nodeKindStr);
+            return;
+        }
+
         std::string modelName;
-        modelName = nodeConfig["model_name"].GetString();
+        NodeLibrary library;
+        parameters_t parameters;
+        if (nodeKind == NodeKind::CUSTOM) {
+            auto libraryPathItr = nodeConfig.FindMember("library_path");
+            if (libraryPathItr == nodeConfig.MemberEnd()) {
+                SPDLOG_LOGGER_WARN(modelmanager_logger, "Pipeline: {} custom node: {} is missing library_path", pipelineName, nodeName);
+                return;
+            }
+            // Library which failed to load is left invalid so that pipeline definition fails validation
+            manager.getCustomNodeLibraryManager().loadLibrary(libraryPathItr->value.GetString(), library);
+            auto paramsItr = nodeConfig.FindMember("params");
+            if (paramsItr != nodeConfig.MemberEnd()) {
+                for (const auto& param : paramsItr->value.GetObject()) {
+                    parameters[param.name.GetString()] = param.value.GetString();
+                }
+            }
+        } else {
+            auto modelNameItr = nodeConfig.FindMember("model_name");
+            if (modelNameItr == nodeConfig.MemberEnd()) {
+                SPDLOG_LOGGER_WARN(modelmanager_logger, "Pipeline: {} node: {} is missing model_name", pipelineName, nodeName);
+                return;
+            }
+            modelName = modelNameItr->value.GetString();
+        }
 
-        const std::string nodeKindStr = nodeConfig["type"].GetString();
         auto nodeOutputsItr = nodeConfig.FindMember("outputs");
         if (nodeOutputsItr == nodeConfig.MemberEnd() || !nodeOutputsItr->value.IsArray()) {
             SPDLOG_LOGGER_WARN(modelmanager_logger, "Pipeline: {} does not have valid outputs configuration", pipelineName);
@@ -207,15 +237,32 @@ void processPipelineConfig(rapidjson::Document& configJson, const rapidjson::Val
         } else {
             modelVersion = std::nullopt;
         }
-        NodeKind nodeKind;
-        auto status = toNodeKind(nodeKindStr, nodeKind);
-        if (!status.ok()) {
-            SPDLOG_LOGGER_WARN(modelmanager_logger, "Parsing node kind failed: {}", nodeKindStr);
-            return;
+        std::optional<size_t> demultiplyCount;
+        if (nodeConfig.HasMember("demultiply_count")) {
+            demultiplyCount = nodeConfig["demultiply_count"].GetUint64();
+        }
+        std::optional<std::string> gatherFromNode;
+        if (nodeConfig.HasMember("gather_from_node")) {
+            gatherFromNode = nodeConfig["gather_from_node"].GetString();
+        }
+        std::optional<ExecutionCondition> executionCondition;
+        auto conditionItr = nodeConfig.FindMember("condition");
+        if (conditionItr != nodeConfig.MemberEnd()) {
+            const auto& conditionConfig = conditionItr->value;
+            ConditionPredicate predicate = ConditionPredicate::NOT_EMPTY;
+            if (conditionConfig.HasMember("predicate")) {
+                status = toConditionPredicate(conditionConfig["predicate"].GetString(), predicate);
+                if (!status.ok()) {
+                    SPDLOG_LOGGER_WARN(modelmanager_logger, "Pipeline: {} node: {} has invalid execution condition", pipelineName, nodeName);
+                    return;
+                }
+            }
+            float threshold = conditionConfig.HasMember("threshold") ? conditionConfig["threshold"].GetFloat() : 0.0f;
+            executionCondition = ExecutionCondition{conditionConfig["node_name"].GetString(), conditionConfig["data_item"].GetString(), predicate, threshold};
         }
         SPDLOG_DEBUG("Creating node: {} type: {} model_name: {} modelVersion: {}",
             nodeName, nodeKindStr, modelName, modelVersion.value_or(0));
-        info.emplace_back(std::move(NodeInfo{nodeKind, nodeName, modelName, modelVersion, nodeOutputNameAlias}));
+        info.emplace_back(std::move(NodeInfo{nodeKind, nodeName, modelName, modelVersion, nodeOutputNameAlias, library, parameters, demultiplyCount, gatherFromNode, executionCondition}));
         auto nodeInputItr = nodeConfig.FindMember("inputs");
         processNodeInputs(nodeName, nodeInputItr, connections);
     }
@@ -249,6 +296,7 @@ Status ModelManager::loadPipelinesConfig(rapidjson::Document& configJson) {
         processPipelineConfig(configJson, pipelineConfig, pipelinesInConfigFile, pipelineFactory, *this);
     }
     pipelineFactory.retireOtherThan(std::move(pipelinesInConfigFile), *this);
+    publishServables();
     return ovms::StatusCode::OK;
 }
 
@@ -450,6 +498,28 @@ void ModelManager::updateConfigurationWithoutConfigFile() {
     pipelineFactory.revalidatePipelines(*this);
 }
 
+void ModelManager::removeIdleSequences() {
+    std::shared_lock modelsLock(modelsMtx);
+    for (const auto& [name, model] : models) {
+        std::unordered_map<model_version_t, std::shared_ptr<ModelInstance>> instances;
+        model->getModelInstancesCopy(instances);
+        for (const auto& [version, instance] : instances) {
+            if (!instance->getModelConfig().isStateful()) {
+                continue;
+            }
+            // Guard keeps sequence manager from being reset by concurrent unload
+            std::unique_ptr<ModelInstanceUnloadGuard> unloadGuard;
+            if (!instance->waitForLoaded(0, unloadGuard).ok()) {
+                continue;
+            }
+            const size_t removed = instance->getSequenceManager()->removeIdleSequences();
+            if (removed > 0) {
+                SPDLOG_LOGGER_INFO(modelmanager_logger, "Removed {} idle sequences of model: {}, version: {}", removed, name, version);
+            }
+        }
+    }
+}
+
 void ModelManager::watcher(std::future<void> exit) {
     SPDLOG_LOGGER_INFO(modelmanager_logger, "Started config watcher thread");
     int64_t lastTime;
@@ -465,6 +535,7 @@ void ModelManager::watcher(std::future<void> exit) {
             loadConfig(configFilename);
         }
         updateConfigurationWithoutConfigFile();
+        removeIdleSequences();
         SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Watcher thread check cycle end");
     }
     SPDLOG_LOGGER_ERROR(modelmanager_logger, "Exited config watcher thread");
@@ -546,10 +617,44 @@ void ModelManager::getVersionsToChange(
 std::shared_ptr<ovms::Model> ModelManager::getModelIfExistCreateElse(const std::string& modelName) {
     std::unique_lock modelsLock(modelsMtx);
     auto modelIt = models.find(modelName);
-    if (models.end() == modelIt) {
-        models.insert({modelName, modelFactory(modelName)});
+    if (models.end() != modelIt) {
+        return modelIt->second;
+    }
+    auto model = modelFactory(modelName);
+    model->setVersionsChangedCallback([this]() { publishServables(); });
+    models.insert({modelName, model});
+    modelsLock.unlock();
+    publishServables();
+    return model;
+}
+
+void ModelManager::publishServables() {
+    std::unique_lock publishLock(servablesPublishMtx);
+    ServableRegistry::servables_t servables;
+    for (auto definition : pipelineFactory.getDefinitions()) {
+        servables[definition->getName()].pipelineDefinition = definition;
+    }
+    std::shared_lock modelsLock(modelsMtx);
+    for (const auto& [name, model] : models) {
+        auto& entry = servables[name];
+        entry.isModel = true;
+        entry.defaultInstance = model->getModelInstancesCopy(entry.versions);
+    }
+    modelsLock.unlock();
+    SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Publishing {} servables for request lookups", servables.size());
+    servableRegistry.publish(std::move(servables));
+}
+
+Status ModelManager::createPipeline(std::unique_ptr<Pipeline>& pipeline,
+    const std::string name,
+    const tensorflow::serving::PredictRequest* request,
+    tensorflow::serving::PredictResponse* response) {
+    auto definition = servableRegistry.findPipelineDefinition(name);
+    if (definition == nullptr) {
+        SPDLOG_LOGGER_INFO(dag_executor_logger, "Pipeline with requested name: {} does not exist", name);
+        return StatusCode::PIPELINE_DEFINITION_NAME_MISSING;
     }
-    return models[modelName];
+    return definition->create(pipeline, request, response, *this);
 }
 
 std::shared_ptr<FileSystem> ModelManager::getFilesystem(const std::string& basePath) {
@@ -654,6 +759,10 @@ Status ModelManager::reloadModelVersions(std::shared_ptr<ovms::Model>& model, st
 
 Status ModelManager::reloadModelWithVersions(ModelConfig& config) {
     SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Started applying config changes to model: {}", config.getName());
+    if (config.isStateful() && config.isDynamicParameterEnabled()) {
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "Requested setting dynamic parameters for model {} but it is stateful. Sequence memory state requires fixed shapes.", config.getName());
+        return StatusCode::REQUESTED_DYNAMIC_PARAMETERS_ON_STATEFUL_MODEL;
+    }
     auto model = getModelIfExistCreateElse(config.getName());
     if (model->isAnyVersionSubscribed() && config.isDynamicParameterEnabled()) {
         SPDLOG_LOGGER_ERROR(modelmanager_logger, "Requested setting dynamic parameters for model {} but it is used in pipeline. Cannot reload model configuration.", config.getName());
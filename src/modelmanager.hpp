@@ -18,6 +18,7 @@
 #include <future>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <shared_mutex>
 #include <string>
@@ -31,8 +32,10 @@
 #include "customloaders.hpp"
 #include "filesystem.hpp"
 #include "model.hpp"
+#include "node_library.hpp"
 #include "pipeline.hpp"
 #include "pipeline_factory.hpp"
+#include "servableregistry.hpp"
 
 namespace ovms {
 class IVersionReader;
@@ -56,6 +59,18 @@ protected:
 
     PipelineFactory pipelineFactory;
 
+    /**
+     * @brief Snapshot of models and pipelines used by request path
+     */
+    ServableRegistry servableRegistry;
+
+    /**
+     * @brief Publishes current models, their versions and pipeline definitions to servable registry
+     */
+    void publishServables();
+
+    CustomNodeLibraryManager customNodeLibraryManager;
+
 private:
     /**
      * @brief Private copying constructor
@@ -112,6 +127,11 @@ private:
      */
     mutable std::shared_mutex modelsMtx;
 
+    /**
+     * @brief Mutex for serializing publishing of servables, so that older snapshot does not replace newer one
+     */
+    std::mutex servablesPublishMtx;
+
     /**
      * Time interval between each config file check
      */
@@ -137,7 +157,11 @@ public:
      * @brief Destroy the Model Manager object
      * 
      */
-    virtual ~ModelManager() {}
+    virtual ~ModelManager() {
+        for (auto& [name, model] : models) {
+            model->setVersionsChangedCallback(nullptr);
+        }
+    }
 
     /**
      * @brief Gets config filename
@@ -161,6 +185,17 @@ public:
         return pipelineFactory;
     }
 
+    /**
+     * @brief Gets registry for lock free lookups of servables in request path
+     */
+    const ServableRegistry& getServableRegistry() const {
+        return servableRegistry;
+    }
+
+    CustomNodeLibraryManager& getCustomNodeLibraryManager() {
+        return customNodeLibraryManager;
+    }
+
     /**
      * @brief Finds model with specific name
      *
@@ -201,9 +236,7 @@ public:
     Status createPipeline(std::unique_ptr<Pipeline>& pipeline,
         const std::string name,
         const tensorflow::serving::PredictRequest* request,
-        tensorflow::serving::PredictResponse* response) {
-        return pipelineFactory.create(pipeline, name, request, response, *this);
-    }
+        tensorflow::serving::PredictResponse* response);
 
     const bool pipelineDefinitionExists(const std::string& name) const {
         return pipelineFactory.definitionExists(name);
@@ -305,6 +338,11 @@ protected:
      * @brief Updates OVMS configuration with cached configuration file. Will check for newly added model versions
      */
     void updateConfigurationWithoutConfigFile();
+
+    /**
+     * @brief Removes sequences of stateful models without requests for longer than their idle timeout
+     */
+    void removeIdleSequences();
 };
 
 }  // namespace ovms
@@ -20,6 +20,7 @@
 
 #include <spdlog/spdlog.h>
 
+#include "logging.hpp"
 #include "status.hpp"
 
 namespace ovms {
@@ -30,7 +31,7 @@ void Node::printNodeConnections(const std::string& nodeName, const std::string&
     for (auto& pair : pairs) {
         ss << "\t" << nodeName << "[" << pair.second << "]=" << sourceNode << "[" << pair.first << "]\n";
     }
-    SPDLOG_DEBUG(ss.str());
+    OVMS_DEBUG(ss.str());
 }
 
 Status Node::setInputs(const Node& dependency, BlobMap& inputs) {
@@ -51,7 +52,22 @@ Status Node::setInputs(const Node& dependency, BlobMap& inputs) {
                 dependency_output_name);
             return StatusCode::INVALID_MISSING_INPUT;
         }
-        SPDLOG_DEBUG("Node::setInputs: setting required input for (Node name {}) from (Node name {}), input name: {}, dependency output name: {}",
+        if (current_node_input_name == EXECUTION_CONDITION_INPUT_NAME) {
+            bool satisfied = false;
+            auto status = this->executionCondition->evaluate(it->second, satisfied);
+            if (!status.ok()) {
+                return status;
+            }
+            if (!satisfied) {
+                OVMS_DEBUG("Node::setInputs: execution condition for (Node name {}) on (Node name {}) output name {} not satisfied, node will be skipped",
+                    getName(),
+                    dependency.getName(),
+                    dependency_output_name);
+                this->skipped = true;
+            }
+            continue;
+        }
+        OVMS_DEBUG("Node::setInputs: setting required input for (Node name {}) from (Node name {}), input name: {}, dependency output name: {}",
             getName(),
             dependency.getName(),
             current_node_input_name,
@@ -15,6 +15,7 @@
 //*****************************************************************************
 #pragma once
 
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -22,6 +23,7 @@
 
 #include <inference_engine.hpp>
 
+#include "execution_condition.hpp"
 #include "status.hpp"
 #include "threadsafequeue.hpp"
 
@@ -46,6 +48,11 @@ protected:
     // Input/Output name mapping and list of required inputs from previous nodes
     std::unordered_map<std::string, InputPairs> blobNamesMapping;
 
+    std::optional<ExecutionCondition> executionCondition;
+
+    // Set when execution condition is not satisfied or any dependency was skipped
+    bool skipped = false;
+
 public:
     Node(const std::string& nodeName) :
         nodeName(nodeName) {
@@ -77,6 +84,28 @@ public:
         return next;
     }
     virtual void release() {}
+
+    /**
+     * @brief Adds condition data item to the mapping of dependency, needs to be called after connecting the nodes
+     */
+    void setExecutionCondition(const ExecutionCondition& condition) {
+        this->executionCondition = condition;
+        this->blobNamesMapping.at(condition.dependencyName).emplace_back(condition.dataItem, EXECUTION_CONDITION_INPUT_NAME);
+    }
+
+    virtual void skipDependency(const Node& dependency) {
+        this->skipped = true;
+        finishedDependenciesCount++;
+    }
+
+    bool isSkipped() const {
+        return skipped;
+    }
+
+    void releaseSkipped() {
+        this->inputBlobs.clear();
+        release();
+    }
     virtual bool tryDisarmStreamIdGuard(const uint microseconds = 1) { return true; }
 
     static void printNodeConnections(const std::string& nodeName, const std::string& sourceNode, const InputPairs& pairs);
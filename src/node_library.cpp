@@ -0,0 +1,61 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "node_library.hpp"
+
+#include <dlfcn.h>
+
+#include "logging.hpp"
+
+namespace ovms {
+
+Status CustomNodeLibraryManager::loadLibrary(const std::string& basePath, NodeLibrary& library) {
+    std::lock_guard<std::mutex> lock(librariesMtx);
+    auto it = libraries.find(basePath);
+    if (it != libraries.end()) {
+        library = it->second;
+        return StatusCode::OK;
+    }
+
+    void* handle = dlopen(basePath.c_str(), RTLD_LAZY | RTLD_LOCAL);
+    if (!handle) {
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "Cannot open custom node library: {} {}", basePath, dlerror());
+        return StatusCode::NODE_LIBRARY_LOAD_FAILED_OPEN;
+    }
+
+    NodeLibrary loaded;
+    loaded.execute = reinterpret_cast<execute_fn>(dlsym(handle, "execute"));
+    const char* error = dlerror();
+    if (error || loaded.execute == nullptr) {
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "Cannot load symbol execute from custom node library: {} {}", basePath, error ? error : "");
+        dlclose(handle);
+        return StatusCode::NODE_LIBRARY_LOAD_FAILED_SYM;
+    }
+
+    loaded.release = reinterpret_cast<release_fn>(dlsym(handle, "release"));
+    error = dlerror();
+    if (error || loaded.release == nullptr) {
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "Cannot load symbol release from custom node library: {} {}", basePath, error ? error : "");
+        dlclose(handle);
+        return StatusCode::NODE_LIBRARY_LOAD_FAILED_SYM;
+    }
+
+    SPDLOG_LOGGER_INFO(modelmanager_logger, "Loaded custom node library: {}", basePath);
+    libraries.emplace(basePath, loaded);
+    library = loaded;
+    return StatusCode::OK;
+}
+
+}  // namespace ovms
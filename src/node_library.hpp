@@ -0,0 +1,51 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "custom_node_interface.h"
+#include "status.hpp"
+
+namespace ovms {
+
+typedef int (*execute_fn)(const struct CustomNodeTensor*, int, struct CustomNodeTensor**, int*, const struct CustomNodeParam*, int);
+typedef int (*release_fn)(void*);
+
+struct NodeLibrary {
+    execute_fn execute = nullptr;
+    release_fn release = nullptr;
+
+    bool isValid() const {
+        return execute != nullptr && release != nullptr;
+    }
+};
+
+/**
+ * @brief Loads custom node libraries. Each library is opened once and kept loaded
+ * since pipelines created from previous configuration may still execute it.
+ */
+class CustomNodeLibraryManager {
+    std::map<std::string, NodeLibrary> libraries;
+    std::mutex librariesMtx;
+
+public:
+    Status loadLibrary(const std::string& basePath, NodeLibrary& library);
+};
+
+}  // namespace ovms
@@ -16,46 +16,59 @@
 
 #include "ov_utils.hpp"
 
+#include <functional>
 #include <memory>
+#include <numeric>
 
 #include <spdlog/spdlog.h>
 
-namespace ovms {
+#include "precisionutils.hpp"
 
-Status blobClone(InferenceEngine::Blob::Ptr& destinationBlob, const InferenceEngine::Blob::Ptr sourceBlob) {
-    auto& description = sourceBlob->getTensorDesc();
+namespace ovms {
 
+Status createBlob(InferenceEngine::Blob::Ptr& blob, const InferenceEngine::TensorDesc& description) {
     try {
         switch (description.getPrecision()) {
         case InferenceEngine::Precision::FP32:
-            destinationBlob = InferenceEngine::make_shared_blob<float>(description);
+            blob = InferenceEngine::make_shared_blob<float>(description);
+            break;
+        case InferenceEngine::Precision::FP16:
+        case InferenceEngine::Precision::U16:
+            blob = InferenceEngine::make_shared_blob<uint16_t>(description);
             break;
         case InferenceEngine::Precision::U8:
-            destinationBlob = InferenceEngine::make_shared_blob<uint8_t>(description);
+            blob = InferenceEngine::make_shared_blob<uint8_t>(description);
             break;
         case InferenceEngine::Precision::I8:
-            destinationBlob = InferenceEngine::make_shared_blob<int8_t>(description);
+            blob = InferenceEngine::make_shared_blob<int8_t>(description);
             break;
         case InferenceEngine::Precision::I16:
-            destinationBlob = InferenceEngine::make_shared_blob<int16_t>(description);
+            blob = InferenceEngine::make_shared_blob<int16_t>(description);
             break;
         case InferenceEngine::Precision::I32:
-            destinationBlob = InferenceEngine::make_shared_blob<int32_t>(description);
+            blob = InferenceEngine::make_shared_blob<int32_t>(description);
             break;
         default: {
-            SPDLOG_ERROR("Blob clone failed, unsupported precision");
+            SPDLOG_ERROR("Blob creation failed, unsupported precision");
             return StatusCode::INVALID_PRECISION;
         }
         }
+        blob->allocate();
     } catch (const InferenceEngine::details::InferenceEngineException& e) {
-        SPDLOG_DEBUG("Blob clone failed; exception message: {}", e.what());
+        SPDLOG_DEBUG("Blob creation failed; exception message: {}", e.what());
         return StatusCode::OV_CLONE_BLOB_ERROR;
     } catch (std::logic_error& e) {
-        SPDLOG_DEBUG("Blob clone failed; exception message: {}", e.what());
+        SPDLOG_DEBUG("Blob creation failed; exception message: {}", e.what());
         return StatusCode::OV_CLONE_BLOB_ERROR;
     }
+    return StatusCode::OK;
+}
 
-    destinationBlob->allocate();
+Status blobClone(InferenceEngine::Blob::Ptr& destinationBlob, const InferenceEngine::Blob::Ptr sourceBlob) {
+    auto status = createBlob(destinationBlob, sourceBlob->getTensorDesc());
+    if (!status.ok()) {
+        return status;
+    }
     if (destinationBlob->byteSize() != sourceBlob->byteSize()) {
         destinationBlob = nullptr;
         return StatusCode::OV_CLONE_BLOB_ERROR;
@@ -64,4 +77,126 @@ Status blobClone(InferenceEngine::Blob::Ptr& destinationBlob, const InferenceEng
     return StatusCode::OK;
 }
 
+template <typename T>
+static InferenceEngine::Blob::Ptr makeBlobSlice(const InferenceEngine::TensorDesc& description, const InferenceEngine::Blob::Ptr& parent, size_t offset, size_t byteSize) {
+    T* ptr = reinterpret_cast<T*>(parent->buffer().as<uint8_t*>() + offset);
+    return std::make_shared<BlobSlice<T>>(description, ptr, byteSize / sizeof(T), parent);
+}
+
+Status createBlobSlice(InferenceEngine::Blob::Ptr& slice, const InferenceEngine::TensorDesc& description, const InferenceEngine::Blob::Ptr& parent, size_t offset) {
+    const auto& dims = description.getDims();
+    const size_t byteSize = std::accumulate(dims.begin(), dims.end(), description.getPrecision().size(), std::multiplies<size_t>());
+    if (offset > parent->byteSize() || byteSize > parent->byteSize() - offset) {
+        SPDLOG_DEBUG("Blob slice creation failed, slice of {} bytes at offset {} exceeds blob of {} bytes", byteSize, offset, parent->byteSize());
+        return StatusCode::INTERNAL_ERROR;
+    }
+    switch (description.getPrecision()) {
+    case InferenceEngine::Precision::FP32:
+        slice = makeBlobSlice<float>(description, parent, offset, byteSize);
+        break;
+    case InferenceEngine::Precision::FP16:
+    case InferenceEngine::Precision::U16:
+        slice = makeBlobSlice<uint16_t>(description, parent, offset, byteSize);
+        break;
+    case InferenceEngine::Precision::U8:
+        slice = makeBlobSlice<uint8_t>(description, parent, offset, byteSize);
+        break;
+    case InferenceEngine::Precision::I8:
+        slice = makeBlobSlice<int8_t>(description, parent, offset, byteSize);
+        break;
+    case InferenceEngine::Precision::I16:
+        slice = makeBlobSlice<int16_t>(description, parent, offset, byteSize);
+        break;
+    case InferenceEngine::Precision::I32:
+        slice = makeBlobSlice<int32_t>(description, parent, offset, byteSize);
+        break;
+    default:
+        return StatusCode::INVALID_PRECISION;
+    }
+    return StatusCode::OK;
+}
+
+Status sliceBlob(InferenceEngine::Blob::Ptr& slice, const InferenceEngine::Blob::Ptr& parent, size_t begin, size_t count) {
+    const auto& parentDescription = parent->getTensorDesc();
+    InferenceEngine::SizeVector dims = parentDescription.getDims();
+    if (dims.empty() || dims[0] == 0 || begin + count > dims[0]) {
+        return StatusCode::INTERNAL_ERROR;
+    }
+    const size_t offset = begin * (parent->byteSize() / dims[0]);
+    dims[0] = count;
+    return createBlobSlice(slice, InferenceEngine::TensorDesc(parentDescription.getPrecision(), dims, parentDescription.getLayout()), parent, offset);
+}
+
+bool isPrecisionConversionSupported(InferenceEngine::Precision sourcePrecision, InferenceEngine::Precision destinationPrecision) {
+    if (destinationPrecision == InferenceEngine::Precision::FP16) {
+        return sourcePrecision == InferenceEngine::Precision::FP32;
+    }
+    if (destinationPrecision != InferenceEngine::Precision::FP32) {
+        return false;
+    }
+    switch (sourcePrecision) {
+    case InferenceEngine::Precision::U8:
+    case InferenceEngine::Precision::I8:
+    case InferenceEngine::Precision::U16:
+    case InferenceEngine::Precision::I16:
+    case InferenceEngine::Precision::I32:
+    case InferenceEngine::Precision::FP16:
+        return true;
+    default:
+        return false;
+    }
+}
+
+Status convertPrecision(const void* source, InferenceEngine::Precision sourcePrecision,
+    void* destination, InferenceEngine::Precision destinationPrecision, size_t count) {
+    if (!isPrecisionConversionSupported(sourcePrecision, destinationPrecision)) {
+        SPDLOG_DEBUG("Unsupported precision conversion from: {} to: {}", sourcePrecision.name(), destinationPrecision.name());
+        return StatusCode::INVALID_PRECISION;
+    }
+    const auto& kernels = getConversionKernels();
+    if (destinationPrecision == InferenceEngine::Precision::FP16) {
+        kernels.fp32ToFp16(static_cast<const float*>(source), static_cast<uint16_t*>(destination), count);
+        return StatusCode::OK;
+    }
+    auto output = static_cast<float*>(destination);
+    switch (sourcePrecision) {
+    case InferenceEngine::Precision::U8:
+        kernels.u8ToFp32(static_cast<const uint8_t*>(source), output, count);
+        break;
+    case InferenceEngine::Precision::I8:
+        kernels.i8ToFp32(static_cast<const int8_t*>(source), output, count);
+        break;
+    case InferenceEngine::Precision::U16:
+        kernels.u16ToFp32(static_cast<const uint16_t*>(source), output, count);
+        break;
+    case InferenceEngine::Precision::I16:
+        kernels.i16ToFp32(static_cast<const int16_t*>(source), output, count);
+        break;
+    case InferenceEngine::Precision::I32:
+        kernels.i32ToFp32(static_cast<const int32_t*>(source), output, count);
+        break;
+    case InferenceEngine::Precision::FP16:
+        kernels.fp16ToFp32(static_cast<const uint16_t*>(source), output, count);
+        break;
+    default:
+        return StatusCode::INVALID_PRECISION;
+    }
+    return StatusCode::OK;
+}
+
+Status convertBlobPrecision(InferenceEngine::Blob::Ptr& destinationBlob, const InferenceEngine::Blob::Ptr sourceBlob, InferenceEngine::Precision precision) {
+    const auto& sourceDescription = sourceBlob->getTensorDesc();
+    InferenceEngine::TensorDesc description(precision, sourceDescription.getDims(), sourceDescription.getLayout());
+    auto status = createBlob(destinationBlob, description);
+    if (!status.ok()) {
+        return status;
+    }
+    status = convertPrecision((const void*)sourceBlob->buffer(), sourceDescription.getPrecision(),
+        (void*)destinationBlob->buffer(), precision, sourceBlob->size());
+    if (!status.ok()) {
+        destinationBlob = nullptr;
+    }
+    return status;
+}
+
 }  // namespace ovms
@@ -15,12 +15,55 @@
 //*****************************************************************************
 #pragma once
 
+#include <memory>
+#include <utility>
+
 #include <inference_engine.hpp>
 
 #include "status.hpp"
 
 namespace ovms {
 
+/**
+ * @brief Blob referring to the part of another blob memory, keeps the parent blob alive
+ */
+template <typename T>
+class BlobSlice : public InferenceEngine::TBlob<T> {
+public:
+    BlobSlice(const InferenceEngine::TensorDesc& tensorDesc, T* ptr, size_t size, InferenceEngine::Blob::Ptr parent) :
+        InferenceEngine::TBlob<T>(tensorDesc, ptr, size),
+        parent(std::move(parent)) {}
+
+private:
+    InferenceEngine::Blob::Ptr parent;
+};
+
+Status createBlob(InferenceEngine::Blob::Ptr& blob, const InferenceEngine::TensorDesc& description);
+
 Status blobClone(InferenceEngine::Blob::Ptr& destinationBlob, const InferenceEngine::Blob::Ptr sourceBlob);
 
+/**
+ * @brief Creates blob of given description referring to memory of parent blob starting at byte offset, without copying
+ */
+Status createBlobSlice(InferenceEngine::Blob::Ptr& slice, const InferenceEngine::TensorDesc& description, const InferenceEngine::Blob::Ptr& parent, size_t offset);
+
+/**
+ * @brief Creates blob referring to count elements of parent blob along the first dimension starting at begin, without copying
+ */
+Status sliceBlob(InferenceEngine::Blob::Ptr& slice, const InferenceEngine::Blob::Ptr& parent, size_t begin, size_t count);
+
+/**
+ * @brief Checks if data of source precision can be converted to destination precision.
+ * Supported are conversions of U8, I8, U16, I16, I32 and FP16 to FP32 and of FP32 to FP16.
+ */
+bool isPrecisionConversionSupported(InferenceEngine::Precision sourcePrecision, InferenceEngine::Precision destinationPrecision);
+
+Status convertPrecision(const void* source, InferenceEngine::Precision sourcePrecision,
+    void* destination, InferenceEngine::Precision destinationPrecision, size_t count);
+
+/**
+ * @brief Creates blob of the same dimensions and layout as source blob with data converted to given precision
+ */
+Status convertBlobPrecision(InferenceEngine::Blob::Ptr& destinationBlob, const InferenceEngine::Blob::Ptr sourceBlob, InferenceEngine::Precision precision);
+
 }  // namespace ovms
@@ -17,42 +17,160 @@
 #include "ovinferrequestsqueue.hpp"
 
 #include <utility>
+#include <vector>
 
 namespace ovms {
+Status OVInferRequestsQueue::takeOrWait(int& streamID, std::shared_ptr<StreamWaiter>& waiter, bool limited, idle_stream_callback_t callback) {
+    if (streams[front_idx] >= 0) {  // we can give idle stream right away
+        streamID = streams[front_idx];
+        streams[front_idx] = -1;  // negative value indicate consumed vector index
+        front_idx = (front_idx + 1) % streams.size();
+        return StatusCode::OK;
+    }
+    // we need to wait for any idle stream to be returned
+    std::unique_lock<std::mutex> queueLock(queue_mutex);
+    if (limited && maxQueueSize > 0 && waitingCount >= maxQueueSize) {
+        rejectedQueueFullCount.fetch_add(1, std::memory_order_relaxed);
+        return StatusCode::INFER_QUEUE_FULL;
+    }
+    waiter = std::make_shared<StreamWaiter>();
+    waiter->callback = std::move(callback);
+    waiter->enqueued = std::chrono::steady_clock::now();
+    waiters.push(waiter);
+    waitingCount++;
+    return StatusCode::OK;
+}
+
 std::future<int> OVInferRequestsQueue::getIdleStream() {
-    int value;
+    int value = -1;
+    std::shared_ptr<StreamWaiter> waiter;
+    std::unique_lock<std::mutex> lk(front_mut);
+    takeOrWait(value, waiter, false);
+    if (waiter) {
+        return waiter->promise.get_future();
+    }
+    lk.unlock();
     std::promise<int> idleStreamPromise;
-    std::future<int> idleStreamFuture = idleStreamPromise.get_future();
+    idleStreamPromise.set_value(value);
+    return idleStreamPromise.get_future();
+}
+
+Status OVInferRequestsQueue::acquireIdleStream(int& streamID, const Deadline& deadline) {
+    auto status = deadline.check();
+    if (!status.ok()) {
+        return status;
+    }
+    std::shared_ptr<StreamWaiter> waiter;
+    std::future<int> idleStreamFuture;
+    {
+        std::unique_lock<std::mutex> lk(front_mut);
+        status = takeOrWait(streamID, waiter, true);
+        if (!status.ok() || !waiter) {
+            return status;
+        }
+        idleStreamFuture = waiter->promise.get_future();
+    }
+    std::optional<Deadline::clock::time_point> queueExpiry;
+    if (maxQueueWait.count() > 0) {
+        queueExpiry = Deadline::clock::now() + maxQueueWait;
+    }
+    while (true) {
+        auto waitUntil = deadline.nextCheck(queueExpiry);
+        if (!waitUntil) {
+            streamID = idleStreamFuture.get();
+            return StatusCode::OK;
+        }
+        if (idleStreamFuture.wait_until(waitUntil.value()) == std::future_status::ready) {
+            streamID = idleStreamFuture.get();
+            return StatusCode::OK;
+        }
+        status = deadline.check();
+        if (status.ok() && queueExpiry && Deadline::clock::now() >= queueExpiry.value()) {
+            status = StatusCode::INFER_QUEUE_TIMEOUT;
+        }
+        if (!status.ok()) {
+            break;
+        }
+    }
+    // Stream is handed over under queue_mutex, so it is either already set or will never be
+    std::unique_lock<std::mutex> queueLock(queue_mutex);
+    if (idleStreamFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+        streamID = idleStreamFuture.get();
+        return StatusCode::OK;
+    }
+    waiter->abandoned = true;
+    waitingCount--;
+    if (status == StatusCode::INFER_QUEUE_TIMEOUT) {
+        rejectedQueueTimeoutCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    return status;
+}
+
+Status OVInferRequestsQueue::acquireIdleStreamAsync(int& streamID, idle_stream_callback_t callback) {
+    std::shared_ptr<StreamWaiter> waiter;
     std::unique_lock<std::mutex> lk(front_mut);
-    if (streams[front_idx] < 0) {  // we need to wait for any idle stream to be returned
-        std::unique_lock<std::mutex> queueLock(queue_mutex);
-        promises.push(std::move(idleStreamPromise));
-    } else {  // we can give idle stream right away
-        value = streams[front_idx];
-        streams[front_idx] = -1;  // negative value indicate consumed vector index
-        front_idx = (front_idx + 1) % streams.size();
-        lk.unlock();
-        idleStreamPromise.set_value(value);
+    auto status = takeOrWait(streamID, waiter, true, std::move(callback));
+    if (waiter) {
+        streamID = -1;
     }
-    return std::move(idleStreamFuture);
+    return status;
+}
+
+bool OVInferRequestsQueue::tryAcquireIdleStream(int& streamID) {
+    std::unique_lock<std::mutex> lk(front_mut);
+    if (streams[front_idx] < 0) {
+        return false;
+    }
+    streamID = streams[front_idx];
+    streams[front_idx] = -1;
+    front_idx = (front_idx + 1) % streams.size();
+    return true;
 }
 
 void OVInferRequestsQueue::returnStream(int streamID) {
-    std::unique_lock<std::mutex> lk(queue_mutex);
-    if (promises.size()) {
-        std::promise<int> promise = std::move(promises.front());
-        promises.pop();
-        lk.unlock();
-        promise.set_value(streamID);
-        return;
-    }
-    std::uint32_t old_back = back_idx.load();
-    while (!back_idx.compare_exchange_weak(
-        old_back,
-        (old_back + 1) % streams.size(),
-        std::memory_order_relaxed)) {
-    }
-    streams[old_back] = streamID;
+    // Callbacks are called without lock, they may return stream right away when request was already cancelled
+    std::vector<idle_stream_callback_t> timedOut;
+    idle_stream_callback_t handedOver;
+    {
+        std::unique_lock<std::mutex> lk(queue_mutex);
+        bool given = false;
+        while (!waiters.empty()) {
+            std::shared_ptr<StreamWaiter> waiter = std::move(waiters.front());
+            waiters.pop();
+            if (waiter->abandoned) {
+                continue;
+            }
+            waitingCount--;
+            if (!waiter->callback) {
+                waiter->promise.set_value(streamID);
+                given = true;
+                break;
+            }
+            if (maxQueueWait.count() > 0 && std::chrono::steady_clock::now() - waiter->enqueued > maxQueueWait) {
+                rejectedQueueTimeoutCount.fetch_add(1, std::memory_order_relaxed);
+                timedOut.push_back(std::move(waiter->callback));
+                continue;
+            }
+            handedOver = std::move(waiter->callback);
+            given = true;
+            break;
+        }
+        if (!given) {
+            std::uint32_t old_back = back_idx.load();
+            while (!back_idx.compare_exchange_weak(
+                old_back,
+                (old_back + 1) % streams.size(),
+                std::memory_order_relaxed)) {
+            }
+            streams[old_back] = streamID;
+        }
+    }
+    for (auto& callback : timedOut) {
+        callback(StatusCode::INFER_QUEUE_TIMEOUT, -1);
+    }
+    if (handedOver) {
+        handedOver(StatusCode::OK, streamID);
+    }
 }
 
 }  // namespace ovms
@@ -16,8 +16,11 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <functional>
 #include <future>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <thread>
@@ -26,7 +29,16 @@
 #include <inference_engine.hpp>
 #include <spdlog/spdlog.h>
 
+#include "deadline.hpp"
+#include "status.hpp"
+
 namespace ovms {
+/**
+* @brief Called with stream handed over to a waiting request, or with INFER_QUEUE_TIMEOUT and no stream
+* when the request waited longer than maximum queue wait time
+*/
+using idle_stream_callback_t = std::function<void(const Status& status, int streamID)>;
+
 /**
 * @brief Class representing circular buffer for managing IE streams
 */
@@ -37,6 +49,27 @@ public:
     */
     std::future<int> getIdleStream();
 
+    /**
+    * @brief Allocating idle stream for execution with admission control.
+    * Fails right away with INFER_QUEUE_FULL when maximum number of requests is already waiting
+    * and with INFER_QUEUE_TIMEOUT when no stream was returned within maximum queue wait time.
+    * Waiting stops with status of the deadline when it expires or the request gets cancelled.
+    */
+    Status acquireIdleStream(int& streamID, const Deadline& deadline = Deadline());
+
+    /**
+    * @brief Allocating idle stream without blocking the calling thread. When stream is idle right away streamID is set,
+    * otherwise it is set to -1 and callback is called by the thread returning a stream, which should only schedule
+    * further work. Maximum queue wait time is checked when stream is handed over. Fails right away with
+    * INFER_QUEUE_FULL when maximum number of requests is already waiting.
+    */
+    Status acquireIdleStreamAsync(int& streamID, idle_stream_callback_t callback);
+
+    /**
+    * @brief Takes idle stream only when one is available right away, never waits nor counts as waiting request
+    */
+    bool tryAcquireIdleStream(int& streamID);
+
     /**
     * @brief Release stream after execution
     */
@@ -45,10 +78,13 @@ public:
     /**
     * @brief Constructor with initialization
     */
-    OVInferRequestsQueue(InferenceEngine::ExecutableNetwork& network, int streamsLength) :
+    OVInferRequestsQueue(InferenceEngine::ExecutableNetwork& network, int streamsLength,
+        size_t maxQueueSize = 0, std::chrono::milliseconds maxQueueWait = std::chrono::milliseconds(0)) :
         streams(streamsLength),
         front_idx{0},
-        back_idx{0} {
+        back_idx{0},
+        maxQueueSize(maxQueueSize),
+        maxQueueWait(maxQueueWait) {
         for (int i = 0; i < streamsLength; ++i) {
             streams[i] = i;
             inferRequests.push_back(network.CreateInferRequest());
@@ -62,6 +98,29 @@ public:
         return inferRequests[streamID];
     }
 
+    /**
+     * @brief Number of streams managed by the queue
+     */
+    size_t getStreamsCount() const {
+        return inferRequests.size();
+    }
+
+    /**
+     * @brief Number of requests waiting for idle stream
+     */
+    size_t getWaitingCount() {
+        std::unique_lock<std::mutex> lk(queue_mutex);
+        return waitingCount;
+    }
+
+    uint64_t getRejectedQueueFullCount() const {
+        return rejectedQueueFullCount.load(std::memory_order_relaxed);
+    }
+
+    uint64_t getRejectedQueueTimeoutCount() const {
+        return rejectedQueueTimeoutCount.load(std::memory_order_relaxed);
+    }
+
 protected:
     /**
     * @brief Vector representing circular buffer for infer queue
@@ -87,6 +146,37 @@ protected:
      * 
      */
     std::vector<InferenceEngine::InferRequest> inferRequests;
-    std::queue<std::promise<int>> promises;
+
+    /**
+    * @brief Request waiting for idle stream, abandoned ones are skipped when stream is returned
+    */
+    struct StreamWaiter {
+        std::promise<int> promise;
+        bool abandoned = false;
+        idle_stream_callback_t callback;
+        std::chrono::steady_clock::time_point enqueued;
+    };
+    std::queue<std::shared_ptr<StreamWaiter>> waiters;
+
+    /**
+    * @brief Number of waiters which are not abandoned, guarded by queue_mutex
+    */
+    size_t waitingCount = 0;
+
+    /**
+    * @brief Admission limits, 0 means no limit
+    */
+    const size_t maxQueueSize;
+    const std::chrono::milliseconds maxQueueWait;
+
+    std::atomic<uint64_t> rejectedQueueFullCount{0};
+    std::atomic<uint64_t> rejectedQueueTimeoutCount{0};
+
+private:
+    /**
+    * @brief Takes idle stream if available, otherwise enqueues waiter unless limit of waiting requests is reached.
+    * Waiter with callback is notified instead of its promise. Must be called with front_mut locked.
+    */
+    Status takeOrWait(int& streamID, std::shared_ptr<StreamWaiter>& waiter, bool limited, idle_stream_callback_t callback = {});
 };
 }  // namespace ovms
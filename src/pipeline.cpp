@@ -18,13 +18,58 @@
 #include <algorithm>
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <utility>
 
 #include "logging.hpp"
 #include "threadsafequeue.hpp"
+#include "tracing.hpp"
 
 namespace ovms {
 
+namespace {
+// Records spans of nodes in the trace of the request. Node span lasts from the first attempt to execute it
+// until pipeline receives message that it finished, so it covers waiting for stream id and polling gaps.
+class NodeSpans {
+public:
+    NodeSpans() :
+        trace(getCurrentTrace()) {}
+
+    void started(const Node& node) {
+        if (trace) {
+            startTimes.emplace(&node, Trace::clock::now());
+        }
+    }
+
+    void deferred(const Node& node) {
+        if (trace) {
+            deferTimes.emplace(&node, Trace::clock::now());
+        }
+    }
+
+    void resumed(const Node& node) {
+        auto it = deferTimes.find(&node);
+        if (it != deferTimes.end()) {
+            trace->addSpan("wait_for_stream:" + node.getName(), it->second, Trace::clock::now());
+            deferTimes.erase(it);
+        }
+    }
+
+    void finished(const Node& node) {
+        auto it = startTimes.find(&node);
+        if (it != startTimes.end()) {
+            trace->addSpan("node:" + node.getName(), it->second, Trace::clock::now());
+            startTimes.erase(it);
+        }
+    }
+
+private:
+    Trace* trace;
+    std::unordered_map<const Node*, Trace::clock::time_point> startTimes;
+    std::unordered_map<const Node*, Trace::clock::time_point> deferTimes;
+};
+}  // namespace
+
 void printNodeConnections(const std::string& nodeName, const std::string& sourceNode, const InputPairs& pairs) {
     if (spdlog::default_logger()->level() > spdlog::level::debug) {
         return;
@@ -34,7 +79,7 @@ void printNodeConnections(const std::string& nodeName, const std::string& source
     for (auto& pair : pairs) {
         ss << "\t" << nodeName << "[" << pair.second << "]=" << sourceNode << "[" << pair.first << "]\n";
     }
-    SPDLOG_LOGGER_DEBUG(dag_executor_logger, ss.str());
+    OVMS_LOGGER_DEBUG(dag_executor_logger, ss.str());
 }
 
 std::map<const std::string, bool> Pipeline::prepareStatusMap() const {
@@ -67,13 +112,20 @@ void setFailIfNotFailEarlier(ovms::Status& earlierStatusCode, ovms::Status& newF
             getName(), NODE.getName(), status.string());                                           \
     }
 
-Status Pipeline::execute() {
-    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Started execution of pipeline: {}", getName());
+Status Pipeline::execute(const Deadline& deadline) {
+    OVMS_LOGGER_DEBUG(dag_executor_logger, "Started execution of pipeline: {}", getName());
+    ovms::Status firstErrorStatus = deadline.check();
+    if (!firstErrorStatus.ok()) {
+        OVMS_LOGGER_DEBUG(dag_executor_logger, "Execution of pipeline: {} dropped: {}", getName(), firstErrorStatus.string());
+        return firstErrorStatus;
+    }
+    ScopedSpan pipelineSpan("pipeline:", getName());
+    NodeSpans nodeSpans;
     ThreadSafeQueue<std::reference_wrapper<Node>> finishedNodeQueue;
-    ovms::Status firstErrorStatus{ovms::StatusCode::OK};
     auto startedExecute{prepareStatusMap()};
     auto finishedExecute{prepareStatusMap()};
     startedExecute.at(entry.getName()) = true;
+    nodeSpans.started(entry);
     ovms::Status status = entry.execute(finishedNodeQueue);  // first node will triger first message
     if (!status.ok()) {
         SPDLOG_LOGGER_WARN(dag_executor_logger, "Executing pipeline: {} node: {} failed with: {}",
@@ -87,27 +139,46 @@ Status Pipeline::execute() {
     // process finished nodes and if no one is finished check if any node with deferred execution
     // has necessary resources already
     while (true) {
+        // Expired deadline is handled like a node failure, so that nodes already running are awaited
+        if (firstErrorStatus.ok()) {
+            status = deadline.check();
+            if (!status.ok()) {
+                OVMS_LOGGER_DEBUG(dag_executor_logger, "Pipeline: {} will not start remaining nodes: {}", getName(), status.string());
+                setFailIfNotFailEarlier(firstErrorStatus, status);
+            }
+        }
         spdlog::trace("Pipeline: {} waiting for message that node finished.", getName());
         auto optionallyFinishedNode = finishedNodeQueue.tryPull(WAIT_FOR_FINISHED_NODE_TIMEOUT_MICROSECONDS);
         if (optionallyFinishedNode) {
             Node& finishedNode = optionallyFinishedNode.value().get();
-            SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Pipeline: {} got message that node: {} finished.", getName(), finishedNode.getName());
+            OVMS_LOGGER_DEBUG(dag_executor_logger, "Pipeline: {} got message that node: {} finished.", getName(), finishedNode.getName());
             finishedExecute.at(finishedNode.getName()) = true;
+            nodeSpans.finished(finishedNode);
             if (!firstErrorStatus.ok()) {
                 finishedNode.release();
             }
             IF_ERROR_OCCURRED_EARLIER_THEN_BREAK_IF_ALL_STARTED_FINISHED_CONTINUE_OTHERWISE
             BlobMap finishedNodeOutputBlobMap;
-            SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Fetching results of pipeline: {} node: {}", getName(), finishedNode.getName());
-            status = finishedNode.fetchResults(finishedNodeOutputBlobMap);
-            CHECK_AND_LOG_ERROR(finishedNode)
-            IF_ERROR_OCCURRED_EARLIER_THEN_BREAK_IF_ALL_STARTED_FINISHED_CONTINUE_OTHERWISE
+            if (!finishedNode.isSkipped()) {
+                OVMS_LOGGER_DEBUG(dag_executor_logger, "Fetching results of pipeline: {} node: {}", getName(), finishedNode.getName());
+                ScopedSpan fetchSpan("fetch_results:", finishedNode.getName());
+                status = finishedNode.fetchResults(finishedNodeOutputBlobMap);
+                fetchSpan.finish();
+                CHECK_AND_LOG_ERROR(finishedNode)
+                IF_ERROR_OCCURRED_EARLIER_THEN_BREAK_IF_ALL_STARTED_FINISHED_CONTINUE_OTHERWISE
+            }
             if (std::all_of(finishedExecute.begin(), finishedExecute.end(), [](auto pair) { return pair.second; })) {
                 break;
             }
             auto& nextNodesFromFinished = finishedNode.getNextNodes();
             for (auto& nextNode : nextNodesFromFinished) {
-                SPDLOG_LOGGER_DEBUG(dag_executor_logger, "setting pipeline: {} node: {} outputs as inputs for node: {}",
+                if (finishedNode.isSkipped()) {
+                    OVMS_LOGGER_DEBUG(dag_executor_logger, "pipeline: {} node: {} was skipped, propagating to node: {}",
+                        getName(), finishedNode.getName(), nextNode.get().getName());
+                    nextNode.get().skipDependency(finishedNode);
+                    continue;
+                }
+                OVMS_LOGGER_DEBUG(dag_executor_logger, "setting pipeline: {} node: {} outputs as inputs for node: {}",
                     getName(), finishedNode.getName(), nextNode.get().getName());
                 status = nextNode.get().setInputs(finishedNode, finishedNodeOutputBlobMap);
                 CHECK_AND_LOG_ERROR(nextNode.get())
@@ -118,11 +189,20 @@ Status Pipeline::execute() {
             finishedNodeOutputBlobMap.clear();
             for (auto& nextNode : nextNodesFromFinished) {
                 if (nextNode.get().isReady()) {
-                    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Started execution of pipeline: {} node: {}", getName(), nextNode.get().getName());
                     startedExecute.at(nextNode.get().getName()) = true;
+                    if (nextNode.get().isSkipped()) {
+                        // Skipped node does not acquire stream id, it only notifies its dependants
+                        OVMS_LOGGER_DEBUG(dag_executor_logger, "Skipped execution of pipeline: {} node: {}", getName(), nextNode.get().getName());
+                        nextNode.get().releaseSkipped();
+                        finishedNodeQueue.push(nextNode.get());
+                        continue;
+                    }
+                    OVMS_LOGGER_DEBUG(dag_executor_logger, "Started execution of pipeline: {} node: {}", getName(), nextNode.get().getName());
+                    nodeSpans.started(nextNode.get());
                     status = nextNode.get().execute(finishedNodeQueue);
                     if (status == StatusCode::PIPELINE_STREAM_ID_NOT_READY_YET) {
-                        SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} not ready for execution yet", nextNode.get().getName());
+                        OVMS_LOGGER_DEBUG(dag_executor_logger, "Node: {} not ready for execution yet", nextNode.get().getName());
+                        nodeSpans.deferred(nextNode.get());
                         nodesWaitingForIdleInferenceStreamId.push_back(nextNode.get());
                         status = StatusCode::OK;
                     }
@@ -135,28 +215,28 @@ Status Pipeline::execute() {
         } else {
             // If error occurred earlier, disarm stream id guards of all deferred nodes and exit
             if (!firstErrorStatus.ok()) {
-                SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Will try to disarm all stream id guards of all {} deferred nodes due to previous error in pipeline", nodesWaitingForIdleInferenceStreamId.size());
+                OVMS_LOGGER_DEBUG(dag_executor_logger, "Will try to disarm all stream id guards of all {} deferred nodes due to previous error in pipeline", nodesWaitingForIdleInferenceStreamId.size());
                 // Check if there are deferred nodes in queue to free
                 if (nodesWaitingForIdleInferenceStreamId.size() > 0) {
-                    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Trying to disarm {} remaining deferred nodes...", nodesWaitingForIdleInferenceStreamId.size());
+                    OVMS_LOGGER_DEBUG(dag_executor_logger, "Trying to disarm {} remaining deferred nodes...", nodesWaitingForIdleInferenceStreamId.size());
                     for (auto it = nodesWaitingForIdleInferenceStreamId.begin(); it != nodesWaitingForIdleInferenceStreamId.end();) {
                         auto& node = (*it).get();
                         if (node.tryDisarmStreamIdGuard(WAIT_FOR_DEFERRED_NODE_DISARM_TIMEOUT_MICROSECONDS)) {
-                            SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Stream id guard disarm of node {} has succeeded", node.getName());
+                            OVMS_LOGGER_DEBUG(dag_executor_logger, "Stream id guard disarm of node {} has succeeded", node.getName());
                             finishedExecute.at(node.getName()) = true;
                             it = nodesWaitingForIdleInferenceStreamId.erase(it);
                         } else {
-                            SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Cannot disarm stream id guard of node {} yet, will try again later", node.getName());
+                            OVMS_LOGGER_DEBUG(dag_executor_logger, "Cannot disarm stream id guard of node {} yet, will try again later", node.getName());
                             it++;
                         }
                     }
-                    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Disarming iteration completed, remaining deferred nodes count: {}", nodesWaitingForIdleInferenceStreamId.size());
+                    OVMS_LOGGER_DEBUG(dag_executor_logger, "Disarming iteration completed, remaining deferred nodes count: {}", nodesWaitingForIdleInferenceStreamId.size());
                 }
                 // Check for deferred node queue size again to indicate if all nodes got freed
                 if (nodesWaitingForIdleInferenceStreamId.size() > 0) {
                     continue;
                 } else {
-                    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Disarming all stream id guards of deferred nodes completed, pipeline will shut down");
+                    OVMS_LOGGER_DEBUG(dag_executor_logger, "Disarming all stream id guards of deferred nodes completed, pipeline will shut down");
                     IF_ERROR_OCCURRED_EARLIER_THEN_BREAK_IF_ALL_STARTED_FINISHED_CONTINUE_OTHERWISE
                 }
             }
@@ -165,16 +245,17 @@ Status Pipeline::execute() {
             // free blocked inferRequests from exeuction first rather than free models for reloading
             for (auto it = nodesWaitingForIdleInferenceStreamId.begin(); it != nodesWaitingForIdleInferenceStreamId.end();) {
                 auto& node = (*it).get();
-                SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Trying to trigger node: {} execution", node.getName());
+                OVMS_LOGGER_DEBUG(dag_executor_logger, "Trying to trigger node: {} execution", node.getName());
                 status = node.execute(finishedNodeQueue);
                 if (status.ok()) {
-                    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} ready yet:", node.getName());
+                    OVMS_LOGGER_DEBUG(dag_executor_logger, "Node: {} ready yet:", node.getName());
+                    nodeSpans.resumed(node);
                     it = nodesWaitingForIdleInferenceStreamId.erase(it);
                     continue;
                 }
                 it++;
                 if (status == StatusCode::PIPELINE_STREAM_ID_NOT_READY_YET) {
-                    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} not ready for execution yet", node.getName());
+                    OVMS_LOGGER_DEBUG(dag_executor_logger, "Node: {} not ready for execution yet", node.getName());
                     status = StatusCode::OK;
                 } else {
                     CHECK_AND_LOG_ERROR(node)
@@ -21,6 +21,8 @@
 #include <utility>
 #include <vector>
 
+#include "custom_node.hpp"
+#include "deadline.hpp"
 #include "dl_node.hpp"
 #include "entry_node.hpp"
 #include "exit_node.hpp"
@@ -56,7 +58,11 @@ public:
         to.addDependency(from, blobNamesMapping);
     }
 
-    Status execute();
+    /**
+     * @brief Executes nodes of the pipeline. No node is started after the deadline expired,
+     * nodes already running are awaited and the deadline status is returned.
+     */
+    Status execute(const Deadline& deadline = Deadline());
     const std::string& getName() const {
         return name;
     }
@@ -67,6 +67,17 @@ public:
             return it->second.get();
         }
     }
+
+    std::vector<PipelineDefinition*> getDefinitions() const {
+        std::shared_lock lock(definitionsMtx);
+        std::vector<PipelineDefinition*> result;
+        result.reserve(definitions.size());
+        for (const auto& [name, definition] : definitions) {
+            result.push_back(definition.get());
+        }
+        return result;
+    }
+
     Status reloadDefinition(const std::string& pipelineName,
         const std::vector<NodeInfo>&& nodeInfos,
         const pipeline_connections_t&& connections,
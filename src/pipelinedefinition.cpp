@@ -15,11 +15,17 @@
 //*****************************************************************************
 #include "pipelinedefinition.hpp"
 
+#include <algorithm>
 #include <chrono>
+#include <iterator>
+#include <map>
 #include <set>
 #include <thread>
 
+#include "demultiplexer_node.hpp"
+#include "gather_node.hpp"
 #include "logging.hpp"
+#include "ov_utils.hpp"
 #include "pipelinedefinitionunloadguard.hpp"
 #include "prediction_service_utils.hpp"
 
@@ -30,6 +36,10 @@ Status toNodeKind(const std::string& str, NodeKind& nodeKind) {
         nodeKind = NodeKind::DL;
         return StatusCode::OK;
     }
+    if (str == CUSTOM_NODE_CONFIG_TYPE) {
+        nodeKind = NodeKind::CUSTOM;
+        return StatusCode::OK;
+    }
     SPDLOG_LOGGER_ERROR(modelmanager_logger, "Unsupported node type: {}", str);
     return StatusCode::PIPELINE_NODE_WRONG_KIND_CONFIGURATION;
 }
@@ -52,6 +62,15 @@ Status PipelineDefinition::validate(ModelManager& manager) {
     if (!validationResult.ok()) {
         return validationResult;
     }
+
+    // Binary inputs are decoded by entry node according to metadata of the nodes they are connected to
+    auto inputsInfo = std::make_shared<tensor_map_t>();
+    validationResult = getInputsInfo(*inputsInfo, manager);
+    if (!validationResult.ok()) {
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "Collecting inputs metadata of pipeline: {} failed: {}", getName(), validationResult.string());
+        return validationResult;
+    }
+    std::atomic_store(&this->inputsInfo, std::shared_ptr<const tensor_map_t>(std::move(inputsInfo)));
     notifier.passed = true;
     SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Finished validation of pipeline: {}", getName());
     return validationResult;
@@ -128,6 +147,59 @@ Status PipelineDefinition::waitForLoaded(std::unique_ptr<PipelineDefinitionUnloa
     return StatusCode::OK;
 }
 
+static std::string getReplicaName(const std::string& nodeName, size_t index) {
+    return nodeName + "/" + std::to_string(index);
+}
+
+static std::string getDemultiplexerSliceName(const std::string& demultiplexerName, size_t index) {
+    return demultiplexerName + "/demultiplexer/" + std::to_string(index);
+}
+
+static std::string getGatherName(const std::string& dependantName, const std::string& demultiplexerName) {
+    return dependantName + "/gather/" + demultiplexerName;
+}
+
+static std::unique_ptr<Node> createNode(const NodeInfo& info, const std::string& nodeName, ModelManager& manager) {
+    if (info.kind == NodeKind::CUSTOM) {
+        return std::make_unique<CustomNode>(nodeName,
+            info.library,
+            info.parameters,
+            info.outputNameAliases);
+    }
+    return std::make_unique<DLNode>(nodeName,
+        info.modelName,
+        info.modelVersion,
+        manager,
+        info.outputNameAliases);
+}
+
+static void setExecutionCondition(std::unordered_map<std::string, std::unique_ptr<Node>>& nodes, const std::string& dependantName, size_t replicasCount, const ExecutionCondition& condition) {
+    if (replicasCount == 0) {
+        nodes.at(dependantName)->setExecutionCondition(condition);
+        return;
+    }
+    // Within demultiplexed subgraph condition is placed on the connection with corresponding replica or slice node
+    for (size_t i = 0; i < replicasCount; i++) {
+        auto& replica = *nodes.at(getReplicaName(dependantName, i));
+        ExecutionCondition replicaCondition = condition;
+        if (nodes.count(getReplicaName(condition.dependencyName, i)) > 0) {
+            replicaCondition.dependencyName = getReplicaName(condition.dependencyName, i);
+        } else if (nodes.count(getDemultiplexerSliceName(condition.dependencyName, i)) > 0) {
+            replicaCondition.dependencyName = getDemultiplexerSliceName(condition.dependencyName, i);
+        }
+        replica.setExecutionCondition(replicaCondition);
+    }
+}
+
+const NodeInfo* PipelineDefinition::findNodeInfo(const std::string& nodeName) const {
+    auto it = std::find_if(nodeInfos.begin(), nodeInfos.end(), [&nodeName](const NodeInfo& info) { return info.nodeName == nodeName; });
+    return it == nodeInfos.end() ? nullptr : &(*it);
+}
+
+size_t PipelineDefinition::getDemultiplyCountOfRegion(const std::string& nodeName) const {
+    return findNodeInfo(demultiplexedBy.at(nodeName))->demultiplyCount.value();
+}
+
 Status PipelineDefinition::create(std::unique_ptr<Pipeline>& pipeline,
     const tensorflow::serving::PredictRequest* request,
     tensorflow::serving::PredictResponse* response,
@@ -138,6 +210,12 @@ Status PipelineDefinition::create(std::unique_ptr<Pipeline>& pipeline,
         return status;
     }
 
+    // Pipeline outputs not listed in output filter are not fetched from nodes connected to exit node
+    std::set<std::string> outputFilter;
+    if (request != nullptr) {
+        outputFilter.insert(request->output_filter().begin(), request->output_filter().end());
+    }
+
     std::unordered_map<std::string, std::unique_ptr<Node>> nodes;
     EntryNode* entry = nullptr;
     ExitNode* exit = nullptr;
@@ -146,20 +224,28 @@ Status PipelineDefinition::create(std::unique_ptr<Pipeline>& pipeline,
             getName(), info.nodeName, info.modelName);
         switch (info.kind) {
         case NodeKind::ENTRY: {
-            auto node = std::make_unique<EntryNode>(request);
+            auto node = std::make_unique<EntryNode>(request, std::atomic_load(&this->inputsInfo));
             entry = node.get();
             nodes.insert(std::make_pair(info.nodeName, std::move(node)));
             break;
         }
         case NodeKind::DL:
-            nodes.insert(std::make_pair(info.nodeName, std::move(std::make_unique<DLNode>(info.nodeName,
-                                                           info.modelName,
-                                                           info.modelVersion,
-                                                           manager,
-                                                           info.outputNameAliases))));
+        case NodeKind::CUSTOM:
+            if (demultiplexedBy.count(info.nodeName) == 0) {
+                nodes.insert(std::make_pair(info.nodeName, createNode(info, info.nodeName, manager)));
+                break;
+            }
+            for (size_t i = 0; i < getDemultiplyCountOfRegion(info.nodeName); i++) {
+                auto replicaName = getReplicaName(info.nodeName, i);
+                nodes.insert(std::make_pair(replicaName, createNode(info, replicaName, manager)));
+            }
             break;
         case NodeKind::EXIT: {
-            auto node = std::make_unique<ExitNode>(response);
+            status = validateOutputFilter(info.nodeName, outputFilter);
+            if (!status.ok()) {
+                return status;
+            }
+            auto node = std::make_unique<ExitNode>(response, outputFilter);
             exit = node.get();
             nodes.insert(std::make_pair(info.nodeName, std::move(node)));
             break;
@@ -168,12 +254,90 @@ Status PipelineDefinition::create(std::unique_ptr<Pipeline>& pipeline,
             throw std::invalid_argument("unknown node kind");
         }
     }
+
+    // Demultiplexer node outputs are sliced by auxiliary node per subgraph replica,
+    // outputs of subgraph replicas are concatenated by auxiliary node per (dependant, demultiplexer) pair.
+    std::map<std::string, std::set<std::string>> demultiplexedOutputs;
+    std::map<std::pair<std::string, std::string>, std::set<std::string>> gatheredInputs;
+    for (const auto& [dependantName, dependencies] : connections) {
+        for (const auto& [dependencyName, mapping] : dependencies) {
+            if (demultiplexedBy.count(dependantName) > 0 && demultiplexedBy.count(dependencyName) == 0 && demultiplexedBy.at(dependantName) == dependencyName) {
+                for (const auto& [alias, realName] : mapping) {
+                    demultiplexedOutputs[dependencyName].insert(alias);
+                }
+                const auto& executionCondition = findNodeInfo(dependantName)->executionCondition;
+                if (executionCondition && executionCondition->dependencyName == dependencyName) {
+                    demultiplexedOutputs[dependencyName].insert(executionCondition->dataItem);
+                }
+            } else if (demultiplexedBy.count(dependencyName) > 0 && demultiplexedBy.count(dependantName) == 0) {
+                for (const auto& [alias, realName] : mapping) {
+                    gatheredInputs[{dependantName, demultiplexedBy.at(dependencyName)}].insert(realName);
+                }
+            }
+        }
+    }
+    for (const auto& [demultiplexerName, aliases] : demultiplexedOutputs) {
+        InputPairs identity;
+        for (const auto& alias : aliases) {
+            identity.emplace_back(alias, alias);
+        }
+        for (size_t i = 0; i < findNodeInfo(demultiplexerName)->demultiplyCount.value(); i++) {
+            auto node = std::make_unique<DemultiplexerNode>(getDemultiplexerSliceName(demultiplexerName, i), i, findNodeInfo(demultiplexerName)->demultiplyCount.value());
+            Pipeline::connect(*nodes.at(demultiplexerName), *node, identity);
+            nodes.insert(std::make_pair(node->getName(), std::move(node)));
+        }
+    }
+    for (const auto& [key, inputNames] : gatheredInputs) {
+        const auto& [dependantName, demultiplexerName] = key;
+        auto node = std::make_unique<GatherNode>(getGatherName(dependantName, demultiplexerName), findNodeInfo(demultiplexerName)->demultiplyCount.value());
+        InputPairs identity;
+        for (const auto& inputName : inputNames) {
+            identity.emplace_back(inputName, inputName);
+        }
+        Pipeline::connect(*node, *nodes.at(dependantName), identity);
+        nodes.insert(std::make_pair(node->getName(), std::move(node)));
+    }
+
     for (const auto& kv : connections) {
-        const auto& dependantNode = nodes.at(kv.first);
+        const auto& dependantName = kv.first;
+        const auto& executionCondition = findNodeInfo(dependantName)->executionCondition;
         for (const auto& pair : kv.second) {
-            const auto& dependencyNode = nodes.at(pair.first);
-            SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Connecting pipeline: {}, from: {}, to: {}", getName(), dependencyNode->getName(), dependantNode->getName());
-            Pipeline::connect(*dependencyNode, *dependantNode, pair.second);
+            const auto& dependencyName = pair.first;
+            const bool dependantDemultiplexed = demultiplexedBy.count(dependantName) > 0;
+            const bool dependencyDemultiplexed = demultiplexedBy.count(dependencyName) > 0;
+            SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Connecting pipeline: {}, from: {}, to: {}", getName(), dependencyName, dependantName);
+            if (dependantDemultiplexed && dependencyDemultiplexed) {
+                for (size_t i = 0; i < getDemultiplyCountOfRegion(dependantName); i++) {
+                    Pipeline::connect(*nodes.at(getReplicaName(dependencyName, i)), *nodes.at(getReplicaName(dependantName, i)), pair.second);
+                }
+            } else if (dependantDemultiplexed && demultiplexedBy.at(dependantName) == dependencyName) {
+                for (size_t i = 0; i < getDemultiplyCountOfRegion(dependantName); i++) {
+                    Pipeline::connect(*nodes.at(getDemultiplexerSliceName(dependencyName, i)), *nodes.at(getReplicaName(dependantName, i)), pair.second);
+                }
+            } else if (dependantDemultiplexed) {
+                for (size_t i = 0; i < getDemultiplyCountOfRegion(dependantName); i++) {
+                    Pipeline::connect(*nodes.at(dependencyName), *nodes.at(getReplicaName(dependantName, i)), pair.second);
+                }
+            } else if (dependencyDemultiplexed) {
+                auto& gatherNode = *nodes.at(getGatherName(dependantName, demultiplexedBy.at(dependencyName)));
+                for (size_t i = 0; i < getDemultiplyCountOfRegion(dependencyName); i++) {
+                    InputPairs mapping;
+                    for (const auto& [alias, realName] : pair.second) {
+                        mapping.emplace_back(alias, GatherNode::getReplicaInputName(realName, i));
+                    }
+                    Pipeline::connect(*nodes.at(getReplicaName(dependencyName, i)), gatherNode, mapping);
+                }
+            } else if (!outputFilter.empty() && findNodeInfo(dependantName)->kind == NodeKind::EXIT) {
+                InputPairs mapping;
+                std::copy_if(pair.second.begin(), pair.second.end(), std::back_inserter(mapping),
+                    [&outputFilter](const auto& aliasAndName) { return outputFilter.count(aliasAndName.second) > 0; });
+                Pipeline::connect(*nodes.at(dependencyName), *nodes.at(dependantName), mapping);
+            } else {
+                Pipeline::connect(*nodes.at(dependencyName), *nodes.at(dependantName), pair.second);
+            }
+            if (executionCondition && executionCondition->dependencyName == dependencyName) {
+                setExecutionCondition(nodes, dependantName, dependantDemultiplexed ? getDemultiplyCountOfRegion(dependantName) : 0, *executionCondition);
+            }
         }
     }
     pipeline = std::make_unique<Pipeline>(*entry, *exit, pipelineName);
@@ -183,6 +347,26 @@ Status PipelineDefinition::create(std::unique_ptr<Pipeline>& pipeline,
     return status;
 }
 
+Status PipelineDefinition::validateOutputFilter(const std::string& exitNodeName, const std::set<std::string>& outputFilter) const {
+    auto it = connections.find(exitNodeName);
+    for (const auto& name : outputFilter) {
+        bool found = false;
+        if (it != connections.end()) {
+            for (const auto& [dependencyName, mapping] : it->second) {
+                found |= std::any_of(mapping.begin(), mapping.end(), [&name](const auto& aliasAndName) { return aliasAndName.second == name; });
+            }
+        }
+        if (!found) {
+            std::stringstream ss;
+            ss << "Unknown output: " << name;
+            const std::string details = ss.str();
+            SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Pipeline: {} invalid output filter - {}", getName(), details);
+            return Status(StatusCode::INVALID_OUTPUT_FILTER, details);
+        }
+    }
+    return StatusCode::OK;
+}
+
 void PipelineDefinition::resetSubscriptions(ModelManager& manager) {
     for (auto& [modelName, modelVersion] : subscriptions) {
         if (modelVersion) {
@@ -240,6 +424,7 @@ class NodeValidator {
     const NodeInfo& dependantNodeInfo;
     const pipeline_connections_t& connections;
     const std::vector<NodeInfo>& nodeInfos;
+    const demultiplexed_regions_t& demultiplexedBy;
 
     std::unique_ptr<ModelInstanceUnloadGuard> dependantModelUnloadGuard;
     std::shared_ptr<ModelInstance> dependantModelInstance;
@@ -251,12 +436,14 @@ public:
         ModelManager& manager,
         const NodeInfo& dependantNodeInfo,
         const pipeline_connections_t& connections,
-        const std::vector<NodeInfo>& nodeInfos) :
+        const std::vector<NodeInfo>& nodeInfos,
+        const demultiplexed_regions_t& demultiplexedBy) :
         pipelineName(pipelineName),
         manager(manager),
         dependantNodeInfo(dependantNodeInfo),
         connections(connections),
-        nodeInfos(nodeInfos) {
+        nodeInfos(nodeInfos),
+        demultiplexedBy(demultiplexedBy) {
         SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Validation of pipeline: {}; node name: {}; node kind: {}",
             pipelineName,
             dependantNodeInfo.nodeName,
@@ -315,6 +502,19 @@ public:
         return StatusCode::OK;
     }
 
+    Status checkForStatefulModel() {
+        const auto& config = dependantModelInstance->getModelConfig();
+        // Pipeline requests carry no sequence inputs, memory state would leak between unrelated requests
+        if (config.isStateful()) {
+            SPDLOG_LOGGER_ERROR(modelmanager_logger, "Validation of pipeline({}) definition failed. Node name {} used stateful model name {} which is not supported in pipelines.",
+                pipelineName,
+                dependantNodeInfo.nodeName,
+                dependantNodeInfo.modelName);
+            return StatusCode::PIPELINE_NODE_REFERING_TO_STATEFUL_MODEL;
+        }
+        return StatusCode::OK;
+    }
+
     Status checkConnectionMappedToExistingDataSource(const NodeInfo& dependencyNodeInfo, std::shared_ptr<ModelInstance>& dependencyModelInstance, const std::string& dataSource) {
         // Check whether dependency node is configured to have required output.
         if (dependencyNodeInfo.outputNameAliases.count(dataSource) == 0) {
@@ -344,12 +544,41 @@ public:
         return StatusCode::OK;
     }
 
+    Status getShapeAfterDemultiplexing(const NodeInfo& dependencyNodeInfo, const shape_t& shape, shape_t& result) {
+        // Demultiplexer output is split along first dimension between subgraph replicas,
+        // while outputs leaving the subgraph are gathered along new first dimension.
+        result = shape;
+        const bool dependantDemultiplexed = demultiplexedBy.count(dependantNodeInfo.nodeName) > 0;
+        const bool dependencyDemultiplexed = demultiplexedBy.count(dependencyNodeInfo.nodeName) > 0;
+        if (dependantDemultiplexed && demultiplexedBy.at(dependantNodeInfo.nodeName) == dependencyNodeInfo.nodeName) {
+            if (shape.size() < 2 || shape[0] > dependencyNodeInfo.demultiplyCount.value()) {
+                SPDLOG_LOGGER_ERROR(modelmanager_logger, "Validation of pipeline({}) definition failed. Demultiplexer node:{} output shape:{} exceeds demultiply_count:{}",
+                    pipelineName,
+                    dependencyNodeInfo.nodeName,
+                    TensorInfo::shapeToString(shape),
+                    dependencyNodeInfo.demultiplyCount.value());
+                return StatusCode::PIPELINE_WRONG_DEMULTIPLEXER_DIMENSION;
+            }
+            result.erase(result.begin());
+        } else if (dependencyDemultiplexed && !dependantDemultiplexed) {
+            const auto& demultiplexerName = demultiplexedBy.at(dependencyNodeInfo.nodeName);
+            auto demultiplexerInfo = std::find_if(nodeInfos.begin(), nodeInfos.end(), [&demultiplexerName](const NodeInfo& info) { return info.nodeName == demultiplexerName; });
+            result.insert(result.begin(), demultiplexerInfo->demultiplyCount.value());
+        }
+        return StatusCode::OK;
+    }
+
     Status checkConnectionMetadataCorrectness(const NodeInfo& dependencyNodeInfo, std::shared_ptr<ModelInstance>& dependencyModelInstance, const std::string& modelInputName, const std::string& modelOutputName) {
         // If validated connection pair connects two DL model nodes,
         // check if both input/output exist and its metadata (shape, precision) matches.
         const auto& tensorInput = dependantModelInstance->getInputsInfo().at(modelInputName);
         const auto& tensorOutput = dependencyModelInstance->getOutputsInfo().at(modelOutputName);
-        if (tensorInput->getShape() != tensorOutput->getShape()) {
+        shape_t outputShape;
+        auto result = getShapeAfterDemultiplexing(dependencyNodeInfo, tensorOutput->getShape(), outputShape);
+        if (!result.ok()) {
+            return result;
+        }
+        if (tensorInput->getShape() != outputShape) {
             SPDLOG_LOGGER_ERROR(modelmanager_logger, "Validation of pipeline({}) definition failed. Shape mismatch between: dependant node:{}; model:{}; version:{}; input:{}; shape:{} vs dependency node:{}; model:{}; version:{}; output:{}; shape:{}",
                 pipelineName,
                 dependantNodeInfo.nodeName,
@@ -361,10 +590,19 @@ public:
                 dependencyNodeInfo.modelName,
                 dependencyNodeInfo.modelVersion.value_or(0),
                 modelOutputName,
-                TensorInfo::shapeToString(tensorOutput->getShape()));
+                TensorInfo::shapeToString(outputShape));
             return StatusCode::INVALID_SHAPE;
         }
-        if (tensorInput->getPrecision() != tensorOutput->getPrecision()) {
+        if (tensorInput->getPrecision() != tensorOutput->getPrecision() &&
+            tensorInput->isPrecisionConversionAllowed() &&
+            isPrecisionConversionSupported(tensorOutput->getPrecision(), tensorInput->getPrecision())) {
+            SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Pipeline({}) dependant node:{}; input:{} will be converted from precision:{} to:{}",
+                pipelineName,
+                dependantNodeInfo.nodeName,
+                modelInputName,
+                tensorOutput->getPrecisionAsString(),
+                tensorInput->getPrecisionAsString());
+        } else if (tensorInput->getPrecision() != tensorOutput->getPrecision()) {
             SPDLOG_LOGGER_ERROR(modelmanager_logger, "Validation of pipeline({}) definition failed. Precision mismatch between: dependant node:{}; model:{}; version:{}; input:{}; precision:{} vs dependency node:{}; model:{}; version:{}; output:{}; precision:{}",
                 pipelineName,
                 dependantNodeInfo.nodeName,
@@ -439,7 +677,7 @@ public:
     }
 
     Status validateConnection(const NodeInfo& dependencyNodeInfo, const InputPairs& mapping) {
-        // At this point dependency node can only be either DL model node or entry node.
+        // At this point dependency node can only be either DL model node, custom node or entry node.
         // Take care when adding new node types.
         std::unique_ptr<ModelInstanceUnloadGuard> dependencyModelUnloadGuard;
         std::shared_ptr<ModelInstance> dependencyModelInstance;
@@ -480,10 +718,60 @@ public:
             }
         }
 
+        if (dependantNodeInfo.executionCondition && dependantNodeInfo.executionCondition->dependencyName == dependencyNodeInfo.nodeName) {
+            auto result = checkConnectionMappedToExistingDataSource(dependencyNodeInfo, dependencyModelInstance, dependantNodeInfo.executionCondition->dataItem);
+            if (!result.ok()) {
+                return result;
+            }
+        }
+
+        return StatusCode::OK;
+    }
+
+    Status checkExecutionCondition() {
+        const auto& condition = dependantNodeInfo.executionCondition.value();
+        if (connections.count(dependantNodeInfo.nodeName) == 0 || connections.at(dependantNodeInfo.nodeName).count(condition.dependencyName) == 0) {
+            SPDLOG_LOGGER_ERROR(modelmanager_logger, "Validation of pipeline({}) definition failed. Node:{} execution condition refers to node:{} which is not its dependency",
+                pipelineName,
+                dependantNodeInfo.nodeName,
+                condition.dependencyName);
+            return StatusCode::PIPELINE_CONDITION_NOT_ON_DEPENDENCY;
+        }
+        if (demultiplexedBy.count(condition.dependencyName) > 0 && demultiplexedBy.count(dependantNodeInfo.nodeName) == 0) {
+            SPDLOG_LOGGER_ERROR(modelmanager_logger, "Validation of pipeline({}) definition failed. Node:{} execution condition refers to gathered results of node:{}",
+                pipelineName,
+                dependantNodeInfo.nodeName,
+                condition.dependencyName);
+            return StatusCode::PIPELINE_CONDITION_NOT_ON_DEPENDENCY;
+        }
+        return StatusCode::OK;
+    }
+
+    Status checkNodeLibrary() {
+        if (!dependantNodeInfo.library.isValid()) {
+            SPDLOG_LOGGER_ERROR(modelmanager_logger, "Validation of pipeline({}) definition failed. Custom node: {} refers to not loaded library",
+                pipelineName,
+                dependantNodeInfo.nodeName);
+            return StatusCode::PIPELINE_DEFINITION_INVALID_NODE_LIBRARY;
+        }
         return StatusCode::OK;
     }
 
     Status validate() {
+        if (dependantNodeInfo.executionCondition) {
+            auto result = checkExecutionCondition();
+            if (!result.ok()) {
+                return result;
+            }
+        }
+
+        if (dependantNodeInfo.kind == NodeKind::CUSTOM) {
+            auto result = checkNodeLibrary();
+            if (!result.ok()) {
+                return result;
+            }
+        }
+
         if (dependantNodeInfo.kind == NodeKind::DL) {
             auto result = fetchUnderlyingModelInstance();
             if (!result.ok()) {
@@ -495,6 +783,11 @@ public:
                 return result;
             }
 
+            result = checkForStatefulModel();
+            if (!result.ok()) {
+                return result;
+            }
+
             prepareRemainingUnconnectedDependantModelInputsSet();
         }
 
@@ -522,7 +815,7 @@ public:
 };
 
 Status PipelineDefinition::validateNode(ModelManager& manager, const NodeInfo& dependantNodeInfo) {
-    NodeValidator validator(this->pipelineName, manager, dependantNodeInfo, connections, nodeInfos);
+    NodeValidator validator(this->pipelineName, manager, dependantNodeInfo, connections, nodeInfos, demultiplexedBy);
     return validator.validate();
 }
 
@@ -593,6 +886,62 @@ Status PipelineDefinition::validateForCycles() {
     return StatusCode::OK;
 }
 
+Status PipelineDefinition::validateDemultiplexing() {
+    demultiplexedBy.clear();
+    std::unordered_map<std::string, std::vector<std::string>> dependants;
+    for (const auto& [dependantName, dependencies] : connections) {
+        for (const auto& [dependencyName, mapping] : dependencies) {
+            dependants[dependencyName].push_back(dependantName);
+        }
+    }
+
+    for (const auto& info : nodeInfos) {
+        if (!info.gatherFromNode) {
+            continue;
+        }
+        auto demultiplexerInfo = findNodeInfo(info.gatherFromNode.value());
+        if (demultiplexerInfo == nullptr || !demultiplexerInfo->demultiplyCount) {
+            SPDLOG_LOGGER_ERROR(modelmanager_logger, "Validation of pipeline({}) definition failed. Node:{} gathers from node:{} which is not a demultiplexer",
+                pipelineName,
+                info.nodeName,
+                info.gatherFromNode.value());
+            return StatusCode::PIPELINE_NODE_GATHER_FROM_NOT_DEMULTIPLEXER;
+        }
+    }
+
+    // Subgraph of demultiplexer consists of all its direct and indirect dependants
+    // up to the exit node or node gathering its results.
+    for (const auto& info : nodeInfos) {
+        if (!info.demultiplyCount) {
+            continue;
+        }
+        std::set<std::string> visited;
+        std::vector<std::string> toVisit{info.nodeName};
+        while (!toVisit.empty()) {
+            auto current = toVisit.back();
+            toVisit.pop_back();
+            for (const auto& dependantName : dependants[current]) {
+                if (!visited.insert(dependantName).second) {
+                    continue;
+                }
+                auto dependantInfo = findNodeInfo(dependantName);
+                if (dependantInfo == nullptr || dependantInfo->kind == NodeKind::EXIT || dependantInfo->gatherFromNode == info.nodeName) {
+                    continue;
+                }
+                if (dependantInfo->demultiplyCount || demultiplexedBy.count(dependantName) > 0) {
+                    SPDLOG_LOGGER_ERROR(modelmanager_logger, "Validation of pipeline({}) definition failed. Node:{} is a part of more than one demultiplexed subgraph",
+                        pipelineName,
+                        dependantName);
+                    return StatusCode::PIPELINE_DEMULTIPLEXER_NESTING_NOT_SUPPORTED;
+                }
+                demultiplexedBy[dependantName] = info.nodeName;
+                toVisit.push_back(dependantName);
+            }
+        }
+    }
+    return StatusCode::OK;
+}
+
 Status PipelineDefinition::validateNodes(ModelManager& manager) {
     SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Validation of pipeline definition: {} nodes started.", getName());
 
@@ -626,6 +975,11 @@ Status PipelineDefinition::validateNodes(ModelManager& manager) {
         return StatusCode::PIPELINE_MULTIPLE_EXIT_NODES;
     }
 
+    auto demultiplexingResult = validateDemultiplexing();
+    if (!demultiplexingResult.ok()) {
+        return demultiplexingResult;
+    }
+
     for (const auto& node : nodeInfos) {
         auto findByName = [node](const NodeInfo& nodeInfo) {
             return nodeInfo.nodeName == node.nodeName;
@@ -663,7 +1017,9 @@ Status PipelineDefinition::getInputsInfo(tensor_map_t& inputsInfo, const ModelMa
             }
 
             switch (dependantNodeInfo->kind) {
-            case NodeKind::EXIT: {
+            case NodeKind::EXIT:
+            case NodeKind::CUSTOM: {
+                // Custom node libraries do not declare tensor metadata
                 for (const auto& [alias, realName] : specificDependencyMapping) {
                     inputsInfo.insert({alias, TensorInfo::getUnspecifiedTensorInfo()});
                 }
@@ -717,7 +1073,8 @@ Status PipelineDefinition::getOutputsInfo(tensor_map_t& outputsInfo, const Model
             const auto& dependencyNodeInfo = std::find_if(std::begin(nodeInfos), std::end(nodeInfos), byName(dependencyNodeName));
 
             switch (dependencyNodeInfo->kind) {
-            case NodeKind::ENTRY: {
+            case NodeKind::ENTRY:
+            case NodeKind::CUSTOM: {
                 for (const auto& [alias, realName] : specificDependencyMapping) {
                     outputsInfo.insert({realName, TensorInfo::getUnspecifiedTensorInfo()});
                 }
@@ -738,7 +1095,15 @@ Status PipelineDefinition::getOutputsInfo(tensor_map_t& outputsInfo, const Model
 
                 for (const auto& [alias, realName] : specificDependencyMapping) {
                     const auto& finalName = dependencyNodeInfo->outputNameAliases.count(alias) > 0 ? dependencyNodeInfo->outputNameAliases.at(alias) : alias;
-                    outputsInfo[realName] = instance->getOutputsInfo().at(finalName);
+                    const auto& outputInfo = instance->getOutputsInfo().at(finalName);
+                    if (demultiplexedBy.count(dependencyNodeName) == 0) {
+                        outputsInfo[realName] = outputInfo;
+                        continue;
+                    }
+                    // Results of demultiplexed subgraph are gathered along new first dimension
+                    shape_t shape = outputInfo->getShape();
+                    shape.insert(shape.begin(), getDemultiplyCountOfRegion(dependencyNodeName));
+                    outputsInfo[realName] = std::make_shared<TensorInfo>(outputInfo->getName(), outputInfo->getMappedName(), outputInfo->getPrecision(), shape, InferenceEngine::Layout::ANY);
                 }
                 break;
             }
@@ -18,6 +18,7 @@
 #include <atomic>
 #include <condition_variable>
 #include <memory>
+#include <optional>
 #include <set>
 #include <shared_mutex>
 #include <string>
@@ -30,8 +31,11 @@
 #include "tensorflow_serving/apis/prediction_service.grpc.pb.h"
 #pragma GCC diagnostic pop
 
+#include "custom_node.hpp"
+#include "execution_condition.hpp"
 #include "model_version_policy.hpp"
 #include "node.hpp"
+#include "node_library.hpp"
 #include "pipeline.hpp"
 #include "pipelinedefinitionstatus.hpp"
 #include "pipelinedefinitionunloadguard.hpp"
@@ -46,10 +50,12 @@ using pipeline_connections_t = std::unordered_map<std::string, std::unordered_ma
 enum class NodeKind {
     ENTRY,
     DL,
+    CUSTOM,
     EXIT
 };
 
 const std::string DL_NODE_CONFIG_TYPE = "DL model";
+const std::string CUSTOM_NODE_CONFIG_TYPE = "custom";
 
 Status toNodeKind(const std::string& str, NodeKind& nodeKind);
 
@@ -59,19 +65,37 @@ struct NodeInfo {
     std::string modelName;
     std::optional<model_version_t> modelVersion;
     std::unordered_map<std::string, std::string> outputNameAliases;
+    NodeLibrary library;
+    parameters_t parameters;
+    std::optional<size_t> demultiplyCount;
+    std::optional<std::string> gatherFromNode;
+    std::optional<ExecutionCondition> executionCondition;
 
     NodeInfo(NodeKind kind,
         const std::string& nodeName,
         const std::string& modelName = "",
         std::optional<model_version_t> modelVersion = std::nullopt,
-        std::unordered_map<std::string, std::string> outputNameAliases = {}) :
+        std::unordered_map<std::string, std::string> outputNameAliases = {},
+        const NodeLibrary& library = {},
+        const parameters_t& parameters = {},
+        std::optional<size_t> demultiplyCount = std::nullopt,
+        std::optional<std::string> gatherFromNode = std::nullopt,
+        std::optional<ExecutionCondition> executionCondition = std::nullopt) :
         kind(kind),
         nodeName(nodeName),
         modelName(modelName),
         modelVersion(modelVersion),
-        outputNameAliases(outputNameAliases) {}
+        outputNameAliases(outputNameAliases),
+        library(library),
+        parameters(parameters),
+        demultiplyCount(demultiplyCount),
+        gatherFromNode(gatherFromNode),
+        executionCondition(executionCondition) {}
 };
 
+// Maps node name to the name of demultiplexer node which subgraph the node belongs to
+using demultiplexed_regions_t = std::unordered_map<std::string, std::string>;
+
 class PipelineDefinition {
     struct ValidationResultNotifier {
         ValidationResultNotifier(PipelineDefinitionStatus& status, std::condition_variable& loadedNotify) :
@@ -95,6 +119,10 @@ class PipelineDefinition {
     const std::string pipelineName;
     std::vector<NodeInfo> nodeInfos;
     pipeline_connections_t connections;
+    demultiplexed_regions_t demultiplexedBy;
+
+    // Inputs metadata collected during validation, replaced when pipeline is revalidated
+    std::shared_ptr<const tensor_map_t> inputsInfo;
 
     std::atomic<uint64_t> requestsHandlesCounter = 0;
     std::shared_mutex loadMtx;
@@ -112,6 +140,10 @@ private:
 
     Status validateNode(ModelManager& manager, const NodeInfo& node);
 
+    const NodeInfo* findNodeInfo(const std::string& nodeName) const;
+    size_t getDemultiplyCountOfRegion(const std::string& nodeName) const;
+    Status validateOutputFilter(const std::string& exitNodeName, const std::set<std::string>& outputFilter) const;
+
 public:
     static constexpr uint64_t WAIT_FOR_LOADED_DEFAULT_TIMEOUT_MICROSECONDS = 10000;
     PipelineDefinition(const std::string& pipelineName,
@@ -131,6 +163,7 @@ public:
     Status validate(ModelManager& manager);
     Status validateNodes(ModelManager& manager);
     Status validateForCycles();
+    Status validateDemultiplexing();
     const std::string& getName() const { return pipelineName; }
     const PipelineDefinitionStateCode getStateCode() const { return status.getStateCode(); }
     const model_version_t getVersion() const { return VERSION; }
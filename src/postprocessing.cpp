@@ -0,0 +1,273 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "postprocessing.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+// Intrinsics returning undefined vectors trigger false positive warnings
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#include <immintrin.h>
+#pragma GCC diagnostic pop
+
+namespace ovms {
+
+namespace {
+
+// Returns 0 for rows containing only NaN values
+int32_t argmaxRowScalar(const float* row, size_t columns) {
+    float maxValue = -std::numeric_limits<float>::infinity();
+    int32_t index = -1;
+    for (size_t i = 0; i < columns; i++) {
+        if (row[i] > maxValue || (index < 0 && row[i] == maxValue)) {
+            maxValue = row[i];
+            index = static_cast<int32_t>(i);
+        }
+    }
+    return index < 0 ? 0 : index;
+}
+
+void argmaxScalar(const float* data, size_t rows, size_t columns, int32_t* indices) {
+    for (size_t row = 0; row < rows; row++) {
+        indices[row] = argmaxRowScalar(data + row * columns, columns);
+    }
+}
+
+/**
+ * @brief Keeps k largest values seen so far in descending order
+ */
+class TopKSelection {
+    const size_t k;
+    float* values;
+    int32_t* indices;
+    size_t filled = 0;
+
+public:
+    TopKSelection(size_t k, float* values, int32_t* indices) :
+        k(k),
+        values(values),
+        indices(indices) {}
+
+    bool isFull() const {
+        return filled == k;
+    }
+
+    float smallest() const {
+        return values[k - 1];
+    }
+
+    void offer(float value, size_t index) {
+        if (value != value) {
+            return;
+        }
+        if (filled == k) {
+            if (!(value > values[k - 1])) {
+                return;
+            }
+            filled--;
+        }
+        size_t position = filled;
+        while (position > 0 && values[position - 1] < value) {
+            values[position] = values[position - 1];
+            indices[position] = indices[position - 1];
+            position--;
+        }
+        values[position] = value;
+        indices[position] = static_cast<int32_t>(index);
+        filled++;
+    }
+
+    void pad() {
+        for (; filled < k; filled++) {
+            values[filled] = std::numeric_limits<float>::quiet_NaN();
+            indices[filled] = -1;
+        }
+    }
+};
+
+void topKScalar(const float* data, size_t rows, size_t columns, size_t k, float* values, int32_t* indices) {
+    if (k == 0) {
+        return;
+    }
+    for (size_t row = 0; row < rows; row++) {
+        TopKSelection selection(k, values + row * k, indices + row * k);
+        const float* rowData = data + row * columns;
+        for (size_t i = 0; i < columns; i++) {
+            selection.offer(rowData[i], i);
+        }
+        selection.pad();
+    }
+}
+
+// Kernels below are compiled for specific instruction sets regardless of global compiler flags.
+// They are called only when CPUID reports support. Remainders are processed with scalar code.
+
+__attribute__((target("avx2"))) void argmaxAvx2(const float* data, size_t rows, size_t columns, int32_t* indices) {
+    for (size_t row = 0; row < rows; row++) {
+        const float* rowData = data + row * columns;
+        if (columns < 8) {
+            indices[row] = argmaxRowScalar(rowData, columns);
+            continue;
+        }
+        // Maximum is searched first, NaN is ignored since max_ps returns its second operand for NaN
+        __m256 maxValues = _mm256_set1_ps(-std::numeric_limits<float>::infinity());
+        size_t i = 0;
+        for (; i + 8 <= columns; i += 8) {
+            maxValues = _mm256_max_ps(_mm256_loadu_ps(rowData + i), maxValues);
+        }
+        __m128 half = _mm_max_ps(_mm256_castps256_ps128(maxValues), _mm256_extractf128_ps(maxValues, 1));
+        half = _mm_max_ps(half, _mm_movehl_ps(half, half));
+        half = _mm_max_ss(half, _mm_shuffle_ps(half, half, 1));
+        float maxValue = _mm_cvtss_f32(half);
+        for (; i < columns; i++) {
+            maxValue = rowData[i] > maxValue ? rowData[i] : maxValue;
+        }
+        // Then its first occurrence
+        const __m256 target = _mm256_set1_ps(maxValue);
+        int32_t index = -1;
+        for (i = 0; i + 8 <= columns; i += 8) {
+            int mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(rowData + i), target, _CMP_EQ_OQ));
+            if (mask != 0) {
+                index = static_cast<int32_t>(i + __builtin_ctz(mask));
+                break;
+            }
+        }
+        for (; index < 0 && i < columns; i++) {
+            if (rowData[i] == maxValue) {
+                index = static_cast<int32_t>(i);
+            }
+        }
+        indices[row] = index < 0 ? 0 : index;
+    }
+}
+
+__attribute__((target("avx2"))) void topKAvx2(const float* data, size_t rows, size_t columns, size_t k, float* values, int32_t* indices) {
+    if (k == 0) {
+        return;
+    }
+    for (size_t row = 0; row < rows; row++) {
+        TopKSelection selection(k, values + row * k, indices + row * k);
+        const float* rowData = data + row * columns;
+        size_t i = 0;
+        for (; i < columns && !selection.isFull(); i++) {
+            selection.offer(rowData[i], i);
+        }
+        // Blocks without value larger than the smallest selected one are skipped with a single comparison
+        __m256 threshold = _mm256_set1_ps(selection.smallest());
+        for (; selection.isFull() && i + 8 <= columns; i += 8) {
+            int mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(rowData + i), threshold, _CMP_GT_OQ));
+            if (mask == 0) {
+                continue;
+            }
+            while (mask != 0) {
+                size_t lane = __builtin_ctz(mask);
+                selection.offer(rowData[i + lane], i + lane);
+                mask &= mask - 1;
+            }
+            threshold = _mm256_set1_ps(selection.smallest());
+        }
+        for (; i < columns; i++) {
+            selection.offer(rowData[i], i);
+        }
+        selection.pad();
+    }
+}
+
+const PostProcessingKernels scalarKernels{
+    argmaxScalar,
+    topKScalar};
+
+const PostProcessingKernels avx2Kernels{
+    argmaxAvx2,
+    topKAvx2};
+
+float intersectionOverUnion(const float* a, const float* b) {
+    float width = std::min(a[5], b[5]) - std::max(a[3], b[3]);
+    float height = std::min(a[6], b[6]) - std::max(a[4], b[4]);
+    if (width <= 0 || height <= 0) {
+        return 0.0f;
+    }
+    float intersection = width * height;
+    float areaA = (a[5] - a[3]) * (a[6] - a[4]);
+    float areaB = (b[5] - b[3]) * (b[6] - b[4]);
+    return intersection / (areaA + areaB - intersection);
+}
+
+}  // namespace
+
+const PostProcessingKernels& getPostProcessingKernels(ConversionIsa isa) {
+    return isa == ConversionIsa::SCALAR ? scalarKernels : avx2Kernels;
+}
+
+const PostProcessingKernels& getPostProcessingKernels() {
+    static const PostProcessingKernels& kernels = getPostProcessingKernels(getBestConversionIsa());
+    return kernels;
+}
+
+size_t selectDetections(const float* detections, size_t count,
+    float scoreThreshold, float iouThreshold, size_t maxDetections, float* selected) {
+    std::vector<size_t> candidates;
+    for (size_t i = 0; i < count; i++) {
+        const float* detection = detections + i * DETECTION_SIZE;
+        if (detection[0] < 0) {
+            break;
+        }
+        if (detection[2] >= scoreThreshold) {
+            candidates.push_back(i);
+        }
+    }
+    auto detection = [detections](size_t i) { return detections + i * DETECTION_SIZE; };
+    std::stable_sort(candidates.begin(), candidates.end(), [&detection](size_t a, size_t b) {
+        if (detection(a)[0] != detection(b)[0]) {
+            return detection(a)[0] < detection(b)[0];
+        }
+        return detection(a)[2] > detection(b)[2];
+    });
+
+    // Greedy suppression within the same image and label, candidates are visited by descending confidence
+    std::vector<size_t> kept;
+    size_t imageStart = 0;
+    size_t keptInImage = 0;
+    for (size_t c = 0; c < candidates.size(); c++) {
+        const float* current = detection(candidates[c]);
+        if (kept.empty() || detection(kept.back())[0] != current[0]) {
+            imageStart = kept.size();
+            keptInImage = 0;
+        }
+        if (maxDetections > 0 && keptInImage == maxDetections) {
+            continue;
+        }
+        bool suppressed = false;
+        if (iouThreshold < 1.0f) {
+            for (size_t k = imageStart; k < kept.size() && !suppressed; k++) {
+                const float* other = detection(kept[k]);
+                suppressed = other[1] == current[1] && intersectionOverUnion(other, current) > iouThreshold;
+            }
+        }
+        if (!suppressed) {
+            kept.push_back(candidates[c]);
+            keptInImage++;
+        }
+    }
+    for (size_t i = 0; i < kept.size(); i++) {
+        std::copy(detection(kept[i]), detection(kept[i]) + DETECTION_SIZE, selected + i * DETECTION_SIZE);
+    }
+    return kept.size();
+}
+
+}  // namespace ovms
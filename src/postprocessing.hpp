@@ -0,0 +1,61 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "precisionutils.hpp"
+
+namespace ovms {
+
+// Values describing single detection: image_id, label, confidence, x_min, y_min, x_max, y_max
+const size_t DETECTION_SIZE = 7;
+
+/**
+ * @brief Set of post-processing kernels operating on rows of the last tensor dimension.
+ * NaN values are never selected.
+ */
+struct PostProcessingKernels {
+    // Index of the first largest value in each row
+    void (*argmax)(const float* data, size_t rows, size_t columns, int32_t* indices);
+    // k largest values of each row in descending order, equal values keep their order.
+    // Rows with less than k values other than NaN are padded with NaN and index -1.
+    void (*topK)(const float* data, size_t rows, size_t columns, size_t k, float* values, int32_t* indices);
+};
+
+/**
+ * @brief Returns kernels for a given instruction set. Caller must ensure it is supported.
+ */
+const PostProcessingKernels& getPostProcessingKernels(ConversionIsa isa);
+
+/**
+ * @brief Returns kernels for the best instruction set supported by the CPU
+ */
+const PostProcessingKernels& getPostProcessingKernels();
+
+/**
+ * @brief Filters detections in DetectionOutput layout, ending at first detection with negative image_id.
+ * Drops detections with confidence below threshold, suppresses detections overlapping detection of the same
+ * image and label with higher confidence by more than iouThreshold and keeps at most maxDetections per image
+ * (0 means no limit). Selected detections are ordered by image_id and descending confidence.
+ *
+ * @return number of detections written to selected, which must have room for count detections
+ */
+size_t selectDetections(const float* detections, size_t count,
+    float scoreThreshold, float iouThreshold, size_t maxDetections, float* selected);
+
+}  // namespace ovms
@@ -0,0 +1,393 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "precisionutils.hpp"
+
+#include <cstring>
+
+// Intrinsics returning undefined vectors trigger false positive warnings
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#include <immintrin.h>
+#pragma GCC diagnostic pop
+
+namespace ovms {
+
+namespace {
+
+float halfToFloat(uint16_t half) {
+    uint32_t sign = static_cast<uint32_t>(half & 0x8000) << 16;
+    uint32_t exponent = (half >> 10) & 0x1f;
+    uint32_t mantissa = half & 0x3ff;
+    uint32_t bits;
+    if (exponent == 0x1f) {
+        // Infinity or NaN, NaN is quieted
+        bits = sign | 0x7f800000 | (mantissa != 0 ? 0x400000 : 0) | (mantissa << 13);
+    } else if (exponent != 0) {
+        bits = sign | ((exponent + 127 - 15) << 23) | (mantissa << 13);
+    } else if (mantissa == 0) {
+        bits = sign;
+    } else {
+        // Subnormal half is a normal float
+        exponent = 127 - 15 + 1;
+        while ((mantissa & 0x400) == 0) {
+            mantissa <<= 1;
+            exponent--;
+        }
+        bits = sign | (exponent << 23) | ((mantissa & 0x3ff) << 13);
+    }
+    float result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+// Rounds to nearest even, the same way as F16C instructions do
+uint16_t floatToHalf(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    uint32_t sign = (bits >> 16) & 0x8000;
+    uint32_t absolute = bits & 0x7fffffff;
+    if (absolute >= 0x7f800000) {
+        // Infinity or NaN, NaN is quieted and its payload truncated
+        return sign | 0x7c00 | (absolute > 0x7f800000 ? (0x200 | ((absolute >> 13) & 0x3ff)) : 0);
+    }
+    if (absolute >= 0x477ff000) {
+        // Rounds above largest half value 65504
+        return sign | 0x7c00;
+    }
+    uint32_t result, remainder, halfway;
+    if (absolute >= 0x38800000) {
+        result = (absolute >> 13) - ((127 - 15) << 10);
+        remainder = absolute & 0x1fff;
+        halfway = 0x1000;
+    } else {
+        // Half subnormal or zero, result in units of 2^-24
+        uint32_t shift = 126 - (absolute >> 23);
+        if (shift > 24) {
+            return sign;
+        }
+        uint32_t mantissa = (absolute & 0x7fffff) | 0x800000;
+        result = mantissa >> shift;
+        remainder = mantissa & ((1u << shift) - 1);
+        halfway = 1u << (shift - 1);
+    }
+    if (remainder > halfway || (remainder == halfway && (result & 1))) {
+        result++;
+    }
+    return static_cast<uint16_t>(sign | result);
+}
+
+void fp16ToFp32Scalar(const uint16_t* src, float* dst, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        dst[i] = halfToFloat(src[i]);
+    }
+}
+
+void fp32ToFp16Scalar(const float* src, uint16_t* dst, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        dst[i] = floatToHalf(src[i]);
+    }
+}
+
+void u16ToU32Scalar(const uint16_t* src, uint32_t* dst, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        dst[i] = src[i];
+    }
+}
+
+void u32ToU16Scalar(const uint32_t* src, uint16_t* dst, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        dst[i] = static_cast<uint16_t>(src[i]);
+    }
+}
+
+void i64ToI32Scalar(const int64_t* src, int32_t* dst, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        dst[i] = static_cast<int32_t>(src[i]);
+    }
+}
+
+template <typename Source>
+void toFp32Scalar(const Source* src, float* dst, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        dst[i] = static_cast<float>(src[i]);
+    }
+}
+
+// Kernels below are compiled for specific instruction sets regardless of global compiler flags.
+// They are called only when CPUID reports support. Remainders are converted with scalar kernels.
+
+__attribute__((target("avx2,f16c"))) void fp16ToFp32Avx2(const uint16_t* src, float* dst, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i half = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(half));
+    }
+    fp16ToFp32Scalar(src + i, dst + i, count - i);
+}
+
+__attribute__((target("avx2,f16c"))) void fp32ToFp16Avx2(const float* src, uint16_t* dst, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i half = _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), half);
+    }
+    fp32ToFp16Scalar(src + i, dst + i, count - i);
+}
+
+__attribute__((target("avx2"))) void u16ToU32Avx2(const uint16_t* src, uint32_t* dst, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i narrow = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_cvtepu16_epi32(narrow));
+    }
+    u16ToU32Scalar(src + i, dst + i, count - i);
+}
+
+__attribute__((target("avx2"))) void u32ToU16Avx2(const uint32_t* src, uint16_t* dst, size_t count) {
+    const __m256i mask = _mm256_set1_epi32(0xffff);
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        // Masking makes unsigned saturation of pack a no-op
+        __m256i low = _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)), mask);
+        __m256i high = _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + 8)), mask);
+        // Pack interleaves 128 bit lanes of both arguments, restore the order
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(low, high), 0xd8);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), packed);
+    }
+    u32ToU16Scalar(src + i, dst + i, count - i);
+}
+
+__attribute__((target("avx2"))) void i64ToI32Avx2(const int64_t* src, int32_t* dst, size_t count) {
+    const __m256i lowerHalves = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i low = _mm256_permutevar8x32_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)), lowerHalves);
+        __m256i high = _mm256_permutevar8x32_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + 4)), lowerHalves);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_permute2x128_si256(low, high, 0x20));
+    }
+    i64ToI32Scalar(src + i, dst + i, count - i);
+}
+
+__attribute__((target("avx2"))) void u8ToFp32Avx2(const uint8_t* src, float* dst, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i narrow = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i));
+        _mm256_storeu_ps(dst + i, _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(narrow)));
+    }
+    toFp32Scalar(src + i, dst + i, count - i);
+}
+
+__attribute__((target("avx2"))) void i8ToFp32Avx2(const int8_t* src, float* dst, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i narrow = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i));
+        _mm256_storeu_ps(dst + i, _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(narrow)));
+    }
+    toFp32Scalar(src + i, dst + i, count - i);
+}
+
+__attribute__((target("avx2"))) void u16ToFp32Avx2(const uint16_t* src, float* dst, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i narrow = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm256_storeu_ps(dst + i, _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(narrow)));
+    }
+    toFp32Scalar(src + i, dst + i, count - i);
+}
+
+__attribute__((target("avx2"))) void i16ToFp32Avx2(const int16_t* src, float* dst, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i narrow = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm256_storeu_ps(dst + i, _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(narrow)));
+    }
+    toFp32Scalar(src + i, dst + i, count - i);
+}
+
+__attribute__((target("avx2"))) void i32ToFp32Avx2(const int32_t* src, float* dst, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        _mm256_storeu_ps(dst + i, _mm256_cvtepi32_ps(value));
+    }
+    toFp32Scalar(src + i, dst + i, count - i);
+}
+
+__attribute__((target("avx512f"))) void fp16ToFp32Avx512(const uint16_t* src, float* dst, size_t count) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m256i half = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        _mm512_storeu_ps(dst + i, _mm512_cvtph_ps(half));
+    }
+    fp16ToFp32Scalar(src + i, dst + i, count - i);
+}
+
+__attribute__((target("avx512f"))) void fp32ToFp16Avx512(const float* src, uint16_t* dst, size_t count) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m256i half = _mm512_cvtps_ph(_mm512_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), half);
+    }
+    fp32ToFp16Scalar(src + i, dst + i, count - i);
+}
+
+__attribute__((target("avx512f"))) void u16ToU32Avx512(const uint16_t* src, uint32_t* dst, size_t count) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m256i narrow = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        _mm512_storeu_si512(dst + i, _mm512_cvtepu16_epi32(narrow));
+    }
+    u16ToU32Scalar(src + i, dst + i, count - i);
+}
+
+__attribute__((target("avx512f"))) void u32ToU16Avx512(const uint32_t* src, uint16_t* dst, size_t count) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m256i narrow = _mm512_cvtepi32_epi16(_mm512_loadu_si512(src + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), narrow);
+    }
+    u32ToU16Scalar(src + i, dst + i, count - i);
+}
+
+__attribute__((target("avx512f"))) void i64ToI32Avx512(const int64_t* src, int32_t* dst, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i narrow = _mm512_cvtepi64_epi32(_mm512_loadu_si512(src + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), narrow);
+    }
+    i64ToI32Scalar(src + i, dst + i, count - i);
+}
+
+__attribute__((target("avx512f"))) void u8ToFp32Avx512(const uint8_t* src, float* dst, size_t count) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m128i narrow = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm512_storeu_ps(dst + i, _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(narrow)));
+    }
+    toFp32Scalar(src + i, dst + i, count - i);
+}
+
+__attribute__((target("avx512f"))) void i8ToFp32Avx512(const int8_t* src, float* dst, size_t count) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m128i narrow = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm512_storeu_ps(dst + i, _mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(narrow)));
+    }
+    toFp32Scalar(src + i, dst + i, count - i);
+}
+
+__attribute__((target("avx512f"))) void u16ToFp32Avx512(const uint16_t* src, float* dst, size_t count) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m256i narrow = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        _mm512_storeu_ps(dst + i, _mm512_cvtepi32_ps(_mm512_cvtepu16_epi32(narrow)));
+    }
+    toFp32Scalar(src + i, dst + i, count - i);
+}
+
+__attribute__((target("avx512f"))) void i16ToFp32Avx512(const int16_t* src, float* dst, size_t count) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m256i narrow = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        _mm512_storeu_ps(dst + i, _mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(narrow)));
+    }
+    toFp32Scalar(src + i, dst + i, count - i);
+}
+
+__attribute__((target("avx512f"))) void i32ToFp32Avx512(const int32_t* src, float* dst, size_t count) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        _mm512_storeu_ps(dst + i, _mm512_cvtepi32_ps(_mm512_loadu_si512(src + i)));
+    }
+    toFp32Scalar(src + i, dst + i, count - i);
+}
+
+const ConversionKernels scalarKernels{
+    fp16ToFp32Scalar,
+    fp32ToFp16Scalar,
+    u16ToU32Scalar,
+    u32ToU16Scalar,
+    i64ToI32Scalar,
+    toFp32Scalar<uint8_t>,
+    toFp32Scalar<int8_t>,
+    toFp32Scalar<uint16_t>,
+    toFp32Scalar<int16_t>,
+    toFp32Scalar<int32_t>};
+
+const ConversionKernels avx2Kernels{
+    fp16ToFp32Avx2,
+    fp32ToFp16Avx2,
+    u16ToU32Avx2,
+    u32ToU16Avx2,
+    i64ToI32Avx2,
+    u8ToFp32Avx2,
+    i8ToFp32Avx2,
+    u16ToFp32Avx2,
+    i16ToFp32Avx2,
+    i32ToFp32Avx2};
+
+const ConversionKernels avx512Kernels{
+    fp16ToFp32Avx512,
+    fp32ToFp16Avx512,
+    u16ToU32Avx512,
+    u32ToU16Avx512,
+    i64ToI32Avx512,
+    u8ToFp32Avx512,
+    i8ToFp32Avx512,
+    u16ToFp32Avx512,
+    i16ToFp32Avx512,
+    i32ToFp32Avx512};
+
+ConversionIsa detectConversionIsa() {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return ConversionIsa::AVX512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("f16c")) {
+        return ConversionIsa::AVX2;
+    }
+    return ConversionIsa::SCALAR;
+}
+
+}  // namespace
+
+ConversionIsa getBestConversionIsa() {
+    static const ConversionIsa isa = detectConversionIsa();
+    return isa;
+}
+
+bool isConversionIsaSupported(ConversionIsa isa) {
+    return static_cast<int>(isa) <= static_cast<int>(getBestConversionIsa());
+}
+
+const ConversionKernels& getConversionKernels(ConversionIsa isa) {
+    switch (isa) {
+    case ConversionIsa::AVX512:
+        return avx512Kernels;
+    case ConversionIsa::AVX2:
+        return avx2Kernels;
+    case ConversionIsa::SCALAR:
+    default:
+        return scalarKernels;
+    }
+}
+
+const ConversionKernels& getConversionKernels() {
+    static const ConversionKernels& kernels = getConversionKernels(getBestConversionIsa());
+    return kernels;
+}
+
+}  // namespace ovms
@@ -0,0 +1,87 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ovms {
+
+enum class ConversionIsa {
+    SCALAR,
+    AVX2,
+    AVX512
+};
+
+/**
+ * @brief Set of element-wise conversion kernels implemented with one instruction set.
+ * Destination must have room for count elements, source and destination must not overlap.
+ */
+struct ConversionKernels {
+    // IEEE half precision bits to float
+    void (*fp16ToFp32)(const uint16_t* src, float* dst, size_t count);
+    // Float to IEEE half precision bits, rounding to nearest even
+    void (*fp32ToFp16)(const float* src, uint16_t* dst, size_t count);
+    void (*u16ToU32)(const uint16_t* src, uint32_t* dst, size_t count);
+    // Keeps lower 16 bits, used to pack values padded to 4 bytes (half_val, int_val)
+    void (*u32ToU16)(const uint32_t* src, uint16_t* dst, size_t count);
+    // Keeps lower 32 bits
+    void (*i64ToI32)(const int64_t* src, int32_t* dst, size_t count);
+    void (*u8ToFp32)(const uint8_t* src, float* dst, size_t count);
+    void (*i8ToFp32)(const int8_t* src, float* dst, size_t count);
+    void (*u16ToFp32)(const uint16_t* src, float* dst, size_t count);
+    void (*i16ToFp32)(const int16_t* src, float* dst, size_t count);
+    void (*i32ToFp32)(const int32_t* src, float* dst, size_t count);
+};
+
+/**
+ * @brief Returns the most capable instruction set supported by the CPU, detected once with CPUID
+ */
+ConversionIsa getBestConversionIsa();
+
+bool isConversionIsaSupported(ConversionIsa isa);
+
+/**
+ * @brief Returns kernels for a given instruction set. Caller must ensure it is supported.
+ */
+const ConversionKernels& getConversionKernels(ConversionIsa isa);
+
+/**
+ * @brief Returns kernels for the best instruction set supported by the CPU
+ */
+const ConversionKernels& getConversionKernels();
+
+inline void convertFp16ToFp32(const uint16_t* src, float* dst, size_t count) {
+    getConversionKernels().fp16ToFp32(src, dst, count);
+}
+
+inline void convertFp32ToFp16(const float* src, uint16_t* dst, size_t count) {
+    getConversionKernels().fp32ToFp16(src, dst, count);
+}
+
+inline void convertU16ToU32(const uint16_t* src, uint32_t* dst, size_t count) {
+    getConversionKernels().u16ToU32(src, dst, count);
+}
+
+inline void convertU32ToU16(const uint32_t* src, uint16_t* dst, size_t count) {
+    getConversionKernels().u32ToU16(src, dst, count);
+}
+
+inline void convertI64ToI32(const int64_t* src, int32_t* dst, size_t count) {
+    getConversionKernels().i64ToI32(src, dst, count);
+}
+
+}  // namespace ovms
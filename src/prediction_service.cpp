@@ -17,7 +17,9 @@
 
 #include <condition_variable>
 #include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <utility>
 
 #include <inference_engine.hpp>
@@ -28,12 +30,18 @@
 #include "tensorflow/core/framework/tensor.h"
 #pragma GCC diagnostic pop
 
+#include "accesslog.hpp"
+#include "capture.hpp"
+#include "deadline.hpp"
 #include "get_model_metadata_impl.hpp"
+#include "logging.hpp"
 #include "modelinstanceunloadguard.hpp"
 #include "modelmanager.hpp"
 #include "ovinferrequestsqueue.hpp"
 #include "prediction_service_utils.hpp"
+#include "priorityscheduler.hpp"
 #include "status.hpp"
+#include "tracing.hpp"
 
 #define DEBUG
 #include "timer.hpp"
@@ -64,6 +72,32 @@ Status getPipeline(const PredictRequest* request,
     return getPipeline(manager, pipelinePtr, request, response);
 }
 
+static Status getRequestPriority(const ServerContext& context, std::optional<PriorityClass>& priority) {
+    auto it = context.client_metadata().find(PRIORITY_HEADER);
+    if (it == context.client_metadata().end()) {
+        return StatusCode::OK;
+    }
+    PriorityClass requested;
+    auto status = parsePriorityClass(std::string(it->second.data(), it->second.size()), requested);
+    if (!status.ok()) {
+        SPDLOG_DEBUG("Invalid {} metadata value: {}", PRIORITY_HEADER, std::string(it->second.data(), it->second.size()));
+        return status;
+    }
+    priority = requested;
+    return StatusCode::OK;
+}
+
+static std::string_view getRequestTraceId(const ServerContext* context) {
+    if (context == nullptr) {
+        return {};
+    }
+    auto it = context->client_metadata().find(TRACE_HEADER);
+    if (it == context->client_metadata().end()) {
+        return {};
+    }
+    return std::string_view(it->second.data(), it->second.size());
+}
+
 grpc::Status ovms::PredictionServiceImpl::Predict(
     ServerContext* context,
     const PredictRequest* request,
@@ -71,37 +105,60 @@ grpc::Status ovms::PredictionServiceImpl::Predict(
     Timer timer;
     timer.start("total");
     using std::chrono::microseconds;
-    SPDLOG_DEBUG("Processing gRPC request for model: {}; version: {}",
+    OVMS_DEBUG("Processing gRPC request for model: {}; version: {}",
         request->model_spec().name(),
         request->model_spec().version().value());
+    AccessLogRecord accessLog(AccessLogApi::GRPC, request->model_spec().name(), request->model_spec().version().value());
+    TrafficCapture::getInstance().captureGrpc(*request);
+    RequestTraceScope traceScope("grpc_predict", getRequestTraceId(context));
 
     std::shared_ptr<ovms::ModelInstance> modelInstance;
     std::unique_ptr<ovms::Pipeline> pipelinePtr;
 
     std::unique_ptr<ModelInstanceUnloadGuard> modelInstanceUnloadGuard;
+    ScopedSpan lookupSpan("get_servable");
     auto status = getModelInstance(request, modelInstance, modelInstanceUnloadGuard);
 
     if (status == StatusCode::MODEL_NAME_MISSING) {
         SPDLOG_INFO("Requested model: {} does not exist. Searching for pipeline with that name...", request->model_spec().name());
         status = getPipeline(request, response, pipelinePtr);
     }
+    lookupSpan.finish();
     if (!status.ok()) {
         SPDLOG_INFO("Getting modelInstance or pipeline failed. {}", status.string());
+        accessLog.finish(status);
         return status.grpc();
     }
-
+    if (modelInstance) {
+        accessLog.setVersion(modelInstance->getVersion());
+    }
+    accessLog.stageFinished("lookup");
+
+    // Work is not started for clients which already gave up waiting
+    Deadline deadline;
+    std::optional<PriorityClass> priority;
+    if (context != nullptr) {
+        deadline = Deadline::fromSystemClock(context->deadline(), [context]() { return context->IsCancelled(); });
+        status = getRequestPriority(*context, priority);
+        if (!status.ok()) {
+            accessLog.finish(status);
+            return status.grpc();
+        }
+    }
     if (pipelinePtr) {
-        status = pipelinePtr->execute();
+        status = pipelinePtr->execute(deadline);
     } else {
-        status = inference(*modelInstance, request, response, modelInstanceUnloadGuard);
+        status = inference(*modelInstance, request, response, modelInstanceUnloadGuard, deadline, priority);
     }
+    accessLog.stageFinished("inference");
+    accessLog.finish(status);
 
     if (!status.ok()) {
         return status.grpc();
     }
 
     timer.stop("total");
-    SPDLOG_DEBUG("Total gRPC request processing time: {} ms", timer.elapsed<microseconds>("total") / 1000);
+    OVMS_DEBUG("Total gRPC request processing time: {} ms", timer.elapsed<microseconds>("total") / 1000);
     return grpc::Status::OK;
 }
 
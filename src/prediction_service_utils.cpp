@@ -15,14 +15,26 @@
 //*****************************************************************************
 #include "prediction_service_utils.hpp"
 
+#include <algorithm>
 #include <map>
+#include <optional>
+#include <vector>
 
 #include "deserialization.hpp"
 #include "executinstreamidguard.hpp"
+#include "logging.hpp"
 #include "modelinstance.hpp"
 #include "modelinstanceunloadguard.hpp"
 #include "modelmanager.hpp"
+#include "node.hpp"
+#include "ov_utils.hpp"
+#include "priorityscheduler.hpp"
+#include "responsecache.hpp"
+#include "sequence.hpp"
+#include "sequence_manager.hpp"
 #include "serialization.hpp"
+#include "shared_memory.hpp"
+#include "tracing.hpp"
 
 #define DEBUG
 #include "timer.hpp"
@@ -56,27 +68,70 @@ std::map<std::string, shape_t> getRequestShapes(const tensorflow::serving::Predi
     return requestShapes;
 }
 
+size_t getRequestChunksCount(const PredictRequest& request, size_t chunkBatchSize) {
+    if (request.inputs_size() == 0 || chunkBatchSize == 0) {
+        return 0;
+    }
+    const auto& firstShape = request.inputs().begin()->second.tensor_shape();
+    if (firstShape.dim_size() == 0 || firstShape.dim(0).size() <= 0) {
+        return 0;
+    }
+    const size_t batchSize = static_cast<size_t>(firstShape.dim(0).size());
+    if (batchSize <= chunkBatchSize || batchSize % chunkBatchSize != 0) {
+        return 0;
+    }
+    for (const auto& [name, input] : request.inputs()) {
+        const auto& shape = input.tensor_shape();
+        if (shape.dim_size() == 0 || static_cast<size_t>(shape.dim(0).size()) != batchSize || isSharedMemoryReference(input)) {
+            return 0;
+        }
+    }
+    return batchSize / chunkBatchSize;
+}
+
+Status mergePredictResponses(const std::vector<PredictResponse>& chunks, PredictResponse* response) {
+    if (chunks.empty()) {
+        return StatusCode::OK;
+    }
+    for (const auto& [name, first] : chunks.front().outputs()) {
+        size_t batchSize = 0;
+        size_t contentSize = 0;
+        for (const auto& chunk : chunks) {
+            auto it = chunk.outputs().find(name);
+            if (it == chunk.outputs().end() || it->second.dtype() != first.dtype() ||
+                it->second.tensor_shape().dim_size() == 0 ||
+                it->second.tensor_shape().dim_size() != first.tensor_shape().dim_size()) {
+                Status status = StatusCode::OV_INTERNAL_SERIALIZATION_ERROR;
+                SPDLOG_ERROR("{}: output {} cannot be concatenated along the first dimension", status.string(), name);
+                return status;
+            }
+            batchSize += it->second.tensor_shape().dim(0).size();
+            contentSize += it->second.tensor_content().size();
+        }
+        auto& output = (*response->mutable_outputs())[name];
+        output.Clear();
+        output.set_dtype(first.dtype());
+        *output.mutable_tensor_shape() = first.tensor_shape();
+        output.mutable_tensor_shape()->mutable_dim(0)->set_size(batchSize);
+        auto content = output.mutable_tensor_content();
+        content->reserve(contentSize);
+        for (const auto& chunk : chunks) {
+            content->append(chunk.outputs().at(name).tensor_content());
+        }
+    }
+    return StatusCode::OK;
+}
+
 Status getModelInstance(ovms::ModelManager& manager,
     const std::string& modelName,
     ovms::model_version_t modelVersionId,
     std::shared_ptr<ovms::ModelInstance>& modelInstance,
     std::unique_ptr<ModelInstanceUnloadGuard>& modelInstanceUnloadGuardPtr) {
-    SPDLOG_DEBUG("Requesting model: {}; version: {}.", modelName, modelVersionId);
+    OVMS_DEBUG("Requesting model: {}; version: {}.", modelName, modelVersionId);
 
-    auto model = manager.findModelByName(modelName);
-    if (model == nullptr) {
-        return StatusCode::MODEL_NAME_MISSING;
-    }
-    if (modelVersionId != 0) {
-        modelInstance = model->getModelInstanceByVersion(modelVersionId);
-        if (modelInstance == nullptr) {
-            return StatusCode::MODEL_VERSION_MISSING;
-        }
-    } else {
-        modelInstance = model->getDefaultModelInstance();
-        if (modelInstance == nullptr) {
-            return StatusCode::MODEL_VERSION_MISSING;
-        }
+    auto status = manager.getServableRegistry().findModelInstance(modelName, modelVersionId, modelInstance);
+    if (!status.ok()) {
+        return status;
     }
 
     return modelInstance->waitForLoaded(WAIT_FOR_MODEL_LOADED_TIMEOUT_MS, modelInstanceUnloadGuardPtr);
@@ -87,7 +142,7 @@ Status getPipeline(ovms::ModelManager& manager,
     const tensorflow::serving::PredictRequest* request,
     tensorflow::serving::PredictResponse* response) {
 
-    SPDLOG_DEBUG("Requesting pipeline: {};", request->model_spec().name());
+    OVMS_DEBUG("Requesting pipeline: {};", request->model_spec().name());
     auto status = manager.createPipeline(pipelinePtr, request->model_spec().name(), request, response);
     return status;
 }
@@ -109,59 +164,493 @@ Status performInference(ovms::OVInferRequestsQueue& inferRequestsQueue, const in
     return StatusCode::OK;
 }
 
-Status inference(
+static Status serializeOutputs(
+    ModelInstance& modelVersion,
+    const PredictRequest* requestProto,
+    InferenceEngine::InferRequest& inferRequest,
+    const std::map<std::string, tensorflow::TensorProto>& sharedMemoryOutputs,
+    PredictResponse* responseProto) {
+    if (sharedMemoryOutputs.empty() && requestProto->output_filter_size() == 0) {
+        return serializePredictResponse(inferRequest, modelVersion.getOutputsInfo(), responseProto);
+    }
+    // Outputs written to shared memory are only referenced in response,
+    // outputs not listed in output filter are never read from infer request
+    tensor_map_t outputsToSerialize;
+    const auto& outputFilter = requestProto->output_filter();
+    const auto isFiltered = [&outputFilter](const std::string& name) {
+        return outputFilter.size() > 0 && std::find(outputFilter.begin(), outputFilter.end(), name) == outputFilter.end();
+    };
+    for (const auto& [name, tensorInfo] : modelVersion.getOutputsInfo()) {
+        if (sharedMemoryOutputs.count(name) > 0) {
+            continue;
+        }
+        const bool hasIndices = tensorInfo->getPostProcessing() && tensorInfo->getPostProcessing()->kind == PostProcessingKind::TOP_K;
+        if (isFiltered(name) && !(hasIndices && !isFiltered(name + TOP_K_INDICES_SUFFIX))) {
+            continue;
+        }
+        outputsToSerialize.emplace(name, tensorInfo);
+    }
+    auto status = serializePredictResponse(inferRequest, outputsToSerialize, responseProto);
+    // top_k values and indices are serialized together, drop the one not listed in output filter
+    for (const auto& [name, tensorInfo] : outputsToSerialize) {
+        if (tensorInfo->getPostProcessing() && tensorInfo->getPostProcessing()->kind == PostProcessingKind::TOP_K) {
+            for (const auto& servedName : {name, name + TOP_K_INDICES_SUFFIX}) {
+                if (isFiltered(servedName)) {
+                    responseProto->mutable_outputs()->erase(servedName);
+                }
+            }
+        }
+    }
+    for (const auto& [name, destination] : sharedMemoryOutputs) {
+        serializeSharedMemoryReference((*responseProto->mutable_outputs())[name], modelVersion.getOutputsInfo().at(name), destination);
+    }
+    return status;
+}
+
+// Runs validated request on a single infer request
+static Status inferenceOnStream(
     ModelInstance& modelVersion,
     const PredictRequest* requestProto,
     PredictResponse* responseProto,
-    std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr) {
+    const std::map<std::string, tensorflow::TensorProto>& sharedMemoryOutputs,
+    const Deadline& deadline,
+    PriorityClass priority,
+    Sequence* sequence = nullptr) {
     Timer timer;
     using std::chrono::microseconds;
 
-    auto status = modelVersion.validate(requestProto);
-    status = reloadModelIfRequired(status, modelVersion, requestProto, modelUnloadGuardPtr);
-    if (!status.ok())
-        return status;
-
+    Status status;
     timer.start("get infer request");
+    ScopedSpan waitSpan("wait_for_infer_request");
     ovms::OVInferRequestsQueue& inferRequestsQueue = modelVersion.getInferRequestsQueue();
-    ExecutingStreamIdGuard executingStreamIdGuard(inferRequestsQueue);
+    ExecutingStreamIdGuard executingStreamIdGuard(inferRequestsQueue, deadline);
+    if (!executingStreamIdGuard.getStatus().ok()) {
+        OVMS_DEBUG("Request to model {}, version {} rejected: {}",
+            requestProto->model_spec().name(), modelVersion.getVersion(), executingStreamIdGuard.getStatus().string());
+        return executingStreamIdGuard.getStatus();
+    }
+    // Infer request of the model is taken first, so that requests waiting for global slot do not block other models
+    PrioritySlotGuard prioritySlotGuard(PriorityScheduler::getInstance(), priority, deadline);
+    if (!prioritySlotGuard.getStatus().ok()) {
+        OVMS_DEBUG("Request to model {}, version {} of priority {} rejected: {}",
+            requestProto->model_spec().name(), modelVersion.getVersion(), priorityClassToString(priority), prioritySlotGuard.getStatus().string());
+        return prioritySlotGuard.getStatus();
+    }
     int executingInferId = executingStreamIdGuard.getId();
     InferenceEngine::InferRequest& inferRequest = inferRequestsQueue.getInferRequest(executingInferId);
     timer.stop("get infer request");
-    SPDLOG_DEBUG("Getting infer req duration in model {}, version {}, nireq {}: {:.3f} ms",
+    waitSpan.finish();
+    OVMS_DEBUG("Getting infer req duration in model {}, version {}, nireq {}: {:.3f} ms",
         requestProto->model_spec().name(), modelVersion.getVersion(), executingInferId, timer.elapsed<microseconds>("get infer request") / 1000);
 
     timer.start("deserialize");
+    ScopedSpan deserializationSpan("deserialization");
     status = deserializePredictRequest<ConcreteTensorProtoDeserializator>(*requestProto, modelVersion.getInputsInfo(), inferRequest);
+    deserializationSpan.finish();
     timer.stop("deserialize");
     if (!status.ok())
         return status;
-    SPDLOG_DEBUG("Deserialization duration in model {}, version {}, nireq {}: {:.3f} ms",
+    OVMS_DEBUG("Deserialization duration in model {}, version {}, nireq {}: {:.3f} ms",
         requestProto->model_spec().name(), modelVersion.getVersion(), executingInferId, timer.elapsed<microseconds>("deserialize") / 1000);
+    if (sequence) {
+        // Infer request is shared by all sequences, so memory state is set for each request
+        status = sequence->restoreMemoryState(inferRequest);
+        if (!status.ok())
+            return status;
+    }
+    SharedMemoryOutputsGuard sharedMemoryOutputsGuard(inferRequest);
+    status = sharedMemoryOutputsGuard.bind(modelVersion.getOutputsInfo(), sharedMemoryOutputs);
+    if (!status.ok())
+        return status;
     timer.start("prediction");
+    ScopedSpan predictionSpan("prediction");
     status = performInference(inferRequestsQueue, executingInferId, inferRequest);
+    predictionSpan.finish();
     timer.stop("prediction");
     if (!status.ok())
         return status;
-    SPDLOG_DEBUG("Prediction duration in model {}, version {}, nireq {}: {:.3f} ms",
+    OVMS_DEBUG("Prediction duration in model {}, version {}, nireq {}: {:.3f} ms",
         requestProto->model_spec().name(), modelVersion.getVersion(), executingInferId, timer.elapsed<microseconds>("prediction") / 1000);
+    if (sequence) {
+        status = sequence->updateMemoryState(inferRequest);
+        if (!status.ok())
+            return status;
+    }
 
     timer.start("serialize");
-    status = serializePredictResponse(inferRequest, modelVersion.getOutputsInfo(), responseProto);
+    ScopedSpan serializationSpan("serialization");
+    status = serializeOutputs(modelVersion, requestProto, inferRequest, sharedMemoryOutputs, responseProto);
+    serializationSpan.finish();
     timer.stop("serialize");
     if (!status.ok())
         return status;
-    SPDLOG_DEBUG("Serialization duration in model {}, version {}, nireq {}: {:.3f} ms",
+    OVMS_DEBUG("Serialization duration in model {}, version {}, nireq {}: {:.3f} ms",
         requestProto->model_spec().name(), modelVersion.getVersion(), executingInferId, timer.elapsed<microseconds>("serialize") / 1000);
 
     return StatusCode::OK;
 }
 
+static bool isBatchSplittingApplicable(ModelInstance& modelVersion) {
+    const auto& config = modelVersion.getModelConfig();
+    if (!config.isBatchSplittingEnabled() || config.getBatchingMode() == AUTO) {
+        return false;
+    }
+    // Detections are not batched along the first dimension
+    for (const auto& [name, postProcessing] : config.getPostProcessing()) {
+        if (postProcessing.kind == PostProcessingKind::DETECTIONS) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Sets blobs referring to index-th chunk of inputs deserialized for the whole request and starts its inference
+static Status startChunkInference(InferenceEngine::InferRequest& inferRequest, const BlobMap& blobs, size_t index, size_t chunkBatchSize) {
+    try {
+        for (const auto& [name, blob] : blobs) {
+            InferenceEngine::Blob::Ptr chunk;
+            auto status = sliceBlob(chunk, blob, index * chunkBatchSize, chunkBatchSize);
+            if (!status.ok())
+                return status;
+            inferRequest.SetBlob(name, chunk);
+        }
+        inferRequest.StartAsync();
+    } catch (const InferenceEngine::details::InferenceEngineException& e) {
+        Status status = StatusCode::OV_INTERNAL_INFERENCE_ERROR;
+        SPDLOG_ERROR("Async caught an exception {}: {}", status.string(), e.what());
+        return status;
+    }
+    return StatusCode::OK;
+}
+
+static Status waitForChunkInference(InferenceEngine::InferRequest& inferRequest) {
+    try {
+        InferenceEngine::StatusCode sts = inferRequest.Wait(InferenceEngine::IInferRequest::RESULT_READY);
+        if (sts != InferenceEngine::StatusCode::OK) {
+            Status status = StatusCode::OV_INTERNAL_INFERENCE_ERROR;
+            SPDLOG_ERROR("Async infer failed {}: {}", status.string(), sts);
+            return status;
+        }
+    } catch (const InferenceEngine::details::InferenceEngineException& e) {
+        Status status = StatusCode::OV_INTERNAL_INFERENCE_ERROR;
+        SPDLOG_ERROR("Async caught an exception {}: {}", status.string(), e.what());
+        return status;
+    }
+    return StatusCode::OK;
+}
+
+// Returns streams taken without waiting for chunks of split request
+struct AdditionalStreamsGuard {
+    OVInferRequestsQueue& inferRequestsQueue;
+    std::vector<int> ids;
+    ~AdditionalStreamsGuard() {
+        for (int id : ids) {
+            inferRequestsQueue.returnStream(id);
+        }
+    }
+};
+
+// Inputs are deserialized once for the whole request and chunks run on blobs referring to their parts.
+// Only the first stream is waited for, further ones are taken when idle right away, so concurrent requests never
+// wait for each other while holding streams. Each stream starts next chunk as soon as its previous one is done.
+static Status inferenceInChunks(
+    ModelInstance& modelVersion,
+    const PredictRequest* requestProto,
+    size_t chunksCount,
+    PredictResponse* responseProto,
+    std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr,
+    const Deadline& deadline,
+    PriorityClass priority) {
+    auto status = modelVersion.validate(requestProto, chunksCount);
+    status = reloadModelIfRequired(status, modelVersion, requestProto, modelUnloadGuardPtr, chunksCount);
+    if (!status.ok())
+        return status;
+
+    ScopedSpan waitSpan("wait_for_infer_request");
+    ovms::OVInferRequestsQueue& inferRequestsQueue = modelVersion.getInferRequestsQueue();
+    ExecutingStreamIdGuard executingStreamIdGuard(inferRequestsQueue, deadline);
+    if (!executingStreamIdGuard.getStatus().ok()) {
+        OVMS_DEBUG("Request to model {}, version {} rejected: {}",
+            requestProto->model_spec().name(), modelVersion.getVersion(), executingStreamIdGuard.getStatus().string());
+        return executingStreamIdGuard.getStatus();
+    }
+    PrioritySlotGuard prioritySlotGuard(PriorityScheduler::getInstance(), priority, deadline);
+    if (!prioritySlotGuard.getStatus().ok()) {
+        OVMS_DEBUG("Request to model {}, version {} of priority {} rejected: {}",
+            requestProto->model_spec().name(), modelVersion.getVersion(), priorityClassToString(priority), prioritySlotGuard.getStatus().string());
+        return prioritySlotGuard.getStatus();
+    }
+    std::vector<int> streamIds{executingStreamIdGuard.getId()};
+    AdditionalStreamsGuard additionalStreamsGuard{inferRequestsQueue, {}};
+    // Request holds a single inference slot, so with limited slots all its chunks run on one stream
+    int streamId;
+    while (PriorityScheduler::getInstance().getSlots() == 0 && streamIds.size() < chunksCount &&
+           inferRequestsQueue.tryAcquireIdleStream(streamId)) {
+        additionalStreamsGuard.ids.push_back(streamId);
+        streamIds.push_back(streamId);
+    }
+    waitSpan.finish();
+
+    ScopedSpan deserializationSpan("deserialization");
+    const size_t chunkBatchSize = modelVersion.getBatchSize();
+    tensor_map_t inputsInfo;
+    for (const auto& [name, tensorInfo] : modelVersion.getInputsInfo()) {
+        inputsInfo.emplace(name, tensorInfo->createCopyWithBatchSize(chunkBatchSize * chunksCount));
+    }
+    BlobMap blobs;
+    status = deserializePredictRequest<ConcreteTensorProtoDeserializator>(*requestProto, inputsInfo, blobs);
+    deserializationSpan.finish();
+    if (!status.ok())
+        return status;
+    OVMS_DEBUG("Splitting request to model {}, version {} into {} chunks processed on {} streams",
+        requestProto->model_spec().name(), modelVersion.getVersion(), chunksCount, streamIds.size());
+
+    ScopedSpan predictionSpan("prediction");
+    std::vector<PredictResponse> responses(chunksCount);
+    std::vector<std::optional<size_t>> runningChunks(streamIds.size());
+    size_t nextChunk = 0;
+    for (size_t i = 0; i < streamIds.size() && status.ok(); i++) {
+        status = startChunkInference(inferRequestsQueue.getInferRequest(streamIds[i]), blobs, nextChunk, chunkBatchSize);
+        if (status.ok())
+            runningChunks[i] = nextChunk++;
+    }
+    // Streams are returned only when no chunk runs on them, so after failure the running chunks are still waited for
+    const std::map<std::string, tensorflow::TensorProto> noSharedMemoryOutputs;
+    bool running = true;
+    while (running) {
+        running = false;
+        for (size_t i = 0; i < streamIds.size(); i++) {
+            if (!runningChunks[i])
+                continue;
+            InferenceEngine::InferRequest& inferRequest = inferRequestsQueue.getInferRequest(streamIds[i]);
+            const size_t chunk = runningChunks[i].value();
+            runningChunks[i].reset();
+            auto chunkStatus = waitForChunkInference(inferRequest);
+            if (chunkStatus.ok())
+                chunkStatus = serializeOutputs(modelVersion, requestProto, inferRequest, noSharedMemoryOutputs, &responses[chunk]);
+            if (!chunkStatus.ok() && status.ok())
+                status = chunkStatus;
+            if (status.ok() && nextChunk < chunksCount) {
+                status = startChunkInference(inferRequest, blobs, nextChunk, chunkBatchSize);
+                if (status.ok())
+                    runningChunks[i] = nextChunk++;
+            }
+            running = running || runningChunks[i].has_value();
+        }
+    }
+    predictionSpan.finish();
+    if (!status.ok())
+        return status;
+    return mergePredictResponses(responses, responseProto);
+}
+
+static Status inferenceWithoutCache(
+    ModelInstance& modelVersion,
+    const PredictRequest* requestProto,
+    PredictResponse* responseProto,
+    std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr,
+    const Deadline& deadline,
+    PriorityClass effectivePriority,
+    Sequence* sequence = nullptr) {
+    // Shared memory destinations for outputs are passed as request inputs keyed with output names
+    std::map<std::string, tensorflow::TensorProto> sharedMemoryOutputs;
+    PredictRequest inputsRequest;
+    if (hasSharedMemoryOutputs(*requestProto, modelVersion.getOutputsInfo())) {
+        splitSharedMemoryOutputs(*requestProto, modelVersion.getOutputsInfo(), inputsRequest, sharedMemoryOutputs);
+        requestProto = &inputsRequest;
+    }
+
+    // Memory state of sequence belongs to a single infer request, so its requests are never split
+    if (sharedMemoryOutputs.empty() && !sequence && isBatchSplittingApplicable(modelVersion)) {
+        const size_t chunksCount = getRequestChunksCount(*requestProto, modelVersion.getBatchSize());
+        if (chunksCount > 1) {
+            return inferenceInChunks(modelVersion, requestProto, chunksCount, responseProto, modelUnloadGuardPtr, deadline, effectivePriority);
+        }
+    }
+
+    auto status = modelVersion.validate(requestProto);
+    status = reloadModelIfRequired(status, modelVersion, requestProto, modelUnloadGuardPtr);
+    if (!status.ok())
+        return status;
+
+    return inferenceOnStream(modelVersion, requestProto, responseProto, sharedMemoryOutputs, deadline, effectivePriority, sequence);
+}
+
+// Requests of a sequence are processed one at a time, each one continues from memory state left by the previous one
+static Status inferenceInSequence(
+    SequenceManager& sequenceManager,
+    ModelInstance& modelVersion,
+    const PredictRequest* requestProto,
+    PredictResponse* responseProto,
+    std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr,
+    const Deadline& deadline,
+    PriorityClass effectivePriority) {
+    SequenceProcessingSpec spec;
+    auto status = extractSequenceProcessingSpec(*requestProto, spec);
+    if (!status.ok())
+        return status;
+    std::shared_ptr<Sequence> sequence;
+    status = sequenceManager.acquire(spec, sequence);
+    if (!status.ok()) {
+        OVMS_DEBUG("Request to model {}, version {} of sequence {} rejected: {}",
+            requestProto->model_spec().name(), modelVersion.getVersion(), spec.sequenceId, status.string());
+        return status;
+    }
+    std::unique_lock<std::mutex> sequenceLock(sequence->getMutex());
+    if (sequence->isTerminated()) {
+        return StatusCode::SEQUENCE_TERMINATED;
+    }
+    status = inferenceWithoutCache(modelVersion, requestProto, responseProto, modelUnloadGuardPtr, deadline, effectivePriority, sequence.get());
+    sequenceManager.release(spec, *sequence, status.ok());
+    if (!status.ok())
+        return status;
+    addSequenceIdOutput(responseProto, sequence->getId());
+    return StatusCode::OK;
+}
+
+static bool isResponseCacheApplicable(ModelInstance& modelVersion) {
+    // Followers of in-flight request hold the model, so its inference must not reload the model
+    return !modelVersion.getModelConfig().isDynamicParameterEnabled();
+}
+
+Status inference(
+    ModelInstance& modelVersion,
+    const PredictRequest* requestProto,
+    PredictResponse* responseProto,
+    std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr,
+    const Deadline& deadline,
+    std::optional<PriorityClass> priority) {
+    const PriorityClass effectivePriority = priority.value_or(modelVersion.getModelConfig().getPriority());
+    // Responses of stateful model depend on the sequence state, so they are never cached
+    std::shared_ptr<SequenceManager> sequenceManager = modelVersion.getSequenceManager();
+    if (sequenceManager) {
+        return inferenceInSequence(*sequenceManager, modelVersion, requestProto, responseProto, modelUnloadGuardPtr, deadline, effectivePriority);
+    }
+    std::shared_ptr<ResponseCache> responseCache = modelVersion.getResponseCache();
+    if (responseCache && isResponseCacheApplicable(modelVersion)) {
+        auto key = ResponseCache::computeKey(*requestProto);
+        if (key) {
+            ScopedSpan cacheSpan("response_cache");
+            return responseCache->getOrCompute(
+                key.value(), responseProto, [&](PredictResponse* response) {
+                    return inferenceWithoutCache(modelVersion, requestProto, response, modelUnloadGuardPtr, deadline, effectivePriority);
+                },
+                deadline);
+        }
+    }
+    return inferenceWithoutCache(modelVersion, requestProto, responseProto, modelUnloadGuardPtr, deadline, effectivePriority);
+}
+
+static bool isAsyncInferenceApplicable(ModelInstance& modelVersion, const PredictRequest& requestProto) {
+    // Waiting for inference slot or for previous request of a sequence blocks the thread
+    if (PriorityScheduler::getInstance().getSlots() > 0 || modelVersion.getSequenceManager()) {
+        return false;
+    }
+    if ((modelVersion.getResponseCache() && isResponseCacheApplicable(modelVersion)) || isBatchSplittingApplicable(modelVersion)) {
+        return false;
+    }
+    // Spans of traced request are recorded by the thread processing it
+    return !hasSharedMemoryOutputs(requestProto, modelVersion.getOutputsInfo()) && getCurrentTrace() == nullptr;
+}
+
+static void finishAsyncInference(const std::shared_ptr<AsyncInference>& inference) {
+    ModelInstance& modelVersion = *inference->modelInstance;
+    OVInferRequestsQueue& inferRequestsQueue = modelVersion.getInferRequestsQueue();
+    InferenceEngine::InferRequest& inferRequest = inferRequestsQueue.getInferRequest(inference->streamId);
+    Status status;
+    try {
+        auto sts = inferRequest.Wait(InferenceEngine::IInferRequest::RESULT_READY);
+        if (sts != InferenceEngine::StatusCode::OK) {
+            status = StatusCode::OV_INTERNAL_INFERENCE_ERROR;
+            SPDLOG_ERROR("Async infer failed {}: {}", status.string(), sts);
+        }
+    } catch (const InferenceEngine::details::InferenceEngineException& e) {
+        status = StatusCode::OV_INTERNAL_INFERENCE_ERROR;
+        SPDLOG_ERROR("Async caught an exception {}: {}", status.string(), e.what());
+    }
+    if (status.ok()) {
+        const std::map<std::string, tensorflow::TensorProto> noSharedMemoryOutputs;
+        status = serializeOutputs(modelVersion, &inference->request, inferRequest, noSharedMemoryOutputs, &inference->response);
+    }
+    // Wait returns after the completion callback has run, so it is replaced only once it is done. Callback holding
+    // the inference must not keep the model after completion nor be called by the next user of the infer request.
+    try {
+        inferRequest.SetCompletionCallback([]() {});
+    } catch (const InferenceEngine::details::InferenceEngineException& e) {
+        SPDLOG_ERROR("Async caught an exception while resetting completion callback: {}", e.what());
+    }
+    inferRequestsQueue.returnStream(inference->streamId);
+    inference->onCompletion(status);
+}
+
+static void startOnStream(const std::shared_ptr<AsyncInference>& inference, Status status, int streamId) {
+    if (!status.ok()) {
+        OVMS_DEBUG("Request to model {}, version {} rejected: {}",
+            inference->request.model_spec().name(), inference->modelInstance->getVersion(), status.string());
+        inference->onCompletion(status);
+        return;
+    }
+    ModelInstance& modelVersion = *inference->modelInstance;
+    OVInferRequestsQueue& inferRequestsQueue = modelVersion.getInferRequestsQueue();
+    InferenceEngine::InferRequest& inferRequest = inferRequestsQueue.getInferRequest(streamId);
+    // Request could wait for the stream past its deadline
+    status = inference->deadline.check();
+    if (status.ok()) {
+        status = deserializePredictRequest<ConcreteTensorProtoDeserializator>(inference->request, modelVersion.getInputsInfo(), inferRequest);
+    }
+    if (status.ok()) {
+        inference->streamId = streamId;
+        try {
+            inferRequest.SetCompletionCallback([inference]() {
+                inference->schedule([inference]() { finishAsyncInference(inference); });
+            });
+            inferRequest.StartAsync();
+            return;
+        } catch (const InferenceEngine::details::InferenceEngineException& e) {
+            status = StatusCode::OV_INTERNAL_INFERENCE_ERROR;
+            SPDLOG_ERROR("Async caught an exception {}: {}", status.string(), e.what());
+            inferRequest.SetCompletionCallback([]() {});
+        }
+    }
+    inferRequestsQueue.returnStream(streamId);
+    inference->onCompletion(status);
+}
+
+bool startAsyncInference(const std::shared_ptr<AsyncInference>& inference) {
+    ModelInstance& modelVersion = *inference->modelInstance;
+    if (!isAsyncInferenceApplicable(modelVersion, inference->request)) {
+        return false;
+    }
+    auto status = modelVersion.validate(&inference->request);
+    // Reload waits for inferences of the model in progress, which is done only by the synchronous path
+    if (status.batchSizeChangeRequired() || status.reshapeRequired()) {
+        return false;
+    }
+    if (!status.ok()) {
+        inference->onCompletion(reloadModelIfRequired(status, modelVersion, &inference->request, inference->modelUnloadGuard));
+        return true;
+    }
+    status = inference->deadline.check();
+    if (!status.ok()) {
+        inference->onCompletion(status);
+        return true;
+    }
+    int streamId;
+    status = modelVersion.getInferRequestsQueue().acquireIdleStreamAsync(streamId, [inference](const Status& streamStatus, int idleStreamId) {
+        inference->schedule([inference, streamStatus, idleStreamId]() { startOnStream(inference, streamStatus, idleStreamId); });
+    });
+    if (!status.ok() || streamId >= 0) {
+        startOnStream(inference, status, streamId);
+    }
+    return true;
+}
+
 Status reloadModelIfRequired(
     Status validationStatus,
     ModelInstance& modelInstance,
     const PredictRequest* requestProto,
-    std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr) {
+    std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr,
+    size_t chunksCount) {
     Status status = validationStatus;
     if (status.batchSizeChangeRequired()) {
         status = modelInstance.reloadModel(getRequestBatchSize(requestProto), {}, modelUnloadGuardPtr);
@@ -169,7 +658,13 @@ Status reloadModelIfRequired(
             SPDLOG_ERROR("Model instance reload (batch size change) failed. Status Code: {}, Error {}", status.getCode(), status.string());
         }
     } else if (status.reshapeRequired()) {
-        status = modelInstance.reloadModel(0, getRequestShapes(requestProto), modelUnloadGuardPtr);
+        auto requestShapes = getRequestShapes(requestProto);
+        // Split request is run in chunks of the model batch size, so model is reshaped to shapes of a chunk
+        for (auto& [name, shape] : requestShapes) {
+            if (!shape.empty())
+                shape[0] /= chunksCount;
+        }
+        status = modelInstance.reloadModel(0, requestShapes, modelUnloadGuardPtr);
         if (!status.ok() && status != StatusCode::RESHAPE_ERROR) {
             SPDLOG_ERROR("Model instance reload (reshape) failed. Status Code: {}, Error: {}", status.getCode(), status.string());
         }
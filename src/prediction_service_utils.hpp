@@ -14,18 +14,23 @@
 // limitations under the License.
 //*****************************************************************************
 #pragma once
+#include <functional>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
+#include <vector>
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wall"
 #include "tensorflow_serving/apis/prediction_service.grpc.pb.h"
 #pragma GCC diagnostic pop
 
+#include "deadline.hpp"
 #include "modelinstance.hpp"
 #include "modelmanager.hpp"
+#include "priorityscheduler.hpp"
 
 namespace ovms {
 
@@ -34,6 +39,18 @@ const uint WAIT_FOR_MODEL_LOADED_TIMEOUT_MS = 10000;
 size_t getRequestBatchSize(const tensorflow::serving::PredictRequest* request);
 std::map<std::string, shape_t> getRequestShapes(const tensorflow::serving::PredictRequest* request);
 
+/**
+ * @brief Number of chunks of chunkBatchSize request with batch size being a multiple of chunkBatchSize is split into.
+ * Returns 0 when request batch is not larger than chunkBatchSize or any input cannot be split along the first dimension.
+ */
+size_t getRequestChunksCount(const tensorflow::serving::PredictRequest& request, size_t chunkBatchSize);
+
+/**
+ * @brief Concatenates outputs of responses to chunks of a split request along the first dimension
+ */
+Status mergePredictResponses(const std::vector<tensorflow::serving::PredictResponse>& chunks,
+    tensorflow::serving::PredictResponse* response);
+
 Status getModelInstance(ModelManager& manager,
     const std::string& modelName,
     model_version_t modelVersionId,
@@ -47,15 +64,52 @@ Status getPipeline(ModelManager& manager,
 
 Status performInference(ovms::OVInferRequestsQueue& inferRequestsQueue, const int executingInferId, InferenceEngine::InferRequest& inferRequest);
 
+/**
+ * @brief Runs inference of a single model request. Priority class, when set, overrides the one configured for the model.
+ */
 Status inference(
     ModelInstance& modelVersion,
     const tensorflow::serving::PredictRequest* requestProto,
     tensorflow::serving::PredictResponse* responseProto,
-    std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr);
+    std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr,
+    const Deadline& deadline = Deadline(),
+    std::optional<PriorityClass> priority = std::nullopt);
+
+/**
+ * @brief Single model request inferred without blocking threads, owns the request and the model until completion
+ */
+struct AsyncInference {
+    std::shared_ptr<ModelInstance> modelInstance;
+    std::unique_ptr<ModelInstanceUnloadGuard> modelUnloadGuard;
+    tensorflow::serving::PredictRequest request;
+    tensorflow::serving::PredictResponse response;
+    Deadline deadline;
+    /**
+     * @brief Runs function on a worker thread. Inference continues there when infer request becomes idle and when
+     * inference finishes, so that threads returning infer requests and threads of OpenVINO only schedule the work.
+     * Scheduled functions hold or return an infer request, so they must not wait behind work which blocks on infer
+     * requests, such as synchronous inference().
+     */
+    std::function<void(std::function<void()>)> schedule;
+    /**
+     * @brief Called once with status of inference, response is filled when it succeeded
+     */
+    std::function<void(const Status&)> onCompletion;
+    int streamId = -1;
+};
+
+/**
+ * @brief Starts inference of a single model request which continues on threads given by schedule, so the calling thread
+ * does not wait for infer request or for inference. Returns false without starting when request needs processing done only
+ * by inference(): stateful model, response cache, batch splitting, shared memory outputs, model reload, inference slots
+ * or traced request. Priority class is not applied, as it only orders requests waiting for inference slots.
+ */
+bool startAsyncInference(const std::shared_ptr<AsyncInference>& inference);
 
 Status reloadModelIfRequired(
     Status validationStatus,
     ModelInstance& modelInstance,
     const tensorflow::serving::PredictRequest* requestProto,
-    std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr);
+    std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr,
+    size_t chunksCount = 1);
 }  // namespace ovms
@@ -0,0 +1,151 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "priorityscheduler.hpp"
+
+#include <algorithm>
+
+#include <spdlog/spdlog.h>
+
+namespace ovms {
+
+static const std::array<std::string, PRIORITY_CLASSES_COUNT> PRIORITY_CLASS_NAMES{"high", "normal", "low"};
+
+const std::string& priorityClassToString(PriorityClass priority) {
+    return PRIORITY_CLASS_NAMES[static_cast<size_t>(priority)];
+}
+
+Status parsePriorityClass(const std::string& name, PriorityClass& priority) {
+    for (size_t i = 0; i < PRIORITY_CLASSES_COUNT; i++) {
+        if (name == PRIORITY_CLASS_NAMES[i]) {
+            priority = static_cast<PriorityClass>(i);
+            return StatusCode::OK;
+        }
+    }
+    return StatusCode::INVALID_PRIORITY_CLASS;
+}
+
+PriorityScheduler::PriorityScheduler(size_t slots, const std::array<uint32_t, PRIORITY_CLASSES_COUNT>& weights) :
+    slots(slots),
+    weights(weights) {}
+
+// Start-time fair queuing: each request gets start tag being the later of virtual time and finish tag
+// of the previous request of its class, and finish tag larger by inverse of class weight.
+// Requests are granted slots in order of finish tags, so a class with weight w gets w slots
+// for every slot of a class with weight 1 as long as both are waiting.
+Status PriorityScheduler::acquire(PriorityClass priority, const Deadline& deadline) {
+    auto& classCounters = counters[static_cast<size_t>(priority)];
+    auto status = deadline.check();
+    if (!status.ok()) {
+        classCounters.rejected.fetch_add(1, std::memory_order_relaxed);
+        return status;
+    }
+    if (slots == 0) {
+        return StatusCode::OK;
+    }
+    std::unique_lock<std::mutex> lock(mutex);
+    if (running < slots && waiters.empty()) {
+        running++;
+        return StatusCode::OK;
+    }
+    const size_t classIndex = static_cast<size_t>(priority);
+    Waiter waiter;
+    waiter.startTag = std::max(virtualTime, lastFinishTags[classIndex]);
+    waiter.finishTag = waiter.startTag + 1.0 / weights[classIndex];
+    waiter.sequence = nextSequence++;
+    lastFinishTags[classIndex] = waiter.finishTag;
+    waiters.insert(&waiter);
+    while (!waiter.granted) {
+        auto waitUntil = deadline.nextCheck();
+        if (!waitUntil) {
+            waiter.granting.wait(lock);
+            continue;
+        }
+        waiter.granting.wait_until(lock, waitUntil.value());
+        if (waiter.granted) {
+            break;
+        }
+        status = deadline.check();
+        if (!status.ok()) {
+            waiters.erase(&waiter);
+            classCounters.rejected.fetch_add(1, std::memory_order_relaxed);
+            SPDLOG_DEBUG("Request of priority class {} stopped waiting for inference slot: {}", priorityClassToString(priority), status.string());
+            return status;
+        }
+    }
+    return StatusCode::OK;
+}
+
+void PriorityScheduler::release() {
+    if (slots == 0) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(mutex);
+    if (waiters.empty()) {
+        running--;
+        return;
+    }
+    Waiter* next = *waiters.begin();
+    waiters.erase(waiters.begin());
+    virtualTime = next->startTag;
+    if (waiters.empty()) {
+        // Classes which were served during contention do not carry their tags to the next one
+        virtualTime = std::max(virtualTime, *std::max_element(lastFinishTags.begin(), lastFinishTags.end()));
+    }
+    next->granted = true;
+    next->granting.notify_one();
+}
+
+size_t PriorityScheduler::getRunningCount() {
+    std::unique_lock<std::mutex> lock(mutex);
+    return running;
+}
+
+size_t PriorityScheduler::getWaitingCount() {
+    std::unique_lock<std::mutex> lock(mutex);
+    return waiters.size();
+}
+
+void PriorityScheduler::recordCompleted(PriorityClass priority, std::chrono::microseconds wait, std::chrono::microseconds latency) {
+    auto& classCounters = counters[static_cast<size_t>(priority)];
+    const uint64_t waitUs = wait.count();
+    const uint64_t latencyUs = latency.count();
+    classCounters.completed.fetch_add(1, std::memory_order_relaxed);
+    classCounters.waitUsTotal.fetch_add(waitUs, std::memory_order_relaxed);
+    classCounters.latencyUsTotal.fetch_add(latencyUs, std::memory_order_relaxed);
+    uint64_t waitUsMax = classCounters.waitUsMax.load(std::memory_order_relaxed);
+    while (waitUs > waitUsMax && !classCounters.waitUsMax.compare_exchange_weak(waitUsMax, waitUs, std::memory_order_relaxed)) {
+    }
+    auto bucket = std::lower_bound(PRIORITY_LATENCY_BUCKETS_MS.begin(), PRIORITY_LATENCY_BUCKETS_MS.end(), latencyUs, [](uint64_t boundMs, uint64_t valueUs) {
+        return boundMs * 1000 < valueUs;
+    });
+    classCounters.latencyHistogram[bucket - PRIORITY_LATENCY_BUCKETS_MS.begin()].fetch_add(1, std::memory_order_relaxed);
+}
+
+PriorityClassStats PriorityScheduler::getStats(PriorityClass priority) const {
+    const auto& classCounters = counters[static_cast<size_t>(priority)];
+    PriorityClassStats stats;
+    stats.completed = classCounters.completed.load(std::memory_order_relaxed);
+    stats.rejected = classCounters.rejected.load(std::memory_order_relaxed);
+    stats.waitUsTotal = classCounters.waitUsTotal.load(std::memory_order_relaxed);
+    stats.waitUsMax = classCounters.waitUsMax.load(std::memory_order_relaxed);
+    stats.latencyUsTotal = classCounters.latencyUsTotal.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < stats.latencyHistogram.size(); i++) {
+        stats.latencyHistogram[i] = classCounters.latencyHistogram[i].load(std::memory_order_relaxed);
+    }
+    return stats;
+}
+
+}  // namespace ovms
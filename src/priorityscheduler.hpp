@@ -0,0 +1,210 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <set>
+#include <string>
+
+#include "deadline.hpp"
+#include "status.hpp"
+
+namespace ovms {
+
+enum class PriorityClass {
+    HIGH,
+    NORMAL,
+    LOW
+};
+
+const size_t PRIORITY_CLASSES_COUNT = 3;
+
+/**
+ * @brief gRPC metadata key and HTTP header overriding priority class of the model for a single request
+ */
+const std::string PRIORITY_HEADER = "ovms-priority";
+
+/**
+ * @brief Share of inference slots each class gets when all of them are waiting
+ */
+const std::array<uint32_t, PRIORITY_CLASSES_COUNT> DEFAULT_PRIORITY_WEIGHTS{8, 4, 1};
+
+/**
+ * @brief Upper bounds in milliseconds of latency histogram buckets, the last bucket has no bound
+ */
+const std::array<uint64_t, 12> PRIORITY_LATENCY_BUCKETS_MS{1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 2000, 5000};
+
+const std::string& priorityClassToString(PriorityClass priority);
+
+/**
+ * @brief Parses lowercase class name: high, normal or low
+ */
+Status parsePriorityClass(const std::string& name, PriorityClass& priority);
+
+/**
+ * @brief Counters of requests of a single priority class
+ */
+struct PriorityClassStats {
+    uint64_t completed = 0;
+    uint64_t rejected = 0;
+    uint64_t waitUsTotal = 0;
+    uint64_t waitUsMax = 0;
+    uint64_t latencyUsTotal = 0;
+    std::array<uint64_t, PRIORITY_LATENCY_BUCKETS_MS.size() + 1> latencyHistogram{};
+};
+
+/**
+ * @brief Limits number of inferences executed concurrently across all models. When all slots are taken,
+ * waiting requests are granted slots with weighted fair queuing of their priority classes, so that classes
+ * with higher weight get proportionally larger share of slots and no class is starved.
+ * Scheduling is disabled with 0 slots, then slots are granted right away.
+ */
+class PriorityScheduler {
+public:
+    using clock = Deadline::clock;
+
+    PriorityScheduler(size_t slots = 0, const std::array<uint32_t, PRIORITY_CLASSES_COUNT>& weights = DEFAULT_PRIORITY_WEIGHTS);
+
+    /**
+     * @brief Scheduler shared by all models
+     */
+    static PriorityScheduler& getInstance() {
+        static PriorityScheduler instance;
+        return instance;
+    }
+
+    /**
+     * @brief Sets number of slots, must not be called while requests are scheduled
+     */
+    void setSlots(size_t slots) {
+        this->slots = slots;
+    }
+
+    size_t getSlots() const {
+        return slots;
+    }
+
+    uint32_t getWeight(PriorityClass priority) const {
+        return weights[static_cast<size_t>(priority)];
+    }
+
+    /**
+     * @brief Waits for free slot. Fails with status of the deadline when it expires or the request gets cancelled.
+     */
+    Status acquire(PriorityClass priority, const Deadline& deadline = Deadline());
+
+    /**
+     * @brief Releases slot, handing it over to the waiting request with the earliest virtual finish time
+     */
+    void release();
+
+    size_t getRunningCount();
+
+    size_t getWaitingCount();
+
+    /**
+     * @brief Records request which held a slot, wait and latency are measured from the call to acquire
+     */
+    void recordCompleted(PriorityClass priority, std::chrono::microseconds wait, std::chrono::microseconds latency);
+
+    PriorityClassStats getStats(PriorityClass priority) const;
+
+private:
+    struct Waiter {
+        double startTag;
+        double finishTag;
+        uint64_t sequence;
+        bool granted = false;
+        std::condition_variable granting;
+    };
+
+    struct WaiterOrder {
+        bool operator()(const Waiter* lhs, const Waiter* rhs) const {
+            if (lhs->finishTag != rhs->finishTag) {
+                return lhs->finishTag < rhs->finishTag;
+            }
+            return lhs->sequence < rhs->sequence;
+        }
+    };
+
+    struct ClassCounters {
+        std::atomic<uint64_t> completed{0};
+        std::atomic<uint64_t> rejected{0};
+        std::atomic<uint64_t> waitUsTotal{0};
+        std::atomic<uint64_t> waitUsMax{0};
+        std::atomic<uint64_t> latencyUsTotal{0};
+        std::array<std::atomic<uint64_t>, PRIORITY_LATENCY_BUCKETS_MS.size() + 1> latencyHistogram{};
+    };
+
+    size_t slots;
+    const std::array<uint32_t, PRIORITY_CLASSES_COUNT> weights;
+
+    std::mutex mutex;
+    size_t running = 0;
+    std::set<Waiter*, WaiterOrder> waiters;
+    uint64_t nextSequence = 0;
+
+    /**
+     * @brief Virtual time is the start tag of the last granted request, tags are guarded by mutex
+     */
+    double virtualTime = 0;
+    std::array<double, PRIORITY_CLASSES_COUNT> lastFinishTags{};
+
+    std::array<ClassCounters, PRIORITY_CLASSES_COUNT> counters;
+};
+
+/**
+ * @brief Holds scheduler slot for the lifetime of the guard and records latency of the request
+ */
+class PrioritySlotGuard {
+public:
+    PrioritySlotGuard(PriorityScheduler& scheduler, PriorityClass priority, const Deadline& deadline = Deadline()) :
+        scheduler(scheduler),
+        priority(priority),
+        start(PriorityScheduler::clock::now()),
+        status(scheduler.acquire(priority, deadline)),
+        granted(PriorityScheduler::clock::now()) {}
+
+    ~PrioritySlotGuard() {
+        if (!status.ok()) {
+            return;
+        }
+        scheduler.release();
+        auto end = PriorityScheduler::clock::now();
+        scheduler.recordCompleted(priority,
+            std::chrono::duration_cast<std::chrono::microseconds>(granted - start),
+            std::chrono::duration_cast<std::chrono::microseconds>(end - start));
+    }
+
+    /**
+     * @brief Not OK when deadline of the request passed before slot was granted
+     */
+    const Status& getStatus() const { return status; }
+
+private:
+    PriorityScheduler& scheduler;
+    const PriorityClass priority;
+    const PriorityScheduler::clock::time_point start;
+    const Status status;
+    const PriorityScheduler::clock::time_point granted;
+};
+
+}  // namespace ovms
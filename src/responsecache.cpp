@@ -0,0 +1,196 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "responsecache.hpp"
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "shared_memory.hpp"
+
+using tensorflow::serving::PredictRequest;
+using tensorflow::serving::PredictResponse;
+
+namespace ovms {
+
+// Fields are prefixed with their size, so that content of different requests never concatenates to the same bytes
+static void appendBytes(std::string& content, std::string_view bytes) {
+    const uint64_t size = bytes.size();
+    content.append(reinterpret_cast<const char*>(&size), sizeof(size));
+    content.append(bytes.data(), bytes.size());
+}
+
+static void appendValue(std::string& content, int64_t value) {
+    content.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+std::optional<ResponseCacheKey> ResponseCache::computeKey(const PredictRequest& request) {
+    // Order of protobuf map iteration is not specified
+    std::vector<std::pair<const std::string*, const tensorflow::TensorProto*>> inputs;
+    inputs.reserve(request.inputs().size());
+    for (const auto& [name, proto] : request.inputs()) {
+        if (isSharedMemoryReference(proto)) {
+            return std::nullopt;
+        }
+        inputs.emplace_back(&name, &proto);
+    }
+    std::sort(inputs.begin(), inputs.end(), [](const auto& lhs, const auto& rhs) { return *lhs.first < *rhs.first; });
+
+    auto content = std::make_shared<std::string>();
+    std::string serialized;
+    appendValue(*content, inputs.size());
+    for (const auto& [name, proto] : inputs) {
+        appendBytes(*content, *name);
+        appendValue(*content, proto->dtype());
+        appendValue(*content, proto->tensor_shape().dim_size());
+        for (const auto& dim : proto->tensor_shape().dim()) {
+            appendValue(*content, dim.size());
+        }
+        if (!proto->tensor_content().empty()) {
+            appendBytes(*content, proto->tensor_content());
+        } else {
+            // Typed fields like float_val, tensor proto has no map fields so serialization is stable
+            proto->SerializeToString(&serialized);
+            appendBytes(*content, serialized);
+        }
+    }
+    std::vector<std::string_view> outputFilter(request.output_filter().begin(), request.output_filter().end());
+    std::sort(outputFilter.begin(), outputFilter.end());
+    appendValue(*content, outputFilter.size());
+    for (const auto& name : outputFilter) {
+        appendBytes(*content, name);
+    }
+    ResponseCacheKey key;
+    key.hash = std::hash<std::string_view>()(*content);
+    key.content = std::move(content);
+    return key;
+}
+
+ResponseCache::response_ptr_t ResponseCache::find(const ResponseCacheKey& key) {
+    auto it = entries.find(key);
+    if (it == entries.end()) {
+        return nullptr;
+    }
+    auto entry = it->second;
+    if (ttl.count() > 0 && clock::now() - entry->created >= ttl) {
+        bytes -= entry->bytes;
+        lru.erase(entry);
+        entries.erase(it);
+        return nullptr;
+    }
+    lru.splice(lru.begin(), lru, entry);
+    return entry->response;
+}
+
+void ResponseCache::insert(const ResponseCacheKey& key, const response_ptr_t& response, size_t responseBytes) {
+    if (key.content) {
+        responseBytes += key.content->size();
+    }
+    if (responseBytes > maxBytes) {
+        return;
+    }
+    auto existing = entries.find(key);
+    if (existing != entries.end()) {
+        bytes -= existing->second->bytes;
+        lru.erase(existing->second);
+        entries.erase(existing);
+    }
+    lru.push_front(Entry{key, response, responseBytes, clock::now()});
+    entries.emplace(key, lru.begin());
+    bytes += responseBytes;
+    while (bytes > maxBytes) {
+        const Entry& last = lru.back();
+        bytes -= last.bytes;
+        entries.erase(last.key);
+        lru.pop_back();
+        evictions.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+Status ResponseCache::getOrCompute(const ResponseCacheKey& key, PredictResponse* response,
+    const compute_fn_t& compute, const Deadline& deadline) {
+    std::shared_ptr<InFlight> flight;
+    bool leader = false;
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        response_ptr_t cached = find(key);
+        if (cached) {
+            lock.unlock();
+            hits.fetch_add(1, std::memory_order_relaxed);
+            *response = *cached;
+            return StatusCode::OK;
+        }
+        auto it = inFlight.find(key);
+        if (it != inFlight.end()) {
+            flight = it->second;
+            flight->waiting++;
+        } else {
+            flight = std::make_shared<InFlight>();
+            flight->result = flight->promise.get_future().share();
+            inFlight.emplace(key, flight);
+            leader = true;
+        }
+    }
+
+    if (!leader) {
+        coalesced.fetch_add(1, std::memory_order_relaxed);
+        while (true) {
+            auto waitUntil = deadline.nextCheck();
+            if (!waitUntil) {
+                flight->result.wait();
+                break;
+            }
+            if (flight->result.wait_until(waitUntil.value()) == std::future_status::ready) {
+                break;
+            }
+            auto status = deadline.check();
+            if (!status.ok()) {
+                return status;
+            }
+        }
+        auto result = flight->result.get();
+        if (result) {
+            *response = *result;
+            return StatusCode::OK;
+        }
+        return compute(response);
+    }
+
+    misses.fetch_add(1, std::memory_order_relaxed);
+    auto status = compute(response);
+    size_t waiting;
+    {
+        // No request joins this inference after it is removed from in-flight ones
+        std::unique_lock<std::mutex> lock(mutex);
+        inFlight.erase(key);
+        waiting = flight->waiting;
+    }
+    response_ptr_t result;
+    if (status.ok() && (waiting > 0 || maxBytes > 0)) {
+        result = std::make_shared<const PredictResponse>(*response);
+    }
+    flight->promise.set_value(result);
+    if (result && maxBytes > 0) {
+        const size_t responseBytes = result->ByteSizeLong();
+        std::unique_lock<std::mutex> lock(mutex);
+        insert(key, result, responseBytes);
+    }
+    return status;
+}
+
+}  // namespace ovms
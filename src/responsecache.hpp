@@ -0,0 +1,154 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wall"
+#include "tensorflow_serving/apis/prediction_service.grpc.pb.h"
+#pragma GCC diagnostic pop
+
+#include "deadline.hpp"
+#include "status.hpp"
+
+namespace ovms {
+
+/**
+ * @brief Identifies request content: input names, precisions, shapes and data plus output filter.
+ * Their serialization is kept with its hash and compared when hashes are equal, so that a hash collision
+ * never returns response to another request.
+ */
+struct ResponseCacheKey {
+    uint64_t hash = 0;
+    std::shared_ptr<const std::string> content;
+
+    bool operator==(const ResponseCacheKey& rhs) const {
+        if (hash != rhs.hash) {
+            return false;
+        }
+        if (content == rhs.content) {
+            return true;
+        }
+        return content && rhs.content && *content == *rhs.content;
+    }
+};
+
+struct ResponseCacheKeyHash {
+    size_t operator()(const ResponseCacheKey& key) const {
+        return static_cast<size_t>(key.hash);
+    }
+};
+
+/**
+ * @brief Responses of a single model version. Concurrent requests with the same key share one inference,
+ * completed responses are kept in LRU order within a limit of their serialized size and optional time to live.
+ * Instance is created with each load of a model version, so reload invalidates all entries.
+ */
+class ResponseCache {
+public:
+    using clock = Deadline::clock;
+    using compute_fn_t = std::function<Status(tensorflow::serving::PredictResponse*)>;
+
+    /**
+     * @param maxBytes limit of cached responses size, 0 keeps only coalescing of in-flight requests
+     * @param ttl time after which entry is not used, 0 means no expiration
+     */
+    ResponseCache(size_t maxBytes, std::chrono::milliseconds ttl) :
+        maxBytes(maxBytes),
+        ttl(ttl) {}
+
+    /**
+     * @brief Computes key of request, no value for requests using shared memory which content is not known
+     */
+    static std::optional<ResponseCacheKey> computeKey(const tensorflow::serving::PredictRequest& request);
+
+    /**
+     * @brief Fills response from cache, from in-flight inference of the same request or by running compute.
+     * Waiting for in-flight inference stops at the deadline. When that inference fails, compute is run
+     * for each waiting request, so that errors specific to a single request (like deadline) do not spread.
+     */
+    Status getOrCompute(const ResponseCacheKey& key, tensorflow::serving::PredictResponse* response,
+        const compute_fn_t& compute, const Deadline& deadline = Deadline());
+
+    uint64_t getHitsCount() const { return hits.load(std::memory_order_relaxed); }
+    uint64_t getMissesCount() const { return misses.load(std::memory_order_relaxed); }
+    uint64_t getCoalescedCount() const { return coalesced.load(std::memory_order_relaxed); }
+    uint64_t getEvictionsCount() const { return evictions.load(std::memory_order_relaxed); }
+
+    size_t getEntriesCount() {
+        std::unique_lock<std::mutex> lock(mutex);
+        return entries.size();
+    }
+
+    size_t getBytes() {
+        std::unique_lock<std::mutex> lock(mutex);
+        return bytes;
+    }
+
+private:
+    using response_ptr_t = std::shared_ptr<const tensorflow::serving::PredictResponse>;
+
+    struct Entry {
+        ResponseCacheKey key;
+        response_ptr_t response;
+        size_t bytes;
+        clock::time_point created;
+    };
+
+    struct InFlight {
+        std::promise<response_ptr_t> promise;
+        std::shared_future<response_ptr_t> result;
+        size_t waiting = 0;
+    };
+
+    /**
+     * @brief Must be called with mutex locked, drops expired entry
+     */
+    response_ptr_t find(const ResponseCacheKey& key);
+
+    /**
+     * @brief Must be called with mutex locked, evicts least recently used entries over the size limit.
+     * Size of entry includes request content kept in its key.
+     */
+    void insert(const ResponseCacheKey& key, const response_ptr_t& response, size_t responseBytes);
+
+    const size_t maxBytes;
+    const std::chrono::milliseconds ttl;
+
+    std::mutex mutex;
+    std::list<Entry> lru;
+    std::unordered_map<ResponseCacheKey, std::list<Entry>::iterator, ResponseCacheKeyHash> entries;
+    std::unordered_map<ResponseCacheKey, std::shared_ptr<InFlight>, ResponseCacheKeyHash> inFlight;
+    size_t bytes = 0;
+
+    std::atomic<uint64_t> hits{0};
+    std::atomic<uint64_t> misses{0};
+    std::atomic<uint64_t> coalesced{0};
+    std::atomic<uint64_t> evictions{0};
+};
+
+}  // namespace ovms
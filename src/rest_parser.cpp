@@ -36,6 +36,11 @@ RestParser::RestParser(const tensor_map_t& tensors) {
     }
 }
 
+void RestParser::setInputPrecision(const std::string& name, InferenceEngine::Precision precision) {
+    tensorPrecisionMap[name] = precision;
+    (*requestProto.mutable_inputs())[name].set_dtype(TensorInfo::getPrecisionAsDataType(precision));
+}
+
 void RestParser::removeUnusedInputs() {
     auto& inputs = (*requestProto.mutable_inputs());
     auto it = inputs.begin();
@@ -198,6 +203,18 @@ Status RestParser::parse(const char* json) {
     if (!doc.IsObject()) {
         return StatusCode::REST_BODY_IS_NOT_AN_OBJECT;
     }
+    auto outputFilterItr = doc.FindMember("output_filter");
+    if (outputFilterItr != doc.MemberEnd()) {
+        if (!outputFilterItr->value.IsArray()) {
+            return StatusCode::REST_OUTPUT_FILTER_NOT_AN_ARRAY;
+        }
+        for (const auto& name : outputFilterItr->value.GetArray()) {
+            if (!name.IsString()) {
+                return StatusCode::REST_OUTPUT_FILTER_NOT_AN_ARRAY;
+            }
+            requestProto.add_output_filter(name.GetString());
+        }
+    }
     auto instancesItr = doc.FindMember("instances");
     auto inputsItr = doc.FindMember("inputs");
     if (instancesItr != doc.MemberEnd() && inputsItr != doc.MemberEnd()) {
@@ -174,6 +174,15 @@ public:
      */
     RestParser(const tensor_map_t& tensors);
 
+    /**
+     * @brief Sets precision of input which is not a network input, like sequence inputs of stateful model.
+     * Precision of such inputs is otherwise deduced from the first value.
+     *
+     * @param name Input name
+     * @param precision Input precision
+     */
+    void setInputPrecision(const std::string& name, InferenceEngine::Precision precision);
+
     /**
      * @brief Gets parsed request proto
      * 
@@ -0,0 +1,149 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "rest_router.hpp"
+
+#include <charconv>
+#include <system_error>
+
+#include <spdlog/spdlog.h>
+
+namespace ovms {
+
+namespace {
+
+bool consumePrefix(std::string_view& path, const std::string_view prefix) {
+    if (path.substr(0, prefix.size()) != prefix) {
+        return false;
+    }
+    path.remove_prefix(prefix.size());
+    return true;
+}
+
+// Consumes characters up to the first one for which isAccepted is false
+template <typename Predicate>
+std::string_view consumeWhile(std::string_view& path, Predicate isAccepted) {
+    size_t length = 0;
+    while (length < path.size() && isAccepted(path[length])) {
+        length++;
+    }
+    auto consumed = path.substr(0, length);
+    path.remove_prefix(length);
+    return consumed;
+}
+
+bool isNameCharacter(char c) {
+    return c != '/' && c != ':';
+}
+
+bool isDigit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+bool isWordCharacter(char c) {
+    return isDigit(c) || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+}
+
+Status routeModelRequest(std::string_view path, HttpRequestComponents& components) {
+    components.resource = RestResource::MODEL;
+    components.model_name = consumeWhile(path, isNameCharacter);
+    if (components.model_name.empty()) {
+        return StatusCode::REST_INVALID_URL;
+    }
+    std::string_view versionDigits;
+    if (consumePrefix(path, "/versions/")) {
+        versionDigits = consumeWhile(path, isDigit);
+        if (versionDigits.empty()) {
+            return StatusCode::REST_INVALID_URL;
+        }
+    } else if (consumePrefix(path, "/labels/")) {
+        auto label = consumeWhile(path, isWordCharacter);
+        if (label.empty()) {
+            return StatusCode::REST_INVALID_URL;
+        }
+        components.model_version_label = label;
+    }
+    bool processing;
+    if (consumePrefix(path, ":")) {
+        if (path != "classify" && path != "regress" && path != "predict") {
+            return StatusCode::REST_INVALID_URL;
+        }
+        processing = true;
+        components.processing_method = path;
+    } else if (path.empty() || path == "/metadata" || path == "/stats") {
+        processing = false;
+        components.model_subresource = path.empty() ? path : path.substr(1);
+    } else {
+        return StatusCode::REST_INVALID_URL;
+    }
+    if (processing != (components.http_method == "POST")) {
+        return StatusCode::REST_UNSUPPORTED_METHOD;
+    }
+    if (!versionDigits.empty()) {
+        int64_t version;
+        auto result = std::from_chars(versionDigits.data(), versionDigits.data() + versionDigits.size(), version);
+        if (result.ec != std::errc()) {
+            SPDLOG_ERROR("Couldn't parse model version {}", versionDigits);
+            return StatusCode::REST_COULD_NOT_PARSE_VERSION;
+        }
+        components.model_version = version;
+    }
+    return StatusCode::OK;
+}
+
+}  // namespace
+
+Status routeRestRequest(const std::string_view http_method, const std::string_view request_path, HttpRequestComponents& components) {
+    if (request_path.find("../") != std::string_view::npos || request_path.find("/..") != std::string_view::npos) {
+        SPDLOG_ERROR("Path {} escape with .. is forbidden.", request_path);
+        return StatusCode::PATH_INVALID;
+    }
+    if (http_method != "POST" && http_method != "GET") {
+        return StatusCode::REST_UNSUPPORTED_METHOD;
+    }
+    components.http_method = http_method;
+
+    std::string_view path = request_path;
+    // Single character before API version is accepted, as it always was
+    if (!path.empty() && path.substr(0, 4) != "/v1/" && path.substr(1, 4) == "/v1/") {
+        path.remove_prefix(1);
+    }
+    if (!consumePrefix(path, "/v1/")) {
+        return StatusCode::REST_INVALID_URL;
+    }
+    if (consumePrefix(path, "models/")) {
+        return routeModelRequest(path, components);
+    }
+    if (consumePrefix(path, "shared_memory/region/")) {
+        components.resource = RestResource::SHARED_MEMORY;
+        components.model_name = consumeWhile(path, isNameCharacter);
+        if (components.model_name.empty() || (path != "/register" && path != "/unregister")) {
+            return StatusCode::REST_INVALID_URL;
+        }
+        components.processing_method = path.substr(1);
+        return http_method == "POST" ? StatusCode::OK : StatusCode::REST_UNSUPPORTED_METHOD;
+    }
+    if (path == "scheduler/stats") {
+        components.resource = RestResource::SCHEDULER_STATS;
+        return http_method == "GET" ? StatusCode::OK : StatusCode::REST_UNSUPPORTED_METHOD;
+    }
+    if (path == "traces") {
+        components.resource = RestResource::TRACES;
+        return http_method == "GET" ? StatusCode::OK : StatusCode::REST_UNSUPPORTED_METHOD;
+    }
+    return StatusCode::REST_INVALID_URL;
+}
+
+}  // namespace ovms
@@ -0,0 +1,65 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+#include "priorityscheduler.hpp"
+#include "status.hpp"
+
+namespace ovms {
+
+enum class RestResource {
+    MODEL,
+    SHARED_MEMORY,
+    SCHEDULER_STATS,
+    TRACES
+};
+
+/**
+ * @brief Components of REST request path, views refer to the path passed to routeRestRequest
+ */
+struct HttpRequestComponents {
+    RestResource resource = RestResource::MODEL;
+    std::string_view http_method;
+    // Model name or shared memory region name
+    std::string_view model_name;
+    std::optional<int64_t> model_version;
+    std::optional<std::string_view> model_version_label;
+    // classify, regress or predict for POST model requests, register or unregister for shared memory
+    std::string_view processing_method;
+    // metadata, stats or empty for GET model requests
+    std::string_view model_subresource;
+    std::optional<PriorityClass> priority;
+};
+
+/**
+ * @brief Validates method and path of REST request in a single pass over the path, without allocations.
+ * Accepted paths:
+ * /v1/models/{name}[/versions/{number}|/labels/{label}]:(classify|regress|predict)  POST
+ * /v1/models/{name}[/versions/{number}|/labels/{label}][/metadata|/stats]           GET
+ * /v1/shared_memory/region/{name}/(register|unregister)                             POST
+ * /v1/scheduler/stats                                                               GET
+ * /v1/traces                                                                        GET
+ *
+ * @return PATH_INVALID for paths escaping with .., REST_UNSUPPORTED_METHOD for methods other than GET and POST
+ * or not matching the path, REST_INVALID_URL for other paths and REST_COULD_NOT_PARSE_VERSION for version out of range
+ */
+Status routeRestRequest(const std::string_view http_method, const std::string_view request_path, HttpRequestComponents& components);
+
+}  // namespace ovms
@@ -83,6 +83,84 @@ const char* MODELS_CONFIG_SCHEMA = R"({
 						"plugin_config": {
 							"type": "object"
 						},
+						"precision_conversion": {
+							"type": ["boolean", "array"],
+							"items": {
+								"type": "string"
+							}
+						},
+						"post_processing": {
+							"type": "object",
+							"additionalProperties": {
+								"type": "object",
+								"required": ["type"],
+								"properties": {
+									"type": {
+										"type": "string",
+										"enum": ["top_k", "argmax", "detections"]
+									},
+									"k": {
+										"type": "integer",
+										"minimum": 1
+									},
+									"score_threshold": {
+										"type": "number"
+									},
+									"iou_threshold": {
+										"type": "number",
+										"minimum": 0,
+										"maximum": 1
+									},
+									"max_detections": {
+										"type": "integer",
+										"minimum": 1
+									}
+								},
+								"additionalProperties": false
+							}
+						},
+						"batch_splitting": {
+							"type": "boolean"
+						},
+						"max_queue_size": {
+							"type": "integer",
+							"minimum": 0
+						},
+						"max_queue_wait_ms": {
+							"type": "integer",
+							"minimum": 0
+						},
+						"priority": {
+							"type": "string",
+							"enum": ["high", "normal", "low"]
+						},
+						"response_cache": {
+							"type": "object",
+							"properties": {
+								"max_size_mb": {
+									"type": "integer",
+									"minimum": 0
+								},
+								"ttl_ms": {
+									"type": "integer",
+									"minimum": 0
+								}
+							},
+							"additionalProperties": false
+						},
+						"stateful": {
+							"type": "boolean"
+						},
+						"max_sequence_number": {
+							"type": "integer",
+							"minimum": 1,
+							"maximum": 4294967295
+						},
+						"idle_sequence_timeout_s": {
+							"type": "integer",
+							"minimum": 0,
+							"maximum": 4294967295
+						},
 						"custom_loader_options": {
 							"type": "object",
                                                         "required": ["loader_name"],
@@ -133,9 +211,29 @@ const char* MODELS_CONFIG_SCHEMA = R"({
 			},
 			"additionalProperties": false
 		},
+		"execution_condition": {
+			"type": "object",
+			"required": ["node_name", "data_item"],
+			"properties": {
+				"node_name": {
+					"type": "string"
+				},
+				"data_item": {
+					"type": "string"
+				},
+				"predicate": {
+					"type": "string",
+					"enum": ["not_empty", "any_greater"]
+				},
+				"threshold": {
+					"type": "number"
+				}
+			},
+			"additionalProperties": false
+		},
 		"node_config": {
 			"type": "object",
-			"required": ["name", "model_name", "inputs", "outputs"],
+			"required": ["name", "inputs", "outputs"],
 			"properties": {
 				"name": {
 					"type": "string"
@@ -143,14 +241,33 @@ const char* MODELS_CONFIG_SCHEMA = R"({
 				"model_name": {
 					"type": "string"
 				},
+				"library_path": {
+					"type": "string"
+				},
+				"params": {
+					"type": "object",
+					"additionalProperties": {
+						"type": "string"
+					}
+				},
 				"type": {
 					"type": "string",
-					"enum": ["DL model", "Demultiplexer", "Batch dispatcher"]
+					"enum": ["DL model", "custom", "Demultiplexer", "Batch dispatcher"]
 				},
 				"version": {
 					"type": "integer",
 					"minimum": 1
 				},
+				"demultiply_count": {
+					"type": "integer",
+					"minimum": 1
+				},
+				"gather_from_node": {
+					"type": "string"
+				},
+				"condition": {
+					"$ref": "#/definitions/execution_condition"
+				},
 				"inputs": {
 					"type": "array",
 					"items": {
@@ -0,0 +1,149 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "sequence.hpp"
+
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+#include <spdlog/spdlog.h>
+
+#include "ov_utils.hpp"
+
+using tensorflow::serving::PredictRequest;
+using tensorflow::serving::PredictResponse;
+
+namespace ovms {
+
+template <typename T, typename Field>
+static bool readSingleValue(const tensorflow::TensorProto& proto, const Field& field, uint64_t& value) {
+    T typed;
+    if (proto.tensor_content().size() == sizeof(T)) {
+        std::memcpy(&typed, proto.tensor_content().data(), sizeof(T));
+    } else if (proto.tensor_content().empty() && field.size() == 1) {
+        typed = static_cast<T>(field.Get(0));
+    } else {
+        return false;
+    }
+    if constexpr (std::is_signed_v<T>) {
+        if (typed < 0) {
+            return false;
+        }
+    }
+    value = static_cast<uint64_t>(typed);
+    return true;
+}
+
+// REST requests carry integers of inputs unknown to the network as I32, gRPC clients usually send declared types
+static bool readSingleValue(const tensorflow::TensorProto& proto, uint64_t& value) {
+    int64_t elements = 1;
+    for (const auto& dim : proto.tensor_shape().dim()) {
+        elements *= dim.size();
+    }
+    if (elements != 1) {
+        return false;
+    }
+    switch (proto.dtype()) {
+    case tensorflow::DataType::DT_UINT64:
+        return readSingleValue<uint64_t>(proto, proto.uint64_val(), value);
+    case tensorflow::DataType::DT_INT64:
+        return readSingleValue<int64_t>(proto, proto.int64_val(), value);
+    case tensorflow::DataType::DT_UINT32:
+        return readSingleValue<uint32_t>(proto, proto.uint32_val(), value);
+    case tensorflow::DataType::DT_INT32:
+        return readSingleValue<int32_t>(proto, proto.int_val(), value);
+    default:
+        return false;
+    }
+}
+
+Status extractSequenceProcessingSpec(const PredictRequest& request, SequenceProcessingSpec& spec) {
+    spec = SequenceProcessingSpec();
+    auto it = request.inputs().find(SEQUENCE_ID_INPUT);
+    if (it != request.inputs().end()) {
+        if (!readSingleValue(it->second, spec.sequenceId)) {
+            return Status(StatusCode::INVALID_SEQUENCE_CONTROL_INPUT, "sequence_id must be a single non-negative integer");
+        }
+    }
+    it = request.inputs().find(SEQUENCE_CONTROL_INPUT);
+    if (it != request.inputs().end()) {
+        uint64_t control;
+        if (!readSingleValue(it->second, control) || control > static_cast<uint64_t>(SequenceControl::SEQUENCE_END)) {
+            return Status(StatusCode::INVALID_SEQUENCE_CONTROL_INPUT, "sequence_control_input must be 0 (none), 1 (start) or 2 (end)");
+        }
+        spec.control = static_cast<SequenceControl>(control);
+    }
+    return StatusCode::OK;
+}
+
+size_t countSequenceInputs(const PredictRequest& request) {
+    return request.inputs().count(SEQUENCE_ID_INPUT) + request.inputs().count(SEQUENCE_CONTROL_INPUT);
+}
+
+void addSequenceIdOutput(PredictResponse* response, uint64_t sequenceId) {
+    auto& proto = (*response->mutable_outputs())[SEQUENCE_ID_INPUT];
+    proto.Clear();
+    proto.set_dtype(tensorflow::DataType::DT_UINT64);
+    proto.mutable_tensor_shape()->add_dim()->set_size(1);
+    proto.mutable_tensor_content()->assign(reinterpret_cast<const char*>(&sequenceId), sizeof(sequenceId));
+}
+
+Status Sequence::restoreMemoryState(InferenceEngine::InferRequest& inferRequest) {
+    try {
+        for (auto&& state : inferRequest.QueryState()) {
+            if (memoryState.empty()) {
+                // Infer request keeps state of the sequence which used it last
+                state.Reset();
+                continue;
+            }
+            auto it = memoryState.find(state.GetName());
+            if (it == memoryState.end()) {
+                SPDLOG_ERROR("Sequence {} has no memory state: {}", id, state.GetName());
+                return StatusCode::INTERNAL_ERROR;
+            }
+            state.SetState(it->second);
+        }
+    } catch (const InferenceEngine::details::InferenceEngineException& e) {
+        SPDLOG_ERROR("Restoring memory state of sequence {} failed: {}", id, e.what());
+        return StatusCode::OV_INTERNAL_INFERENCE_ERROR;
+    }
+    return StatusCode::OK;
+}
+
+Status Sequence::updateMemoryState(InferenceEngine::InferRequest& inferRequest) {
+    try {
+        for (auto&& state : inferRequest.QueryState()) {
+            auto source = std::const_pointer_cast<InferenceEngine::Blob>(state.GetState());
+            auto& destination = memoryState[state.GetName()];
+            // Buffers are reused for each request of the sequence, state size does not change with fixed shapes
+            if (destination && destination->byteSize() == source->byteSize()) {
+                std::memcpy((void*)destination->buffer(), (void*)source->buffer(), source->byteSize());
+                continue;
+            }
+            auto status = blobClone(destination, source);
+            if (!status.ok()) {
+                SPDLOG_ERROR("Copying memory state {} of sequence {} failed", state.GetName(), id);
+                return status;
+            }
+        }
+    } catch (const InferenceEngine::details::InferenceEngineException& e) {
+        SPDLOG_ERROR("Reading memory state of sequence {} failed: {}", id, e.what());
+        return StatusCode::OV_INTERNAL_INFERENCE_ERROR;
+    }
+    return StatusCode::OK;
+}
+
+}  // namespace ovms
@@ -0,0 +1,134 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <inference_engine.hpp>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wall"
+#include "tensorflow_serving/apis/prediction_service.grpc.pb.h"
+#pragma GCC diagnostic pop
+
+#include "status.hpp"
+
+namespace ovms {
+
+const std::string SEQUENCE_ID_INPUT = "sequence_id";
+const std::string SEQUENCE_CONTROL_INPUT = "sequence_control_input";
+
+enum class SequenceControl : uint32_t {
+    NO_CONTROL_INPUT = 0,
+    SEQUENCE_START = 1,
+    SEQUENCE_END = 2
+};
+
+/**
+ * @brief Sequence inputs of a request to stateful model. Sequence id 0 means not provided.
+ */
+struct SequenceProcessingSpec {
+    SequenceControl control = SequenceControl::NO_CONTROL_INPUT;
+    uint64_t sequenceId = 0;
+};
+
+/**
+ * @brief Reads sequence_id and sequence_control_input from request. Both are single values
+ * of any integer type accepted by gRPC and REST, passed in typed fields or tensor_content.
+ */
+Status extractSequenceProcessingSpec(const tensorflow::serving::PredictRequest& request, SequenceProcessingSpec& spec);
+
+/**
+ * @brief Number of sequence inputs present in request, those are not network inputs
+ */
+size_t countSequenceInputs(const tensorflow::serving::PredictRequest& request);
+
+/**
+ * @brief Adds sequence_id output, so that clients starting a sequence learn its generated id
+ */
+void addSequenceIdOutput(tensorflow::serving::PredictResponse* response, uint64_t sequenceId);
+
+using sequence_memory_state_t = std::unordered_map<std::string, InferenceEngine::Blob::Ptr>;
+
+/**
+ * @brief Memory state of stateful network kept between requests of a single sequence.
+ * Requests of a sequence are processed one at a time under sequence mutex, since each one
+ * starts from the state left by the previous one.
+ */
+class Sequence {
+public:
+    using clock = std::chrono::steady_clock;
+
+    explicit Sequence(uint64_t id) :
+        id(id),
+        lastActivity(clock::now()) {}
+
+    uint64_t getId() const {
+        return id;
+    }
+
+    std::mutex& getMutex() {
+        return mutex;
+    }
+
+    /**
+     * @brief Must be called with sequence mutex locked
+     */
+    bool isTerminated() const {
+        return terminated;
+    }
+
+    /**
+     * @brief Must be called with sequence mutex locked, requests still waiting for the sequence are rejected
+     */
+    void setTerminated() {
+        terminated = true;
+    }
+
+    /**
+     * @brief Sets memory states of infer request to the ones left by the previous request of the sequence,
+     * or resets them for the first request. Must be called with sequence mutex locked.
+     */
+    Status restoreMemoryState(InferenceEngine::InferRequest& inferRequest);
+
+    /**
+     * @brief Copies memory states of infer request after inference, since the infer request
+     * is reused by other sequences. Must be called with sequence mutex locked.
+     */
+    Status updateMemoryState(InferenceEngine::InferRequest& inferRequest);
+
+    const sequence_memory_state_t& getMemoryState() const {
+        return memoryState;
+    }
+
+private:
+    friend class SequenceManager;
+
+    const uint64_t id;
+
+    std::mutex mutex;
+    bool terminated = false;
+    sequence_memory_state_t memoryState;
+
+    // Guarded by mutex of sequence manager
+    clock::time_point lastActivity;
+};
+
+}  // namespace ovms
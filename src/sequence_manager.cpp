@@ -0,0 +1,103 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "sequence_manager.hpp"
+
+#include <spdlog/spdlog.h>
+
+namespace ovms {
+
+uint64_t SequenceManager::generateSequenceId() {
+    // Ids chosen by clients are skipped, 0 means not provided
+    while (nextSequenceId == 0 || sequences.count(nextSequenceId) > 0) {
+        nextSequenceId++;
+    }
+    return nextSequenceId++;
+}
+
+Status SequenceManager::acquire(const SequenceProcessingSpec& spec, std::shared_ptr<Sequence>& sequence) {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (spec.control != SequenceControl::SEQUENCE_START) {
+        if (spec.sequenceId == 0) {
+            return StatusCode::SEQUENCE_ID_NOT_PROVIDED;
+        }
+        auto it = sequences.find(spec.sequenceId);
+        if (it == sequences.end()) {
+            return StatusCode::SEQUENCE_MISSING;
+        }
+        sequence = it->second;
+        sequence->lastActivity = Sequence::clock::now();
+        return StatusCode::OK;
+    }
+    if (spec.sequenceId != 0 && sequences.count(spec.sequenceId) > 0) {
+        return StatusCode::SEQUENCE_ALREADY_EXISTS;
+    }
+    if (sequences.size() >= maxSequenceNumber && removeIdleSequencesLocked() == 0) {
+        return StatusCode::MAX_SEQUENCE_NUMBER_REACHED;
+    }
+    const uint64_t sequenceId = spec.sequenceId != 0 ? spec.sequenceId : generateSequenceId();
+    sequence = std::make_shared<Sequence>(sequenceId);
+    sequences.emplace(sequenceId, sequence);
+    SPDLOG_DEBUG("Sequence {} started, sequences count: {}", sequenceId, sequences.size());
+    return StatusCode::OK;
+}
+
+void SequenceManager::release(const SequenceProcessingSpec& spec, Sequence& sequence, bool succeeded) {
+    // Failed start does not leave state behind, so client can retry it with the same id
+    const bool remove = spec.control == SequenceControl::SEQUENCE_END ||
+                        (spec.control == SequenceControl::SEQUENCE_START && !succeeded);
+    if (!remove || sequence.isTerminated()) {
+        return;
+    }
+    sequence.setTerminated();
+    std::unique_lock<std::mutex> lock(mutex);
+    sequences.erase(sequence.getId());
+    SPDLOG_DEBUG("Sequence {} ended, sequences count: {}", sequence.getId(), sequences.size());
+}
+
+size_t SequenceManager::removeIdleSequences() {
+    std::unique_lock<std::mutex> lock(mutex);
+    return removeIdleSequencesLocked();
+}
+
+size_t SequenceManager::removeIdleSequencesLocked() {
+    if (idleTimeout.count() == 0) {
+        return 0;
+    }
+    const auto now = Sequence::clock::now();
+    size_t removed = 0;
+    for (auto it = sequences.begin(); it != sequences.end();) {
+        auto& sequence = *it->second;
+        if (now - sequence.lastActivity < idleTimeout) {
+            ++it;
+            continue;
+        }
+        // Lock order is sequence first, so sequence being processed is skipped instead of waited for
+        std::unique_lock<std::mutex> sequenceLock(sequence.getMutex(), std::try_to_lock);
+        if (!sequenceLock.owns_lock()) {
+            ++it;
+            continue;
+        }
+        sequence.setTerminated();
+        SPDLOG_DEBUG("Sequence {} removed after being idle for over {} s", sequence.getId(), idleTimeout.count());
+        // Map may hold the last reference to the sequence
+        sequenceLock.unlock();
+        it = sequences.erase(it);
+        removed++;
+    }
+    return removed;
+}
+
+}  // namespace ovms
@@ -0,0 +1,89 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "sequence.hpp"
+#include "status.hpp"
+
+namespace ovms {
+
+/**
+ * @brief Sequences of a single stateful model version. Instance is created with each load of the version,
+ * so reload drops all sequences.
+ */
+class SequenceManager {
+public:
+    /**
+     * @param maxSequenceNumber limit of concurrent sequences
+     * @param idleTimeout time without requests after which sequence is removed, 0 means no removal
+     */
+    SequenceManager(uint32_t maxSequenceNumber, std::chrono::seconds idleTimeout) :
+        maxSequenceNumber(maxSequenceNumber),
+        idleTimeout(idleTimeout) {}
+
+    /**
+     * @brief Finds sequence of request or creates one on sequence start. Start without sequence id
+     * gets a generated one. When the limit is reached, idle sequences are removed before rejecting.
+     */
+    Status acquire(const SequenceProcessingSpec& spec, std::shared_ptr<Sequence>& sequence);
+
+    /**
+     * @brief Removes sequence after its end or after its start failed, must be called with sequence mutex locked
+     */
+    void release(const SequenceProcessingSpec& spec, Sequence& sequence, bool succeeded);
+
+    /**
+     * @brief Removes sequences without requests for longer than idle timeout, skipping ones being processed
+     *
+     * @return number of removed sequences
+     */
+    size_t removeIdleSequences();
+
+    size_t getSequencesCount() {
+        std::unique_lock<std::mutex> lock(mutex);
+        return sequences.size();
+    }
+
+    uint32_t getMaxSequenceNumber() const {
+        return maxSequenceNumber;
+    }
+
+private:
+    /**
+     * @brief Must be called with mutex locked
+     */
+    size_t removeIdleSequencesLocked();
+
+    /**
+     * @brief Must be called with mutex locked
+     */
+    uint64_t generateSequenceId();
+
+    const uint32_t maxSequenceNumber;
+    const std::chrono::seconds idleTimeout;
+
+    std::mutex mutex;
+    std::unordered_map<uint64_t, std::shared_ptr<Sequence>> sequences;
+    uint64_t nextSequenceId = 1;
+};
+
+}  // namespace ovms
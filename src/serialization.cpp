@@ -15,8 +15,44 @@
 //*****************************************************************************
 #include "serialization.hpp"
 
+#include <algorithm>
+#include <vector>
+
+#include "postprocessing.hpp"
+#include "precisionutils.hpp"
+
 namespace ovms {
 
+template <typename Source, typename Destination>
+static void convertBlobContent(
+    tensorflow::TensorProto& proto,
+    const InferenceEngine::Blob::Ptr& blob,
+    void (*convert)(const Source*, Destination*, size_t)) {
+    const size_t count = blob->byteSize() / sizeof(Source);
+    auto content = proto.mutable_tensor_content();
+    content->resize(count * sizeof(Destination));
+    convert(blob->buffer().as<const Source*>(), reinterpret_cast<Destination*>(&(*content)[0]), count);
+}
+
+void serializeBlobContent(
+    tensorflow::TensorProto& proto,
+    const InferenceEngine::Precision& precision,
+    const InferenceEngine::Blob::Ptr& blob) {
+    switch (precision) {
+    case InferenceEngine::Precision::FP16:
+        convertBlobContent<uint16_t, float>(proto, blob, convertFp16ToFp32);
+        break;
+    case InferenceEngine::Precision::U16:
+        convertBlobContent<uint16_t, uint32_t>(proto, blob, convertU16ToU32);
+        break;
+    case InferenceEngine::Precision::I64:
+        convertBlobContent<int64_t, int32_t>(proto, blob, convertI64ToI32);
+        break;
+    default:
+        proto.mutable_tensor_content()->assign((char*)blob->buffer(), blob->byteSize());
+    }
+}
+
 Status serializeBlobToTensorProto(
     tensorflow::TensorProto& responseOutput,
     const std::shared_ptr<TensorInfo>& networkOutput,
@@ -39,7 +75,7 @@ Status serializeBlobToTensorProto(
         responseOutput.set_dtype(tensorflow::DataTypeToEnum<int8_t>::value);
         break;
 
-    // 2 byte padding [v1, v0, 0, 0, u1, u0, 0, 0, ...]
+    // Converted to 4 byte values in serializeBlobContent
     case InferenceEngine::Precision::U16:
         responseOutput.set_dtype(tensorflow::DataTypeToEnum<uint32_t>::value);
         break;
@@ -66,10 +102,113 @@ Status serializeBlobToTensorProto(
     for (auto dim : networkOutput->getShape()) {
         responseOutput.mutable_tensor_shape()->add_dim()->set_size(dim);
     }
-    responseOutput.mutable_tensor_content()->assign((char*)blob->buffer(), blob->byteSize());
+    serializeBlobContent(responseOutput, networkOutput->getPrecision(), blob);
     return StatusCode::OK;
 }
 
+static void setShape(tensorflow::TensorProto& proto, const shape_t& shape) {
+    proto.mutable_tensor_shape()->Clear();
+    for (auto dim : shape) {
+        proto.mutable_tensor_shape()->add_dim()->set_size(dim);
+    }
+}
+
+template <typename T>
+static T* resizeContent(tensorflow::TensorProto& proto, size_t count) {
+    auto content = proto.mutable_tensor_content();
+    content->resize(count * sizeof(T));
+    return reinterpret_cast<T*>(&(*content)[0]);
+}
+
+Status serializePostProcessedOutput(
+    tensorflow::serving::PredictResponse& response,
+    const std::shared_ptr<TensorInfo>& networkOutput,
+    const InferenceEngine::Blob::Ptr& blob) {
+    const auto& config = networkOutput->getPostProcessing().value();
+    shape_t shape = networkOutput->getShape();
+    const size_t count = blob->size();
+    const size_t columns = shape.back();
+    const size_t rows = columns == 0 ? 0 : count / columns;
+
+    // Operators work on FP32 values, FP16 is converted once for the whole blob
+    std::vector<float> converted;
+    const float* data = nullptr;
+    if (networkOutput->getPrecision() == InferenceEngine::Precision::FP16) {
+        converted.resize(count);
+        convertFp16ToFp32(blob->buffer().as<const uint16_t*>(), converted.data(), count);
+        data = converted.data();
+    } else {
+        data = blob->buffer().as<const float*>();
+    }
+
+    auto& proto = (*response.mutable_outputs())[networkOutput->getMappedName()];
+    proto.Clear();
+    switch (config.kind) {
+    case PostProcessingKind::TOP_K: {
+        auto& indicesProto = (*response.mutable_outputs())[networkOutput->getMappedName() + TOP_K_INDICES_SUFFIX];
+        indicesProto.Clear();
+        shape.back() = config.k;
+        proto.set_dtype(tensorflow::DataTypeToEnum<float>::value);
+        indicesProto.set_dtype(tensorflow::DataTypeToEnum<int32_t>::value);
+        setShape(proto, shape);
+        setShape(indicesProto, shape);
+        getPostProcessingKernels().topK(data, rows, columns, config.k,
+            resizeContent<float>(proto, rows * config.k),
+            resizeContent<int32_t>(indicesProto, rows * config.k));
+        break;
+    }
+    case PostProcessingKind::ARGMAX:
+        shape.pop_back();
+        proto.set_dtype(tensorflow::DataTypeToEnum<int32_t>::value);
+        setShape(proto, shape);
+        getPostProcessingKernels().argmax(data, rows, columns, resizeContent<int32_t>(proto, rows));
+        break;
+    case PostProcessingKind::DETECTIONS: {
+        std::vector<float> selected(count);
+        size_t selectedCount = selectDetections(data, rows, config.scoreThreshold, config.iouThreshold,
+            config.maxDetections, selected.data());
+        shape[shape.size() - 2] = selectedCount;
+        proto.set_dtype(tensorflow::DataTypeToEnum<float>::value);
+        setShape(proto, shape);
+        std::copy(selected.begin(), selected.begin() + selectedCount * DETECTION_SIZE,
+            resizeContent<float>(proto, selectedCount * DETECTION_SIZE));
+        break;
+    }
+    }
+    return StatusCode::OK;
+}
+
+tensor_map_t getPostProcessedOutputsInfo(const tensor_map_t& outputsInfo) {
+    tensor_map_t result;
+    for (const auto& [name, tensor] : outputsInfo) {
+        if (!tensor->getPostProcessing()) {
+            result.emplace(name, tensor);
+            continue;
+        }
+        const auto& config = tensor->getPostProcessing().value();
+        shape_t shape = tensor->getShape();
+        switch (config.kind) {
+        case PostProcessingKind::TOP_K:
+            shape.back() = config.k;
+            result.emplace(name, std::make_shared<TensorInfo>(tensor->getName(), tensor->getMappedName(),
+                                     InferenceEngine::Precision::FP32, shape, InferenceEngine::Layout::ANY));
+            result.emplace(name + TOP_K_INDICES_SUFFIX, std::make_shared<TensorInfo>(tensor->getName() + TOP_K_INDICES_SUFFIX,
+                                                            tensor->getMappedName() + TOP_K_INDICES_SUFFIX, InferenceEngine::Precision::I32, shape, InferenceEngine::Layout::ANY));
+            break;
+        case PostProcessingKind::ARGMAX:
+            shape.pop_back();
+            result.emplace(name, std::make_shared<TensorInfo>(tensor->getName(), tensor->getMappedName(),
+                                     InferenceEngine::Precision::I32, shape, InferenceEngine::Layout::ANY));
+            break;
+        case PostProcessingKind::DETECTIONS:
+            result.emplace(name, std::make_shared<TensorInfo>(tensor->getName(), tensor->getMappedName(),
+                                     InferenceEngine::Precision::FP32, shape, InferenceEngine::Layout::ANY));
+            break;
+        }
+    }
+    return result;
+}
+
 Status serializePredictResponse(
     InferenceEngine::InferRequest& inferRequest,
     const tensor_map_t& outputMap,
@@ -85,6 +224,13 @@ Status serializePredictResponse(
             SPDLOG_ERROR("{}: {}", status.string(), e.what());
             return status;
         }
+        if (networkOutput->getPostProcessing()) {
+            auto status = serializePostProcessedOutput(*response, networkOutput, blob);
+            if (!status.ok()) {
+                return status;
+            }
+            continue;
+        }
         auto& tensorProto = (*response->mutable_outputs())[networkOutput->getMappedName()];
         auto status = serializeBlobToTensorProto(tensorProto, networkOutput, blob);
         if (!status.ok()) {
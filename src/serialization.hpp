@@ -32,11 +32,40 @@
 
 namespace ovms {
 
+/**
+ * @brief Fills tensor_content with blob data. FP16, U16 and I64 data is converted to FP32, U32 and I32
+ * respectively, so that content matches dtype set for those precisions.
+ */
+void serializeBlobContent(
+    tensorflow::TensorProto& proto,
+    const InferenceEngine::Precision& precision,
+    const InferenceEngine::Blob::Ptr& blob);
+
 Status serializeBlobToTensorProto(
     tensorflow::TensorProto& responseOutput,
     const std::shared_ptr<TensorInfo>& networkOutput,
     InferenceEngine::Blob::Ptr blob);
 
+// Suffix of the additional output holding indices of values selected by top_k post-processing
+const std::string TOP_K_INDICES_SUFFIX = "_indices";
+
+/**
+ * @brief Serializes result of post-processing configured for networkOutput instead of the raw blob.
+ * top_k produces values of shape [..., k] and their indices under name suffixed with TOP_K_INDICES_SUFFIX,
+ * argmax produces indices with the last dimension removed and detections keep DetectionOutput layout
+ * with the number of detections reduced to the selected ones.
+ */
+Status serializePostProcessedOutput(
+    tensorflow::serving::PredictResponse& response,
+    const std::shared_ptr<TensorInfo>& networkOutput,
+    const InferenceEngine::Blob::Ptr& blob);
+
+/**
+ * @brief Describes outputs as they are serialized to responses, with post-processing configured for them applied.
+ * Number of detections is reported as its upper limit equal to the number of detections produced by the network.
+ */
+tensor_map_t getPostProcessedOutputsInfo(const tensor_map_t& outputsInfo);
+
 Status serializePredictResponse(
     InferenceEngine::InferRequest& inferRequest,
     const tensor_map_t& outputMap,
@@ -0,0 +1,93 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "servableregistry.hpp"
+
+#include <utility>
+
+#include "modelinstance.hpp"
+
+namespace ovms {
+
+// Generations are unique across registries, so cache of one registry is never taken for another one's
+static std::atomic<uint64_t> nextGeneration{1};
+
+ServableRegistry::ServableRegistry() {
+    auto empty = std::make_shared<Snapshot>();
+    empty->generation = nextGeneration.fetch_add(1);
+    currentGeneration.store(empty->generation, std::memory_order_release);
+    snapshot = std::move(empty);
+}
+
+void ServableRegistry::publish(servables_t servables) {
+    auto next = std::make_shared<Snapshot>();
+    next->generation = nextGeneration.fetch_add(1);
+    next->servables = std::move(servables);
+    const uint64_t generation = next->generation;
+    std::atomic_store(&snapshot, std::shared_ptr<const Snapshot>(std::move(next)));
+    currentGeneration.store(generation, std::memory_order_release);
+}
+
+const ServableRegistry::Snapshot& ServableRegistry::current() const {
+    thread_local std::shared_ptr<const Snapshot> cached;
+    // Generation is stored after the snapshot, so a reader seeing it loads that snapshot or a newer one
+    if (!cached || cached->generation != currentGeneration.load(std::memory_order_acquire)) {
+        cached = std::atomic_load(&snapshot);
+    }
+    return *cached;
+}
+
+const ServableEntry* ServableRegistry::find(const std::string& name) const {
+    const auto& servables = current().servables;
+    auto it = servables.find(name);
+    return it != servables.end() ? &it->second : nullptr;
+}
+
+Status ServableRegistry::findModelInstance(const std::string& name, model_version_t version, std::shared_ptr<ModelInstance>& instance) const {
+    const ServableEntry* entry = find(name);
+    if (entry == nullptr || !entry->isModel) {
+        return StatusCode::MODEL_NAME_MISSING;
+    }
+    if (version == 0) {
+        instance = entry->defaultInstance;
+    } else {
+        auto it = entry->versions.find(version);
+        instance = it != entry->versions.end() ? it->second : nullptr;
+    }
+    if (instance == nullptr) {
+        return StatusCode::MODEL_VERSION_MISSING;
+    }
+    return StatusCode::OK;
+}
+
+bool ServableRegistry::modelExists(const std::string& name) const {
+    const ServableEntry* entry = find(name);
+    return entry != nullptr && entry->isModel;
+}
+
+bool ServableRegistry::pipelineDefinitionExists(const std::string& name) const {
+    return findPipelineDefinition(name) != nullptr;
+}
+
+PipelineDefinition* ServableRegistry::findPipelineDefinition(const std::string& name) const {
+    const ServableEntry* entry = find(name);
+    return entry != nullptr ? entry->pipelineDefinition : nullptr;
+}
+
+size_t ServableRegistry::getServablesCount() const {
+    return current().servables.size();
+}
+
+}  // namespace ovms
@@ -0,0 +1,95 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "model_version_policy.hpp"
+#include "status.hpp"
+
+namespace ovms {
+
+class ModelInstance;
+class PipelineDefinition;
+
+/**
+ * @brief Servable as seen by request path: instances of model versions or pipeline definition
+ */
+struct ServableEntry {
+    bool isModel = false;
+    std::shared_ptr<ModelInstance> defaultInstance;
+    std::unordered_map<model_version_t, std::shared_ptr<ModelInstance>> versions;
+    PipelineDefinition* pipelineDefinition = nullptr;
+};
+
+/**
+ * @brief Read-copy-update registry of servables used by request path.
+ * Management code keeps authoritative collections and publishes an immutable snapshot after each change.
+ * Readers keep the last snapshot in thread local cache and only compare its generation with the current one,
+ * so that lookups take no locks and do not touch reference counters shared between threads.
+ * Snapshot no longer current is released when all threads which used it make their next lookup.
+ */
+class ServableRegistry {
+public:
+    using servables_t = std::unordered_map<std::string, ServableEntry>;
+
+    ServableRegistry();
+
+    /**
+     * @brief Replaces current snapshot, calls have to be serialized by the caller
+     */
+    void publish(servables_t servables);
+
+    /**
+     * @brief Finds instance of model version or default one when version is 0
+     *
+     * @return MODEL_NAME_MISSING when there is no such model, MODEL_VERSION_MISSING when there is no such version
+     */
+    Status findModelInstance(const std::string& name, model_version_t version, std::shared_ptr<ModelInstance>& instance) const;
+
+    bool modelExists(const std::string& name) const;
+
+    bool pipelineDefinitionExists(const std::string& name) const;
+
+    /**
+     * @brief Finds pipeline definition, definitions are never deleted so the pointer stays valid
+     */
+    PipelineDefinition* findPipelineDefinition(const std::string& name) const;
+
+    size_t getServablesCount() const;
+
+private:
+    struct Snapshot {
+        uint64_t generation;
+        servables_t servables;
+    };
+
+    /**
+     * @brief Returns snapshot valid until next lookup made by the calling thread
+     */
+    const Snapshot& current() const;
+
+    const ServableEntry* find(const std::string& name) const;
+
+    std::shared_ptr<const Snapshot> snapshot;
+    std::atomic<uint64_t> currentGeneration;
+};
+
+}  // namespace ovms
@@ -29,13 +29,17 @@
 #include <sys/socket.h>
 #include <unistd.h>
 
+#include "capture.hpp"
 #include "config.hpp"
 #include "http_server.hpp"
 #include "logging.hpp"
 #include "model_service.hpp"
 #include "modelmanager.hpp"
 #include "prediction_service.hpp"
+#include "priorityscheduler.hpp"
+#include "shared_memory.hpp"
 #include "stringutils.hpp"
+#include "tracing.hpp"
 
 using grpc::Server;
 using grpc::ServerBuilder;
@@ -115,12 +119,24 @@ void logConfig(Config& config) {
         SPDLOG_DEBUG("config_path: {}", config.configPath());
     }
     SPDLOG_DEBUG("gRPC port: {}", config.port());
+    SPDLOG_DEBUG("gRPC unix socket path: {}", config.grpcUnixSocketPath());
     SPDLOG_DEBUG("REST port: {}", config.restPort());
+    SPDLOG_DEBUG("REST unix socket path: {}", config.restUnixSocketPath());
     SPDLOG_DEBUG("REST workers: {}", config.restWorkers());
     SPDLOG_DEBUG("gRPC workers: {}", config.grpcWorkers());
     SPDLOG_DEBUG("gRPC channel arguments: {}", config.grpcChannelArguments());
     SPDLOG_DEBUG("log level: {}", config.logLevel());
     SPDLOG_DEBUG("log path: {}", config.logPath());
+    SPDLOG_DEBUG("log async queue size: {}", config.logAsyncQueueSize());
+    SPDLOG_DEBUG("access log path: {}", config.accessLogPath());
+    SPDLOG_DEBUG("shared memory key prefix: {}", config.sharedMemoryKeyPrefix());
+    SPDLOG_DEBUG("inference slots: {}", config.inferenceSlots());
+    SPDLOG_DEBUG("trace buffer size: {}", config.traceBufferSize());
+    SPDLOG_DEBUG("trace sampling interval: {}", config.traceSamplingInterval());
+    SPDLOG_DEBUG("capture path: {}", config.capturePath());
+    SPDLOG_DEBUG("capture sampling interval: {}", config.captureSamplingInterval());
+    SPDLOG_DEBUG("capture queue size: {}", config.captureQueueSize());
+    SPDLOG_DEBUG("capture queue size mb: {}", config.captureQueueSizeMb());
 }
 
 void onInterrupt(int status) {
@@ -155,31 +171,15 @@ void installSignalHandlers() {
     sigaction(SIGILL, &sigIllHandler, NULL);
 }
 
-std::vector<std::unique_ptr<Server>> startGRPCServer(
+void configureGRPCServerBuilder(
+    ServerBuilder& builder,
     PredictionServiceImpl& predict_service,
-    ModelServiceImpl& model_service) {
+    ModelServiceImpl& model_service,
+    const std::vector<GrpcChannelArgument>& channel_arguments) {
     const int GIGABYTE = 1024 * 1024 * 1024;
 
-    std::vector<GrpcChannelArgument> channel_arguments;
-    auto& config = ovms::Config::instance();
-    auto status = parseGrpcChannelArgs(config.grpcChannelArguments(), channel_arguments);
-    if (!status.ok()) {
-        SPDLOG_ERROR("grpc channel arguments passed in wrong format: {}", config.grpcChannelArguments());
-        exit(1);
-    }
-
-    logConfig(config);
-    auto& manager = ModelManager::getInstance();
-    status = manager.start();
-    if (!status.ok()) {
-        SPDLOG_ERROR("ovms::ModelManager::Start() Error: {}", status.string());
-        exit(1);
-    }
-
-    ServerBuilder builder;
     builder.SetMaxReceiveMessageSize(GIGABYTE);
     builder.SetMaxSendMessageSize(GIGABYTE);
-    builder.AddListeningPort(config.grpcBindAddress() + ":" + std::to_string(config.port()), grpc::InsecureServerCredentials());
     builder.RegisterService(&predict_service);
     builder.RegisterService(&model_service);
     for (const GrpcChannelArgument& channel_argument : channel_arguments) {
@@ -196,10 +196,45 @@ std::vector<std::unique_ptr<Server>> startGRPCServer(
             SPDLOG_WARN("Out of range parameter {} : {}", channel_argument.key, channel_argument.value);
         }
     }
+}
+
+std::vector<std::unique_ptr<Server>> startGRPCServer(
+    PredictionServiceImpl& predict_service,
+    ModelServiceImpl& model_service) {
+    std::vector<GrpcChannelArgument> channel_arguments;
+    auto& config = ovms::Config::instance();
+    auto status = parseGrpcChannelArgs(config.grpcChannelArguments(), channel_arguments);
+    if (!status.ok()) {
+        SPDLOG_ERROR("grpc channel arguments passed in wrong format: {}", config.grpcChannelArguments());
+        exit(1);
+    }
+
+    logConfig(config);
+    SharedMemoryManager::getInstance().setAllowedKeyPrefix(config.sharedMemoryKeyPrefix());
+    PriorityScheduler::getInstance().setSlots(config.inferenceSlots());
+    Tracer::getInstance().configure(config.traceBufferSize(), config.traceSamplingInterval());
+    if (!config.capturePath().empty()) {
+        status = TrafficCapture::getInstance().start(config.capturePath(), config.captureSamplingInterval(), config.captureQueueSize(),
+            static_cast<size_t>(config.captureQueueSizeMb()) * 1024 * 1024);
+        if (!status.ok()) {
+            SPDLOG_ERROR("Failed to start traffic capture: {}", status.string());
+            exit(1);
+        }
+    }
+    auto& manager = ModelManager::getInstance();
+    status = manager.start();
+    if (!status.ok()) {
+        SPDLOG_ERROR("ovms::ModelManager::Start() Error: {}", status.string());
+        exit(1);
+    }
+
+    ServerBuilder builder;
+    builder.AddListeningPort(config.grpcBindAddress() + ":" + std::to_string(config.port()), grpc::InsecureServerCredentials());
+    configureGRPCServerBuilder(builder, predict_service, model_service, channel_arguments);
 
     std::vector<std::unique_ptr<Server>> servers;
     uint grpcServersCount = getGRPCServersCount();
-    servers.reserve(grpcServersCount);
+    servers.reserve(grpcServersCount + 1);
     SPDLOG_DEBUG("Starting grpc servers: {}", grpcServersCount);
 
     if (!isPortAvailable(config.port())) {
@@ -214,6 +249,21 @@ std::vector<std::unique_ptr<Server>> startGRPCServer(
     }
     SPDLOG_INFO("Server started on port {}", config.port());
 
+    if (!config.grpcUnixSocketPath().empty()) {
+        // Unix domain socket cannot be shared by several servers like TCP port with SO_REUSEPORT,
+        // so it is served by a dedicated one
+        const std::string unixSocketAddress = "unix:" + config.grpcUnixSocketPath();
+        ServerBuilder unixSocketBuilder;
+        unixSocketBuilder.AddListeningPort(unixSocketAddress, grpc::InsecureServerCredentials());
+        configureGRPCServerBuilder(unixSocketBuilder, predict_service, model_service, channel_arguments);
+        std::unique_ptr<Server> server = unixSocketBuilder.BuildAndStart();
+        if (server == nullptr) {
+            throw std::runtime_error("Failed to start GRPC server at " + unixSocketAddress);
+        }
+        servers.push_back(std::move(server));
+        SPDLOG_INFO("Server started on unix socket {}", config.grpcUnixSocketPath());
+    }
+
     return servers;
 }
 
@@ -227,9 +277,12 @@ std::unique_ptr<ovms::http_server> startRESTServer() {
         int workers = config.restWorkers() ? config.restWorkers() : 10;
         SPDLOG_INFO("Will start {} REST workers", workers);
 
-        std::unique_ptr<ovms::http_server> restServer = ovms::createAndStartHttpServer(config.restBindAddress(), config.restPort(), workers, REST_TIMEOUT);
+        std::unique_ptr<ovms::http_server> restServer = ovms::createAndStartHttpServer(config.restBindAddress(), config.restPort(), workers, REST_TIMEOUT, config.restUnixSocketPath());
         if (restServer != nullptr) {
             SPDLOG_INFO("Started REST server at {}", server_address);
+            if (!config.restUnixSocketPath().empty()) {
+                SPDLOG_INFO("Started REST server at unix socket {}", config.restUnixSocketPath());
+            }
         } else {
             throw std::runtime_error("Failed to start REST server at " + server_address);
         }
@@ -244,7 +297,7 @@ int server_main(int argc, char** argv) {
     installSignalHandlers();
     try {
         auto& config = ovms::Config::instance().parse(argc, argv);
-        configure_logger(config.logLevel(), config.logPath());
+        configure_logger(config.logLevel(), config.logPath(), config.logAsyncQueueSize(), config.accessLogPath());
 
         PredictionServiceImpl predict_service;
         ModelServiceImpl model_service;
@@ -266,6 +319,7 @@ int server_main(int argc, char** argv) {
         if (rest != nullptr) {
             rest->Terminate();
         }
+        TrafficCapture::getInstance().stop();
 
         ModelManager::getInstance().join();
     } catch (std::exception& e) {
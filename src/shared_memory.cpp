@@ -0,0 +1,268 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "shared_memory.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <mutex>
+#include <sstream>
+
+#include <spdlog/spdlog.h>
+
+namespace ovms {
+
+const std::string SHARED_MEMORY_DEVICE = "/ovms:shared_memory";
+const std::string DEFAULT_SHARED_MEMORY_KEY_PREFIX = "/ovms_";
+
+bool isSharedMemoryReference(const tensorflow::TensorProto& proto) {
+    return proto.resource_handle_val_size() == 1 &&
+           proto.resource_handle_val(0).device() == SHARED_MEMORY_DEVICE;
+}
+
+SharedMemoryRegion::~SharedMemoryRegion() {
+    if (mapping != nullptr) {
+        munmap(mapping, mappingSize);
+    }
+}
+
+Status SharedMemoryRegion::map() {
+    int fd = shm_open(key.c_str(), O_RDWR, 0);
+    if (fd == -1) {
+        SPDLOG_ERROR("Could not open shared memory segment: {} for region: {}", key, name);
+        return StatusCode::SHARED_MEMORY_REGION_MAPPING_FAILED;
+    }
+    struct stat segmentStat;
+    if (fstat(fd, &segmentStat) == -1 ||
+        offset > static_cast<size_t>(segmentStat.st_size) ||
+        byteSize > static_cast<size_t>(segmentStat.st_size) - offset) {
+        close(fd);
+        std::stringstream ss;
+        ss << "Segment: " << key << " is smaller than requested offset: " << offset << " and size: " << byteSize;
+        const std::string details = ss.str();
+        SPDLOG_ERROR(details);
+        return Status(StatusCode::SHARED_MEMORY_REGION_OUT_OF_BOUNDS, details);
+    }
+    // mmap offset has to be page aligned, map from segment start and apply offset on access
+    mappingSize = offset + byteSize;
+    void* address = mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (address == MAP_FAILED) {
+        SPDLOG_ERROR("Could not map shared memory segment: {} for region: {}", key, name);
+        return StatusCode::SHARED_MEMORY_REGION_MAPPING_FAILED;
+    }
+    mapping = address;
+    return StatusCode::OK;
+}
+
+Status SharedMemoryRegion::getAddress(size_t dataOffset, size_t dataByteSize, void*& address) const {
+    if (dataOffset > byteSize || dataByteSize > byteSize - dataOffset) {
+        std::stringstream ss;
+        ss << "Region: " << name << " size: " << byteSize << "; Requested offset: " << dataOffset << " size: " << dataByteSize;
+        const std::string details = ss.str();
+        SPDLOG_DEBUG(details);
+        return Status(StatusCode::SHARED_MEMORY_REGION_OUT_OF_BOUNDS, details);
+    }
+    address = static_cast<char*>(mapping) + offset + dataOffset;
+    return StatusCode::OK;
+}
+
+void SharedMemoryManager::setAllowedKeyPrefix(const std::string& prefix) {
+    std::unique_lock lock(regionsMtx);
+    allowedKeyPrefix = prefix;
+}
+
+bool SharedMemoryManager::isKeyAllowed(const std::string& key) const {
+    // Segment names have a single leading slash, other ones would be resolved outside of the shared memory directory
+    return key.size() > allowedKeyPrefix.size() &&
+           key.compare(0, allowedKeyPrefix.size(), allowedKeyPrefix) == 0 &&
+           key[0] == '/' &&
+           key.find('/', 1) == std::string::npos;
+}
+
+Status SharedMemoryManager::registerRegion(const std::string& name, const std::string& key, size_t offset, size_t byteSize) {
+    std::unique_lock lock(regionsMtx);
+    if (!isKeyAllowed(key)) {
+        SPDLOG_WARN("Shared memory segment: {} requested for region: {} does not match allowed prefix: {}", key, name, allowedKeyPrefix);
+        return Status(StatusCode::SHARED_MEMORY_KEY_NOT_ALLOWED, key);
+    }
+    if (regions.count(name)) {
+        SPDLOG_WARN("Shared memory region: {} is already registered", name);
+        return StatusCode::SHARED_MEMORY_REGION_ALREADY_EXISTS;
+    }
+    auto region = std::make_shared<SharedMemoryRegion>(name, key, offset, byteSize);
+    auto status = region->map();
+    if (!status.ok()) {
+        return status;
+    }
+    regions.emplace(name, std::move(region));
+    SPDLOG_INFO("Registered shared memory region: {}; key: {}; offset: {}; size: {}", name, key, offset, byteSize);
+    return StatusCode::OK;
+}
+
+Status SharedMemoryManager::unregisterRegion(const std::string& name) {
+    std::unique_lock lock(regionsMtx);
+    // Region is unmapped when the last blob using it is released
+    if (regions.erase(name) == 0) {
+        return StatusCode::SHARED_MEMORY_REGION_MISSING;
+    }
+    SPDLOG_INFO("Unregistered shared memory region: {}", name);
+    return StatusCode::OK;
+}
+
+std::shared_ptr<const SharedMemoryRegion> SharedMemoryManager::findRegionByName(const std::string& name) const {
+    std::shared_lock lock(regionsMtx);
+    auto it = regions.find(name);
+    if (it == regions.end()) {
+        return nullptr;
+    }
+    return it->second;
+}
+
+template <typename T>
+static InferenceEngine::Blob::Ptr makeSharedMemoryBlob(const std::shared_ptr<TensorInfo>& tensorInfo, void* address, size_t byteSize,
+    const std::shared_ptr<const SharedMemoryRegion>& region) {
+    return std::make_shared<SharedMemoryBlob<T>>(tensorInfo->getTensorDesc(), static_cast<T*>(address), byteSize / sizeof(T), region);
+}
+
+Status SharedMemoryManager::createBlob(const tensorflow::TensorProto& proto, const std::shared_ptr<TensorInfo>& tensorInfo, InferenceEngine::Blob::Ptr& blob) const {
+    const auto& handle = proto.resource_handle_val(0);
+    auto region = findRegionByName(handle.container());
+    if (!region) {
+        SPDLOG_DEBUG("Shared memory region: {} referenced by tensor: {} is not registered", handle.container(), tensorInfo->getMappedName());
+        return Status(StatusCode::SHARED_MEMORY_REGION_MISSING, handle.container());
+    }
+
+    size_t byteSize = tensorInfo->getPrecision().size();
+    for (int i = 0; i < proto.tensor_shape().dim_size(); i++) {
+        byteSize *= proto.tensor_shape().dim(i).size();
+    }
+    void* address = nullptr;
+    auto status = region->getAddress(handle.hash_code(), byteSize, address);
+    if (!status.ok()) {
+        return status;
+    }
+
+    switch (tensorInfo->getPrecision()) {
+    case InferenceEngine::Precision::FP32:
+        blob = makeSharedMemoryBlob<float>(tensorInfo, address, byteSize, region);
+        break;
+    case InferenceEngine::Precision::FP16:
+    case InferenceEngine::Precision::U16:
+        // Data in shared memory is not zero padded as in tensor proto _val containers
+        blob = makeSharedMemoryBlob<uint16_t>(tensorInfo, address, byteSize, region);
+        break;
+    case InferenceEngine::Precision::U8:
+        blob = makeSharedMemoryBlob<uint8_t>(tensorInfo, address, byteSize, region);
+        break;
+    case InferenceEngine::Precision::I8:
+        blob = makeSharedMemoryBlob<int8_t>(tensorInfo, address, byteSize, region);
+        break;
+    case InferenceEngine::Precision::I16:
+        blob = makeSharedMemoryBlob<int16_t>(tensorInfo, address, byteSize, region);
+        break;
+    case InferenceEngine::Precision::I32:
+        blob = makeSharedMemoryBlob<int32_t>(tensorInfo, address, byteSize, region);
+        break;
+    case InferenceEngine::Precision::I64:
+        blob = makeSharedMemoryBlob<int64_t>(tensorInfo, address, byteSize, region);
+        break;
+    default:
+        blob = nullptr;
+        return StatusCode::OV_UNSUPPORTED_DESERIALIZATION_PRECISION;
+    }
+    return StatusCode::OK;
+}
+
+bool hasSharedMemoryOutputs(const tensorflow::serving::PredictRequest& request, const tensor_map_t& outputsInfo) {
+    for (const auto& [name, proto] : request.inputs()) {
+        if (outputsInfo.count(name) && isSharedMemoryReference(proto)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void splitSharedMemoryOutputs(const tensorflow::serving::PredictRequest& request,
+    const tensor_map_t& outputsInfo,
+    tensorflow::serving::PredictRequest& inputsRequest,
+    std::map<std::string, tensorflow::TensorProto>& destinations) {
+    *inputsRequest.mutable_model_spec() = request.model_spec();
+    *inputsRequest.mutable_output_filter() = request.output_filter();
+    for (const auto& [name, proto] : request.inputs()) {
+        if (outputsInfo.count(name) && isSharedMemoryReference(proto)) {
+            destinations.emplace(name, proto);
+        } else {
+            (*inputsRequest.mutable_inputs())[name] = proto;
+        }
+    }
+}
+
+SharedMemoryOutputsGuard::~SharedMemoryOutputsGuard() {
+    for (auto& [name, blob] : originalBlobs) {
+        try {
+            inferRequest.SetBlob(name, blob);
+        } catch (const InferenceEngine::details::InferenceEngineException& e) {
+            SPDLOG_ERROR("Could not restore output blob: {} after shared memory inference: {}", name, e.what());
+        }
+    }
+}
+
+Status SharedMemoryOutputsGuard::bind(const tensor_map_t& outputsInfo, const std::map<std::string, tensorflow::TensorProto>& destinations) {
+    for (const auto& [mappedName, destination] : destinations) {
+        const auto& networkOutput = outputsInfo.at(mappedName);
+        const auto& shape = networkOutput->getShape();
+        bool shapeMatches = shape.size() == static_cast<size_t>(destination.tensor_shape().dim_size());
+        for (int i = 0; shapeMatches && i < destination.tensor_shape().dim_size(); i++) {
+            shapeMatches = shape[i] == static_cast<size_t>(destination.tensor_shape().dim(i).size());
+        }
+        if (!shapeMatches) {
+            std::stringstream ss;
+            ss << "Output: " << mappedName << " Expected: " << TensorInfo::shapeToString(shape)
+               << "; Actual: " << TensorInfo::tensorShapeToString(destination.tensor_shape());
+            const std::string details = ss.str();
+            SPDLOG_DEBUG("Invalid shared memory output shape - {}", details);
+            return Status(StatusCode::INVALID_SHAPE, details);
+        }
+        InferenceEngine::Blob::Ptr blob;
+        auto status = SharedMemoryManager::getInstance().createBlob(destination, networkOutput, blob);
+        if (!status.ok()) {
+            return status;
+        }
+        try {
+            originalBlobs.emplace_back(networkOutput->getName(), inferRequest.GetBlob(networkOutput->getName()));
+            inferRequest.SetBlob(networkOutput->getName(), blob);
+        } catch (const InferenceEngine::details::InferenceEngineException& e) {
+            status = StatusCode::OV_INTERNAL_DESERIALIZATION_ERROR;
+            SPDLOG_DEBUG("{}: {}", status.string(), e.what());
+            return status;
+        }
+    }
+    return StatusCode::OK;
+}
+
+void serializeSharedMemoryReference(tensorflow::TensorProto& responseOutput,
+    const std::shared_ptr<TensorInfo>& networkOutput,
+    const tensorflow::TensorProto& destination) {
+    responseOutput.Clear();
+    responseOutput.set_dtype(networkOutput->getPrecisionAsDataType());
+    *responseOutput.mutable_tensor_shape() = destination.tensor_shape();
+    *responseOutput.add_resource_handle_val() = destination.resource_handle_val(0);
+}
+
+}  // namespace ovms
@@ -0,0 +1,205 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <inference_engine.hpp>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wall"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow_serving/apis/prediction_service.grpc.pb.h"
+#pragma GCC diagnostic pop
+
+#include "status.hpp"
+#include "tensorinfo.hpp"
+
+namespace ovms {
+
+/**
+ * Tensor proto referring to shared memory instead of carrying the data has exactly one
+ * resource_handle_val entry with:
+ *  - device set to SHARED_MEMORY_DEVICE,
+ *  - container set to the name of registered region,
+ *  - hash_code set to the byte offset of tensor data within that region.
+ * Byte size of the data is implied by tensor shape and precision.
+ */
+extern const std::string SHARED_MEMORY_DEVICE;
+
+extern const std::string DEFAULT_SHARED_MEMORY_KEY_PREFIX;
+
+bool isSharedMemoryReference(const tensorflow::TensorProto& proto);
+
+/**
+ * @brief POSIX shared memory segment (or its part) registered by a co-located client
+ */
+class SharedMemoryRegion {
+public:
+    SharedMemoryRegion(const std::string& name, const std::string& key, size_t offset, size_t byteSize) :
+        name(name),
+        key(key),
+        offset(offset),
+        byteSize(byteSize) {}
+
+    ~SharedMemoryRegion();
+
+    SharedMemoryRegion(const SharedMemoryRegion&) = delete;
+    SharedMemoryRegion& operator=(const SharedMemoryRegion&) = delete;
+
+    /**
+     * @brief Opens the segment and maps it into server address space
+     *
+     * @return Status
+     */
+    Status map();
+
+    /**
+     * @brief Gets address of data placed at offset within the region
+     *
+     * @param dataOffset offset relative to the region start
+     * @param dataByteSize size of the data
+     * @param address out
+     *
+     * @return Status
+     */
+    Status getAddress(size_t dataOffset, size_t dataByteSize, void*& address) const;
+
+    const std::string& getName() const {
+        return name;
+    }
+
+    const std::string& getKey() const {
+        return key;
+    }
+
+    size_t getOffset() const {
+        return offset;
+    }
+
+    size_t getByteSize() const {
+        return byteSize;
+    }
+
+private:
+    const std::string name;
+    const std::string key;
+    const size_t offset;
+    const size_t byteSize;
+
+    void* mapping = nullptr;
+    size_t mappingSize = 0;
+};
+
+/**
+ * @brief Blob wrapping shared memory, keeps the region mapped for as long as it is used
+ */
+template <typename T>
+class SharedMemoryBlob : public InferenceEngine::TBlob<T> {
+public:
+    SharedMemoryBlob(const InferenceEngine::TensorDesc& tensorDesc, T* ptr, size_t size, std::shared_ptr<const SharedMemoryRegion> region) :
+        InferenceEngine::TBlob<T>(tensorDesc, ptr, size),
+        region(std::move(region)) {}
+
+private:
+    std::shared_ptr<const SharedMemoryRegion> region;
+};
+
+class SharedMemoryManager {
+public:
+    static SharedMemoryManager& getInstance() {
+        static SharedMemoryManager instance;
+        return instance;
+    }
+
+    /**
+     * @brief Segments are mapped for reading and writing on request of any client reaching the REST API,
+     * so only segments named with this prefix can be registered
+     */
+    void setAllowedKeyPrefix(const std::string& prefix);
+
+    Status registerRegion(const std::string& name, const std::string& key, size_t offset, size_t byteSize);
+
+    Status unregisterRegion(const std::string& name);
+
+    std::shared_ptr<const SharedMemoryRegion> findRegionByName(const std::string& name) const;
+
+    /**
+     * @brief Wraps shared memory referenced by tensor proto into a blob without copying
+     *
+     * @param proto tensor proto with shared memory reference
+     * @param tensorInfo network tensor description
+     * @param blob out
+     *
+     * @return Status
+     */
+    Status createBlob(const tensorflow::TensorProto& proto, const std::shared_ptr<TensorInfo>& tensorInfo, InferenceEngine::Blob::Ptr& blob) const;
+
+private:
+    SharedMemoryManager() = default;
+
+    bool isKeyAllowed(const std::string& key) const;
+
+    std::string allowedKeyPrefix = DEFAULT_SHARED_MEMORY_KEY_PREFIX;
+    std::map<std::string, std::shared_ptr<const SharedMemoryRegion>> regions;
+    mutable std::shared_mutex regionsMtx;
+};
+
+/**
+ * @brief Checks if request contains shared memory destinations for model outputs.
+ * Destination is passed as an entry in request inputs keyed with model output name.
+ */
+bool hasSharedMemoryOutputs(const tensorflow::serving::PredictRequest& request, const tensor_map_t& outputsInfo);
+
+/**
+ * @brief Splits request into inputs only request and shared memory output destinations
+ */
+void splitSharedMemoryOutputs(const tensorflow::serving::PredictRequest& request,
+    const tensor_map_t& outputsInfo,
+    tensorflow::serving::PredictRequest& inputsRequest,
+    std::map<std::string, tensorflow::TensorProto>& destinations);
+
+/**
+ * @brief Binds shared memory blobs as infer request outputs so inference writes directly into them.
+ * Original output blobs are restored on destruction since infer requests are reused.
+ */
+class SharedMemoryOutputsGuard {
+public:
+    SharedMemoryOutputsGuard(InferenceEngine::InferRequest& inferRequest) :
+        inferRequest(inferRequest) {}
+
+    ~SharedMemoryOutputsGuard();
+
+    Status bind(const tensor_map_t& outputsInfo, const std::map<std::string, tensorflow::TensorProto>& destinations);
+
+private:
+    InferenceEngine::InferRequest& inferRequest;
+    std::vector<std::pair<std::string, InferenceEngine::Blob::Ptr>> originalBlobs;
+};
+
+/**
+ * @brief Fills response output with shared memory reference instead of the data
+ */
+void serializeSharedMemoryReference(tensorflow::TensorProto& responseOutput,
+    const std::shared_ptr<TensorInfo>& networkOutput,
+    const tensorflow::TensorProto& destination);
+
+}  // namespace ovms
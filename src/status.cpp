@@ -44,8 +44,10 @@ const std::map<const StatusCode, const std::string> Status::statusMessageMap = {
     {StatusCode::MODEL_SPEC_MISSING, "model_spec missing in request"},
     {StatusCode::INVALID_SIGNATURE_DEF, "Invalid signature name"},
     {StatusCode::CONFIG_SHAPE_IS_NOT_IN_NETWORK, "Shape from config not found in network"},
+    {StatusCode::POST_PROCESSING_NOT_SUPPORTED, "Post-processing from config not supported for network output"},
     {StatusCode::INVALID_NIREQ, "Nireq parameter too high"},
     {StatusCode::REQUESTED_DYNAMIC_PARAMETERS_ON_SUBSCRIBED_MODEL, "Requested dynamic parameters but model is subscribed to pipeline"},
+    {StatusCode::REQUESTED_DYNAMIC_PARAMETERS_ON_STATEFUL_MODEL, "Requested dynamic parameters but model is stateful"},
     {StatusCode::PIPELINE_STREAM_ID_NOT_READY_YET, "Node is not ready for execution"},
 
     // Predict request validation
@@ -57,6 +59,9 @@ const std::map<const StatusCode, const std::string> Status::statusMessageMap = {
     {StatusCode::INVALID_PRECISION, "Invalid input precision"},
     {StatusCode::INVALID_VALUE_COUNT, "Invalid number of values in tensor proto container"},
     {StatusCode::INVALID_CONTENT_SIZE, "Invalid content size of tensor proto"},
+    {StatusCode::IMAGE_PARSING_FAILED, "Image parsing failed"},
+    {StatusCode::BINARY_INPUT_NOT_IMAGE, "Binary input is supported only for 4 dimensional image inputs"},
+    {StatusCode::INVALID_OUTPUT_FILTER, "Output filter contains name of output which does not exist"},
 
     // Deserialization
     {StatusCode::OV_UNSUPPORTED_DESERIALIZATION_PRECISION, "Unsupported deserialization precision"},
@@ -64,6 +69,19 @@ const std::map<const StatusCode, const std::string> Status::statusMessageMap = {
 
     // Inference
     {StatusCode::OV_INTERNAL_INFERENCE_ERROR, "Internal inference error"},
+    {StatusCode::INFER_QUEUE_FULL, "Model is overloaded, queue of requests waiting for inference is full"},
+    {StatusCode::INFER_QUEUE_TIMEOUT, "Model is overloaded, request waited for inference longer than allowed"},
+    {StatusCode::DEADLINE_EXCEEDED, "Deadline of the request passed before inference was started"},
+    {StatusCode::REQUEST_CANCELLED, "Request was cancelled before inference was started"},
+    {StatusCode::INVALID_PRIORITY_CLASS, "Invalid priority class, expected one of: high, normal, low"},
+
+    // Sequence
+    {StatusCode::SEQUENCE_MISSING, "Sequence with provided ID does not exist"},
+    {StatusCode::SEQUENCE_ALREADY_EXISTS, "Sequence with provided ID already exists"},
+    {StatusCode::SEQUENCE_ID_NOT_PROVIDED, "Sequence ID has not been provided in request inputs"},
+    {StatusCode::SEQUENCE_TERMINATED, "Sequence has been ended or evicted"},
+    {StatusCode::INVALID_SEQUENCE_CONTROL_INPUT, "Unexpected value of sequence control input"},
+    {StatusCode::MAX_SEQUENCE_NUMBER_REACHED, "Max sequence number has been reached. Could not create new sequence"},
 
     // Serialization
     {StatusCode::OV_UNSUPPORTED_SERIALIZATION_PRECISION, "Unsupported serialization precision"},
@@ -75,6 +93,8 @@ const std::map<const StatusCode, const std::string> Status::statusMessageMap = {
     // Rest handler failure
     {StatusCode::REST_INVALID_URL, "Invalid request URL"},
     {StatusCode::REST_UNSUPPORTED_METHOD, "Unsupported method"},
+    {StatusCode::REST_MALFORMED_REQUEST, "Malformed request"},
+    {StatusCode::REST_TRACING_DISABLED, "Tracing is disabled, set trace_buffer_size to enable it"},
 
     // Rest parser failure
     {StatusCode::REST_BODY_IS_NOT_AN_OBJECT, "Request body should be JSON object"},
@@ -89,6 +109,7 @@ const std::map<const StatusCode, const std::string> Status::statusMessageMap = {
     {StatusCode::REST_INPUTS_NOT_AN_OBJECT, "Invalid JSON structure. One of inputs is not a JSON object."},
     {StatusCode::REST_NO_INPUTS_FOUND, "Invalid JSON structure. Missing inputs in column format"},
     {StatusCode::REST_COULD_NOT_PARSE_INPUT, "Could not parse input content. Not valid ndarray detected"},
+    {StatusCode::REST_OUTPUT_FILTER_NOT_AN_ARRAY, "Invalid JSON structure. Output filter is not an array of strings"},
     {StatusCode::REST_PROTO_TO_STRING_ERROR, "Response parsing to JSON error"},
     {StatusCode::REST_UNSUPPORTED_PRECISION, "Could not parse input content. Unsupported data precision detected"},
     {StatusCode::REST_SERIALIZE_TENSOR_CONTENT_INVALID_SIZE, "Tensor serialization error"},
@@ -105,6 +126,7 @@ const std::map<const StatusCode, const std::string> Status::statusMessageMap = {
     {StatusCode::PIPELINE_CONTAINS_UNCONNECTED_NODES, "Pipeline definition has unconnected nodes"},
     {StatusCode::PIPELINE_NODE_REFERING_TO_MISSING_NODE, "Pipeline definition has reference to missing node"},
     {StatusCode::PIPELINE_NODE_REFERING_TO_MISSING_MODEL, "Pipeline definition has reference to missing model"},
+    {StatusCode::PIPELINE_NODE_REFERING_TO_STATEFUL_MODEL, "Pipeline definition has reference to stateful model"},
     {StatusCode::PIPELINE_NODE_REFERING_TO_MISSING_DATA_SOURCE, "Pipeline definition has reference to missing data source"},
     {StatusCode::PIPELINE_NODE_REFERING_TO_MISSING_MODEL_OUTPUT, "Pipeline definition has reference to missing model output"},
     {StatusCode::PIPELINE_CONNECTION_TO_MISSING_MODEL_INPUT, "Pipeline definition has connection to non existing model input"},
@@ -112,6 +134,14 @@ const std::map<const StatusCode, const std::string> Status::statusMessageMap = {
     {StatusCode::PIPELINE_MODEL_INPUT_CONNECTED_TO_MULTIPLE_DATA_SOURCES, "Pipeline definition has multiple connections to the same input of underlying model"},
     {StatusCode::PIPELINE_EXIT_USED_AS_NODE_DEPENDENCY, "Pipeline definition has response node used as dependency node"},
     {StatusCode::PIPELINE_NAME_OCCUPIED, "Pipeline has the same name as model"},
+    {StatusCode::PIPELINE_DEFINITION_INVALID_NODE_LIBRARY, "Pipeline refers to incorrect custom node library"},
+    {StatusCode::PIPELINE_NODE_GATHER_FROM_NOT_DEMULTIPLEXER, "Gathering node refers to node which is not a demultiplexer"},
+    {StatusCode::PIPELINE_DEMULTIPLEXER_NESTING_NOT_SUPPORTED, "Demultiplexed pipeline subgraphs cannot be nested or overlap"},
+    {StatusCode::PIPELINE_WRONG_DEMULTIPLEXER_DIMENSION, "Demultiplexed tensor first dimension exceeds demultiply count or differs between outputs"},
+    {StatusCode::PIPELINE_INCONSISTENT_GATHER_SHAPES, "Gathered tensors have different shapes or precisions"},
+    {StatusCode::PIPELINE_CONDITION_WRONG_PREDICATE, "Unsupported node execution condition predicate"},
+    {StatusCode::PIPELINE_CONDITION_NOT_ON_DEPENDENCY, "Node execution condition refers to node which is not its dependency"},
+    {StatusCode::PIPELINE_CONDITION_UNSUPPORTED_PRECISION, "Node execution condition cannot be evaluated for data item precision"},
 
     // Storage errors
     // S3
@@ -155,6 +185,21 @@ const std::map<const StatusCode, const std::string> Status::statusMessageMap = {
     {StatusCode::CUSTOM_LOADER_NOT_PRESENT, "The custom loader is not present in loaders list"},
     {StatusCode::CUSTOM_LOADER_INIT_FAILED, "Custom Loader LoadInit failed"},
     {StatusCode::CUSTOM_LOADER_ERROR, "Custom Loader Generic / Unknown Error"},
+
+    // Shared memory
+    {StatusCode::SHARED_MEMORY_REGION_ALREADY_EXISTS, "Shared memory region with the same name is already registered"},
+    {StatusCode::SHARED_MEMORY_REGION_MISSING, "Shared memory region is not registered"},
+    {StatusCode::SHARED_MEMORY_REGION_MAPPING_FAILED, "Could not map shared memory region"},
+    {StatusCode::SHARED_MEMORY_REGION_OUT_OF_BOUNDS, "Requested data exceeds shared memory region boundaries"},
+    {StatusCode::SHARED_MEMORY_KEY_NOT_ALLOWED, "Shared memory segment name does not match allowed prefix"},
+
+    // Custom node library
+    {StatusCode::NODE_LIBRARY_LOAD_FAILED_OPEN, "Could not open custom node library"},
+    {StatusCode::NODE_LIBRARY_LOAD_FAILED_SYM, "Custom node library is missing required symbols"},
+    {StatusCode::NODE_LIBRARY_EXECUTION_FAILED, "Custom node execution failed"},
+    {StatusCode::NODE_LIBRARY_OUTPUTS_CORRUPTED, "Custom node returned corrupted outputs"},
+    {StatusCode::NODE_LIBRARY_MISSING_OUTPUT, "Custom node did not return required output"},
+    {StatusCode::NODE_LIBRARY_INVALID_PRECISION, "Tensor precision is not supported by custom node"},
 };
 
 const std::map<const StatusCode, grpc::StatusCode> Status::grpcStatusMap = {
@@ -191,6 +236,9 @@ const std::map<const StatusCode, grpc::StatusCode> Status::grpcStatusMap = {
     {StatusCode::INVALID_PRECISION, grpc::StatusCode::INVALID_ARGUMENT},
     {StatusCode::INVALID_VALUE_COUNT, grpc::StatusCode::INVALID_ARGUMENT},
     {StatusCode::INVALID_CONTENT_SIZE, grpc::StatusCode::INVALID_ARGUMENT},
+    {StatusCode::IMAGE_PARSING_FAILED, grpc::StatusCode::INVALID_ARGUMENT},
+    {StatusCode::BINARY_INPUT_NOT_IMAGE, grpc::StatusCode::INVALID_ARGUMENT},
+    {StatusCode::INVALID_OUTPUT_FILTER, grpc::StatusCode::INVALID_ARGUMENT},
 
     // Deserialization
 
@@ -200,6 +248,19 @@ const std::map<const StatusCode, grpc::StatusCode> Status::grpcStatusMap = {
 
     // Inference
     {StatusCode::OV_INTERNAL_INFERENCE_ERROR, grpc::StatusCode::INTERNAL},
+    {StatusCode::INFER_QUEUE_FULL, grpc::StatusCode::RESOURCE_EXHAUSTED},
+    {StatusCode::INFER_QUEUE_TIMEOUT, grpc::StatusCode::RESOURCE_EXHAUSTED},
+    {StatusCode::DEADLINE_EXCEEDED, grpc::StatusCode::DEADLINE_EXCEEDED},
+    {StatusCode::REQUEST_CANCELLED, grpc::StatusCode::CANCELLED},
+    {StatusCode::INVALID_PRIORITY_CLASS, grpc::StatusCode::INVALID_ARGUMENT},
+
+    // Sequence
+    {StatusCode::SEQUENCE_MISSING, grpc::StatusCode::NOT_FOUND},
+    {StatusCode::SEQUENCE_ALREADY_EXISTS, grpc::StatusCode::ALREADY_EXISTS},
+    {StatusCode::SEQUENCE_ID_NOT_PROVIDED, grpc::StatusCode::INVALID_ARGUMENT},
+    {StatusCode::SEQUENCE_TERMINATED, grpc::StatusCode::FAILED_PRECONDITION},
+    {StatusCode::INVALID_SEQUENCE_CONTROL_INPUT, grpc::StatusCode::INVALID_ARGUMENT},
+    {StatusCode::MAX_SEQUENCE_NUMBER_REACHED, grpc::StatusCode::UNAVAILABLE},
 
     // Serialization
 
@@ -209,6 +270,24 @@ const std::map<const StatusCode, grpc::StatusCode> Status::grpcStatusMap = {
 
     // GetModelStatus
     {StatusCode::INTERNAL_ERROR, grpc::StatusCode::INTERNAL},
+
+    // Shared memory
+    {StatusCode::SHARED_MEMORY_REGION_ALREADY_EXISTS, grpc::StatusCode::ALREADY_EXISTS},
+    {StatusCode::SHARED_MEMORY_REGION_MISSING, grpc::StatusCode::INVALID_ARGUMENT},
+    {StatusCode::SHARED_MEMORY_REGION_MAPPING_FAILED, grpc::StatusCode::INVALID_ARGUMENT},
+    {StatusCode::SHARED_MEMORY_REGION_OUT_OF_BOUNDS, grpc::StatusCode::INVALID_ARGUMENT},
+    {StatusCode::SHARED_MEMORY_KEY_NOT_ALLOWED, grpc::StatusCode::PERMISSION_DENIED},
+
+    // Pipeline execution
+    {StatusCode::PIPELINE_WRONG_DEMULTIPLEXER_DIMENSION, grpc::StatusCode::INVALID_ARGUMENT},
+    {StatusCode::PIPELINE_INCONSISTENT_GATHER_SHAPES, grpc::StatusCode::INTERNAL},
+    {StatusCode::PIPELINE_CONDITION_UNSUPPORTED_PRECISION, grpc::StatusCode::INTERNAL},
+
+    // Custom node library
+    {StatusCode::NODE_LIBRARY_EXECUTION_FAILED, grpc::StatusCode::INTERNAL},
+    {StatusCode::NODE_LIBRARY_OUTPUTS_CORRUPTED, grpc::StatusCode::INTERNAL},
+    {StatusCode::NODE_LIBRARY_MISSING_OUTPUT, grpc::StatusCode::INTERNAL},
+    {StatusCode::NODE_LIBRARY_INVALID_PRECISION, grpc::StatusCode::INVALID_ARGUMENT},
 };
 
 const std::map<const StatusCode, net_http::HTTPStatusCode> Status::httpStatusMap = {
@@ -217,6 +296,8 @@ const std::map<const StatusCode, net_http::HTTPStatusCode> Status::httpStatusMap
     // REST handler failure
     {StatusCode::REST_INVALID_URL, net_http::HTTPStatusCode::BAD_REQUEST},
     {StatusCode::REST_UNSUPPORTED_METHOD, net_http::HTTPStatusCode::NONE_ACC},
+    {StatusCode::REST_MALFORMED_REQUEST, net_http::HTTPStatusCode::BAD_REQUEST},
+    {StatusCode::REST_TRACING_DISABLED, net_http::HTTPStatusCode::NOT_FOUND},
 
     // REST parser failure
     {StatusCode::REST_BODY_IS_NOT_AN_OBJECT, net_http::HTTPStatusCode::BAD_REQUEST},
@@ -231,6 +312,7 @@ const std::map<const StatusCode, net_http::HTTPStatusCode> Status::httpStatusMap
     {StatusCode::REST_INPUTS_NOT_AN_OBJECT, net_http::HTTPStatusCode::BAD_REQUEST},
     {StatusCode::REST_NO_INPUTS_FOUND, net_http::HTTPStatusCode::BAD_REQUEST},
     {StatusCode::REST_COULD_NOT_PARSE_INPUT, net_http::HTTPStatusCode::BAD_REQUEST},
+    {StatusCode::REST_OUTPUT_FILTER_NOT_AN_ARRAY, net_http::HTTPStatusCode::BAD_REQUEST},
     {StatusCode::REST_PROTO_TO_STRING_ERROR, net_http::HTTPStatusCode::ERROR},
     {StatusCode::REST_UNSUPPORTED_PRECISION, net_http::HTTPStatusCode::BAD_REQUEST},
     {StatusCode::REST_SERIALIZE_TENSOR_CONTENT_INVALID_SIZE, net_http::HTTPStatusCode::ERROR},
@@ -266,6 +348,9 @@ const std::map<const StatusCode, net_http::HTTPStatusCode> Status::httpStatusMap
     {StatusCode::INVALID_PRECISION, net_http::HTTPStatusCode::BAD_REQUEST},
     {StatusCode::INVALID_VALUE_COUNT, net_http::HTTPStatusCode::BAD_REQUEST},
     {StatusCode::INVALID_CONTENT_SIZE, net_http::HTTPStatusCode::BAD_REQUEST},
+    {StatusCode::IMAGE_PARSING_FAILED, net_http::HTTPStatusCode::BAD_REQUEST},
+    {StatusCode::BINARY_INPUT_NOT_IMAGE, net_http::HTTPStatusCode::BAD_REQUEST},
+    {StatusCode::INVALID_OUTPUT_FILTER, net_http::HTTPStatusCode::BAD_REQUEST},
 
     // Deserialization
 
@@ -275,6 +360,19 @@ const std::map<const StatusCode, net_http::HTTPStatusCode> Status::httpStatusMap
 
     // Inference
     {StatusCode::OV_INTERNAL_INFERENCE_ERROR, net_http::HTTPStatusCode::ERROR},
+    {StatusCode::INFER_QUEUE_FULL, net_http::HTTPStatusCode::TOO_MANY_REQUESTS},
+    {StatusCode::INFER_QUEUE_TIMEOUT, net_http::HTTPStatusCode::TOO_MANY_REQUESTS},
+    {StatusCode::DEADLINE_EXCEEDED, net_http::HTTPStatusCode::REQUEST_TO},
+    {StatusCode::REQUEST_CANCELLED, net_http::HTTPStatusCode::REQUEST_TO},
+    {StatusCode::INVALID_PRIORITY_CLASS, net_http::HTTPStatusCode::BAD_REQUEST},
+
+    // Sequence
+    {StatusCode::SEQUENCE_MISSING, net_http::HTTPStatusCode::NOT_FOUND},
+    {StatusCode::SEQUENCE_ALREADY_EXISTS, net_http::HTTPStatusCode::BAD_REQUEST},
+    {StatusCode::SEQUENCE_ID_NOT_PROVIDED, net_http::HTTPStatusCode::BAD_REQUEST},
+    {StatusCode::SEQUENCE_TERMINATED, net_http::HTTPStatusCode::PRECOND_FAILED},
+    {StatusCode::INVALID_SEQUENCE_CONTROL_INPUT, net_http::HTTPStatusCode::BAD_REQUEST},
+    {StatusCode::MAX_SEQUENCE_NUMBER_REACHED, net_http::HTTPStatusCode::TOO_MANY_REQUESTS},
 
     // Serialization
 
@@ -284,6 +382,24 @@ const std::map<const StatusCode, net_http::HTTPStatusCode> Status::httpStatusMap
 
     // GetModelStatus
     {StatusCode::INTERNAL_ERROR, net_http::HTTPStatusCode::ERROR},
+
+    // Shared memory
+    {StatusCode::SHARED_MEMORY_REGION_ALREADY_EXISTS, net_http::HTTPStatusCode::BAD_REQUEST},
+    {StatusCode::SHARED_MEMORY_REGION_MISSING, net_http::HTTPStatusCode::NOT_FOUND},
+    {StatusCode::SHARED_MEMORY_REGION_MAPPING_FAILED, net_http::HTTPStatusCode::BAD_REQUEST},
+    {StatusCode::SHARED_MEMORY_REGION_OUT_OF_BOUNDS, net_http::HTTPStatusCode::BAD_REQUEST},
+    {StatusCode::SHARED_MEMORY_KEY_NOT_ALLOWED, net_http::HTTPStatusCode::FORBIDDEN},
+
+    // Pipeline execution
+    {StatusCode::PIPELINE_WRONG_DEMULTIPLEXER_DIMENSION, net_http::HTTPStatusCode::BAD_REQUEST},
+    {StatusCode::PIPELINE_INCONSISTENT_GATHER_SHAPES, net_http::HTTPStatusCode::ERROR},
+    {StatusCode::PIPELINE_CONDITION_UNSUPPORTED_PRECISION, net_http::HTTPStatusCode::ERROR},
+
+    // Custom node library
+    {StatusCode::NODE_LIBRARY_EXECUTION_FAILED, net_http::HTTPStatusCode::ERROR},
+    {StatusCode::NODE_LIBRARY_OUTPUTS_CORRUPTED, net_http::HTTPStatusCode::ERROR},
+    {StatusCode::NODE_LIBRARY_MISSING_OUTPUT, net_http::HTTPStatusCode::ERROR},
+    {StatusCode::NODE_LIBRARY_INVALID_PRECISION, net_http::HTTPStatusCode::BAD_REQUEST},
 };
 
 }  // namespace ovms
@@ -52,8 +52,10 @@ enum class StatusCode {
     FORBIDDEN_MODEL_DYNAMIC_PARAMETER,      /*!< Value of the provided param is forbidden */
     ANONYMOUS_FIXED_SHAPE_NOT_ALLOWED,      /*!< Anonymous fixed shape is invalid for models with multiple inputs */
     CONFIG_SHAPE_IS_NOT_IN_NETWORK,         /*!< Invalid shape dimension number or dimension value */
+    POST_PROCESSING_NOT_SUPPORTED,          /*!< Post-processing from config cannot be applied to network output */
     CANNOT_LOAD_NETWORK_INTO_TARGET_DEVICE, /*!< Cannot load network into target device */
     REQUESTED_DYNAMIC_PARAMETERS_ON_SUBSCRIBED_MODEL,
+    REQUESTED_DYNAMIC_PARAMETERS_ON_STATEFUL_MODEL,
 
     // Model management
     MODEL_MISSING,                    /*!< Model with such name and/or version does not exist */
@@ -73,6 +75,9 @@ enum class StatusCode {
     INVALID_PRECISION,              /*!< Invalid precision */
     INVALID_VALUE_COUNT,            /*!< Invalid value count error status for uint16 and half float data types */
     INVALID_CONTENT_SIZE,           /*!< Invalid content size error status for types using tensor_content() */
+    IMAGE_PARSING_FAILED,           /*!< Encoded image in binary input could not be decoded */
+    BINARY_INPUT_NOT_IMAGE,         /*!< Binary input sent for model input which is not an image */
+    INVALID_OUTPUT_FILTER,          /*!< Output filter references output which does not exist */
 
     // Deserialization
     OV_UNSUPPORTED_DESERIALIZATION_PRECISION, /*!< Unsupported deserialization precision, theoretically should never be returned since ModelInstance::validation checks against network precision */
@@ -80,6 +85,19 @@ enum class StatusCode {
 
     // Inference
     OV_INTERNAL_INFERENCE_ERROR, /*!< Error occured during inference */
+    INFER_QUEUE_FULL,            /*!< Number of requests waiting for model infer request reached the limit */
+    INFER_QUEUE_TIMEOUT,         /*!< Request waited for model infer request longer than the limit */
+    DEADLINE_EXCEEDED,           /*!< Client deadline passed before inference was started */
+    REQUEST_CANCELLED,           /*!< Client cancelled request before inference was started */
+    INVALID_PRIORITY_CLASS,      /*!< Priority class requested in header is not one of high, normal, low */
+
+    // Sequence
+    SEQUENCE_MISSING,               /*!< Sequence with requested id does not exist */
+    SEQUENCE_ALREADY_EXISTS,        /*!< Sequence with requested id already exists */
+    SEQUENCE_ID_NOT_PROVIDED,       /*!< Sequence id is required for requests other than sequence start */
+    SEQUENCE_TERMINATED,            /*!< Sequence was ended or evicted while request waited for it */
+    INVALID_SEQUENCE_CONTROL_INPUT, /*!< Sequence control input has unexpected value */
+    MAX_SEQUENCE_NUMBER_REACHED,    /*!< Number of concurrent sequences reached the limit */
 
     // Serialization
     OV_UNSUPPORTED_SERIALIZATION_PRECISION, /*!< Unsupported serializaton precision */
@@ -138,6 +156,7 @@ enum class StatusCode {
     REST_INVALID_URL,             /*!< Malformed REST request url */
     REST_UNSUPPORTED_METHOD,      /*!< Request sent with unsupported method */
     REST_MALFORMED_REQUEST,       /*!< Malformed REST request */
+    REST_TRACING_DISABLED,        /*!< Traces requested while tracing is disabled */
 
     // REST Parse
     REST_BODY_IS_NOT_AN_OBJECT,          /*!< REST body should be JSON object */
@@ -152,6 +171,7 @@ enum class StatusCode {
     REST_INPUTS_NOT_AN_OBJECT,           /*!< When parsing column order, inputs must be an object */
     REST_NO_INPUTS_FOUND,                /*!< Missing inputs in column order */
     REST_COULD_NOT_PARSE_INPUT,          /*!< Error while parsing input content, not valid ndarray */
+    REST_OUTPUT_FILTER_NOT_AN_ARRAY,     /*!< Output filter must be an array of output names */
     REST_PROTO_TO_STRING_ERROR,          /*!< Error while parsing ResponseProto to JSON string */
     REST_UNSUPPORTED_PRECISION,          /*!< Unsupported conversion from tensor_content to _val container */
     REST_SERIALIZE_TENSOR_CONTENT_INVALID_SIZE,
@@ -171,6 +191,7 @@ enum class StatusCode {
     PIPELINE_CONTAINS_UNCONNECTED_NODES,
     PIPELINE_NODE_REFERING_TO_MISSING_NODE,
     PIPELINE_NODE_REFERING_TO_MISSING_MODEL,
+    PIPELINE_NODE_REFERING_TO_STATEFUL_MODEL,
     PIPELINE_NODE_REFERING_TO_MISSING_DATA_SOURCE,
     PIPELINE_NODE_REFERING_TO_MISSING_MODEL_OUTPUT,
     PIPELINE_CONNECTION_TO_MISSING_MODEL_INPUT,
@@ -178,6 +199,14 @@ enum class StatusCode {
     PIPELINE_MODEL_INPUT_CONNECTED_TO_MULTIPLE_DATA_SOURCES,
     PIPELINE_EXIT_USED_AS_NODE_DEPENDENCY,
     PIPELINE_NAME_OCCUPIED,
+    PIPELINE_DEFINITION_INVALID_NODE_LIBRARY,
+    PIPELINE_NODE_GATHER_FROM_NOT_DEMULTIPLEXER,
+    PIPELINE_DEMULTIPLEXER_NESTING_NOT_SUPPORTED,
+    PIPELINE_WRONG_DEMULTIPLEXER_DIMENSION,
+    PIPELINE_INCONSISTENT_GATHER_SHAPES,
+    PIPELINE_CONDITION_WRONG_PREDICATE,
+    PIPELINE_CONDITION_NOT_ON_DEPENDENCY,
+    PIPELINE_CONDITION_UNSUPPORTED_PRECISION,
 
     // Custom Loader
     CUSTOM_LOADER_LIBRARY_INVALID,
@@ -187,6 +216,21 @@ enum class StatusCode {
     CUSTOM_LOADER_INIT_FAILED,
     CUSTOM_LOADER_ERROR,
 
+    // Shared memory
+    SHARED_MEMORY_REGION_ALREADY_EXISTS, /*!< Region with the same name is already registered */
+    SHARED_MEMORY_REGION_MISSING,        /*!< Referenced region is not registered */
+    SHARED_MEMORY_REGION_MAPPING_FAILED, /*!< Could not open or map shared memory segment */
+    SHARED_MEMORY_REGION_OUT_OF_BOUNDS,  /*!< Requested data exceeds region boundaries */
+    SHARED_MEMORY_KEY_NOT_ALLOWED,       /*!< Segment name does not match allowed prefix */
+
+    // Custom node library
+    NODE_LIBRARY_LOAD_FAILED_OPEN,   /*!< Could not open custom node library */
+    NODE_LIBRARY_LOAD_FAILED_SYM,    /*!< Custom node library does not export required symbols */
+    NODE_LIBRARY_EXECUTION_FAILED,   /*!< Custom node library execute returned an error */
+    NODE_LIBRARY_OUTPUTS_CORRUPTED,  /*!< Custom node library returned malformed outputs */
+    NODE_LIBRARY_MISSING_OUTPUT,     /*!< Custom node library did not return required output */
+    NODE_LIBRARY_INVALID_PRECISION,  /*!< Tensor precision not supported by custom node interface */
+
     STATUS_CODE_END
 };
 
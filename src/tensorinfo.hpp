@@ -17,6 +17,7 @@
 
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 
 #include <inference_engine.hpp>
@@ -65,6 +66,16 @@ protected:
          */
     InferenceEngine::TensorDesc tensorDesc;
 
+    /**
+         * @brief Whether data of other precision is converted to tensor precision
+         */
+    bool precisionConversionAllowed = false;
+
+    /**
+         * @brief Post-processing applied before serialization of output
+         */
+    std::optional<PostProcessingConfig> postProcessing;
+
 public:
     /**
          * @brief Construct a new Tensor Info object
@@ -199,6 +210,33 @@ public:
         }
     }
 
+    static const InferenceEngine::Precision getPrecisionFromDataType(tensorflow::DataType dataType) {
+        switch (dataType) {
+        case tensorflow::DataType::DT_FLOAT:
+            return InferenceEngine::Precision::FP32;
+        case tensorflow::DataType::DT_HALF:
+            return InferenceEngine::Precision::FP16;
+        case tensorflow::DataType::DT_INT16:
+            return InferenceEngine::Precision::I16;
+        case tensorflow::DataType::DT_UINT8:
+            return InferenceEngine::Precision::U8;
+        case tensorflow::DataType::DT_INT8:
+            return InferenceEngine::Precision::I8;
+        case tensorflow::DataType::DT_UINT16:
+            return InferenceEngine::Precision::U16;
+        case tensorflow::DataType::DT_INT32:
+            return InferenceEngine::Precision::I32;
+        case tensorflow::DataType::DT_UINT64:
+            return InferenceEngine::Precision::U64;
+        case tensorflow::DataType::DT_INT64:
+            return InferenceEngine::Precision::I64;
+        case tensorflow::DataType::DT_BOOL:
+            return InferenceEngine::Precision::BOOL;
+        default:
+            return InferenceEngine::Precision::UNSPECIFIED;
+        }
+    }
+
     /**
         * @brief Get the Precision As String object
         *
@@ -357,6 +395,22 @@ public:
         return layout;
     }
 
+    bool isPrecisionConversionAllowed() const {
+        return precisionConversionAllowed;
+    }
+
+    void setPrecisionConversionAllowed(bool allowed) {
+        precisionConversionAllowed = allowed;
+    }
+
+    const std::optional<PostProcessingConfig>& getPostProcessing() const {
+        return postProcessing;
+    }
+
+    void setPostProcessing(const PostProcessingConfig& config) {
+        postProcessing = config;
+    }
+
     /**
          * @brief Gets input shape
          *
@@ -375,6 +429,19 @@ public:
         return InferenceEngine::TensorDesc{precision, shape, layout};
     }
 
+    /**
+         * @brief Creates copy of tensor info with the first dimension set to batch size
+         *
+         * @return std::shared_ptr<TensorInfo>
+         */
+    std::shared_ptr<TensorInfo> createCopyWithBatchSize(size_t batchSize) const {
+        auto copy = std::make_shared<TensorInfo>(*this);
+        if (!copy->shape.empty()) {
+            copy->shape[0] = batchSize;
+        }
+        return copy;
+    }
+
     static std::string shapeToString(const shape_t& shape) {
         std::ostringstream oss;
         oss << "(";
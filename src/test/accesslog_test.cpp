@@ -0,0 +1,77 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <memory>
+#include <sstream>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <spdlog/sinks/ostream_sink.h>
+
+#include "../accesslog.hpp"
+#include "../logging.hpp"
+
+using namespace ovms;
+
+using testing::MatchesRegex;
+
+class AccessLogTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        previousLogger = access_logger;
+        access_logger = std::make_shared<spdlog::logger>("access_test", std::make_shared<spdlog::sinks::ostream_sink_mt>(output));
+        access_logger->set_pattern("%v");
+    }
+    void TearDown() override {
+        access_logger = previousLogger;
+    }
+
+    std::ostringstream output;
+    std::shared_ptr<spdlog::logger> previousLogger;
+};
+
+TEST_F(AccessLogTest, RecordIsWrittenAsSingleLine) {
+    AccessLogRecord record(AccessLogApi::GRPC, "dummy", 0);
+    record.setVersion(2);
+    record.stageFinished("lookup");
+    record.stageFinished("inference");
+    EXPECT_EQ(output.str(), "");
+    record.finish(StatusCode::OK);
+    EXPECT_THAT(output.str(), MatchesRegex("grpc model=dummy version=2 status=0 total_us=[0-9]+ lookup_us=[0-9]+ inference_us=[0-9]+\n"));
+}
+
+TEST_F(AccessLogTest, FailedRequestReportsClientStatus) {
+    AccessLogRecord record(AccessLogApi::REST, "dummy", 1);
+    record.finish(StatusCode::MODEL_VERSION_MISSING);
+    EXPECT_THAT(output.str(), MatchesRegex("rest model=dummy version=1 status=404 total_us=[0-9]+ error=.+\n"));
+}
+
+TEST_F(AccessLogTest, StagesOverLimitAreIgnored) {
+    AccessLogRecord record(AccessLogApi::GRPC, "dummy", 1);
+    for (size_t i = 0; i < AccessLogRecord::MAX_STAGES + 2; i++) {
+        record.stageFinished("stage");
+    }
+    record.finish(StatusCode::OK);
+    EXPECT_THAT(output.str(), MatchesRegex("grpc model=dummy version=1 status=0 total_us=[0-9]+( stage_us=[0-9]+){4}\n"));
+}
+
+TEST_F(AccessLogTest, DisabledAccessLogWritesNothing) {
+    access_logger->set_level(spdlog::level::off);
+    AccessLogRecord record(AccessLogApi::GRPC, "dummy", 1);
+    EXPECT_FALSE(record.isEnabled());
+    record.stageFinished("lookup");
+    record.finish(StatusCode::OK);
+    EXPECT_EQ(output.str(), "");
+}
@@ -0,0 +1,127 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <opencv2/core.hpp>
+#include <opencv2/imgcodecs.hpp>
+
+#include "../binaryutils.hpp"
+
+using namespace ovms;
+
+class BinaryUtilsTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // 4x2 BGR image, each pixel equal to (1, 2, 3)
+        cv::Mat image(2, 4, CV_8UC3, cv::Scalar(1, 2, 3));
+        std::vector<uint8_t> encoded;
+        ASSERT_TRUE(cv::imencode(".png", image, encoded));
+        encodedImage.assign(encoded.begin(), encoded.end());
+
+        proto.set_dtype(tensorflow::DataType::DT_STRING);
+        proto.add_string_val(encodedImage);
+        proto.add_string_val(encodedImage);
+        proto.mutable_tensor_shape()->add_dim()->set_size(2);
+    }
+
+    tensorflow::TensorProto proto;
+    std::string encodedImage;
+};
+
+TEST_F(BinaryUtilsTest, IsBinaryInput) {
+    EXPECT_TRUE(isBinaryInput(proto));
+    proto.set_dtype(tensorflow::DataType::DT_FLOAT);
+    EXPECT_FALSE(isBinaryInput(proto));
+}
+
+TEST_F(BinaryUtilsTest, DecodeToNCHWFloat) {
+    auto tensorInfo = std::make_shared<TensorInfo>("input", InferenceEngine::Precision::FP32, shape_t{2, 3, 2, 4}, InferenceEngine::Layout::NCHW);
+    InferenceEngine::Blob::Ptr blob;
+    ASSERT_EQ(convertBinaryInputToBlob(proto, tensorInfo, blob), StatusCode::OK);
+    EXPECT_EQ(blob->getTensorDesc().getDims(), (InferenceEngine::SizeVector{2, 3, 2, 4}));
+    EXPECT_EQ(blob->getTensorDesc().getLayout(), InferenceEngine::Layout::NCHW);
+    const float* data = blob->cbuffer().as<const float*>();
+    for (size_t n = 0; n < 2; n++) {
+        for (size_t c = 0; c < 3; c++) {
+            for (size_t i = 0; i < 8; i++) {
+                EXPECT_EQ(data[(n * 3 + c) * 8 + i], static_cast<float>(c + 1));
+            }
+        }
+    }
+}
+
+TEST_F(BinaryUtilsTest, DecodeAndResizeToNHWCU8) {
+    auto tensorInfo = std::make_shared<TensorInfo>("input", InferenceEngine::Precision::U8, shape_t{2, 4, 8, 3}, InferenceEngine::Layout::NHWC);
+    InferenceEngine::Blob::Ptr blob;
+    ASSERT_EQ(convertBinaryInputToBlob(proto, tensorInfo, blob), StatusCode::OK);
+    EXPECT_EQ(blob->getTensorDesc().getDims(), (InferenceEngine::SizeVector{2, 4, 8, 3}));
+    const uint8_t* data = blob->cbuffer().as<const uint8_t*>();
+    for (size_t i = 0; i < 2 * 4 * 8; i++) {
+        EXPECT_EQ(data[i * 3], 1);
+        EXPECT_EQ(data[i * 3 + 1], 2);
+        EXPECT_EQ(data[i * 3 + 2], 3);
+    }
+}
+
+TEST_F(BinaryUtilsTest, DecodeGrayscale) {
+    auto tensorInfo = std::make_shared<TensorInfo>("input", InferenceEngine::Precision::FP32, shape_t{2, 1, 2, 4}, InferenceEngine::Layout::NCHW);
+    InferenceEngine::Blob::Ptr blob;
+    ASSERT_EQ(convertBinaryInputToBlob(proto, tensorInfo, blob), StatusCode::OK);
+    EXPECT_EQ(blob->byteSize(), 2 * 8 * sizeof(float));
+}
+
+TEST_F(BinaryUtilsTest, CorruptedImage) {
+    proto.set_string_val(1, "not an image");
+    auto tensorInfo = std::make_shared<TensorInfo>("input", InferenceEngine::Precision::FP32, shape_t{2, 3, 2, 4}, InferenceEngine::Layout::NCHW);
+    InferenceEngine::Blob::Ptr blob;
+    EXPECT_EQ(convertBinaryInputToBlob(proto, tensorInfo, blob), StatusCode::IMAGE_PARSING_FAILED);
+}
+
+TEST_F(BinaryUtilsTest, TruncatedImage) {
+    proto.set_string_val(0, encodedImage.substr(0, encodedImage.size() / 2));
+    auto tensorInfo = std::make_shared<TensorInfo>("input", InferenceEngine::Precision::U8, shape_t{2, 2, 4, 3}, InferenceEngine::Layout::NHWC);
+    InferenceEngine::Blob::Ptr blob;
+    EXPECT_EQ(convertBinaryInputToBlob(proto, tensorInfo, blob), StatusCode::IMAGE_PARSING_FAILED);
+    EXPECT_EQ(blob, nullptr);
+}
+
+TEST_F(BinaryUtilsTest, DegenerateTargetSize) {
+    // Resizing to empty image throws inside parallel conversion
+    auto tensorInfo = std::make_shared<TensorInfo>("input", InferenceEngine::Precision::FP32, shape_t{2, 3, 0, 4}, InferenceEngine::Layout::NCHW);
+    InferenceEngine::Blob::Ptr blob;
+    EXPECT_EQ(convertBinaryInputToBlob(proto, tensorInfo, blob), StatusCode::IMAGE_PARSING_FAILED);
+    EXPECT_EQ(blob, nullptr);
+}
+
+TEST_F(BinaryUtilsTest, UnsupportedInput) {
+    InferenceEngine::Blob::Ptr blob;
+    auto notImage = std::make_shared<TensorInfo>("input", InferenceEngine::Precision::FP32, shape_t{2, 10}, InferenceEngine::Layout::NC);
+    EXPECT_EQ(convertBinaryInputToBlob(proto, notImage, blob), StatusCode::BINARY_INPUT_NOT_IMAGE);
+    auto wrongPrecision = std::make_shared<TensorInfo>("input", InferenceEngine::Precision::I32, shape_t{2, 3, 2, 4}, InferenceEngine::Layout::NCHW);
+    EXPECT_EQ(convertBinaryInputToBlob(proto, wrongPrecision, blob), StatusCode::BINARY_INPUT_NOT_IMAGE);
+    auto wrongChannels = std::make_shared<TensorInfo>("input", InferenceEngine::Precision::FP32, shape_t{2, 4, 2, 4}, InferenceEngine::Layout::NCHW);
+    EXPECT_EQ(convertBinaryInputToBlob(proto, wrongChannels, blob), StatusCode::BINARY_INPUT_NOT_IMAGE);
+}
+
+TEST_F(BinaryUtilsTest, ShapeNotMatchingNumberOfImages) {
+    proto.mutable_tensor_shape()->mutable_dim(0)->set_size(3);
+    auto tensorInfo = std::make_shared<TensorInfo>("input", InferenceEngine::Precision::FP32, shape_t{2, 3, 2, 4}, InferenceEngine::Layout::NCHW);
+    InferenceEngine::Blob::Ptr blob;
+    EXPECT_EQ(convertBinaryInputToBlob(proto, tensorInfo, blob), StatusCode::INVALID_SHAPE);
+}
@@ -0,0 +1,163 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../capture.hpp"
+#include "test_utils.hpp"
+
+using namespace ovms;
+
+using tensorflow::serving::PredictRequest;
+
+class TrafficCaptureTest : public TestWithTempDir {
+protected:
+    void SetUp() override {
+        TestWithTempDir::SetUp();
+        path = directoryPath + "/capture.bin";
+    }
+
+    std::vector<CaptureRecord> readAll(bool expectTruncated = false) {
+        CaptureReader reader;
+        EXPECT_EQ(reader.open(path), StatusCode::OK);
+        std::vector<CaptureRecord> records;
+        CaptureRecord record;
+        while (reader.next(record)) {
+            records.push_back(record);
+        }
+        EXPECT_EQ(reader.isTruncated(), expectTruncated);
+        return records;
+    }
+
+    std::string path;
+};
+
+static PredictRequest createRequest(const std::string& name, int64_t version) {
+    PredictRequest request;
+    request.mutable_model_spec()->set_name(name);
+    request.mutable_model_spec()->mutable_version()->set_value(version);
+    auto& proto = (*request.mutable_inputs())["b"];
+    proto.set_dtype(tensorflow::DataType::DT_FLOAT);
+    proto.mutable_tensor_shape()->add_dim()->set_size(2);
+    proto.add_float_val(1);
+    proto.add_float_val(2);
+    return request;
+}
+
+TEST_F(TrafficCaptureTest, CapturedRequestsAreReadBack) {
+    TrafficCapture capture;
+    ASSERT_EQ(capture.start(path, 1, 100, 1024 * 1024), StatusCode::OK);
+    EXPECT_TRUE(capture.isEnabled());
+    auto request = createRequest("dummy", 3);
+    capture.captureGrpc(request);
+    const std::string body = R"({"inputs": {"b": [[1.0, 2.0]]}})";
+    capture.captureRest("dummy_rest", 0, body);
+    capture.stop();
+    EXPECT_FALSE(capture.isEnabled());
+    EXPECT_EQ(capture.getCapturedCount(), 2);
+    EXPECT_EQ(capture.getDroppedCount(), 0);
+
+    auto records = readAll();
+    ASSERT_EQ(records.size(), 2);
+    EXPECT_EQ(records[0].api, CaptureApi::GRPC);
+    EXPECT_EQ(records[0].modelName, "dummy");
+    EXPECT_EQ(records[0].modelVersion, 3);
+    PredictRequest captured;
+    ASSERT_TRUE(captured.ParseFromString(records[0].payload));
+    EXPECT_EQ(captured.SerializeAsString(), request.SerializeAsString());
+    EXPECT_EQ(records[1].api, CaptureApi::REST);
+    EXPECT_EQ(records[1].modelName, "dummy_rest");
+    EXPECT_EQ(records[1].modelVersion, 0);
+    EXPECT_EQ(records[1].payload, body);
+    EXPECT_LE(records[0].timestampUs, records[1].timestampUs);
+}
+
+TEST_F(TrafficCaptureTest, EveryNthRequestIsCaptured) {
+    TrafficCapture capture;
+    ASSERT_EQ(capture.start(path, 3, 100, 1024 * 1024), StatusCode::OK);
+    for (int64_t i = 0; i < 7; i++) {
+        capture.captureGrpc(createRequest("dummy", i));
+    }
+    capture.stop();
+    auto records = readAll();
+    ASSERT_EQ(records.size(), 3);
+    EXPECT_EQ(records[0].modelVersion, 0);
+    EXPECT_EQ(records[1].modelVersion, 3);
+    EXPECT_EQ(records[2].modelVersion, 6);
+}
+
+TEST_F(TrafficCaptureTest, RequestsOverQueueLimitAreDropped) {
+    TrafficCapture capture;
+    ASSERT_EQ(capture.start(path, 1, 0, 1024 * 1024), StatusCode::OK);
+    capture.captureGrpc(createRequest("dummy", 1));
+    capture.captureRest("dummy", 1, "{}");
+    capture.stop();
+    EXPECT_EQ(capture.getCapturedCount(), 0);
+    EXPECT_EQ(capture.getDroppedCount(), 2);
+    EXPECT_TRUE(readAll().empty());
+}
+
+TEST_F(TrafficCaptureTest, RequestsOverQueueBytesLimitAreDropped) {
+    TrafficCapture capture;
+    // Size of record of REST request is 4 bytes of size, 19 bytes of header, model name and body
+    const std::string body = "{}";
+    const size_t restRecordSize = 4 + 19 + std::string("d").size() + body.size();
+    ASSERT_EQ(capture.start(path, 1, 100, restRecordSize), StatusCode::OK);
+    capture.captureGrpc(createRequest("dummy", 1));
+    capture.captureRest("d", 1, body);
+    capture.stop();
+    EXPECT_EQ(capture.getCapturedCount(), 1);
+    EXPECT_EQ(capture.getDroppedCount(), 1);
+    auto records = readAll();
+    ASSERT_EQ(records.size(), 1);
+    EXPECT_EQ(records[0].api, CaptureApi::REST);
+}
+
+TEST_F(TrafficCaptureTest, DisabledCaptureIgnoresRequests) {
+    TrafficCapture capture;
+    capture.captureGrpc(createRequest("dummy", 1));
+    EXPECT_FALSE(capture.isEnabled());
+    EXPECT_EQ(capture.getCapturedCount(), 0);
+    EXPECT_FALSE(std::filesystem::exists(path));
+}
+
+TEST_F(TrafficCaptureTest, TruncatedRecordEndsReading) {
+    TrafficCapture capture;
+    ASSERT_EQ(capture.start(path, 1, 100, 1024 * 1024), StatusCode::OK);
+    capture.captureRest("dummy", 1, "{\"instances\": [1]}");
+    capture.captureRest("dummy", 2, "{\"instances\": [2]}");
+    capture.stop();
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 3);
+    auto records = readAll(true);
+    ASSERT_EQ(records.size(), 1);
+    EXPECT_EQ(records[0].modelVersion, 1);
+}
+
+TEST_F(TrafficCaptureTest, InvalidFilesAreRejected) {
+    TrafficCapture capture;
+    EXPECT_EQ(capture.start(directoryPath + "/missing/capture.bin", 1, 100), StatusCode::FILE_INVALID);
+    EXPECT_FALSE(capture.isEnabled());
+
+    CaptureReader reader;
+    EXPECT_EQ(reader.open(path), StatusCode::FILE_INVALID);
+    std::ofstream(path) << "not a capture";
+    CaptureReader otherReader;
+    EXPECT_EQ(otherReader.open(path), StatusCode::FILE_INVALID);
+}
@@ -1010,4 +1010,68 @@ TEST_F(TestCustomLoader, CustomLoaderMultipleLoaderWithSameLoaderName) {
     performPredict("dummy", 1, request);
 }
 
+TEST(CustomLoaderBuffer, MapFile) {
+    const std::string path = "/tmp/ovms_custom_loader_buffer_test.bin";
+    const std::string content = "model weights";
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << content;
+    }
+    auto buffer = CustomLoaderBuffer::mapFile(path);
+    std::filesystem::remove(path);
+    ASSERT_NE(buffer, nullptr);
+    ASSERT_EQ(buffer->size(), content.size());
+    EXPECT_EQ(std::string(reinterpret_cast<const char*>(buffer->data()), buffer->size()), content);
+    EXPECT_EQ(CustomLoaderBuffer::mapFile("/tmp/ovms_custom_loader_buffer_missing.bin"), nullptr);
+}
+
+TEST(CustomLoaderBuffer, FromVectorKeepsData) {
+    std::vector<uint8_t> content{1, 2, 3};
+    const uint8_t* data = content.data();
+    auto buffer = CustomLoaderBuffer::fromVector(std::move(content));
+    EXPECT_EQ(buffer->data(), data);
+    EXPECT_EQ(buffer->size(), 3);
+}
+
+TEST(CustomLoaderBuffer, ReleaseIsCalledOnDestruction) {
+    int releases = 0;
+    uint8_t data[4] = {};
+    {
+        CustomLoaderBuffer buffer(data, sizeof(data), [&releases]() { releases++; });
+        EXPECT_EQ(releases, 0);
+    }
+    EXPECT_EQ(releases, 1);
+}
+
+namespace {
+class BufferLoader : public CustomLoaderInterfaceV2 {
+public:
+    std::vector<uint8_t> modelContent{1, 2};
+    std::vector<uint8_t> weightsContent{3, 4, 5};
+    int releases = 0;
+
+    CustomLoaderStatus loaderInit(const std::string&) override { return CustomLoaderStatus::OK; }
+    CustomLoaderStatus loadModelBuffers(const std::string&, const std::string&, const int, const std::string&,
+        std::unique_ptr<CustomLoaderBuffer>& model, std::unique_ptr<CustomLoaderBuffer>& weights) override {
+        model = std::make_unique<CustomLoaderBuffer>(modelContent.data(), modelContent.size(), [this]() { releases++; });
+        weights = std::make_unique<CustomLoaderBuffer>(weightsContent.data(), weightsContent.size(), [this]() { releases++; });
+        return CustomLoaderStatus::MODEL_TYPE_IR;
+    }
+    CustomLoaderStatus unloadModel(const std::string&, const int) override { return CustomLoaderStatus::OK; }
+    CustomLoaderStatus retireModel(const std::string&) override { return CustomLoaderStatus::OK; }
+    CustomLoaderStatus loaderDeInit() override { return CustomLoaderStatus::OK; }
+};
+}  // namespace
+
+TEST(CustomLoaderInterfaceV2, LoadModelCopiesBuffersForCallersOfFirstVersion) {
+    auto loader = std::make_shared<BufferLoader>();
+    std::shared_ptr<CustomLoaderInterface> loaderInterface = loader;
+    ASSERT_NE(std::dynamic_pointer_cast<CustomLoaderInterfaceV2>(loaderInterface), nullptr);
+    std::vector<uint8_t> model, weights;
+    EXPECT_EQ(loaderInterface->loadModel("dummy", "/tmp", 1, "{}", model, weights), CustomLoaderStatus::MODEL_TYPE_IR);
+    EXPECT_EQ(model, loader->modelContent);
+    EXPECT_EQ(weights, loader->weightsContent);
+    EXPECT_EQ(loader->releases, 2);
+}
+
 #pragma GCC diagnostic pop
@@ -0,0 +1,238 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../custom_node.hpp"
+#include "../entry_node.hpp"
+#include "../exit_node.hpp"
+#include "../pipeline.hpp"
+#include "test_utils.hpp"
+
+using namespace ovms;
+using namespace tensorflow;
+using namespace tensorflow::serving;
+
+// Test library returning its single FP32 input increased by 1 under name "output"
+static int addOneExecute(const struct CustomNodeTensor* inputs, int inputsCount, struct CustomNodeTensor** outputs, int* outputsCount, const struct CustomNodeParam*, int) {
+    if (inputsCount != 1 || inputs[0].precision != CUSTOM_NODE_TENSOR_PRECISION_FP32) {
+        return 1;
+    }
+    auto output = static_cast<struct CustomNodeTensor*>(malloc(sizeof(struct CustomNodeTensor)));
+    output->name = strdup("output");
+    output->dataBytes = inputs[0].dataBytes;
+    output->data = static_cast<uint8_t*>(malloc(output->dataBytes));
+    output->dimsCount = inputs[0].dimsCount;
+    output->dims = static_cast<uint64_t*>(malloc(output->dimsCount * sizeof(uint64_t)));
+    memcpy(output->dims, inputs[0].dims, output->dimsCount * sizeof(uint64_t));
+    output->precision = CUSTOM_NODE_TENSOR_PRECISION_FP32;
+    auto inputData = reinterpret_cast<const float*>(inputs[0].data);
+    auto outputData = reinterpret_cast<float*>(output->data);
+    for (size_t i = 0; i < output->dataBytes / sizeof(float); i++) {
+        outputData[i] = inputData[i] + 1;
+    }
+    *outputs = output;
+    *outputsCount = 1;
+    return 0;
+}
+
+static int failingExecute(const struct CustomNodeTensor*, int, struct CustomNodeTensor**, int*, const struct CustomNodeParam*, int) {
+    return 1;
+}
+
+static int corruptedOutputExecute(const struct CustomNodeTensor* inputs, int inputsCount, struct CustomNodeTensor** outputs, int* outputsCount, const struct CustomNodeParam* params, int paramsCount) {
+    int result = addOneExecute(inputs, inputsCount, outputs, outputsCount, params, paramsCount);
+    (*outputs)[0].dataBytes -= sizeof(float);
+    return result;
+}
+
+static int releasedCount = 0;
+
+static int countingRelease(void* ptr) {
+    releasedCount++;
+    free(ptr);
+    return 0;
+}
+
+class CustomNodeTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        auto& proto = (*request.mutable_inputs())[pipelineInputName];
+        proto.set_dtype(tensorflow::DataType::DT_FLOAT);
+        proto.mutable_tensor_content()->assign((char*)requestData.data(), requestData.size() * sizeof(float));
+        proto.mutable_tensor_shape()->add_dim()->set_size(1);
+        proto.mutable_tensor_shape()->add_dim()->set_size(requestData.size());
+        releasedCount = 0;
+    }
+
+    Status executePipeline(execute_fn execute, const std::string& libraryOutputName = "output") {
+        NodeLibrary library;
+        library.execute = execute;
+        library.release = countingRelease;
+
+        auto input_node = std::make_unique<EntryNode>(&request);
+        auto custom_node = std::make_unique<CustomNode>("custom_node", library, parameters_t{}, std::unordered_map<std::string, std::string>{{"custom_output", libraryOutputName}});
+        auto output_node = std::make_unique<ExitNode>(&response);
+
+        Pipeline pipeline(*input_node, *output_node);
+        pipeline.connect(*input_node, *custom_node, {{pipelineInputName, "input"}});
+        pipeline.connect(*custom_node, *output_node, {{"custom_output", pipelineOutputName}});
+
+        pipeline.push(std::move(input_node));
+        pipeline.push(std::move(custom_node));
+        pipeline.push(std::move(output_node));
+        return pipeline.execute();
+    }
+
+    PredictRequest request;
+    PredictResponse response;
+
+    const std::string pipelineInputName = "pipeline_input";
+    const std::string pipelineOutputName = "pipeline_output";
+    const std::vector<float> requestData{-5.0, 3.0, 0.0, -12.0, 9.0, -100.0, 102.0, 92.0, -1.0, 12.0};
+};
+
+TEST_F(CustomNodeTest, AddOne) {
+    ASSERT_EQ(executePipeline(addOneExecute), StatusCode::OK);
+    ASSERT_EQ(response.outputs().count(pipelineOutputName), 1u);
+    const auto& proto = response.outputs().at(pipelineOutputName);
+    ASSERT_EQ(proto.tensor_content().size(), requestData.size() * sizeof(float));
+    ASSERT_EQ(proto.tensor_shape().dim_size(), 2);
+    EXPECT_EQ(proto.tensor_shape().dim(1).size(), static_cast<int64_t>(requestData.size()));
+    auto actual = reinterpret_cast<const float*>(proto.tensor_content().data());
+    for (size_t i = 0; i < requestData.size(); i++) {
+        EXPECT_EQ(actual[i], requestData[i] + 1);
+    }
+    // outputs array, name, dims and data
+    EXPECT_EQ(releasedCount, 4);
+}
+
+TEST_F(CustomNodeTest, ExecutionFailure) {
+    EXPECT_EQ(executePipeline(failingExecute), StatusCode::NODE_LIBRARY_EXECUTION_FAILED);
+}
+
+TEST_F(CustomNodeTest, CorruptedOutput) {
+    EXPECT_EQ(executePipeline(corruptedOutputExecute), StatusCode::NODE_LIBRARY_OUTPUTS_CORRUPTED);
+    EXPECT_EQ(releasedCount, 4);
+}
+
+TEST_F(CustomNodeTest, MissingOutput) {
+    EXPECT_EQ(executePipeline(addOneExecute, "not_existing_output"), StatusCode::NODE_LIBRARY_MISSING_OUTPUT);
+    EXPECT_EQ(releasedCount, 4);
+}
+
+TEST(CustomNodePrecision, Conversion) {
+    for (auto precision : {InferenceEngine::Precision::FP32, InferenceEngine::Precision::FP16, InferenceEngine::Precision::U8,
+             InferenceEngine::Precision::I8, InferenceEngine::Precision::U16, InferenceEngine::Precision::I16, InferenceEngine::Precision::I32}) {
+        CustomNodeTensorPrecision customNodePrecision;
+        ASSERT_EQ(CustomNode::toCustomNodeTensorPrecision(precision, customNodePrecision), StatusCode::OK);
+        InferenceEngine::Precision result;
+        ASSERT_EQ(CustomNode::toInferenceEnginePrecision(customNodePrecision, result), StatusCode::OK);
+        EXPECT_EQ(result, precision);
+    }
+    CustomNodeTensorPrecision customNodePrecision;
+    EXPECT_EQ(CustomNode::toCustomNodeTensorPrecision(InferenceEngine::Precision::I64, customNodePrecision), StatusCode::NODE_LIBRARY_INVALID_PRECISION);
+}
+
+static const char* pipelineCustomNodeConfig = R"(
+{
+    "model_config_list": [
+        {
+            "config": {
+                "name": "dummy",
+                "base_path": "/ovms/src/test/dummy"
+            }
+        }
+    ],
+    "pipeline_config_list": [
+        {
+            "name": "pipelineCustom",
+            "inputs": ["pipeline_input"],
+            "nodes": [
+                {
+                    "name": "custom_node",
+                    "type": "custom",
+                    "library_path": "/ovms/bazel-bin/src/libcustom_node_add_sub.so",
+                    "params": {
+                        "add_value": "3.5",
+                        "sub_value": "1.5"
+                    },
+                    "inputs": [
+                        {"input_numbers": {"node_name": "request",
+                                           "data_item": "pipeline_input"}}
+                    ],
+                    "outputs": [
+                        {"data_item": "output_numbers",
+                         "alias": "custom_output"}
+                    ]
+                }
+            ],
+            "outputs": [
+                {"pipeline_output": {"node_name": "custom_node",
+                                     "data_item": "custom_output"}
+                }
+            ]
+        }
+    ]
+})";
+
+class CustomNodeConfigTest : public TestWithTempDir {};
+
+TEST_F(CustomNodeConfigTest, PipelineWithLibraryFromConfig) {
+    std::string fileToReload = directoryPath + "/ovms_config_file.json";
+    createConfigFileWithContent(pipelineCustomNodeConfig, fileToReload);
+    ConstructorEnabledModelManager manager;
+    ASSERT_EQ(manager.loadConfig(fileToReload), StatusCode::OK);
+
+    PredictRequest request;
+    PredictResponse response;
+    std::vector<float> data{1.0, 2.0, 3.0};
+    auto& proto = (*request.mutable_inputs())["pipeline_input"];
+    proto.set_dtype(tensorflow::DataType::DT_FLOAT);
+    proto.mutable_tensor_content()->assign((char*)data.data(), data.size() * sizeof(float));
+    proto.mutable_tensor_shape()->add_dim()->set_size(1);
+    proto.mutable_tensor_shape()->add_dim()->set_size(data.size());
+
+    std::unique_ptr<Pipeline> pipeline;
+    ASSERT_EQ(manager.createPipeline(pipeline, "pipelineCustom", &request, &response), StatusCode::OK);
+    ASSERT_EQ(pipeline->execute(), StatusCode::OK);
+    const auto& output = response.outputs().at("pipeline_output");
+    ASSERT_EQ(output.tensor_content().size(), data.size() * sizeof(float));
+    auto actual = reinterpret_cast<const float*>(output.tensor_content().data());
+    for (size_t i = 0; i < data.size(); i++) {
+        EXPECT_EQ(actual[i], data[i] + 2.0);
+    }
+}
+
+TEST_F(CustomNodeConfigTest, MissingLibraryFailsValidation) {
+    std::string config = pipelineCustomNodeConfig;
+    const std::string libraryPath = "/ovms/bazel-bin/src/libcustom_node_add_sub.so";
+    config.replace(config.find(libraryPath), libraryPath.size(), "/ovms/not_existing_library.so");
+    std::string fileToReload = directoryPath + "/ovms_config_file.json";
+    createConfigFileWithContent(config, fileToReload);
+    ConstructorEnabledModelManager manager;
+    manager.loadConfig(fileToReload);
+
+    PredictRequest request;
+    PredictResponse response;
+    std::unique_ptr<Pipeline> pipeline;
+    EXPECT_EQ(manager.createPipeline(pipeline, "pipelineCustom", &request, &response), StatusCode::PIPELINE_DEFINITION_NAME_MISSING);
+}
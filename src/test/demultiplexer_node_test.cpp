@@ -0,0 +1,259 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../demultiplexer_node.hpp"
+#include "../gather_node.hpp"
+#include "../pipelinedefinition.hpp"
+#include "test_utils.hpp"
+
+using namespace ovms;
+using namespace tensorflow;
+using namespace tensorflow::serving;
+
+TEST(DemultiplexerNode, SliceSharesMemoryWithParent) {
+    std::vector<float> data{1, 2, 3, 4, 5, 6};
+    InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {3, 2}, InferenceEngine::Layout::NC);
+    auto blob = InferenceEngine::make_shared_blob<float>(desc, data.data(), data.size());
+    for (size_t i = 0; i < 3; i++) {
+        InferenceEngine::Blob::Ptr slice;
+        ASSERT_EQ(DemultiplexerNode::slice(blob, i, slice), StatusCode::OK);
+        EXPECT_EQ(slice->getTensorDesc().getDims(), (InferenceEngine::SizeVector{2}));
+        EXPECT_EQ(slice->buffer().as<float*>(), data.data() + i * 2);
+    }
+}
+
+TEST(DemultiplexerNode, SliceWrongDimension) {
+    std::vector<float> data{1, 2, 3, 4, 5, 6};
+    auto blob = InferenceEngine::make_shared_blob<float>(
+        InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32, {2, 3}, InferenceEngine::Layout::NC), data.data(), data.size());
+    InferenceEngine::Blob::Ptr slice;
+    EXPECT_EQ(DemultiplexerNode::slice(blob, 2, slice), StatusCode::PIPELINE_WRONG_DEMULTIPLEXER_DIMENSION);
+    auto flat = InferenceEngine::make_shared_blob<float>(
+        InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32, {6}, InferenceEngine::Layout::C), data.data(), data.size());
+    EXPECT_EQ(DemultiplexerNode::slice(flat, 0, slice), StatusCode::PIPELINE_WRONG_DEMULTIPLEXER_DIMENSION);
+}
+
+TEST(DemultiplexerNode, PartsCountFromFirstDimension) {
+    std::vector<float> data{1, 2, 3, 4, 5, 6};
+    auto blob = [&data](InferenceEngine::SizeVector dims) {
+        return InferenceEngine::make_shared_blob<float>(
+            InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32, dims, InferenceEngine::TensorDesc::getLayoutByDims(dims)), data.data(), data.size());
+    };
+    size_t count = 0;
+    ASSERT_EQ(DemultiplexerNode::getPartsCount({{"a", blob({2, 3})}, {"b", blob({2, 1, 3})}}, 3, count), StatusCode::OK);
+    EXPECT_EQ(count, 2);
+    ASSERT_EQ(DemultiplexerNode::getPartsCount({{"a", blob({3, 2})}}, 3, count), StatusCode::OK);
+    EXPECT_EQ(count, 3);
+    EXPECT_EQ(DemultiplexerNode::getPartsCount({{"a", blob({6, 1})}}, 3, count), StatusCode::PIPELINE_WRONG_DEMULTIPLEXER_DIMENSION);
+    EXPECT_EQ(DemultiplexerNode::getPartsCount({{"a", blob({2, 3})}, {"b", blob({3, 2})}}, 3, count), StatusCode::PIPELINE_WRONG_DEMULTIPLEXER_DIMENSION);
+    EXPECT_EQ(DemultiplexerNode::getPartsCount({{"a", blob({6})}}, 6, count), StatusCode::PIPELINE_WRONG_DEMULTIPLEXER_DIMENSION);
+}
+
+TEST(GatherNode, Concatenate) {
+    std::vector<float> first{1, 2}, second{3, 4};
+    InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, 2}, InferenceEngine::Layout::NC);
+    std::vector<InferenceEngine::Blob::Ptr> blobs{
+        InferenceEngine::make_shared_blob<float>(desc, first.data(), first.size()),
+        InferenceEngine::make_shared_blob<float>(desc, second.data(), second.size())};
+    InferenceEngine::Blob::Ptr result;
+    ASSERT_EQ(GatherNode::concatenate(blobs, result), StatusCode::OK);
+    EXPECT_EQ(result->getTensorDesc().getDims(), (InferenceEngine::SizeVector{2, 1, 2}));
+    auto actual = result->buffer().as<float*>();
+    EXPECT_EQ(std::vector<float>(actual, actual + 4), (std::vector<float>{1, 2, 3, 4}));
+}
+
+TEST(GatherNode, ConcatenateInconsistentShapes) {
+    std::vector<float> data{1, 2, 3};
+    std::vector<InferenceEngine::Blob::Ptr> blobs{
+        InferenceEngine::make_shared_blob<float>(InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32, {1, 2}, InferenceEngine::Layout::NC), data.data(), 2),
+        InferenceEngine::make_shared_blob<float>(InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32, {1, 3}, InferenceEngine::Layout::NC), data.data(), 3)};
+    InferenceEngine::Blob::Ptr result;
+    EXPECT_EQ(GatherNode::concatenate(blobs, result), StatusCode::PIPELINE_INCONSISTENT_GATHER_SHAPES);
+}
+
+// Test library returning its single FP32 input "input" increased by 1 under name "output"
+static int addOneExecute(const struct CustomNodeTensor* inputs, int inputsCount, struct CustomNodeTensor** outputs, int* outputsCount, const struct CustomNodeParam*, int) {
+    if (inputsCount != 1 || inputs[0].precision != CUSTOM_NODE_TENSOR_PRECISION_FP32) {
+        return 1;
+    }
+    auto output = static_cast<struct CustomNodeTensor*>(malloc(sizeof(struct CustomNodeTensor)));
+    output->name = strdup("output");
+    output->dataBytes = inputs[0].dataBytes;
+    output->data = static_cast<uint8_t*>(malloc(output->dataBytes));
+    output->dimsCount = inputs[0].dimsCount;
+    output->dims = static_cast<uint64_t*>(malloc(output->dimsCount * sizeof(uint64_t)));
+    memcpy(output->dims, inputs[0].dims, output->dimsCount * sizeof(uint64_t));
+    output->precision = CUSTOM_NODE_TENSOR_PRECISION_FP32;
+    auto inputData = reinterpret_cast<const float*>(inputs[0].data);
+    auto outputData = reinterpret_cast<float*>(output->data);
+    for (size_t i = 0; i < output->dataBytes / sizeof(float); i++) {
+        outputData[i] = inputData[i] + 1;
+    }
+    *outputs = output;
+    *outputsCount = 1;
+    return 0;
+}
+
+static int freeRelease(void* ptr) {
+    free(ptr);
+    return 0;
+}
+
+class DemultiplexerPipelineTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        library.execute = addOneExecute;
+        library.release = freeRelease;
+
+        auto& proto = (*request.mutable_inputs())["pipeline_input"];
+        proto.set_dtype(tensorflow::DataType::DT_FLOAT);
+        proto.mutable_tensor_content()->assign((char*)requestData.data(), requestData.size() * sizeof(float));
+        proto.mutable_tensor_shape()->add_dim()->set_size(3);
+        proto.mutable_tensor_shape()->add_dim()->set_size(1);
+        proto.mutable_tensor_shape()->add_dim()->set_size(2);
+
+        // request O--->O demultiplexer (x3) O--->O per object node O--->O response
+        connections["demultiplexer"] = {
+            {ENTRY_NODE_NAME, {{"pipeline_input", "input"}}}};
+        connections["per_object"] = {
+            {"demultiplexer", {{"custom_output", "input"}}}};
+        connections[EXIT_NODE_NAME] = {
+            {"per_object", {{"custom_output", "pipeline_output"}}}};
+    }
+
+    std::vector<NodeInfo> createNodeInfos(std::optional<std::string> gatherFromNode = std::nullopt, std::optional<ExecutionCondition> condition = std::nullopt) {
+        return {
+            {NodeKind::ENTRY, ENTRY_NODE_NAME, "", std::nullopt, {{"pipeline_input", "pipeline_input"}}},
+            {NodeKind::CUSTOM, "demultiplexer", "", std::nullopt, {{"custom_output", "output"}}, library, {}, 3},
+            {NodeKind::CUSTOM, "per_object", "", std::nullopt, {{"custom_output", "output"}}, library, {}, std::nullopt, gatherFromNode, condition},
+            {NodeKind::EXIT, EXIT_NODE_NAME},
+        };
+    }
+
+    NodeLibrary library;
+    pipeline_connections_t connections;
+    PredictRequest request;
+    PredictResponse response;
+    const std::vector<float> requestData{-5.0, 3.0, 0.0, -12.0, 9.0, -100.0};
+};
+
+TEST_F(DemultiplexerPipelineTest, FanOutAndGather) {
+    ConstructorEnabledModelManager manager;
+    PipelineDefinition definition("demultiplexer_pipeline", createNodeInfos(), connections);
+    ASSERT_EQ(definition.validate(manager), StatusCode::OK);
+
+    std::unique_ptr<Pipeline> pipeline;
+    ASSERT_EQ(definition.create(pipeline, &request, &response, manager), StatusCode::OK);
+    ASSERT_EQ(pipeline->execute(), StatusCode::OK);
+
+    const auto& proto = response.outputs().at("pipeline_output");
+    ASSERT_EQ(proto.tensor_shape().dim_size(), 3);
+    EXPECT_EQ(proto.tensor_shape().dim(0).size(), 3);
+    EXPECT_EQ(proto.tensor_shape().dim(1).size(), 1);
+    EXPECT_EQ(proto.tensor_shape().dim(2).size(), 2);
+    ASSERT_EQ(proto.tensor_content().size(), requestData.size() * sizeof(float));
+    auto actual = reinterpret_cast<const float*>(proto.tensor_content().data());
+    for (size_t i = 0; i < requestData.size(); i++) {
+        EXPECT_EQ(actual[i], requestData[i] + 2);
+    }
+}
+
+TEST_F(DemultiplexerPipelineTest, GatherWithSkippedReplica) {
+    ConstructorEnabledModelManager manager;
+    // Second slice {1, -11} does not satisfy the condition
+    PipelineDefinition definition("demultiplexer_pipeline",
+        createNodeInfos(std::nullopt, ExecutionCondition("demultiplexer", "custom_output", ConditionPredicate::ANY_GREATER, 3.0)), connections);
+    ASSERT_EQ(definition.validate(manager), StatusCode::OK);
+
+    std::unique_ptr<Pipeline> pipeline;
+    ASSERT_EQ(definition.create(pipeline, &request, &response, manager), StatusCode::OK);
+    ASSERT_EQ(pipeline->execute(), StatusCode::OK);
+
+    const auto& proto = response.outputs().at("pipeline_output");
+    ASSERT_EQ(proto.tensor_shape().dim_size(), 3);
+    EXPECT_EQ(proto.tensor_shape().dim(0).size(), 2);
+    ASSERT_EQ(proto.tensor_content().size(), 4 * sizeof(float));
+    auto actual = reinterpret_cast<const float*>(proto.tensor_content().data());
+    EXPECT_EQ(std::vector<float>(actual, actual + 4), (std::vector<float>{-3.0, 5.0, 11.0, -98.0}));
+}
+
+TEST_F(DemultiplexerPipelineTest, AllReplicasSkipped) {
+    ConstructorEnabledModelManager manager;
+    PipelineDefinition definition("demultiplexer_pipeline",
+        createNodeInfos(std::nullopt, ExecutionCondition("demultiplexer", "custom_output", ConditionPredicate::ANY_GREATER, 100.0)), connections);
+    ASSERT_EQ(definition.validate(manager), StatusCode::OK);
+
+    std::unique_ptr<Pipeline> pipeline;
+    ASSERT_EQ(definition.create(pipeline, &request, &response, manager), StatusCode::OK);
+    ASSERT_EQ(pipeline->execute(), StatusCode::OK);
+    EXPECT_EQ(response.outputs().count("pipeline_output"), 0);
+}
+
+TEST_F(DemultiplexerPipelineTest, FewerPartsThanDemultiplyCount) {
+    ConstructorEnabledModelManager manager;
+    request.mutable_inputs()->at("pipeline_input").mutable_tensor_shape()->mutable_dim(0)->set_size(1);
+    request.mutable_inputs()->at("pipeline_input").mutable_tensor_shape()->mutable_dim(1)->set_size(3);
+    PipelineDefinition definition("demultiplexer_pipeline", createNodeInfos(), connections);
+    ASSERT_EQ(definition.validate(manager), StatusCode::OK);
+
+    std::unique_ptr<Pipeline> pipeline;
+    ASSERT_EQ(definition.create(pipeline, &request, &response, manager), StatusCode::OK);
+    ASSERT_EQ(pipeline->execute(), StatusCode::OK);
+
+    const auto& proto = response.outputs().at("pipeline_output");
+    ASSERT_EQ(proto.tensor_shape().dim_size(), 3);
+    EXPECT_EQ(proto.tensor_shape().dim(0).size(), 1);
+    EXPECT_EQ(proto.tensor_shape().dim(1).size(), 3);
+    EXPECT_EQ(proto.tensor_shape().dim(2).size(), 2);
+    ASSERT_EQ(proto.tensor_content().size(), requestData.size() * sizeof(float));
+    auto actual = reinterpret_cast<const float*>(proto.tensor_content().data());
+    for (size_t i = 0; i < requestData.size(); i++) {
+        EXPECT_EQ(actual[i], requestData[i] + 2);
+    }
+}
+
+TEST_F(DemultiplexerPipelineTest, MorePartsThanDemultiplyCount) {
+    ConstructorEnabledModelManager manager;
+    request.mutable_inputs()->at("pipeline_input").mutable_tensor_shape()->mutable_dim(0)->set_size(6);
+    request.mutable_inputs()->at("pipeline_input").mutable_tensor_shape()->mutable_dim(2)->set_size(1);
+    PipelineDefinition definition("demultiplexer_pipeline", createNodeInfos(), connections);
+    ASSERT_EQ(definition.validate(manager), StatusCode::OK);
+
+    std::unique_ptr<Pipeline> pipeline;
+    ASSERT_EQ(definition.create(pipeline, &request, &response, manager), StatusCode::OK);
+    EXPECT_EQ(pipeline->execute(), StatusCode::PIPELINE_WRONG_DEMULTIPLEXER_DIMENSION);
+}
+
+TEST_F(DemultiplexerPipelineTest, GatherFromNotDemultiplexer) {
+    ConstructorEnabledModelManager manager;
+    PipelineDefinition definition("demultiplexer_pipeline", createNodeInfos("per_object"), connections);
+    EXPECT_EQ(definition.validate(manager), StatusCode::PIPELINE_NODE_GATHER_FROM_NOT_DEMULTIPLEXER);
+}
+
+TEST_F(DemultiplexerPipelineTest, NestedDemultiplexersNotSupported) {
+    ConstructorEnabledModelManager manager;
+    auto nodeInfos = createNodeInfos();
+    nodeInfos[2].demultiplyCount = 2;
+    PipelineDefinition definition("demultiplexer_pipeline", nodeInfos, connections);
+    EXPECT_EQ(definition.validate(manager), StatusCode::PIPELINE_DEMULTIPLEXER_NESTING_NOT_SUPPORTED);
+}
@@ -204,6 +204,52 @@ TEST_P(GRPCPredictRequest, ShouldSuccessForSupportedPrecision) {
     EXPECT_TRUE(status.ok());
 }
 
+TEST_F(GRPCPredictRequest, ShouldConvertPrecisionWhenAllowed) {
+    tensorMap[tensorName]->setPrecisionConversionAllowed(true);
+    auto& input = (*request.mutable_inputs())[tensorName];
+    input.set_dtype(tensorflow::DataType::DT_UINT8);
+    *(input.mutable_tensor_content()) = std::string{0, 1, static_cast<char>(255)};
+    std::shared_ptr<MockIInferRequest> mInferRequestPtr = std::make_shared<MockIInferRequest>();
+    InferenceEngine::InferRequest inferRequest(mInferRequestPtr);
+    InferenceEngine::Blob::Ptr blob;
+    EXPECT_CALL(*mInferRequestPtr, SetBlob(_, _, _)).WillOnce(testing::DoAll(testing::SaveArg<1>(&blob), testing::Return(InferenceEngine::StatusCode::OK)));
+    auto status = deserializePredictRequest<ConcreteTensorProtoDeserializator>(request, tensorMap, inferRequest);
+    ASSERT_EQ(status, ovms::StatusCode::OK);
+    ASSERT_NE(blob, nullptr);
+    ASSERT_EQ(blob->getTensorDesc().getPrecision(), Precision::FP32);
+    auto actual = blob->buffer().as<float*>();
+    EXPECT_EQ(std::vector<float>(actual, actual + 3), (std::vector<float>{0.0f, 1.0f, 255.0f}));
+}
+
+TEST_F(GRPCPredictRequest, ShouldConvertPaddedFP16ValuesWhenAllowed) {
+    tensorMap[tensorName]->setPrecisionConversionAllowed(true);
+    auto& input = (*request.mutable_inputs())[tensorName];
+    input.set_dtype(tensorflow::DataType::DT_HALF);
+    input.clear_tensor_content();
+    for (int32_t value : {0x3c00, 0xc000, 0x3800}) {
+        input.add_half_val(value);
+    }
+    std::shared_ptr<MockIInferRequest> mInferRequestPtr = std::make_shared<MockIInferRequest>();
+    InferenceEngine::InferRequest inferRequest(mInferRequestPtr);
+    InferenceEngine::Blob::Ptr blob;
+    EXPECT_CALL(*mInferRequestPtr, SetBlob(_, _, _)).WillOnce(testing::DoAll(testing::SaveArg<1>(&blob), testing::Return(InferenceEngine::StatusCode::OK)));
+    auto status = deserializePredictRequest<ConcreteTensorProtoDeserializator>(request, tensorMap, inferRequest);
+    ASSERT_EQ(status, ovms::StatusCode::OK);
+    ASSERT_NE(blob, nullptr);
+    auto actual = blob->buffer().as<float*>();
+    EXPECT_EQ(std::vector<float>(actual, actual + 3), (std::vector<float>{1.0f, -2.0f, 0.5f}));
+}
+
+TEST_F(GRPCPredictRequest, ShouldRejectConvertedInputWithInvalidContentSize) {
+    tensorMap[tensorName]->setPrecisionConversionAllowed(true);
+    auto& input = (*request.mutable_inputs())[tensorName];
+    input.set_dtype(tensorflow::DataType::DT_INT16);
+    *(input.mutable_tensor_content()) = std::string(3, '1');
+    InferenceEngine::InferRequest inferRequest;
+    auto status = deserializePredictRequest<ConcreteTensorProtoDeserializator>(request, tensorMap, inferRequest);
+    EXPECT_EQ(status, ovms::StatusCode::INVALID_CONTENT_SIZE);
+}
+
 TEST_P(DeserializeTFTensorProtoNegative, ShouldReturnNullptrForPrecision) {
     Precision testedPrecision = GetParam();
     tensorMap[tensorName]->setPrecision(testedPrecision);
@@ -225,6 +271,20 @@ TEST_P(DeserializeTFTensorProto, ShouldReturnValidBlob) {
                                 << " should return valid blob ptr";
 }
 
+TEST_F(DeserializeTFTensorProto, ShouldPackPaddedFP16Values) {
+    tensorMap[tensorName]->setPrecision(Precision::FP16);
+    tensorProto.Clear();
+    tensorProto.set_dtype(tensorflow::DataType::DT_HALF);
+    for (int32_t value : {0x3c00, 0xc000, 0x3800}) {
+        tensorProto.add_half_val(value);
+    }
+    InferenceEngine::Blob::Ptr blobPtr = deserializeTensorProto<ConcreteTensorProtoDeserializator>(tensorProto, tensorMap[tensorName]);
+    ASSERT_NE(nullptr, blobPtr);
+    ASSERT_EQ(blobPtr->size(), 3u);
+    auto actual = blobPtr->buffer().as<uint16_t*>();
+    EXPECT_EQ(std::vector<uint16_t>(actual, actual + 3), (std::vector<uint16_t>{0x3c00, 0xc000, 0x3800}));
+}
+
 INSTANTIATE_TEST_SUITE_P(
     TestDeserialize,
     GRPCPredictRequestNegative,
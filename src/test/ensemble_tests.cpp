@@ -133,6 +133,31 @@ TEST_F(EnsembleFlowTest, DummyModel) {
     checkDummyResponse(dummySeriallyConnectedCount);
 }
 
+TEST_F(EnsembleFlowTest, ExpiredDeadlineOrCancelledRequestDoesNotStartNodes) {
+    ConstructorEnabledModelManager managerWithDummyModel;
+    managerWithDummyModel.reloadModelWithVersions(config);
+
+    auto input_node = std::make_unique<EntryNode>(&request);
+    auto model_node = std::make_unique<DLNode>("dummy_node", dummyModelName, requestedModelVersion, managerWithDummyModel);
+    auto output_node = std::make_unique<ExitNode>(&response);
+
+    Pipeline pipeline(*input_node, *output_node);
+    pipeline.connect(*input_node, *model_node, {{customPipelineInputName, DUMMY_MODEL_INPUT_NAME}});
+    pipeline.connect(*model_node, *output_node, {{DUMMY_MODEL_OUTPUT_NAME, customPipelineOutputName}});
+
+    pipeline.push(std::move(input_node));
+    pipeline.push(std::move(model_node));
+    pipeline.push(std::move(output_node));
+
+    EXPECT_EQ(pipeline.execute(Deadline::fromNow(std::chrono::milliseconds(0))), StatusCode::DEADLINE_EXCEEDED);
+    EXPECT_EQ(pipeline.execute(Deadline(std::nullopt, []() { return true; })), StatusCode::REQUEST_CANCELLED);
+    EXPECT_EQ(response.outputs_size(), 0);
+
+    EXPECT_EQ(pipeline.execute(Deadline::fromNow(std::chrono::seconds(60))), StatusCode::OK);
+    const int dummySeriallyConnectedCount = 1;
+    checkDummyResponse(dummySeriallyConnectedCount);
+}
+
 TEST_F(EnsembleFlowTest, DummyModelDirectAndPipelineInference) {
     ConstructorEnabledModelManager managerWithDummyModel;
     config.setNireq(1);
@@ -1260,6 +1285,49 @@ TEST_F(EnsembleFlowTest, SimplePipelineFactoryCreation) {
     checkDummyResponse(dummySeriallyConnectedCount);
 }
 
+TEST_F(EnsembleFlowTest, PipelineFactoryCreationWithOutputFilter) {
+    ConstructorEnabledModelManager managerWithDummyModel;
+    managerWithDummyModel.reloadModelWithVersions(config);
+
+    PipelineFactory factory;
+
+    // Nodes
+    // request   dummy_node    response
+    //  O--------->O---------->O
+    //  |                      ^
+    //  |______________________|
+
+    std::vector<NodeInfo> info{
+        {NodeKind::ENTRY, ENTRY_NODE_NAME, "", std::nullopt, {{customPipelineInputName, customPipelineInputName}}},
+        {NodeKind::DL, "dummy_node", "dummy", std::nullopt, {{DUMMY_MODEL_OUTPUT_NAME, DUMMY_MODEL_OUTPUT_NAME}}},
+        {NodeKind::EXIT, EXIT_NODE_NAME},
+    };
+
+    pipeline_connections_t connections;
+
+    connections["dummy_node"] = {
+        {ENTRY_NODE_NAME, {{customPipelineInputName, DUMMY_MODEL_INPUT_NAME}}}};
+
+    connections[EXIT_NODE_NAME] = {
+        {"dummy_node", {{DUMMY_MODEL_OUTPUT_NAME, customPipelineOutputName}}},
+        {ENTRY_NODE_NAME, {{customPipelineInputName, "passthrough"}}}};
+
+    ASSERT_EQ(factory.createDefinition("my_new_pipeline", info, connections, managerWithDummyModel), StatusCode::OK);
+
+    std::unique_ptr<Pipeline> pipeline;
+
+    // Unrequested passthrough output is not fetched from entry node
+    request.add_output_filter(customPipelineOutputName);
+    ASSERT_EQ(factory.create(pipeline, "my_new_pipeline", &request, &response, managerWithDummyModel), StatusCode::OK);
+    ASSERT_EQ(pipeline->execute(), StatusCode::OK);
+    EXPECT_EQ(response.outputs_size(), 1);
+    const int dummySeriallyConnectedCount = 1;
+    checkDummyResponse(dummySeriallyConnectedCount);
+
+    request.add_output_filter("unknown");
+    EXPECT_EQ(factory.create(pipeline, "my_new_pipeline", &request, &response, managerWithDummyModel), StatusCode::INVALID_OUTPUT_FILTER);
+}
+
 TEST_F(EnsembleFlowTest, ParallelPipelineFactoryUsage) {
     // Prepare manager
     ConstructorEnabledModelManager managerWithDummyModel;
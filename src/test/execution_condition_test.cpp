@@ -0,0 +1,189 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../execution_condition.hpp"
+#include "../pipelinedefinition.hpp"
+#include "test_utils.hpp"
+
+using namespace ovms;
+using namespace tensorflow;
+using namespace tensorflow::serving;
+
+TEST(ExecutionCondition, AnyGreater) {
+    std::vector<float> data{0.1, 0.7, 0.3};
+    auto blob = InferenceEngine::make_shared_blob<float>(
+        InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32, {1, 3}, InferenceEngine::Layout::NC), data.data(), data.size());
+    bool result = false;
+    ASSERT_EQ(ExecutionCondition("node", "scores", ConditionPredicate::ANY_GREATER, 0.5).evaluate(blob, result), StatusCode::OK);
+    EXPECT_TRUE(result);
+    ASSERT_EQ(ExecutionCondition("node", "scores", ConditionPredicate::ANY_GREATER, 0.7).evaluate(blob, result), StatusCode::OK);
+    EXPECT_FALSE(result);
+}
+
+TEST(ExecutionCondition, AnyGreaterIntegerFlag) {
+    std::vector<int32_t> data{0};
+    auto blob = InferenceEngine::make_shared_blob<int32_t>(
+        InferenceEngine::TensorDesc(InferenceEngine::Precision::I32, {1}, InferenceEngine::Layout::C), data.data(), data.size());
+    bool result = true;
+    ASSERT_EQ(ExecutionCondition("node", "flag", ConditionPredicate::ANY_GREATER).evaluate(blob, result), StatusCode::OK);
+    EXPECT_FALSE(result);
+}
+
+TEST(ExecutionCondition, NotEmpty) {
+    std::vector<float> data{1.0};
+    auto blob = InferenceEngine::make_shared_blob<float>(
+        InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32, {1, 1}, InferenceEngine::Layout::NC), data.data(), data.size());
+    bool result = false;
+    ASSERT_EQ(ExecutionCondition("node", "detections").evaluate(blob, result), StatusCode::OK);
+    EXPECT_TRUE(result);
+}
+
+TEST(ExecutionCondition, UnsupportedPrecision) {
+    std::vector<int64_t> data{1};
+    auto blob = InferenceEngine::make_shared_blob<int64_t>(
+        InferenceEngine::TensorDesc(InferenceEngine::Precision::I64, {1}, InferenceEngine::Layout::C), data.data(), data.size());
+    bool result = false;
+    EXPECT_EQ(ExecutionCondition("node", "flag", ConditionPredicate::ANY_GREATER).evaluate(blob, result), StatusCode::PIPELINE_CONDITION_UNSUPPORTED_PRECISION);
+}
+
+TEST(ExecutionCondition, PredicateFromString) {
+    ConditionPredicate predicate;
+    ASSERT_EQ(toConditionPredicate("any_greater", predicate), StatusCode::OK);
+    EXPECT_EQ(predicate, ConditionPredicate::ANY_GREATER);
+    ASSERT_EQ(toConditionPredicate("not_empty", predicate), StatusCode::OK);
+    EXPECT_EQ(predicate, ConditionPredicate::NOT_EMPTY);
+    EXPECT_EQ(toConditionPredicate("less", predicate), StatusCode::PIPELINE_CONDITION_WRONG_PREDICATE);
+}
+
+static int executedCount = 0;
+
+// Test library returning its single FP32 input increased by 1 under name "output"
+static int addOneExecute(const struct CustomNodeTensor* inputs, int inputsCount, struct CustomNodeTensor** outputs, int* outputsCount, const struct CustomNodeParam*, int) {
+    executedCount++;
+    if (inputsCount != 1 || inputs[0].precision != CUSTOM_NODE_TENSOR_PRECISION_FP32) {
+        return 1;
+    }
+    auto output = static_cast<struct CustomNodeTensor*>(malloc(sizeof(struct CustomNodeTensor)));
+    output->name = strdup("output");
+    output->dataBytes = inputs[0].dataBytes;
+    output->data = static_cast<uint8_t*>(malloc(output->dataBytes));
+    output->dimsCount = inputs[0].dimsCount;
+    output->dims = static_cast<uint64_t*>(malloc(output->dimsCount * sizeof(uint64_t)));
+    memcpy(output->dims, inputs[0].dims, output->dimsCount * sizeof(uint64_t));
+    output->precision = CUSTOM_NODE_TENSOR_PRECISION_FP32;
+    auto inputData = reinterpret_cast<const float*>(inputs[0].data);
+    auto outputData = reinterpret_cast<float*>(output->data);
+    for (size_t i = 0; i < output->dataBytes / sizeof(float); i++) {
+        outputData[i] = inputData[i] + 1;
+    }
+    *outputs = output;
+    *outputsCount = 1;
+    return 0;
+}
+
+static int freeRelease(void* ptr) {
+    free(ptr);
+    return 0;
+}
+
+class ConditionalPipelineTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        library.execute = addOneExecute;
+        library.release = freeRelease;
+        executedCount = 0;
+
+        auto& proto = (*request.mutable_inputs())["pipeline_input"];
+        proto.set_dtype(tensorflow::DataType::DT_FLOAT);
+        proto.mutable_tensor_content()->assign((char*)requestData.data(), requestData.size() * sizeof(float));
+        proto.mutable_tensor_shape()->add_dim()->set_size(1);
+        proto.mutable_tensor_shape()->add_dim()->set_size(requestData.size());
+
+        // request O--->O first_stage O--->O second_stage (if first_stage output any greater than threshold) O--->O response
+        //                            O------------------------------------------------------------------------->O response
+        connections["first_stage"] = {
+            {ENTRY_NODE_NAME, {{"pipeline_input", "input"}}}};
+        connections["second_stage"] = {
+            {"first_stage", {{"custom_output", "input"}}}};
+        connections["third_stage"] = {
+            {"second_stage", {{"custom_output", "input"}}}};
+        connections[EXIT_NODE_NAME] = {
+            {"first_stage", {{"custom_output", "scores"}}},
+            {"third_stage", {{"custom_output", "pipeline_output"}}}};
+    }
+
+    Status executePipeline(const ExecutionCondition& condition) {
+        std::vector<NodeInfo> info{
+            {NodeKind::ENTRY, ENTRY_NODE_NAME, "", std::nullopt, {{"pipeline_input", "pipeline_input"}}},
+            {NodeKind::CUSTOM, "first_stage", "", std::nullopt, {{"custom_output", "output"}}, library},
+            {NodeKind::CUSTOM, "second_stage", "", std::nullopt, {{"custom_output", "output"}}, library, {}, std::nullopt, std::nullopt, condition},
+            {NodeKind::CUSTOM, "third_stage", "", std::nullopt, {{"custom_output", "output"}}, library},
+            {NodeKind::EXIT, EXIT_NODE_NAME},
+        };
+        PipelineDefinition definition("conditional_pipeline", info, connections);
+        auto status = definition.validate(manager);
+        if (!status.ok()) {
+            return status;
+        }
+        std::unique_ptr<Pipeline> pipeline;
+        status = definition.create(pipeline, &request, &response, manager);
+        if (!status.ok()) {
+            return status;
+        }
+        return pipeline->execute();
+    }
+
+    ConstructorEnabledModelManager manager;
+    NodeLibrary library;
+    pipeline_connections_t connections;
+    PredictRequest request;
+    PredictResponse response;
+    const std::vector<float> requestData{0.1, 0.2, 0.3};
+};
+
+TEST_F(ConditionalPipelineTest, ConditionSatisfied) {
+    ASSERT_EQ(executePipeline({"first_stage", "custom_output", ConditionPredicate::ANY_GREATER, 1.25}), StatusCode::OK);
+    EXPECT_EQ(executedCount, 3);
+    EXPECT_EQ(response.outputs().count("scores"), 1u);
+    ASSERT_EQ(response.outputs().count("pipeline_output"), 1u);
+    auto actual = reinterpret_cast<const float*>(response.outputs().at("pipeline_output").tensor_content().data());
+    for (size_t i = 0; i < requestData.size(); i++) {
+        EXPECT_EQ(actual[i], requestData[i] + 3);
+    }
+}
+
+TEST_F(ConditionalPipelineTest, SkippedNodesReturnPartialResponse) {
+    ASSERT_EQ(executePipeline({"first_stage", "custom_output", ConditionPredicate::ANY_GREATER, 1.5}), StatusCode::OK);
+    // Second and third stage are skipped
+    EXPECT_EQ(executedCount, 1);
+    EXPECT_EQ(response.outputs().count("scores"), 1u);
+    EXPECT_EQ(response.outputs().count("pipeline_output"), 0u);
+}
+
+TEST_F(ConditionalPipelineTest, ConditionOnNotConnectedNode) {
+    EXPECT_EQ(executePipeline({ENTRY_NODE_NAME, "pipeline_input"}), StatusCode::PIPELINE_CONDITION_NOT_ON_DEPENDENCY);
+}
+
+TEST_F(ConditionalPipelineTest, ConditionOnMissingDataItem) {
+    EXPECT_EQ(executePipeline({"first_stage", "not_existing"}), StatusCode::PIPELINE_NODE_REFERING_TO_MISSING_DATA_SOURCE);
+}
@@ -251,6 +251,40 @@ TEST_F(GetModelMetadataResponseBuild, HasCorrectShape) {
         {2, 20, 3}));
 }
 
+TEST_F(GetModelMetadataResponse, ReportsPostProcessedOutputs) {
+    ovms::PostProcessingConfig topK;
+    topK.kind = ovms::PostProcessingKind::TOP_K;
+    topK.k = 2;
+    networkOutputs.at("Output_FP32_2_20_3")->setPostProcessing(topK);
+    ovms::PostProcessingConfig argmax;
+    argmax.kind = ovms::PostProcessingKind::ARGMAX;
+    networkOutputs.at("Output_I32_1_2000")->setPostProcessing(argmax);
+    ASSERT_EQ(ovms::GetModelMetadataImpl::buildResponse(instance, &response), ovms::StatusCode::OK);
+
+    tensorflow::serving::SignatureDefMap def;
+    response.metadata().at("signature_def").UnpackTo(&def);
+    const auto& outputs = ((*def.mutable_signature_def())["serving_default"]).outputs();
+    ASSERT_EQ(outputs.size(), 3);
+
+    const auto& values = outputs.at("Output_FP32_2_20_3");
+    EXPECT_EQ(values.dtype(), tensorflow::DT_FLOAT);
+    ASSERT_EQ(values.tensor_shape().dim_size(), 3);
+    EXPECT_EQ(values.tensor_shape().dim(2).size(), 2);
+
+    const auto& indices = outputs.at("Output_FP32_2_20_3_indices");
+    EXPECT_EQ(indices.name(), "Output_FP32_2_20_3_indices");
+    EXPECT_EQ(indices.dtype(), tensorflow::DT_INT32);
+    ASSERT_EQ(indices.tensor_shape().dim_size(), 3);
+    EXPECT_EQ(indices.tensor_shape().dim(0).size(), 2);
+    EXPECT_EQ(indices.tensor_shape().dim(1).size(), 20);
+    EXPECT_EQ(indices.tensor_shape().dim(2).size(), 2);
+
+    const auto& argmaxIndices = outputs.at("Output_I32_1_2000");
+    EXPECT_EQ(argmaxIndices.dtype(), tensorflow::DT_INT32);
+    ASSERT_EQ(argmaxIndices.tensor_shape().dim_size(), 1);
+    EXPECT_EQ(argmaxIndices.tensor_shape().dim(0).size(), 1);
+}
+
 TEST_F(GetModelMetadataResponse, ModelVersionNotLoadedAnymore) {
     instance->unloadModel();
     EXPECT_EQ(ovms::GetModelMetadataImpl::buildResponse(instance, &response), ovms::StatusCode::MODEL_VERSION_NOT_LOADED_ANYMORE);
@@ -0,0 +1,237 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../benchmark/latency_histogram.hpp"
+#include "../benchmark/loadgen_utils.hpp"
+
+using namespace ovms;
+
+using tensorflow::DataType;
+using tensorflow::serving::GetModelMetadataResponse;
+using tensorflow::serving::PredictRequest;
+
+namespace {
+
+GetModelMetadataResponse createMetadata() {
+    tensorflow::serving::SignatureDefMap signatures;
+    auto& signature = (*signatures.mutable_signature_def())["serving_default"];
+    auto& image = (*signature.mutable_inputs())["image"];
+    image.set_dtype(DataType::DT_FLOAT);
+    for (auto dim : {-1, 3, 4, 4}) {
+        image.mutable_tensor_shape()->add_dim()->set_size(dim);
+    }
+    auto& mask = (*signature.mutable_inputs())["mask"];
+    mask.set_dtype(DataType::DT_HALF);
+    for (auto dim : {1, -1}) {
+        mask.mutable_tensor_shape()->add_dim()->set_size(dim);
+    }
+    GetModelMetadataResponse response;
+    (*response.mutable_metadata())["signature_def"].PackFrom(signatures);
+    return response;
+}
+
+}  // namespace
+
+TEST(LatencyHistogram, SmallValuesAreExact) {
+    LatencyHistogram histogram;
+    for (uint64_t value = 0; value < LatencyHistogram::SUB_BUCKET_COUNT; value++) {
+        EXPECT_EQ(LatencyHistogram::getHighestEquivalentValue(LatencyHistogram::getBucketIndex(value)), value);
+    }
+    histogram.record(7);
+    histogram.record(3);
+    histogram.record(5);
+    EXPECT_EQ(histogram.getCount(), 3);
+    EXPECT_EQ(histogram.getMin(), 3);
+    EXPECT_EQ(histogram.getMax(), 7);
+    EXPECT_DOUBLE_EQ(histogram.getMean(), 5.0);
+    EXPECT_EQ(histogram.getValueAtPercentile(50), 5);
+    EXPECT_EQ(histogram.getValueAtPercentile(100), 7);
+}
+
+TEST(LatencyHistogram, LargeValuesKeepThreeSignificantDigits) {
+    uint64_t previousIndex = 0;
+    for (uint64_t value = 1; value < LatencyHistogram::MAX_TRACKABLE_VALUE; value = value * 3 / 2 + 1) {
+        auto index = LatencyHistogram::getBucketIndex(value);
+        auto highest = LatencyHistogram::getHighestEquivalentValue(index);
+        EXPECT_GE(highest, value);
+        EXPECT_LE(highest - value, value / 1024) << value;
+        EXPECT_LT(LatencyHistogram::getHighestEquivalentValue(index - 1), value) << value;
+        EXPECT_GE(index, previousIndex);
+        previousIndex = index;
+    }
+    LatencyHistogram histogram;
+    histogram.record(LatencyHistogram::MAX_TRACKABLE_VALUE + 100);
+    EXPECT_EQ(histogram.getMax(), LatencyHistogram::MAX_TRACKABLE_VALUE);
+}
+
+TEST(LatencyHistogram, RelativeErrorIsBelowOnePerMille) {
+    // Every value up to 2^22 and then values spread over the rest of the range
+    for (uint64_t value = 1; value < (1ULL << 22); value++) {
+        auto highest = LatencyHistogram::getHighestEquivalentValue(LatencyHistogram::getBucketIndex(value));
+        ASSERT_GE(highest, value);
+        ASSERT_LT(static_cast<double>(highest - value) / value, 0.001) << value;
+    }
+    for (uint64_t value = 1ULL << 22; value < LatencyHistogram::MAX_TRACKABLE_VALUE; value += value / 997 + 1) {
+        auto highest = LatencyHistogram::getHighestEquivalentValue(LatencyHistogram::getBucketIndex(value));
+        ASSERT_GE(highest, value);
+        ASSERT_LT(static_cast<double>(highest - value) / value, 0.001) << value;
+    }
+    LatencyHistogram histogram;
+    const uint64_t value = 123456789;
+    histogram.record(value);
+    histogram.record(value + 1);
+    EXPECT_NEAR(static_cast<double>(histogram.getValueAtPercentile(50)), value, value * 0.001);
+}
+
+TEST(LatencyHistogram, PercentilesOfMergedHistograms) {
+    LatencyHistogram first, second;
+    for (uint64_t value = 1; value <= 5000; value++) {
+        first.record(value);
+        second.record(value + 5000);
+    }
+    first.merge(second);
+    EXPECT_EQ(first.getCount(), 10000);
+    EXPECT_EQ(first.getMin(), 1);
+    EXPECT_EQ(first.getMax(), 10000);
+    EXPECT_NEAR(first.getValueAtPercentile(50), 5000, 10);
+    EXPECT_NEAR(first.getValueAtPercentile(99), 9900, 10);
+    EXPECT_EQ(first.getValueAtPercentile(100), 10000);
+    first.reset();
+    EXPECT_EQ(first.getCount(), 0);
+    EXPECT_EQ(first.getValueAtPercentile(99), 0);
+}
+
+TEST(Loadgen, ParseShapes) {
+    shapes_map_t shapes;
+    std::string error;
+    ASSERT_TRUE(parseShapes("image:1,3,224,224; mask : 1,10", shapes, error)) << error;
+    EXPECT_THAT(shapes["image"], ::testing::ElementsAre(1, 3, 224, 224));
+    EXPECT_THAT(shapes["mask"], ::testing::ElementsAre(1, 10));
+    EXPECT_FALSE(parseShapes("image", shapes, error));
+    EXPECT_FALSE(parseShapes("image:1,-1", shapes, error));
+    EXPECT_FALSE(parseShapes("image:", shapes, error));
+}
+
+TEST(Loadgen, DynamicDimensionsOfMetadata) {
+    std::vector<LoadgenInput> inputs;
+    std::string error;
+    ASSERT_TRUE(parseModelMetadata(createMetadata(), {{"mask", {1, 20}}}, inputs, error)) << error;
+    ASSERT_EQ(inputs.size(), 2);
+    EXPECT_EQ(inputs[0].name, "image");
+    EXPECT_EQ(inputs[0].dtype, DataType::DT_FLOAT);
+    EXPECT_THAT(inputs[0].shape, ::testing::ElementsAre(1, 3, 4, 4));
+    EXPECT_EQ(inputs[1].name, "mask");
+    EXPECT_THAT(inputs[1].shape, ::testing::ElementsAre(1, 20));
+
+    EXPECT_FALSE(parseModelMetadata(createMetadata(), {{"unknown", {1}}}, inputs, error));
+    EXPECT_FALSE(parseModelMetadata(GetModelMetadataResponse(), {}, inputs, error));
+}
+
+TEST(Loadgen, MetadataOfRestApi) {
+    const std::string json = R"({
+        "modelSpec": {"name": "dummy", "version": "1"},
+        "metadata": {"signature_def": {
+            "@type": "type.googleapis.com/tensorflow.serving.SignatureDefMap",
+            "signatureDef": {"serving_default": {
+                "inputs": {"b": {"dtype": "DT_FLOAT", "tensorShape": {"dim": [{"size": "1"}, {"size": "10"}]}, "name": "b"}},
+                "outputs": {"a": {"dtype": "DT_FLOAT", "tensorShape": {"dim": [{"size": "1"}, {"size": "10"}]}, "name": "a"}},
+                "methodName": ""}}}}})";
+    std::vector<LoadgenInput> inputs;
+    std::string error;
+    ASSERT_TRUE(parseModelMetadataJson(json, {}, inputs, error)) << error;
+    ASSERT_EQ(inputs.size(), 1);
+    EXPECT_EQ(inputs[0].name, "b");
+    EXPECT_THAT(inputs[0].shape, ::testing::ElementsAre(1, 10));
+    EXPECT_FALSE(parseModelMetadataJson("{", {}, inputs, error));
+}
+
+TEST(Loadgen, RandomInputsMatchShapes) {
+    std::vector<LoadgenInput> inputs;
+    std::string error;
+    ASSERT_TRUE(parseModelMetadata(createMetadata(), {}, inputs, error)) << error;
+    std::mt19937_64 generator(42);
+    PredictRequest first;
+    ASSERT_TRUE(fillRandomInputs(inputs, generator, first, error)) << error;
+    const auto& image = first.inputs().at("image");
+    EXPECT_EQ(image.tensor_content().size(), 3 * 4 * 4 * sizeof(float));
+    EXPECT_EQ(image.tensor_shape().dim_size(), 4);
+    EXPECT_EQ(first.inputs().at("mask").half_val_size(), 1);
+
+    PredictRequest second;
+    ASSERT_TRUE(fillRandomInputs(inputs, generator, second, error));
+    EXPECT_NE(second.inputs().at("image").tensor_content(), image.tensor_content());
+    std::mt19937_64 sameSeed(42);
+    ASSERT_TRUE(fillRandomInputs(inputs, sameSeed, second, error));
+    EXPECT_EQ(second.inputs().at("image").tensor_content(), image.tensor_content());
+
+    inputs[0].dtype = DataType::DT_STRING;
+    EXPECT_FALSE(fillRandomInputs(inputs, generator, second, error));
+}
+
+TEST(Loadgen, RestBodyIsInColumnFormat) {
+    PredictRequest request;
+    auto& proto = (*request.mutable_inputs())["b"];
+    proto.set_dtype(DataType::DT_INT32);
+    proto.mutable_tensor_shape()->add_dim()->set_size(2);
+    proto.mutable_tensor_shape()->add_dim()->set_size(3);
+    std::vector<int32_t> data{1, 2, 3, 4, 5, 6};
+    proto.set_tensor_content(std::string(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(int32_t)));
+    auto& mask = (*request.mutable_inputs())["a"];
+    mask.set_dtype(DataType::DT_UINT16);
+    mask.mutable_tensor_shape()->add_dim()->set_size(2);
+    mask.add_int_val(7);
+    mask.add_int_val(8);
+
+    std::string body, error;
+    ASSERT_TRUE(createRestBody(request, body, error)) << error;
+    EXPECT_EQ(body, R"({"inputs":{"a":[7,8],"b":[[1,2,3],[4,5,6]]}})");
+
+    mask.add_int_val(9);
+    EXPECT_FALSE(createRestBody(request, body, error));
+}
+
+TEST(Loadgen, HttpResponseWithContentLength) {
+    std::string buffer = "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nContent-Length: 4\r\n\r\n{}";
+    HttpResponse response;
+    EXPECT_EQ(parseHttpResponse(buffer, response), HttpParseResult::INCOMPLETE);
+    buffer += "\n}HTTP/1.1";
+    ASSERT_EQ(parseHttpResponse(buffer, response), HttpParseResult::COMPLETE);
+    EXPECT_EQ(response.statusCode, 200);
+    EXPECT_TRUE(response.keepAlive);
+    EXPECT_EQ(response.body, "{}\n}");
+    EXPECT_EQ(buffer, "HTTP/1.1");
+}
+
+TEST(Loadgen, HttpResponseChunked) {
+    std::string buffer = "HTTP/1.1 404 Not Found\r\nTransfer-Encoding: chunked\r\nConnection: close\r\n\r\n5\r\nhello\r\n";
+    HttpResponse response;
+    EXPECT_EQ(parseHttpResponse(buffer, response), HttpParseResult::INCOMPLETE);
+    buffer += "6;ext=1\r\n world\r\n0\r\n\r\n";
+    ASSERT_EQ(parseHttpResponse(buffer, response), HttpParseResult::COMPLETE);
+    EXPECT_EQ(response.statusCode, 404);
+    EXPECT_FALSE(response.keepAlive);
+    EXPECT_EQ(response.body, "hello world");
+    EXPECT_TRUE(buffer.empty());
+
+    buffer = "garbage\r\n\r\n";
+    EXPECT_EQ(parseHttpResponse(buffer, response), HttpParseResult::INVALID);
+}
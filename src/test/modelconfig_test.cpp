@@ -475,3 +475,136 @@ TEST(ModelConfig, ConfigParseNodeWithForbiddenShapeName) {
     ASSERT_EQ(status, ovms::StatusCode::OK);
     EXPECT_EQ(modelConfig.getShapes().size(), 0);
 }
+
+TEST(ModelConfig, ConfigParseNodePrecisionConversion) {
+    std::string config = R"#(
+        {
+            "name": "alpha",
+            "base_path": "/tmp/models/dummy1",
+            "precision_conversion": ["image", "mask"]
+        }
+    )#";
+
+    rapidjson::Document configJson;
+    rapidjson::ParseResult parsingSucceeded = configJson.Parse(config.c_str());
+    ASSERT_EQ(parsingSucceeded, true);
+    ovms::ModelConfig modelConfig;
+    auto status = modelConfig.parseNode(configJson);
+
+    ASSERT_EQ(status, ovms::StatusCode::OK);
+    EXPECT_TRUE(modelConfig.isPrecisionConversionAllowed("image"));
+    EXPECT_TRUE(modelConfig.isPrecisionConversionAllowed("mask"));
+    EXPECT_FALSE(modelConfig.isPrecisionConversionAllowed("other"));
+
+    ovms::ModelConfig allInputsConfig;
+    allInputsConfig.setPrecisionConversion(true);
+    EXPECT_TRUE(allInputsConfig.isPrecisionConversionAllowed("other"));
+    EXPECT_TRUE(modelConfig.isReloadRequired(allInputsConfig));
+}
+
+TEST(ModelConfig, ConfigParseNodePostProcessing) {
+    std::string config = R"#(
+        {
+            "name": "alpha",
+            "base_path": "/tmp/models/dummy1",
+            "post_processing": {
+                "prob": {"type": "top_k", "k": 5},
+                "logits": {"type": "argmax"},
+                "detection_out": {"type": "detections", "score_threshold": 0.5, "iou_threshold": 0.4, "max_detections": 100}
+            }
+        }
+    )#";
+
+    rapidjson::Document configJson;
+    rapidjson::ParseResult parsingSucceeded = configJson.Parse(config.c_str());
+    ASSERT_EQ(parsingSucceeded, true);
+    ovms::ModelConfig modelConfig;
+    auto status = modelConfig.parseNode(configJson);
+
+    ASSERT_EQ(status, ovms::StatusCode::OK);
+    const auto& postProcessing = modelConfig.getPostProcessing();
+    ASSERT_EQ(postProcessing.size(), 3);
+    EXPECT_EQ(postProcessing.at("prob").kind, ovms::PostProcessingKind::TOP_K);
+    EXPECT_EQ(postProcessing.at("prob").k, 5);
+    EXPECT_EQ(postProcessing.at("logits").kind, ovms::PostProcessingKind::ARGMAX);
+    const auto& detections = postProcessing.at("detection_out");
+    EXPECT_EQ(detections.kind, ovms::PostProcessingKind::DETECTIONS);
+    EXPECT_FLOAT_EQ(detections.scoreThreshold, 0.5f);
+    EXPECT_FLOAT_EQ(detections.iouThreshold, 0.4f);
+    EXPECT_EQ(detections.maxDetections, 100);
+
+    ovms::ModelConfig withoutPostProcessing;
+    EXPECT_TRUE(modelConfig.isReloadRequired(withoutPostProcessing));
+}
+
+TEST(ModelConfig, ConfigParseNodeQueueLimits) {
+    std::string config = R"#(
+        {
+            "name": "alpha",
+            "base_path": "/tmp/models/dummy1",
+            "max_queue_size": 16,
+            "max_queue_wait_ms": 200
+        }
+    )#";
+
+    rapidjson::Document configJson;
+    rapidjson::ParseResult parsingSucceeded = configJson.Parse(config.c_str());
+    ASSERT_EQ(parsingSucceeded, true);
+    ovms::ModelConfig modelConfig;
+    auto status = modelConfig.parseNode(configJson);
+
+    ASSERT_EQ(status, ovms::StatusCode::OK);
+    EXPECT_EQ(modelConfig.getMaxQueueSize(), 16);
+    EXPECT_EQ(modelConfig.getMaxQueueWaitMs(), 200);
+
+    ovms::ModelConfig unlimited;
+    EXPECT_TRUE(modelConfig.isReloadRequired(unlimited));
+}
+
+TEST(ModelConfig, ConfigParseNodePriority) {
+    std::string config = R"#(
+        {
+            "name": "alpha",
+            "base_path": "/tmp/models/dummy1",
+            "priority": "high"
+        }
+    )#";
+
+    rapidjson::Document configJson;
+    rapidjson::ParseResult parsingSucceeded = configJson.Parse(config.c_str());
+    ASSERT_EQ(parsingSucceeded, true);
+    ovms::ModelConfig modelConfig;
+    auto status = modelConfig.parseNode(configJson);
+
+    ASSERT_EQ(status, ovms::StatusCode::OK);
+    EXPECT_EQ(modelConfig.getPriority(), ovms::PriorityClass::HIGH);
+
+    ovms::ModelConfig defaultPriority;
+    EXPECT_EQ(defaultPriority.getPriority(), ovms::PriorityClass::NORMAL);
+    EXPECT_TRUE(modelConfig.isReloadRequired(defaultPriority));
+}
+
+TEST(ModelConfig, ConfigParseNodeResponseCache) {
+    std::string config = R"#(
+        {
+            "name": "alpha",
+            "base_path": "/tmp/models/dummy1",
+            "response_cache": {"max_size_mb": 64, "ttl_ms": 1000}
+        }
+    )#";
+
+    rapidjson::Document configJson;
+    rapidjson::ParseResult parsingSucceeded = configJson.Parse(config.c_str());
+    ASSERT_EQ(parsingSucceeded, true);
+    ovms::ModelConfig modelConfig;
+    auto status = modelConfig.parseNode(configJson);
+
+    ASSERT_EQ(status, ovms::StatusCode::OK);
+    EXPECT_TRUE(modelConfig.getResponseCache().enabled);
+    EXPECT_EQ(modelConfig.getResponseCache().maxSizeMb, 64);
+    EXPECT_EQ(modelConfig.getResponseCache().ttlMs, 1000);
+
+    ovms::ModelConfig withoutCache;
+    EXPECT_FALSE(withoutCache.getResponseCache().enabled);
+    EXPECT_TRUE(modelConfig.isReloadRequired(withoutCache));
+}
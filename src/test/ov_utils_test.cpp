@@ -63,3 +63,60 @@ TEST(OVUtils, CopyBlob) {
     // Expect memory addresses to differ since cloning should allocate new memory space for the cloned blob
     EXPECT_NE((float*)copyBlob->buffer(), (float*)originalBlob->buffer());
 }
+
+TEST(OVUtils, ConvertBlobPrecisionU8ToFP32) {
+    const std::vector<size_t> shape{1, 2, 3};
+    const InferenceEngine::TensorDesc desc{InferenceEngine::Precision::U8, shape, InferenceEngine::Layout::CHW};
+    std::vector<uint8_t> data{0, 1, 2, 127, 128, 255};
+    InferenceEngine::Blob::Ptr originalBlob = InferenceEngine::make_shared_blob<uint8_t>(desc, data.data());
+    InferenceEngine::Blob::Ptr convertedBlob = nullptr;
+    ASSERT_EQ(ovms::convertBlobPrecision(convertedBlob, originalBlob, InferenceEngine::Precision::FP32), ovms::StatusCode::OK);
+
+    ASSERT_EQ(convertedBlob->getTensorDesc().getPrecision(), InferenceEngine::Precision::FP32);
+    ASSERT_EQ(convertedBlob->getTensorDesc().getDims(), shape);
+    ASSERT_EQ(convertedBlob->getTensorDesc().getLayout(), InferenceEngine::Layout::CHW);
+    std::vector<float> actual((float*)convertedBlob->buffer(), ((float*)convertedBlob->buffer()) + data.size());
+    EXPECT_THAT(actual, ElementsAre(0.0f, 1.0f, 2.0f, 127.0f, 128.0f, 255.0f));
+}
+
+TEST(OVUtils, ConvertBlobPrecisionFP32ToFP16) {
+    const std::vector<size_t> shape{1, 3};
+    const InferenceEngine::TensorDesc desc{InferenceEngine::Precision::FP32, shape, InferenceEngine::Layout::NC};
+    std::vector<float> data{1.0f, -2.0f, 0.0f};
+    InferenceEngine::Blob::Ptr originalBlob = InferenceEngine::make_shared_blob<float>(desc, data.data());
+    InferenceEngine::Blob::Ptr convertedBlob = nullptr;
+    ASSERT_EQ(ovms::convertBlobPrecision(convertedBlob, originalBlob, InferenceEngine::Precision::FP16), ovms::StatusCode::OK);
+
+    ASSERT_EQ(convertedBlob->getTensorDesc().getPrecision(), InferenceEngine::Precision::FP16);
+    ASSERT_EQ(convertedBlob->byteSize(), data.size() * sizeof(uint16_t));
+    std::vector<uint16_t> actual((uint16_t*)convertedBlob->buffer(), ((uint16_t*)convertedBlob->buffer()) + data.size());
+    EXPECT_THAT(actual, ElementsAre(0x3c00, 0xc000, 0x0000));
+}
+
+TEST(OVUtils, ConvertBlobPrecisionUnsupported) {
+    EXPECT_TRUE(ovms::isPrecisionConversionSupported(InferenceEngine::Precision::I16, InferenceEngine::Precision::FP32));
+    EXPECT_FALSE(ovms::isPrecisionConversionSupported(InferenceEngine::Precision::FP32, InferenceEngine::Precision::U8));
+
+    const InferenceEngine::TensorDesc desc{InferenceEngine::Precision::FP32, {1, 2}, InferenceEngine::Layout::NC};
+    std::vector<float> data{1.0f, 2.0f};
+    InferenceEngine::Blob::Ptr originalBlob = InferenceEngine::make_shared_blob<float>(desc, data.data());
+    InferenceEngine::Blob::Ptr convertedBlob = nullptr;
+    EXPECT_EQ(ovms::convertBlobPrecision(convertedBlob, originalBlob, InferenceEngine::Precision::U8), ovms::StatusCode::INVALID_PRECISION);
+}
+
+TEST(OVUtils, SliceBlobRefersToParentMemory) {
+    const std::vector<size_t> shape{4, 2};
+    const InferenceEngine::TensorDesc desc{InferenceEngine::Precision::FP32, shape, InferenceEngine::Layout::NC};
+    std::vector<float> data{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f};
+    InferenceEngine::Blob::Ptr originalBlob = InferenceEngine::make_shared_blob<float>(desc, data.data());
+    InferenceEngine::Blob::Ptr slice = nullptr;
+    ASSERT_EQ(ovms::sliceBlob(slice, originalBlob, 2, 2), ovms::StatusCode::OK);
+
+    ASSERT_EQ(slice->getTensorDesc().getDims(), (std::vector<size_t>{2, 2}));
+    ASSERT_EQ(slice->getTensorDesc().getLayout(), InferenceEngine::Layout::NC);
+    EXPECT_EQ((float*)slice->buffer(), data.data() + 4);
+    std::vector<float> actual((float*)slice->buffer(), ((float*)slice->buffer()) + slice->size());
+    EXPECT_THAT(actual, ElementsAre(5.0f, 6.0f, 7.0f, 8.0f));
+
+    EXPECT_EQ(ovms::sliceBlob(slice, originalBlob, 3, 2), ovms::StatusCode::INTERNAL_ERROR);
+}
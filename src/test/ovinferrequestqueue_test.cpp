@@ -14,11 +14,15 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <atomic>
 #include <chrono>
 #include <filesystem>
+#include <future>
+#include <optional>
 #include <random>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -127,3 +131,135 @@ TEST(OVInferRequestQueue, AsyncGetInferRequest) {
     const int secondStreamId = secondStreamRequest.get();
     EXPECT_EQ(firstStreamId, secondStreamId);
 }
+
+TEST(OVInferRequestQueue, RejectWhenQueueIsFull) {
+    InferenceEngine::Core engine;
+    InferenceEngine::CNNNetwork network = engine.ReadNetwork(DUMMY_MODEL_PATH);
+    InferenceEngine::ExecutableNetwork execNetwork = engine.LoadNetwork(network, "CPU");
+    const size_t maxQueueSize = 1;
+    ovms::OVInferRequestsQueue inferRequestsQueue(execNetwork, 1, maxQueueSize);
+
+    int streamId;
+    ASSERT_EQ(inferRequestsQueue.acquireIdleStream(streamId), ovms::StatusCode::OK);
+    std::future<ovms::Status> waitingRequest = std::async(std::launch::async, [&inferRequestsQueue]() {
+        int waitingStreamId;
+        return inferRequestsQueue.acquireIdleStream(waitingStreamId);
+    });
+    while (inferRequestsQueue.getWaitingCount() == 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    int rejectedStreamId;
+    EXPECT_EQ(inferRequestsQueue.acquireIdleStream(rejectedStreamId), ovms::StatusCode::INFER_QUEUE_FULL);
+    EXPECT_EQ(inferRequestsQueue.getRejectedQueueFullCount(), 1);
+
+    inferRequestsQueue.returnStream(streamId);
+    EXPECT_EQ(waitingRequest.get(), ovms::StatusCode::OK);
+    EXPECT_EQ(inferRequestsQueue.getWaitingCount(), 0);
+}
+
+TEST(OVInferRequestQueue, RejectAfterQueueWaitTimeout) {
+    InferenceEngine::Core engine;
+    InferenceEngine::CNNNetwork network = engine.ReadNetwork(DUMMY_MODEL_PATH);
+    InferenceEngine::ExecutableNetwork execNetwork = engine.LoadNetwork(network, "CPU");
+    ovms::OVInferRequestsQueue inferRequestsQueue(execNetwork, 1, 0, std::chrono::milliseconds(10));
+
+    int streamId;
+    ASSERT_EQ(inferRequestsQueue.acquireIdleStream(streamId), ovms::StatusCode::OK);
+    int rejectedStreamId;
+    EXPECT_EQ(inferRequestsQueue.acquireIdleStream(rejectedStreamId), ovms::StatusCode::INFER_QUEUE_TIMEOUT);
+    EXPECT_EQ(inferRequestsQueue.getRejectedQueueTimeoutCount(), 1);
+    EXPECT_EQ(inferRequestsQueue.getWaitingCount(), 0);
+
+    // Stream returned after timeout is not lost for abandoned request
+    inferRequestsQueue.returnStream(streamId);
+    int nextStreamId;
+    ASSERT_EQ(inferRequestsQueue.acquireIdleStream(nextStreamId), ovms::StatusCode::OK);
+    EXPECT_EQ(nextStreamId, streamId);
+}
+
+TEST(OVInferRequestQueue, StopWaitingAtDeadlineOrCancellation) {
+    InferenceEngine::Core engine;
+    InferenceEngine::CNNNetwork network = engine.ReadNetwork(DUMMY_MODEL_PATH);
+    InferenceEngine::ExecutableNetwork execNetwork = engine.LoadNetwork(network, "CPU");
+    ovms::OVInferRequestsQueue inferRequestsQueue(execNetwork, 1);
+
+    int streamId;
+    ASSERT_EQ(inferRequestsQueue.acquireIdleStream(streamId), ovms::StatusCode::OK);
+    int otherStreamId;
+    EXPECT_EQ(inferRequestsQueue.acquireIdleStream(otherStreamId, ovms::Deadline::fromNow(std::chrono::milliseconds(10))),
+        ovms::StatusCode::DEADLINE_EXCEEDED);
+    std::atomic<bool> cancelled{false};
+    std::thread canceller([&cancelled]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        cancelled = true;
+    });
+    EXPECT_EQ(inferRequestsQueue.acquireIdleStream(otherStreamId, ovms::Deadline(std::nullopt, [&cancelled]() { return cancelled.load(); })),
+        ovms::StatusCode::REQUEST_CANCELLED);
+    canceller.join();
+    EXPECT_EQ(inferRequestsQueue.getWaitingCount(), 0);
+    EXPECT_EQ(inferRequestsQueue.getRejectedQueueTimeoutCount(), 0);
+
+    // Expired request does not take idle stream
+    inferRequestsQueue.returnStream(streamId);
+    EXPECT_EQ(inferRequestsQueue.acquireIdleStream(otherStreamId, ovms::Deadline::fromNow(std::chrono::milliseconds(0))),
+        ovms::StatusCode::DEADLINE_EXCEEDED);
+    ASSERT_EQ(inferRequestsQueue.acquireIdleStream(otherStreamId), ovms::StatusCode::OK);
+    EXPECT_EQ(otherStreamId, streamId);
+}
+
+TEST(OVInferRequestQueue, AcquireIdleStreamWithCallback) {
+    InferenceEngine::Core engine;
+    InferenceEngine::CNNNetwork network = engine.ReadNetwork(DUMMY_MODEL_PATH);
+    InferenceEngine::ExecutableNetwork execNetwork = engine.LoadNetwork(network, "CPU");
+    ovms::OVInferRequestsQueue inferRequestsQueue(execNetwork, 1, 1);
+
+    int calls = 0;
+    int handedOverStreamId = -1;
+    ovms::Status handedOverStatus;
+    auto callback = [&](const ovms::Status& status, int streamId) {
+        calls++;
+        handedOverStatus = status;
+        handedOverStreamId = streamId;
+    };
+    int streamId;
+    ASSERT_EQ(inferRequestsQueue.acquireIdleStreamAsync(streamId, callback), ovms::StatusCode::OK);
+    EXPECT_GE(streamId, 0);
+    EXPECT_EQ(calls, 0);
+
+    int waitingStreamId;
+    ASSERT_EQ(inferRequestsQueue.acquireIdleStreamAsync(waitingStreamId, callback), ovms::StatusCode::OK);
+    EXPECT_EQ(waitingStreamId, -1);
+    EXPECT_EQ(inferRequestsQueue.getWaitingCount(), 1);
+    int rejectedStreamId;
+    EXPECT_EQ(inferRequestsQueue.acquireIdleStreamAsync(rejectedStreamId, callback), ovms::StatusCode::INFER_QUEUE_FULL);
+
+    inferRequestsQueue.returnStream(streamId);
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(handedOverStatus, ovms::StatusCode::OK);
+    EXPECT_EQ(handedOverStreamId, streamId);
+    EXPECT_EQ(inferRequestsQueue.getWaitingCount(), 0);
+}
+
+TEST(OVInferRequestQueue, CallbackOfTimedOutRequestIsRejected) {
+    InferenceEngine::Core engine;
+    InferenceEngine::CNNNetwork network = engine.ReadNetwork(DUMMY_MODEL_PATH);
+    InferenceEngine::ExecutableNetwork execNetwork = engine.LoadNetwork(network, "CPU");
+    ovms::OVInferRequestsQueue inferRequestsQueue(execNetwork, 1, 0, std::chrono::milliseconds(10));
+
+    int streamId;
+    ASSERT_EQ(inferRequestsQueue.acquireIdleStream(streamId), ovms::StatusCode::OK);
+    std::vector<ovms::Status> statuses;
+    int waitingStreamId;
+    ASSERT_EQ(inferRequestsQueue.acquireIdleStreamAsync(waitingStreamId, [&statuses](const ovms::Status& status, int) { statuses.push_back(status); }),
+        ovms::StatusCode::OK);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    // Stream is not given to timed out request, it stays idle
+    inferRequestsQueue.returnStream(streamId);
+    ASSERT_EQ(statuses.size(), 1);
+    EXPECT_EQ(statuses[0], ovms::StatusCode::INFER_QUEUE_TIMEOUT);
+    EXPECT_EQ(inferRequestsQueue.getRejectedQueueTimeoutCount(), 1);
+    int nextStreamId;
+    ASSERT_EQ(inferRequestsQueue.acquireIdleStream(nextStreamId), ovms::StatusCode::OK);
+    EXPECT_EQ(nextStreamId, streamId);
+}
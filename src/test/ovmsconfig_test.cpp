@@ -116,6 +116,18 @@ TEST_F(DISABLED_OvmsConfigTest, negativeSamePorts) {
     EXPECT_EXIT(ovms::Config::instance().parse(arg_count, n_argv), ::testing::ExitedWithCode(EX_USAGE), "port and rest_port cannot");
 }
 
+TEST_F(DISABLED_OvmsConfigTest, negativeSameUnixSocketPaths) {
+    char* n_argv[] = {"ovms", "--config_path", "/path1", "--rest_port", "8080", "--grpc_unix_socket_path", "/tmp/ovms.sock", "--rest_unix_socket_path", "/tmp/ovms.sock"};
+    int arg_count = 9;
+    EXPECT_EXIT(ovms::Config::instance().parse(arg_count, n_argv), ::testing::ExitedWithCode(EX_USAGE), "grpc_unix_socket_path and rest_unix_socket_path cannot");
+}
+
+TEST_F(DISABLED_OvmsConfigTest, negativeRestUnixSocketWithoutRestPort) {
+    char* n_argv[] = {"ovms", "--config_path", "/path1", "--rest_unix_socket_path", "/tmp/ovms.sock"};
+    int arg_count = 5;
+    EXPECT_EXIT(ovms::Config::instance().parse(arg_count, n_argv), ::testing::ExitedWithCode(EX_USAGE), "rest_unix_socket_path is set but rest_port is not set");
+}
+
 TEST_F(DISABLED_OvmsConfigTest, negativeMultiParams) {
     char* n_argv[] = {"ovms", "--config_path", "/path1", "--batch_size", "10"};
     int arg_count = 5;
@@ -191,4 +203,11 @@ TEST_F(OvmsParamsTest, hostname_ip_regex) {
     EXPECT_EQ(ovms::Config::instance().check_hostname_or_ip(too_long), false);
 }
 
+TEST_F(OvmsParamsTest, unix_socket_path) {
+    EXPECT_EQ(ovms::Config::instance().check_unix_socket_path("/tmp/ovms.sock"), true);
+    EXPECT_EQ(ovms::Config::instance().check_unix_socket_path(""), false);
+    EXPECT_EQ(ovms::Config::instance().check_unix_socket_path(std::string(107, 'a')), true);
+    EXPECT_EQ(ovms::Config::instance().check_unix_socket_path(std::string(108, 'a')), false);
+}
+
 #pragma GCC diagnostic pop
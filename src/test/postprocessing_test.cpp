@@ -0,0 +1,155 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../postprocessing.hpp"
+
+using namespace ovms;
+
+using testing::ElementsAre;
+
+class PostProcessingTest : public ::testing::TestWithParam<ConversionIsa> {
+protected:
+    void SetUp() override {
+        if (!isConversionIsaSupported(GetParam())) {
+            GTEST_SKIP() << "Instruction set not supported by CPU";
+        }
+    }
+
+    const PostProcessingKernels& kernels() {
+        return getPostProcessingKernels(GetParam());
+    }
+
+    std::mt19937 generator{42};
+};
+
+TEST_P(PostProcessingTest, ArgmaxKnownValues) {
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    // Rows of 11 values cover vector loop and remainder
+    std::vector<float> data{
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+        10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+        nan, 1, 2, 3, 4, 5, 6, 7, 8, 9, nan,
+        nan, nan, nan, nan, nan, nan, nan, nan, nan, nan, nan};
+    std::vector<int32_t> indices(4);
+    kernels().argmax(data.data(), 4, 11, indices.data());
+    EXPECT_THAT(indices, ElementsAre(10, 0, 9, 0));
+}
+
+TEST_P(PostProcessingTest, ArgmaxMatchesScalar) {
+    std::uniform_real_distribution<float> distribution(-10.0f, 10.0f);
+    for (size_t columns : {1, 7, 8, 9, 1000, 1001}) {
+        const size_t rows = 3;
+        std::vector<float> data(rows * columns);
+        for (auto& value : data) {
+            value = std::round(distribution(generator));  // duplicates of maximum are likely
+        }
+        std::vector<int32_t> expected(rows), actual(rows);
+        getPostProcessingKernels(ConversionIsa::SCALAR).argmax(data.data(), rows, columns, expected.data());
+        kernels().argmax(data.data(), rows, columns, actual.data());
+        EXPECT_EQ(actual, expected) << "columns: " << columns;
+    }
+}
+
+TEST_P(PostProcessingTest, TopKKnownValues) {
+    std::vector<float> data{
+        1, 9, 3, 9, 5, 0, 7, 2, 8, 4, 6,
+        -1, -2, -3, -4, -5, -6, -7, -8, -9, -10, -11};
+    std::vector<float> values(6);
+    std::vector<int32_t> indices(6);
+    kernels().topK(data.data(), 2, 11, 3, values.data(), indices.data());
+    EXPECT_THAT(values, ElementsAre(9, 9, 8, -1, -2, -3));
+    EXPECT_THAT(indices, ElementsAre(1, 3, 8, 0, 1, 2));
+}
+
+TEST_P(PostProcessingTest, TopKPadsRowsWithNaN) {
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    std::vector<float> data{nan, 2, nan, 1};
+    std::vector<float> values(3);
+    std::vector<int32_t> indices(3);
+    kernels().topK(data.data(), 1, 4, 3, values.data(), indices.data());
+    EXPECT_EQ(values[0], 2);
+    EXPECT_EQ(values[1], 1);
+    EXPECT_TRUE(std::isnan(values[2]));
+    EXPECT_THAT(indices, ElementsAre(1, 3, -1));
+}
+
+TEST_P(PostProcessingTest, TopKMatchesSort) {
+    std::uniform_real_distribution<float> distribution(-100.0f, 100.0f);
+    for (size_t columns : {5, 8, 17, 1000, 1001}) {
+        for (size_t k : {1, 5}) {
+            const size_t rows = 2;
+            std::vector<float> data(rows * columns);
+            for (auto& value : data) {
+                value = distribution(generator);
+            }
+            std::vector<float> values(rows * k);
+            std::vector<int32_t> indices(rows * k);
+            kernels().topK(data.data(), rows, columns, k, values.data(), indices.data());
+            for (size_t row = 0; row < rows; row++) {
+                std::vector<float> sorted(data.begin() + row * columns, data.begin() + (row + 1) * columns);
+                std::sort(sorted.begin(), sorted.end(), std::greater<float>());
+                for (size_t i = 0; i < k; i++) {
+                    ASSERT_EQ(values[row * k + i], sorted[i]) << "columns: " << columns << " k: " << k;
+                    ASSERT_EQ(data[row * columns + indices[row * k + i]], sorted[i]) << "columns: " << columns << " k: " << k;
+                }
+            }
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    Test,
+    PostProcessingTest,
+    ::testing::Values(ConversionIsa::SCALAR, ConversionIsa::AVX2),
+    [](const ::testing::TestParamInfo<ConversionIsa>& info) {
+        return info.param == ConversionIsa::SCALAR ? "SCALAR" : "AVX2";
+    });
+
+TEST(PostProcessing, SelectDetections) {
+    std::vector<float> detections{
+        // image_id, label, confidence, x_min, y_min, x_max, y_max
+        0, 1, 0.6, 0.0, 0.0, 0.5, 0.5,
+        0, 1, 0.9, 0.0, 0.0, 0.5, 0.6,  // suppresses previous one of the same label
+        0, 2, 0.8, 0.0, 0.0, 0.5, 0.5,  // overlaps, but of other label
+        1, 1, 0.2, 0.0, 0.0, 0.5, 0.5,  // below threshold
+        1, 1, 0.7, 0.5, 0.5, 1.0, 1.0,
+        -1, 0, 0, 0, 0, 0, 0,
+        1, 1, 0.9, 0.0, 0.0, 0.5, 0.5};  // after end of detections
+    const size_t count = detections.size() / DETECTION_SIZE;
+    std::vector<float> selected(detections.size());
+    size_t selectedCount = selectDetections(detections.data(), count, 0.5f, 0.5f, 0, selected.data());
+    ASSERT_EQ(selectedCount, 3u);
+    EXPECT_EQ(selected[0 * DETECTION_SIZE + 2], 0.9f);
+    EXPECT_EQ(selected[1 * DETECTION_SIZE + 2], 0.8f);
+    EXPECT_EQ(selected[2 * DETECTION_SIZE + 0], 1.0f);
+    EXPECT_EQ(selected[2 * DETECTION_SIZE + 2], 0.7f);
+
+    // Without suppression, with limit of detections per image
+    selectedCount = selectDetections(detections.data(), count, 0.5f, 1.0f, 2, selected.data());
+    ASSERT_EQ(selectedCount, 3u);
+    EXPECT_EQ(selected[0 * DETECTION_SIZE + 2], 0.9f);
+    EXPECT_EQ(selected[1 * DETECTION_SIZE + 2], 0.8f);
+    EXPECT_EQ(selected[2 * DETECTION_SIZE + 2], 0.7f);
+}
@@ -0,0 +1,215 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../precisionutils.hpp"
+
+using namespace ovms;
+
+static uint32_t floatBits(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+static float bitsToFloat(uint32_t bits) {
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// Sizes covering empty input, remainders only and vector loops followed by remainders
+static const std::vector<size_t> COUNTS{0, 1, 7, 8, 15, 16, 17, 33, 1001};
+
+class PrecisionUtilsTest : public ::testing::TestWithParam<ConversionIsa> {
+protected:
+    void SetUp() override {
+        if (!isConversionIsaSupported(GetParam())) {
+            GTEST_SKIP() << "Instruction set not supported by CPU";
+        }
+    }
+
+    const ConversionKernels& kernels() {
+        return getConversionKernels(GetParam());
+    }
+
+    const ConversionKernels& reference() {
+        return getConversionKernels(ConversionIsa::SCALAR);
+    }
+
+    std::mt19937 generator{42};
+};
+
+TEST_P(PrecisionUtilsTest, Fp16ToFp32KnownValues) {
+    std::vector<uint16_t> half{0x3c00, 0xc000, 0x0000, 0x8000, 0x7bff, 0x0001, 0x0400, 0x7c00, 0xfc00, 0x3555};
+    std::vector<float> result(half.size());
+    kernels().fp16ToFp32(half.data(), result.data(), half.size());
+    EXPECT_EQ(result[0], 1.0f);
+    EXPECT_EQ(result[1], -2.0f);
+    EXPECT_EQ(floatBits(result[2]), 0u);
+    EXPECT_EQ(floatBits(result[3]), 0x80000000u);
+    EXPECT_EQ(result[4], 65504.0f);
+    EXPECT_EQ(result[5], std::ldexp(1.0f, -24));
+    EXPECT_EQ(result[6], std::ldexp(1.0f, -14));
+    EXPECT_EQ(result[7], std::numeric_limits<float>::infinity());
+    EXPECT_EQ(result[8], -std::numeric_limits<float>::infinity());
+    EXPECT_NEAR(result[9], 1.0f / 3, 1e-3);
+}
+
+TEST_P(PrecisionUtilsTest, Fp16ToFp32AllValuesMatchScalar) {
+    std::vector<uint16_t> half(1 << 16);
+    for (size_t i = 0; i < half.size(); i++) {
+        half[i] = static_cast<uint16_t>(i);
+    }
+    std::vector<float> expected(half.size()), actual(half.size());
+    reference().fp16ToFp32(half.data(), expected.data(), half.size());
+    kernels().fp16ToFp32(half.data(), actual.data(), half.size());
+    for (size_t i = 0; i < half.size(); i++) {
+        ASSERT_EQ(floatBits(actual[i]), floatBits(expected[i])) << "half: " << std::hex << i;
+    }
+}
+
+TEST_P(PrecisionUtilsTest, Fp32ToFp16Rounding) {
+    std::vector<float> values{
+        1.0f,
+        1.0f + std::ldexp(1.0f, -11),      // halfway, rounds to even
+        1.0f + 3 * std::ldexp(1.0f, -11),  // halfway, rounds to even
+        65504.0f,
+        65520.0f,  // rounds to infinity
+        std::ldexp(1.0f, -25),
+        std::ldexp(1.5f, -25),
+        -0.0f,
+        std::numeric_limits<float>::quiet_NaN()};
+    std::vector<uint16_t> result(values.size());
+    kernels().fp32ToFp16(values.data(), result.data(), values.size());
+    EXPECT_EQ(result[0], 0x3c00);
+    EXPECT_EQ(result[1], 0x3c00);
+    EXPECT_EQ(result[2], 0x3c02);
+    EXPECT_EQ(result[3], 0x7bff);
+    EXPECT_EQ(result[4], 0x7c00);
+    EXPECT_EQ(result[5], 0x0000);
+    EXPECT_EQ(result[6], 0x0001);
+    EXPECT_EQ(result[7], 0x8000);
+    EXPECT_EQ(result[8] & 0x7c00, 0x7c00);
+    EXPECT_NE(result[8] & 0x3ff, 0);
+}
+
+TEST_P(PrecisionUtilsTest, Fp32ToFp16RandomValuesMatchScalar) {
+    std::vector<float> values(1 << 16);
+    for (auto& value : values) {
+        // Exponents around half precision range, including subnormals and overflows
+        uint32_t bits = generator();
+        bits = (bits & 0x807fffff) | ((100 + generator() % 45) << 23);
+        value = bitsToFloat(bits);
+    }
+    std::vector<uint16_t> expected(values.size()), actual(values.size());
+    reference().fp32ToFp16(values.data(), expected.data(), values.size());
+    kernels().fp32ToFp16(values.data(), actual.data(), values.size());
+    for (size_t i = 0; i < values.size(); i++) {
+        ASSERT_EQ(actual[i], expected[i]) << "float bits: " << std::hex << floatBits(values[i]);
+    }
+}
+
+TEST_P(PrecisionUtilsTest, IntegerConversions) {
+    for (size_t count : COUNTS) {
+        std::vector<uint32_t> padded(count);
+        std::vector<int64_t> wide(count);
+        for (size_t i = 0; i < count; i++) {
+            padded[i] = generator();
+            wide[i] = (static_cast<int64_t>(generator()) << 32) | generator();
+        }
+        std::vector<uint16_t> packed(count);
+        kernels().u32ToU16(padded.data(), packed.data(), count);
+        std::vector<uint32_t> unpacked(count);
+        kernels().u16ToU32(packed.data(), unpacked.data(), count);
+        std::vector<int32_t> narrowed(count);
+        kernels().i64ToI32(wide.data(), narrowed.data(), count);
+        for (size_t i = 0; i < count; i++) {
+            ASSERT_EQ(packed[i], static_cast<uint16_t>(padded[i])) << "count: " << count << " index: " << i;
+            ASSERT_EQ(unpacked[i], padded[i] & 0xffff) << "count: " << count << " index: " << i;
+            ASSERT_EQ(narrowed[i], static_cast<int32_t>(wide[i])) << "count: " << count << " index: " << i;
+        }
+    }
+}
+
+TEST_P(PrecisionUtilsTest, IntegerToFp32Conversions) {
+    for (size_t count : COUNTS) {
+        std::vector<uint8_t> u8(count);
+        std::vector<int8_t> i8(count);
+        std::vector<uint16_t> u16(count);
+        std::vector<int16_t> i16(count);
+        std::vector<int32_t> i32(count);
+        for (size_t i = 0; i < count; i++) {
+            u8[i] = static_cast<uint8_t>(generator());
+            i8[i] = static_cast<int8_t>(generator());
+            u16[i] = static_cast<uint16_t>(generator());
+            i16[i] = static_cast<int16_t>(generator());
+            i32[i] = static_cast<int32_t>(generator());
+        }
+        std::vector<float> fromU8(count), fromI8(count), fromU16(count), fromI16(count), fromI32(count);
+        kernels().u8ToFp32(u8.data(), fromU8.data(), count);
+        kernels().i8ToFp32(i8.data(), fromI8.data(), count);
+        kernels().u16ToFp32(u16.data(), fromU16.data(), count);
+        kernels().i16ToFp32(i16.data(), fromI16.data(), count);
+        kernels().i32ToFp32(i32.data(), fromI32.data(), count);
+        for (size_t i = 0; i < count; i++) {
+            ASSERT_EQ(fromU8[i], static_cast<float>(u8[i])) << "count: " << count << " index: " << i;
+            ASSERT_EQ(fromI8[i], static_cast<float>(i8[i])) << "count: " << count << " index: " << i;
+            ASSERT_EQ(fromU16[i], static_cast<float>(u16[i])) << "count: " << count << " index: " << i;
+            ASSERT_EQ(fromI16[i], static_cast<float>(i16[i])) << "count: " << count << " index: " << i;
+            ASSERT_EQ(fromI32[i], static_cast<float>(i32[i])) << "count: " << count << " index: " << i;
+        }
+    }
+}
+
+TEST_P(PrecisionUtilsTest, RemaindersAreConverted) {
+    for (size_t count : COUNTS) {
+        std::vector<uint16_t> half(count, 0x3c00);
+        std::vector<float> result(count + 1, 0.0f);
+        kernels().fp16ToFp32(half.data(), result.data(), count);
+        for (size_t i = 0; i < count; i++) {
+            ASSERT_EQ(result[i], 1.0f) << "count: " << count << " index: " << i;
+        }
+        EXPECT_EQ(result[count], 0.0f) << "Conversion wrote past the end, count: " << count;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    Test,
+    PrecisionUtilsTest,
+    ::testing::Values(ConversionIsa::SCALAR, ConversionIsa::AVX2, ConversionIsa::AVX512),
+    [](const ::testing::TestParamInfo<ConversionIsa>& info) {
+        switch (info.param) {
+        case ConversionIsa::AVX512:
+            return "AVX512";
+        case ConversionIsa::AVX2:
+            return "AVX2";
+        case ConversionIsa::SCALAR:
+        default:
+            return "SCALAR";
+        }
+    });
+
+TEST(PrecisionUtils, BestIsaIsSupported) {
+    EXPECT_TRUE(isConversionIsaSupported(getBestConversionIsa()));
+    EXPECT_TRUE(isConversionIsaSupported(ConversionIsa::SCALAR));
+}
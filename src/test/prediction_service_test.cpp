@@ -13,12 +13,19 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //*****************************************************************************
+#include <chrono>
+#include <condition_variable>
 #include <cstdio>
 #include <cstring>
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
 #include <thread>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -28,6 +35,7 @@
 #include "../executinstreamidguard.hpp"
 #include "../modelinstance.hpp"
 #include "../prediction_service_utils.hpp"
+#include "../serialization.hpp"
 #include "test_utils.hpp"
 
 using testing::Each;
@@ -479,4 +487,297 @@ TEST_F(TestPredict, ChangeBatchSizeViaRequestAndConfigChange) {
     ASSERT_EQ(performInferenceWithBatchSize(response, 3), StatusCode::OK);
     checkOutputShape(response, {3, 10});
 }
+TEST_F(TestPredict, OutputFilter) {
+    ovms::ModelConfig config = DUMMY_MODEL_CONFIG;
+    config.setBatchSize(1);
+    ASSERT_EQ(manager.reloadModelWithVersions(config), ovms::StatusCode::OK);
+    std::shared_ptr<ovms::ModelInstance> model;
+    std::unique_ptr<ovms::ModelInstanceUnloadGuard> unload_guard;
+    ASSERT_EQ(ovms::getModelInstance(manager, "dummy", 0, model, unload_guard), ovms::StatusCode::OK);
+
+    tensorflow::serving::PredictRequest request = preparePredictRequest(
+        {{DUMMY_MODEL_INPUT_NAME,
+            std::tuple<ovms::shape_t, tensorflow::DataType>{{1, 10}, tensorflow::DataType::DT_FLOAT}}});
+    request.add_output_filter(DUMMY_MODEL_OUTPUT_NAME);
+    tensorflow::serving::PredictResponse response;
+    ASSERT_EQ(inference(*model, &request, &response, unload_guard), ovms::StatusCode::OK);
+    EXPECT_EQ(response.outputs().count(DUMMY_MODEL_OUTPUT_NAME), 1);
+
+    request.add_output_filter("unknown");
+    response.Clear();
+    EXPECT_EQ(inference(*model, &request, &response, unload_guard), ovms::StatusCode::INVALID_OUTPUT_FILTER);
+    EXPECT_EQ(response.outputs_size(), 0);
+}
+
+TEST_F(TestPredict, OutputFilterWithTopKIndices) {
+    ovms::ModelConfig config = DUMMY_MODEL_CONFIG;
+    config.setBatchSize(1);
+    ovms::PostProcessingConfig topK;
+    topK.kind = ovms::PostProcessingKind::TOP_K;
+    topK.k = 3;
+    config.addPostProcessing(DUMMY_MODEL_OUTPUT_NAME, topK);
+    ASSERT_EQ(manager.reloadModelWithVersions(config), ovms::StatusCode::OK);
+    std::shared_ptr<ovms::ModelInstance> model;
+    std::unique_ptr<ovms::ModelInstanceUnloadGuard> unload_guard;
+    ASSERT_EQ(ovms::getModelInstance(manager, "dummy", 0, model, unload_guard), ovms::StatusCode::OK);
+    const std::string indicesName = std::string(DUMMY_MODEL_OUTPUT_NAME) + ovms::TOP_K_INDICES_SUFFIX;
+
+    tensorflow::serving::PredictRequest request = preparePredictRequest(
+        {{DUMMY_MODEL_INPUT_NAME,
+            std::tuple<ovms::shape_t, tensorflow::DataType>{{1, 10}, tensorflow::DataType::DT_FLOAT}}});
+    request.add_output_filter(indicesName);
+    tensorflow::serving::PredictResponse response;
+    ASSERT_EQ(inference(*model, &request, &response, unload_guard), ovms::StatusCode::OK);
+    EXPECT_EQ(response.outputs_size(), 1);
+    ASSERT_EQ(response.outputs().count(indicesName), 1);
+    EXPECT_EQ(response.outputs().at(indicesName).dtype(), tensorflow::DataType::DT_INT32);
+
+    request.clear_output_filter();
+    request.add_output_filter(DUMMY_MODEL_OUTPUT_NAME);
+    response.Clear();
+    ASSERT_EQ(inference(*model, &request, &response, unload_guard), ovms::StatusCode::OK);
+    EXPECT_EQ(response.outputs_size(), 1);
+    EXPECT_EQ(response.outputs().count(DUMMY_MODEL_OUTPUT_NAME), 1);
+
+    request.add_output_filter(std::string("b") + ovms::TOP_K_INDICES_SUFFIX);
+    response.Clear();
+    EXPECT_EQ(inference(*model, &request, &response, unload_guard), ovms::StatusCode::INVALID_OUTPUT_FILTER);
+}
+
+TEST_F(TestPredict, BatchSplitting) {
+    ovms::ModelConfig config = DUMMY_MODEL_CONFIG;
+    config.setBatchingParams(1);
+    config.setNireq(2);
+    config.setBatchSplitting(true);
+    ASSERT_EQ(manager.reloadModelWithVersions(config), ovms::StatusCode::OK);
+    std::shared_ptr<ovms::ModelInstance> model;
+    std::unique_ptr<ovms::ModelInstanceUnloadGuard> unload_guard;
+    ASSERT_EQ(ovms::getModelInstance(manager, "dummy", 0, model, unload_guard), ovms::StatusCode::OK);
+
+    const size_t batchSize = 4;
+    std::vector<float> data(batchSize * DUMMY_MODEL_INPUT_SIZE);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<float>(i);
+    }
+    tensorflow::serving::PredictRequest request = preparePredictRequest(
+        {{DUMMY_MODEL_INPUT_NAME,
+            std::tuple<ovms::shape_t, tensorflow::DataType>{{batchSize, DUMMY_MODEL_INPUT_SIZE}, tensorflow::DataType::DT_FLOAT}}});
+    (*request.mutable_inputs())[DUMMY_MODEL_INPUT_NAME].mutable_tensor_content()->assign((char*)data.data(), data.size() * sizeof(float));
+    tensorflow::serving::PredictResponse response;
+    ASSERT_EQ(inference(*model, &request, &response, unload_guard), ovms::StatusCode::OK);
+    checkOutputShape(response, {batchSize, DUMMY_MODEL_OUTPUT_SIZE});
+    const auto& content = response.outputs().at(DUMMY_MODEL_OUTPUT_NAME).tensor_content();
+    ASSERT_EQ(content.size(), data.size() * sizeof(float));
+    const float* output = reinterpret_cast<const float*>(content.data());
+    for (size_t i = 0; i < data.size(); i++) {
+        EXPECT_EQ(output[i], data[i] + 1) << "at index " << i;
+    }
+
+    // Split request is validated as a whole before its chunks refer to its content
+    (*request.mutable_inputs())[DUMMY_MODEL_INPUT_NAME].mutable_tensor_content()->resize((data.size() - 1) * sizeof(float));
+    response.Clear();
+    EXPECT_EQ(inference(*model, &request, &response, unload_guard), ovms::StatusCode::INVALID_CONTENT_SIZE);
+
+    // Batch which is not a multiple of network batch size is not split
+    unload_guard.reset();
+    config.setBatchingParams(2);
+    ASSERT_EQ(manager.reloadModelWithVersions(config), ovms::StatusCode::OK);
+    ASSERT_EQ(ovms::getModelInstance(manager, "dummy", 0, model, unload_guard), ovms::StatusCode::OK);
+    request = preparePredictRequest(
+        {{DUMMY_MODEL_INPUT_NAME,
+            std::tuple<ovms::shape_t, tensorflow::DataType>{{3, DUMMY_MODEL_INPUT_SIZE}, tensorflow::DataType::DT_FLOAT}}});
+    EXPECT_EQ(inference(*model, &request, &response, unload_guard), ovms::StatusCode::INVALID_BATCH_SIZE);
+}
+
+TEST_F(TestPredict, AsyncInference) {
+    ovms::ModelConfig config = DUMMY_MODEL_CONFIG;
+    config.setBatchSize(1);
+    config.setNireq(1);
+    ASSERT_EQ(manager.reloadModelWithVersions(config), ovms::StatusCode::OK);
+
+    std::vector<float> data(DUMMY_MODEL_INPUT_SIZE);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<float>(i);
+    }
+    const size_t requestsCount = 3;
+    std::vector<std::shared_ptr<ovms::AsyncInference>> inferences;
+    std::vector<std::promise<ovms::Status>> completed(requestsCount);
+    std::vector<std::thread> scheduled;
+    std::mutex scheduledMutex;
+    for (size_t i = 0; i < requestsCount; i++) {
+        auto asyncInference = std::make_shared<ovms::AsyncInference>();
+        ASSERT_EQ(ovms::getModelInstance(manager, "dummy", 0, asyncInference->modelInstance, asyncInference->modelUnloadGuard), ovms::StatusCode::OK);
+        asyncInference->request = preparePredictRequest(
+            {{DUMMY_MODEL_INPUT_NAME,
+                std::tuple<ovms::shape_t, tensorflow::DataType>{{1, DUMMY_MODEL_INPUT_SIZE}, tensorflow::DataType::DT_FLOAT}}});
+        (*asyncInference->request.mutable_inputs())[DUMMY_MODEL_INPUT_NAME].mutable_tensor_content()->assign((char*)data.data(), data.size() * sizeof(float));
+        asyncInference->schedule = [&scheduled, &scheduledMutex](std::function<void()> fn) {
+            std::unique_lock<std::mutex> lock(scheduledMutex);
+            scheduled.emplace_back(std::move(fn));
+        };
+        asyncInference->onCompletion = [&completed, i](const ovms::Status& status) { completed[i].set_value(status); };
+        inferences.push_back(asyncInference);
+    }
+    // Requests over single infer request wait for it without blocking the caller
+    for (auto& asyncInference : inferences) {
+        ASSERT_TRUE(ovms::startAsyncInference(asyncInference));
+    }
+    for (size_t i = 0; i < requestsCount; i++) {
+        ASSERT_EQ(completed[i].get_future().get(), ovms::StatusCode::OK);
+        checkOutputShape(inferences[i]->response, {1, DUMMY_MODEL_OUTPUT_SIZE});
+        const float* output = reinterpret_cast<const float*>(inferences[i]->response.outputs().at(DUMMY_MODEL_OUTPUT_NAME).tensor_content().data());
+        for (size_t j = 0; j < data.size(); j++) {
+            EXPECT_EQ(output[j], data[j] + 1) << "at index " << j;
+        }
+    }
+    {
+        std::unique_lock<std::mutex> lock(scheduledMutex);
+        for (auto& thread : scheduled) {
+            thread.join();
+        }
+    }
+    EXPECT_EQ(inferences[0]->modelInstance->getInferRequestsQueue().getWaitingCount(), 0);
+
+    // Invalid request is completed without infer request
+    auto invalid = std::make_shared<ovms::AsyncInference>();
+    ASSERT_EQ(ovms::getModelInstance(manager, "dummy", 0, invalid->modelInstance, invalid->modelUnloadGuard), ovms::StatusCode::OK);
+    invalid->request = preparePredictRequest(
+        {{DUMMY_MODEL_INPUT_NAME,
+            std::tuple<ovms::shape_t, tensorflow::DataType>{{2, DUMMY_MODEL_INPUT_SIZE}, tensorflow::DataType::DT_FLOAT}}});
+    ovms::Status invalidStatus;
+    invalid->onCompletion = [&invalidStatus](const ovms::Status& status) { invalidStatus = status; };
+    ASSERT_TRUE(ovms::startAsyncInference(invalid));
+    EXPECT_EQ(invalidStatus, ovms::StatusCode::INVALID_BATCH_SIZE);
+}
+
+namespace {
+// Fixed size thread pool, REST server runs its workers and completions of asynchronous requests on such pools
+class FixedThreadPool {
+public:
+    explicit FixedThreadPool(size_t threadsCount) {
+        for (size_t i = 0; i < threadsCount; i++) {
+            threads.emplace_back([this]() { run(); });
+        }
+    }
+
+    ~FixedThreadPool() {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            stopped = true;
+        }
+        condition.notify_all();
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    void schedule(std::function<void()> fn) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            tasks.push(std::move(fn));
+        }
+        condition.notify_one();
+    }
+
+private:
+    void run() {
+        while (true) {
+            std::function<void()> fn;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                condition.wait(lock, [this]() { return stopped || !tasks.empty(); });
+                // Pending tasks are finished before stopping
+                if (tasks.empty()) {
+                    return;
+                }
+                fn = std::move(tasks.front());
+                tasks.pop();
+            }
+            fn();
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::queue<std::function<void()>> tasks;
+    bool stopped = false;
+    std::vector<std::thread> threads;
+};
+}  // namespace
+
+TEST_F(TestPredict, AsyncInferenceCompletesWhileWorkersWaitForInferRequests) {
+    ovms::ModelConfig config = DUMMY_MODEL_CONFIG;
+    config.setBatchSize(1);
+    config.setNireq(2);
+    ASSERT_EQ(manager.reloadModelWithVersions(config), ovms::StatusCode::OK);
+
+    std::vector<float> data(DUMMY_MODEL_INPUT_SIZE, 1.0);
+    auto prepareRequest = [&data](tensorflow::serving::PredictRequest& request) {
+        request = preparePredictRequest(
+            {{DUMMY_MODEL_INPUT_NAME,
+                std::tuple<ovms::shape_t, tensorflow::DataType>{{1, DUMMY_MODEL_INPUT_SIZE}, tensorflow::DataType::DT_FLOAT}}});
+        (*request.mutable_inputs())[DUMMY_MODEL_INPUT_NAME].mutable_tensor_content()->assign((char*)data.data(), data.size() * sizeof(float));
+    };
+    const size_t workersCount = 2;
+    const size_t asyncCount = 3;
+    std::vector<std::promise<ovms::Status>> asyncCompleted(asyncCount);
+    std::vector<std::promise<ovms::Status>> syncCompleted(workersCount);
+    std::vector<tensorflow::serving::PredictResponse> syncResponses(workersCount);
+    std::promise<void> completionsReleased;
+    std::shared_future<void> completionsReleasedFuture = completionsReleased.get_future().share();
+    // Pools are destroyed first, so their tasks never outlive the state they refer to
+    FixedThreadPool workers(workersCount);
+    FixedThreadPool completions(1);
+
+    // Completions wait until workers are blocked, so asynchronous inferences hold every infer request meanwhile.
+    // Wait is bounded, so that failed assertion does not leave the pool blocked.
+    completions.schedule([completionsReleasedFuture]() { completionsReleasedFuture.wait_for(std::chrono::seconds(5)); });
+    std::vector<std::shared_ptr<ovms::AsyncInference>> inferences;
+    for (size_t i = 0; i < asyncCount; i++) {
+        auto asyncInference = std::make_shared<ovms::AsyncInference>();
+        ASSERT_EQ(ovms::getModelInstance(manager, "dummy", 0, asyncInference->modelInstance, asyncInference->modelUnloadGuard), ovms::StatusCode::OK);
+        prepareRequest(asyncInference->request);
+        asyncInference->schedule = [&completions](std::function<void()> fn) { completions.schedule(std::move(fn)); };
+        asyncInference->onCompletion = [&asyncCompleted, i](const ovms::Status& status) { asyncCompleted[i].set_value(status); };
+        inferences.push_back(asyncInference);
+        ASSERT_TRUE(ovms::startAsyncInference(asyncInference));
+    }
+    auto& inferRequestsQueue = inferences[0]->modelInstance->getInferRequestsQueue();
+    // Every worker processes a request which blocks waiting for infer request, as pipelines or traced requests do
+    const auto deadline = ovms::Deadline::fromNow(std::chrono::milliseconds(5000));
+    for (size_t i = 0; i < workersCount; i++) {
+        workers.schedule([this, &prepareRequest, &syncCompleted, &syncResponses, deadline, i]() {
+            std::shared_ptr<ovms::ModelInstance> modelInstance;
+            std::unique_ptr<ovms::ModelInstanceUnloadGuard> modelUnloadGuard;
+            auto status = ovms::getModelInstance(manager, "dummy", 0, modelInstance, modelUnloadGuard);
+            if (status.ok()) {
+                tensorflow::serving::PredictRequest request;
+                prepareRequest(request);
+                status = ovms::inference(*modelInstance, &request, &syncResponses[i], modelUnloadGuard, deadline);
+            }
+            syncCompleted[i].set_value(status);
+        });
+    }
+    const size_t expectedWaitingCount = workersCount + asyncCount - config.getNireq();
+    const auto waitingStart = std::chrono::steady_clock::now();
+    while (inferRequestsQueue.getWaitingCount() < expectedWaitingCount &&
+           std::chrono::steady_clock::now() - waitingStart < std::chrono::seconds(2)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    const auto waitingCount = inferRequestsQueue.getWaitingCount();
+    completionsReleased.set_value();
+    ASSERT_EQ(waitingCount, expectedWaitingCount);
+
+    // Infer requests are returned and handed over by completions, without any worker being free
+    for (size_t i = 0; i < asyncCount; i++) {
+        ASSERT_EQ(asyncCompleted[i].get_future().get(), ovms::StatusCode::OK);
+        checkOutputShape(inferences[i]->response, {1, DUMMY_MODEL_OUTPUT_SIZE});
+    }
+    for (size_t i = 0; i < workersCount; i++) {
+        ASSERT_EQ(syncCompleted[i].get_future().get(), ovms::StatusCode::OK);
+        checkOutputShape(syncResponses[i], {1, DUMMY_MODEL_OUTPUT_SIZE});
+    }
+    EXPECT_EQ(inferRequestsQueue.getWaitingCount(), 0);
+}
+
 #pragma GCC diagnostic pop
@@ -16,6 +16,7 @@
 #include <chrono>
 #include <memory>
 #include <thread>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -220,3 +221,45 @@ TEST_F(ModelInstanceModelLoadedNotify, WhenChangedStateFromLoadingToAvailableInR
     spdlog::error("State: {}", (int)modelInstance->getStatus().getState());
     EXPECT_EQ(status, ovms::StatusCode::MODEL_VERSION_NOT_LOADED_YET);
 }
+
+TEST(GetRequestChunksCount, CountsChunksAlongFirstDimension) {
+    tensorflow::serving::PredictRequest request;
+    auto& contentInput = (*request.mutable_inputs())["content"];
+    contentInput.set_dtype(tensorflow::DataType::DT_UINT8);
+    contentInput.mutable_tensor_shape()->add_dim()->set_size(4);
+    contentInput.mutable_tensor_shape()->add_dim()->set_size(2);
+    contentInput.set_tensor_content("aabbccdd");
+    auto& halfInput = (*request.mutable_inputs())["half"];
+    halfInput.set_dtype(tensorflow::DataType::DT_HALF);
+    halfInput.mutable_tensor_shape()->add_dim()->set_size(4);
+    for (int i = 0; i < 4; i++) {
+        halfInput.add_half_val(i);
+    }
+
+    EXPECT_EQ(ovms::getRequestChunksCount(request, 2), 2);
+    EXPECT_EQ(ovms::getRequestChunksCount(request, 1), 4);
+    EXPECT_EQ(ovms::getRequestChunksCount(request, 3), 0) << "batch is not a multiple of chunk batch";
+    EXPECT_EQ(ovms::getRequestChunksCount(request, 4), 0) << "batch is not larger than chunk batch";
+    (*request.mutable_inputs())["content"].mutable_tensor_shape()->mutable_dim(0)->set_size(2);
+    EXPECT_EQ(ovms::getRequestChunksCount(request, 2), 0) << "inputs differ in batch size";
+}
+
+TEST(MergePredictResponses, ConcatenatesOutputsAlongFirstDimension) {
+    std::vector<tensorflow::serving::PredictResponse> chunks(2);
+    for (size_t i = 0; i < chunks.size(); i++) {
+        auto& output = (*chunks[i].mutable_outputs())["a"];
+        output.set_dtype(tensorflow::DataType::DT_UINT8);
+        output.mutable_tensor_shape()->add_dim()->set_size(1);
+        output.mutable_tensor_shape()->add_dim()->set_size(3);
+        output.set_tensor_content(i == 0 ? "abc" : "def");
+    }
+    tensorflow::serving::PredictResponse response;
+    ASSERT_EQ(ovms::mergePredictResponses(chunks, &response), ovms::StatusCode::OK);
+    const auto& output = response.outputs().at("a");
+    EXPECT_EQ(output.tensor_content(), "abcdef");
+    EXPECT_EQ(output.tensor_shape().dim(0).size(), 2);
+    EXPECT_EQ(output.tensor_shape().dim(1).size(), 3);
+
+    (*chunks[1].mutable_outputs())["a"].set_dtype(tensorflow::DataType::DT_FLOAT);
+    EXPECT_EQ(ovms::mergePredictResponses(chunks, &response), ovms::StatusCode::OV_INTERNAL_SERIALIZATION_ERROR);
+}
@@ -0,0 +1,188 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../priorityscheduler.hpp"
+
+using namespace ovms;
+
+using testing::ElementsAre;
+
+static void waitForWaitingCount(PriorityScheduler& scheduler, size_t count) {
+    while (scheduler.getWaitingCount() != count) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+TEST(PriorityScheduler, ParsePriorityClass) {
+    PriorityClass priority;
+    ASSERT_EQ(parsePriorityClass("high", priority), StatusCode::OK);
+    EXPECT_EQ(priority, PriorityClass::HIGH);
+    ASSERT_EQ(parsePriorityClass("low", priority), StatusCode::OK);
+    EXPECT_EQ(priority, PriorityClass::LOW);
+    EXPECT_EQ(parsePriorityClass("urgent", priority), StatusCode::INVALID_PRIORITY_CLASS);
+    EXPECT_EQ(priorityClassToString(PriorityClass::NORMAL), "normal");
+}
+
+TEST(PriorityScheduler, DisabledSchedulerGrantsRightAway) {
+    PriorityScheduler scheduler(0);
+    for (int i = 0; i < 10; i++) {
+        ASSERT_EQ(scheduler.acquire(PriorityClass::LOW), StatusCode::OK);
+    }
+    EXPECT_EQ(scheduler.getRunningCount(), 0);
+    EXPECT_EQ(scheduler.getWaitingCount(), 0);
+}
+
+TEST(PriorityScheduler, SlotsAreGrantedByWeightedFairQueuing) {
+    PriorityScheduler scheduler(1, {4, 2, 1});
+    ASSERT_EQ(scheduler.acquire(PriorityClass::NORMAL), StatusCode::OK);
+    EXPECT_EQ(scheduler.getRunningCount(), 1);
+
+    std::mutex orderMutex;
+    std::vector<PriorityClass> order;
+    std::atomic<size_t> granted{0};
+    std::vector<std::thread> threads;
+    auto request = [&](PriorityClass priority) {
+        threads.emplace_back([&, priority]() {
+            ASSERT_EQ(scheduler.acquire(priority), StatusCode::OK);
+            std::unique_lock<std::mutex> lock(orderMutex);
+            order.push_back(priority);
+            granted++;
+        });
+    };
+    // Low priority requests arrive first, yet high priority ones get 4 slots for each low priority one
+    for (size_t i = 0; i < 3; i++) {
+        request(PriorityClass::LOW);
+    }
+    waitForWaitingCount(scheduler, 3);
+    for (size_t i = 0; i < 6; i++) {
+        request(PriorityClass::HIGH);
+    }
+    waitForWaitingCount(scheduler, 9);
+    for (size_t i = 0; i < 9; i++) {
+        scheduler.release();
+        while (granted != i + 1) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const auto H = PriorityClass::HIGH;
+    const auto L = PriorityClass::LOW;
+    EXPECT_THAT(order, ElementsAre(H, H, H, L, H, H, H, L, L));
+    EXPECT_EQ(scheduler.getRunningCount(), 1);
+    scheduler.release();
+    EXPECT_EQ(scheduler.getRunningCount(), 0);
+}
+
+TEST(PriorityScheduler, IdleClassIsNotPenalizedForPastUsage) {
+    PriorityScheduler scheduler(1, {4, 2, 1});
+    ASSERT_EQ(scheduler.acquire(PriorityClass::HIGH), StatusCode::OK);
+    // Earlier contention served only low priority requests
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < 3; i++) {
+        threads.emplace_back([&scheduler]() { ASSERT_EQ(scheduler.acquire(PriorityClass::LOW), StatusCode::OK); });
+    }
+    waitForWaitingCount(scheduler, 3);
+    for (size_t i = 0; i < 3; i++) {
+        scheduler.release();
+        waitForWaitingCount(scheduler, 2 - i);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    threads.clear();
+    // In the next one low priority request arriving first is granted before second high priority one
+    std::vector<PriorityClass> order;
+    std::mutex orderMutex;
+    std::atomic<size_t> granted{0};
+    auto request = [&](PriorityClass priority) {
+        threads.emplace_back([&, priority]() {
+            ASSERT_EQ(scheduler.acquire(priority), StatusCode::OK);
+            std::unique_lock<std::mutex> lock(orderMutex);
+            order.push_back(priority);
+            granted++;
+        });
+    };
+    request(PriorityClass::LOW);
+    waitForWaitingCount(scheduler, 1);
+    for (size_t i = 0; i < 4; i++) {
+        request(PriorityClass::HIGH);
+    }
+    waitForWaitingCount(scheduler, 5);
+    for (size_t i = 0; i < 5; i++) {
+        scheduler.release();
+        while (granted != i + 1) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    std::unique_lock<std::mutex> lock(orderMutex);
+    ASSERT_EQ(order.size(), 5);
+    EXPECT_EQ(order[0], PriorityClass::HIGH);
+    EXPECT_EQ(order[4], PriorityClass::HIGH);
+    EXPECT_NE(std::find(order.begin(), order.begin() + 4, PriorityClass::LOW), order.begin() + 4);
+    scheduler.release();
+}
+
+TEST(PriorityScheduler, StopWaitingAtDeadlineOrCancellation) {
+    PriorityScheduler scheduler(1);
+    ASSERT_EQ(scheduler.acquire(PriorityClass::HIGH), StatusCode::OK);
+    EXPECT_EQ(scheduler.acquire(PriorityClass::LOW, Deadline::fromNow(std::chrono::milliseconds(20))), StatusCode::DEADLINE_EXCEEDED);
+    std::atomic<bool> cancelled{false};
+    std::thread cancelling([&cancelled]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        cancelled = true;
+    });
+    EXPECT_EQ(scheduler.acquire(PriorityClass::LOW, Deadline(std::nullopt, [&cancelled]() { return cancelled.load(); })), StatusCode::REQUEST_CANCELLED);
+    cancelling.join();
+    EXPECT_EQ(scheduler.getWaitingCount(), 0);
+    EXPECT_EQ(scheduler.getStats(PriorityClass::LOW).rejected, 2);
+    // Slot is returned to the pool, not to abandoned waiters
+    scheduler.release();
+    EXPECT_EQ(scheduler.getRunningCount(), 0);
+    ASSERT_EQ(scheduler.acquire(PriorityClass::LOW), StatusCode::OK);
+    scheduler.release();
+}
+
+TEST(PriorityScheduler, GuardRecordsLatency) {
+    PriorityScheduler scheduler(1);
+    {
+        PrioritySlotGuard guard(scheduler, PriorityClass::HIGH);
+        ASSERT_EQ(guard.getStatus(), StatusCode::OK);
+        EXPECT_EQ(scheduler.getRunningCount(), 1);
+        std::this_thread::sleep_for(std::chrono::milliseconds(3));
+    }
+    EXPECT_EQ(scheduler.getRunningCount(), 0);
+    auto stats = scheduler.getStats(PriorityClass::HIGH);
+    EXPECT_EQ(stats.completed, 1);
+    EXPECT_GE(stats.latencyUsTotal, 3000);
+    EXPECT_LE(stats.waitUsMax, stats.latencyUsTotal);
+    // 3 ms latency falls into bucket bounded by 5 ms
+    EXPECT_EQ(stats.latencyHistogram[2] + stats.latencyHistogram[3], 1);
+    EXPECT_EQ(scheduler.getStats(PriorityClass::LOW).completed, 0);
+}
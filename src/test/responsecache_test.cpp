@@ -0,0 +1,257 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../responsecache.hpp"
+#include "../shared_memory.hpp"
+
+using namespace ovms;
+
+using tensorflow::serving::PredictRequest;
+using tensorflow::serving::PredictResponse;
+
+namespace {
+
+PredictRequest createRequest(const std::vector<float>& data) {
+    PredictRequest request;
+    auto& proto = (*request.mutable_inputs())["b"];
+    proto.set_dtype(tensorflow::DataType::DT_FLOAT);
+    proto.mutable_tensor_shape()->add_dim()->set_size(1);
+    proto.mutable_tensor_shape()->add_dim()->set_size(data.size());
+    proto.mutable_tensor_content()->assign(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(float));
+    return request;
+}
+
+ResponseCache::compute_fn_t respondWith(float value, std::atomic<int>& calls) {
+    return [value, &calls](PredictResponse* response) {
+        calls++;
+        auto& proto = (*response->mutable_outputs())["a"];
+        proto.set_dtype(tensorflow::DataType::DT_FLOAT);
+        proto.add_float_val(value);
+        return Status(StatusCode::OK);
+    };
+}
+
+}  // namespace
+
+TEST(ResponseCache, KeyDependsOnContentOnly) {
+    auto first = createRequest({1, 2, 3});
+    auto second = createRequest({1, 2, 3});
+    (*second.mutable_inputs())["a"].set_dtype(tensorflow::DataType::DT_FLOAT);
+    (*first.mutable_inputs())["a"].set_dtype(tensorflow::DataType::DT_FLOAT);
+    auto firstKey = ResponseCache::computeKey(first);
+    auto secondKey = ResponseCache::computeKey(second);
+    ASSERT_TRUE(firstKey.has_value());
+    ASSERT_TRUE(secondKey.has_value());
+    EXPECT_EQ(firstKey.value(), secondKey.value());
+
+    EXPECT_FALSE(ResponseCache::computeKey(createRequest({1, 2, 4})).value() == firstKey.value());
+    second.add_output_filter("a");
+    EXPECT_FALSE(ResponseCache::computeKey(second).value() == firstKey.value());
+
+    auto typed = createRequest({});
+    (*typed.mutable_inputs())["b"].add_float_val(1);
+    auto otherTyped = createRequest({});
+    (*otherTyped.mutable_inputs())["b"].add_float_val(2);
+    EXPECT_FALSE(ResponseCache::computeKey(typed).value() == ResponseCache::computeKey(otherTyped).value());
+}
+
+TEST(ResponseCache, SharedMemoryRequestsHaveNoKey) {
+    auto request = createRequest({});
+    auto* handle = (*request.mutable_inputs())["b"].add_resource_handle_val();
+    handle->set_device(SHARED_MEMORY_DEVICE);
+    handle->set_container("region");
+    EXPECT_FALSE(ResponseCache::computeKey(request).has_value());
+}
+
+TEST(ResponseCache, CachedResponseIsReturned) {
+    ResponseCache cache(1024 * 1024, std::chrono::milliseconds(0));
+    std::atomic<int> calls{0};
+    auto key = ResponseCache::computeKey(createRequest({1, 2, 3})).value();
+    PredictResponse first, second;
+    ASSERT_EQ(cache.getOrCompute(key, &first, respondWith(7, calls)), StatusCode::OK);
+    ASSERT_EQ(cache.getOrCompute(key, &second, respondWith(8, calls)), StatusCode::OK);
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(second.outputs().at("a").float_val(0), 7);
+    EXPECT_EQ(cache.getHitsCount(), 1);
+    EXPECT_EQ(cache.getMissesCount(), 1);
+    EXPECT_EQ(cache.getEntriesCount(), 1);
+    EXPECT_EQ(cache.getBytes(), first.ByteSizeLong() + key.content->size());
+}
+
+TEST(ResponseCache, HashCollisionIsMiss) {
+    ResponseCache cache(1024 * 1024, std::chrono::milliseconds(0));
+    std::atomic<int> calls{0};
+    auto key = ResponseCache::computeKey(createRequest({1, 2, 3})).value();
+    auto colliding = ResponseCache::computeKey(createRequest({1, 2, 4})).value();
+    colliding.hash = key.hash;
+    ASSERT_EQ(key.content->size(), colliding.content->size());
+    EXPECT_FALSE(key == colliding);
+    PredictResponse first, second;
+    ASSERT_EQ(cache.getOrCompute(key, &first, respondWith(7, calls)), StatusCode::OK);
+    ASSERT_EQ(cache.getOrCompute(colliding, &second, respondWith(8, calls)), StatusCode::OK);
+    EXPECT_EQ(calls, 2);
+    EXPECT_EQ(second.outputs().at("a").float_val(0), 8);
+    EXPECT_EQ(cache.getHitsCount(), 0);
+    EXPECT_EQ(cache.getMissesCount(), 2);
+    EXPECT_EQ(cache.getEntriesCount(), 2);
+}
+
+TEST(ResponseCache, FailedInferenceIsNotCached) {
+    ResponseCache cache(1024 * 1024, std::chrono::milliseconds(0));
+    auto key = ResponseCache::computeKey(createRequest({1})).value();
+    PredictResponse failed, response;
+    ASSERT_EQ(cache.getOrCompute(key, &failed, [](PredictResponse*) { return Status(StatusCode::OV_INTERNAL_INFERENCE_ERROR); }),
+        StatusCode::OV_INTERNAL_INFERENCE_ERROR);
+    std::atomic<int> calls{0};
+    ASSERT_EQ(cache.getOrCompute(key, &response, respondWith(1, calls)), StatusCode::OK);
+    EXPECT_EQ(calls, 1);
+}
+
+TEST(ResponseCache, LeastRecentlyUsedEntriesAreEvicted) {
+    std::atomic<int> calls{0};
+    PredictResponse response;
+    respondWith(0, calls)(&response);
+    const size_t entryBytes = response.ByteSizeLong() + ResponseCache::computeKey(createRequest({0})).value().content->size();
+    ResponseCache cache(2 * entryBytes, std::chrono::milliseconds(0));
+    auto request = [&cache, &calls](float value) {
+        PredictResponse response;
+        cache.getOrCompute(ResponseCache::computeKey(createRequest({value})).value(), &response, respondWith(0, calls));
+    };
+    calls = 0;
+    request(1);
+    request(2);
+    request(1);
+    request(3);
+    EXPECT_EQ(calls, 3);
+    EXPECT_EQ(cache.getEvictionsCount(), 1);
+    // Second one was least recently used
+    request(1);
+    request(3);
+    EXPECT_EQ(calls, 3);
+    request(2);
+    EXPECT_EQ(calls, 4);
+    EXPECT_EQ(cache.getEntriesCount(), 2);
+    EXPECT_EQ(cache.getBytes(), 2 * entryBytes);
+}
+
+TEST(ResponseCache, ExpiredEntriesAreNotUsed) {
+    ResponseCache cache(1024 * 1024, std::chrono::milliseconds(20));
+    std::atomic<int> calls{0};
+    auto key = ResponseCache::computeKey(createRequest({1})).value();
+    PredictResponse first, second, third;
+    cache.getOrCompute(key, &first, respondWith(1, calls));
+    cache.getOrCompute(key, &second, respondWith(1, calls));
+    EXPECT_EQ(calls, 1);
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    cache.getOrCompute(key, &third, respondWith(1, calls));
+    EXPECT_EQ(calls, 2);
+}
+
+TEST(ResponseCache, ConcurrentIdenticalRequestsShareInference) {
+    // No entries are kept, only in-flight requests are coalesced
+    ResponseCache cache(0, std::chrono::milliseconds(0));
+    auto key = ResponseCache::computeKey(createRequest({1, 2})).value();
+    std::atomic<int> calls{0};
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    auto slowCompute = [&calls, released](PredictResponse* response) {
+        calls++;
+        released.wait();
+        (*response->mutable_outputs())["a"].add_float_val(5);
+        return Status(StatusCode::OK);
+    };
+    std::vector<PredictResponse> responses(4);
+    std::vector<std::thread> threads;
+    threads.emplace_back([&]() { EXPECT_EQ(cache.getOrCompute(key, &responses[0], slowCompute), StatusCode::OK); });
+    while (calls == 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    for (size_t i = 1; i < responses.size(); i++) {
+        threads.emplace_back([&, i]() { EXPECT_EQ(cache.getOrCompute(key, &responses[i], slowCompute), StatusCode::OK); });
+    }
+    while (cache.getCoalescedCount() != responses.size() - 1) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    release.set_value();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(calls, 1);
+    for (const auto& response : responses) {
+        EXPECT_EQ(response.outputs().at("a").float_val(0), 5);
+    }
+    EXPECT_EQ(cache.getEntriesCount(), 0);
+}
+
+TEST(ResponseCache, WaitingForInFlightRequestStopsAtDeadline) {
+    ResponseCache cache(0, std::chrono::milliseconds(0));
+    auto key = ResponseCache::computeKey(createRequest({1})).value();
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::atomic<int> calls{0};
+    PredictResponse leaderResponse, followerResponse;
+    std::thread leader([&]() {
+        cache.getOrCompute(key, &leaderResponse, [&calls, released](PredictResponse*) {
+            calls++;
+            released.wait();
+            return Status(StatusCode::OK);
+        });
+    });
+    while (calls == 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(cache.getOrCompute(key, &followerResponse, respondWith(1, calls), Deadline::fromNow(std::chrono::milliseconds(20))),
+        StatusCode::DEADLINE_EXCEEDED);
+    release.set_value();
+    leader.join();
+    EXPECT_EQ(calls, 1);
+}
+
+TEST(ResponseCache, HashCollisionIsNotCoalesced) {
+    ResponseCache cache(0, std::chrono::milliseconds(0));
+    auto key = ResponseCache::computeKey(createRequest({1})).value();
+    auto colliding = ResponseCache::computeKey(createRequest({2})).value();
+    colliding.hash = key.hash;
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::atomic<int> calls{0};
+    PredictResponse leaderResponse, collidingResponse;
+    std::thread leader([&]() {
+        cache.getOrCompute(key, &leaderResponse, [&calls, released](PredictResponse*) {
+            calls++;
+            released.wait();
+            return Status(StatusCode::OK);
+        });
+    });
+    while (calls == 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(cache.getOrCompute(colliding, &collidingResponse, respondWith(2, calls)), StatusCode::OK);
+    EXPECT_EQ(collidingResponse.outputs().at("a").float_val(0), 2);
+    EXPECT_EQ(cache.getCoalescedCount(), 0);
+    release.set_value();
+    leader.join();
+    EXPECT_EQ(calls, 2);
+}
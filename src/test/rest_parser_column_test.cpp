@@ -641,3 +641,25 @@ TEST(RestParserColumn, RemoveUnnecessaryInputs) {
         ASSERT_EQ(parser.getProto().inputs().count("l"), 1);
     }
 }
+
+TEST(RestParserColumn, ParseOutputFilter) {
+    RestParser parser(prepareTensors({{"i", {1, 1}}}));
+    ASSERT_EQ(parser.parse(R"({"signature_name":"","inputs":{
+        "i":[[155.0]]
+    }, "output_filter": ["a", "b"]})"),
+        StatusCode::OK);
+    EXPECT_THAT(parser.getProto().output_filter(), ElementsAre("a", "b"));
+}
+
+TEST(RestParserColumn, OutputFilterNotAnArray) {
+    RestParser parser(prepareTensors({{"i", {1, 1}}}));
+    EXPECT_EQ(parser.parse(R"({"signature_name":"","inputs":{
+        "i":[[155.0]]
+    }, "output_filter": "a"})"),
+        StatusCode::REST_OUTPUT_FILTER_NOT_AN_ARRAY);
+    RestParser parser2(prepareTensors({{"i", {1, 1}}}));
+    EXPECT_EQ(parser2.parse(R"({"signature_name":"","inputs":{
+        "i":[[155.0]]
+    }, "output_filter": [1]})"),
+        StatusCode::REST_OUTPUT_FILTER_NOT_AN_ARRAY);
+}
@@ -0,0 +1,143 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <string>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../rest_router.hpp"
+
+using namespace ovms;
+
+TEST(RestRouter, PredictRequest) {
+    HttpRequestComponents components;
+    ASSERT_EQ(routeRestRequest("POST", "/v1/models/dummy:predict", components), StatusCode::OK);
+    EXPECT_EQ(components.resource, RestResource::MODEL);
+    EXPECT_EQ(components.model_name, "dummy");
+    EXPECT_FALSE(components.model_version.has_value());
+    EXPECT_FALSE(components.model_version_label.has_value());
+    EXPECT_EQ(components.processing_method, "predict");
+
+    components = HttpRequestComponents();
+    ASSERT_EQ(routeRestRequest("POST", "/v1/models/dummy/versions/12:classify", components), StatusCode::OK);
+    EXPECT_EQ(components.model_name, "dummy");
+    EXPECT_EQ(components.model_version, 12);
+    EXPECT_EQ(components.processing_method, "classify");
+
+    components = HttpRequestComponents();
+    ASSERT_EQ(routeRestRequest("POST", "/v1/models/dummy/labels/stable_1:regress", components), StatusCode::OK);
+    EXPECT_EQ(components.model_version_label, "stable_1");
+    EXPECT_EQ(components.processing_method, "regress");
+}
+
+TEST(RestRouter, ModelStatusRequests) {
+    HttpRequestComponents components;
+    ASSERT_EQ(routeRestRequest("GET", "/v1/models/dummy", components), StatusCode::OK);
+    EXPECT_EQ(components.resource, RestResource::MODEL);
+    EXPECT_EQ(components.model_name, "dummy");
+    EXPECT_TRUE(components.model_subresource.empty());
+
+    components = HttpRequestComponents();
+    ASSERT_EQ(routeRestRequest("GET", "/v1/models/dummy/versions/3/metadata", components), StatusCode::OK);
+    EXPECT_EQ(components.model_version, 3);
+    EXPECT_EQ(components.model_subresource, "metadata");
+
+    components = HttpRequestComponents();
+    ASSERT_EQ(routeRestRequest("GET", "/v1/models/dummy/labels/latest/stats", components), StatusCode::OK);
+    EXPECT_EQ(components.model_version_label, "latest");
+    EXPECT_EQ(components.model_subresource, "stats");
+}
+
+TEST(RestRouter, OtherResources) {
+    HttpRequestComponents components;
+    ASSERT_EQ(routeRestRequest("POST", "/v1/shared_memory/region/input_0/register", components), StatusCode::OK);
+    EXPECT_EQ(components.resource, RestResource::SHARED_MEMORY);
+    EXPECT_EQ(components.model_name, "input_0");
+    EXPECT_EQ(components.processing_method, "register");
+    ASSERT_EQ(routeRestRequest("POST", "/v1/shared_memory/region/input_0/unregister", components), StatusCode::OK);
+    EXPECT_EQ(components.processing_method, "unregister");
+
+    ASSERT_EQ(routeRestRequest("GET", "/v1/scheduler/stats", components), StatusCode::OK);
+    EXPECT_EQ(components.resource, RestResource::SCHEDULER_STATS);
+    ASSERT_EQ(routeRestRequest("GET", "/v1/traces", components), StatusCode::OK);
+    EXPECT_EQ(components.resource, RestResource::TRACES);
+}
+
+TEST(RestRouter, SingleCharacterBeforeApiVersionIsAccepted) {
+    HttpRequestComponents components;
+    ASSERT_EQ(routeRestRequest("GET", "//v1/models/dummy", components), StatusCode::OK);
+    EXPECT_EQ(components.model_name, "dummy");
+    EXPECT_EQ(routeRestRequest("GET", "///v1/models/dummy", components), StatusCode::REST_INVALID_URL);
+}
+
+TEST(RestRouter, MethodNotMatchingPathIsRejected) {
+    HttpRequestComponents components;
+    EXPECT_EQ(routeRestRequest("GET", "/v1/models/dummy:predict", components), StatusCode::REST_UNSUPPORTED_METHOD);
+    EXPECT_EQ(routeRestRequest("POST", "/v1/models/dummy/metadata", components), StatusCode::REST_UNSUPPORTED_METHOD);
+    EXPECT_EQ(routeRestRequest("GET", "/v1/shared_memory/region/input_0/register", components), StatusCode::REST_UNSUPPORTED_METHOD);
+    EXPECT_EQ(routeRestRequest("POST", "/v1/scheduler/stats", components), StatusCode::REST_UNSUPPORTED_METHOD);
+    EXPECT_EQ(routeRestRequest("POST", "/v1/traces", components), StatusCode::REST_UNSUPPORTED_METHOD);
+    EXPECT_EQ(routeRestRequest("PUT", "/v1/models/dummy", components), StatusCode::REST_UNSUPPORTED_METHOD);
+    EXPECT_EQ(routeRestRequest("DELETE", "/v1/unknown", components), StatusCode::REST_UNSUPPORTED_METHOD);
+}
+
+TEST(RestRouter, InvalidPathsAreRejected) {
+    HttpRequestComponents components;
+    for (const std::string path : {
+             "",
+             "/",
+             "/v1/models",
+             "/v1/models/",
+             "/v2/models/dummy",
+             "/v1/models/dummy/",
+             "/v1/models/dummy:",
+             "/v1/models/dummy:infer",
+             "/v1/models/dummy:predict/",
+             "/v1/models/dummy/versions/:predict",
+             "/v1/models/dummy/versions/-1",
+             "/v1/models/dummy/versions/1a",
+             "/v1/models/dummy/labels/:predict",
+             "/v1/models/dummy/labels/a-b",
+             "/v1/models/dummy/versions/1/labels/a",
+             "/v1/models/dummy/status",
+             "/v1/models/dummy/metadata/",
+             "/v1/models/dummy/stats:predict",
+             "/v1/models/dummy/extra/metadata",
+             "/v1/shared_memory/region//register",
+             "/v1/shared_memory/region/input_0",
+             "/v1/shared_memory/region/input_0/delete",
+             "/v1/scheduler",
+             "/v1/scheduler/stats/",
+             "/v1/traces/1",
+         }) {
+        EXPECT_EQ(routeRestRequest("GET", path, components), StatusCode::REST_INVALID_URL) << path;
+        EXPECT_EQ(routeRestRequest("POST", path, components), StatusCode::REST_INVALID_URL) << path;
+    }
+}
+
+TEST(RestRouter, EscapedPathIsRejected) {
+    HttpRequestComponents components;
+    EXPECT_EQ(routeRestRequest("GET", "/v1/models/../dummy", components), StatusCode::PATH_INVALID);
+    EXPECT_EQ(routeRestRequest("POST", "/v1/models/dummy/..:predict", components), StatusCode::PATH_INVALID);
+    EXPECT_EQ(routeRestRequest("PUT", "/v1/models/../dummy", components), StatusCode::PATH_INVALID);
+}
+
+TEST(RestRouter, VersionOutOfRangeIsRejected) {
+    HttpRequestComponents components;
+    EXPECT_EQ(routeRestRequest("GET", "/v1/models/dummy/versions/99999999999999999999", components), StatusCode::REST_COULD_NOT_PARSE_VERSION);
+    // Method is checked first
+    EXPECT_EQ(routeRestRequest("GET", "/v1/models/dummy/versions/99999999999999999999:predict", components), StatusCode::REST_UNSUPPORTED_METHOD);
+}
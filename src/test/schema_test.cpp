@@ -715,3 +715,73 @@ TEST(SchemaTest, parseModelMappingWhenConfigIsNotJson) {
     result = ovms::validateJsonAgainstSchema(mappingConfigIsNotAJsonParsed, ovms::MODELS_MAPPING_OUTPUTS_SCHEMA);
     EXPECT_EQ(result, ovms::StatusCode::JSON_INVALID);
 }
+
+TEST(SchemaTest, PipelineConfigWithDemultiplexerNodeOptions) {
+    const char* pipelineConfigWithDemultiplexer = R"(
+    {
+        "model_config_list": [],
+        "pipeline_config_list": [
+            {
+                "name": "pipelineDemultiplexer",
+                "inputs": ["custom_dummy_input"],
+                "nodes": [
+                    {
+                        "name": "dummyNode",
+                        "model_name": "dummy",
+                        "type": "DL model",
+                        "demultiply_count": 4,
+                        "inputs": [
+                            {"b": {"node_name": "request",
+                                "data_item": "custom_dummy_input"}}
+                        ],
+                        "outputs": [
+                            {"data_item": "a",
+                            "alias": "new_dummy_output"}
+                        ]
+                    },
+                    {
+                        "name": "perObjectNode",
+                        "model_name": "dummy",
+                        "type": "DL model",
+                        "inputs": [
+                            {"b": {"node_name": "dummyNode",
+                                "data_item": "new_dummy_output"}}
+                        ],
+                        "outputs": [
+                            {"data_item": "a",
+                            "alias": "new_dummy_output"}
+                        ]
+                    },
+                    {
+                        "name": "gatheringNode",
+                        "model_name": "dummy",
+                        "type": "DL model",
+                        "gather_from_node": "dummyNode",
+                        "inputs": [
+                            {"b": {"node_name": "perObjectNode",
+                                "data_item": "new_dummy_output"}}
+                        ],
+                        "outputs": [
+                            {"data_item": "a",
+                            "alias": "new_dummy_output"}
+                        ]
+                    }
+                ],
+                "outputs": [
+                    {"custom_dummy_output": {"node_name": "gatheringNode",
+                                            "data_item": "new_dummy_output"}
+                    }
+                ]
+            }
+        ]
+    })";
+
+    rapidjson::Document pipelineConfigWithDemultiplexerParsed;
+    pipelineConfigWithDemultiplexerParsed.Parse(pipelineConfigWithDemultiplexer);
+    auto result = ovms::validateJsonAgainstSchema(pipelineConfigWithDemultiplexerParsed, ovms::MODELS_CONFIG_SCHEMA);
+    EXPECT_EQ(result, ovms::StatusCode::OK);
+
+    pipelineConfigWithDemultiplexerParsed["pipeline_config_list"][0]["nodes"][0]["demultiply_count"].SetInt(0);
+    result = ovms::validateJsonAgainstSchema(pipelineConfigWithDemultiplexerParsed, ovms::MODELS_CONFIG_SCHEMA);
+    EXPECT_EQ(result, ovms::StatusCode::JSON_INVALID);
+}
@@ -0,0 +1,188 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../sequence.hpp"
+#include "../sequence_manager.hpp"
+
+using namespace ovms;
+
+using tensorflow::serving::PredictRequest;
+using tensorflow::serving::PredictResponse;
+
+namespace {
+
+SequenceProcessingSpec spec(SequenceControl control, uint64_t sequenceId) {
+    SequenceProcessingSpec spec;
+    spec.control = control;
+    spec.sequenceId = sequenceId;
+    return spec;
+}
+
+const auto START = SequenceControl::SEQUENCE_START;
+const auto NONE = SequenceControl::NO_CONTROL_INPUT;
+const auto END = SequenceControl::SEQUENCE_END;
+
+}  // namespace
+
+TEST(SequenceProcessingSpec, ExtractFromTypedFieldsAndTensorContent) {
+    PredictRequest request;
+    SequenceProcessingSpec extracted;
+    ASSERT_EQ(extractSequenceProcessingSpec(request, extracted), StatusCode::OK);
+    EXPECT_EQ(extracted.control, NONE);
+    EXPECT_EQ(extracted.sequenceId, 0);
+
+    auto& id = (*request.mutable_inputs())[SEQUENCE_ID_INPUT];
+    id.set_dtype(tensorflow::DataType::DT_UINT64);
+    id.mutable_tensor_shape()->add_dim()->set_size(1);
+    id.add_uint64_val(1ULL << 40);
+    auto& control = (*request.mutable_inputs())[SEQUENCE_CONTROL_INPUT];
+    control.set_dtype(tensorflow::DataType::DT_UINT32);
+    control.mutable_tensor_shape()->add_dim()->set_size(1);
+    control.add_uint32_val(1);
+    ASSERT_EQ(extractSequenceProcessingSpec(request, extracted), StatusCode::OK);
+    EXPECT_EQ(extracted.control, START);
+    EXPECT_EQ(extracted.sequenceId, 1ULL << 40);
+    EXPECT_EQ(countSequenceInputs(request), 2);
+
+    // REST requests send values of unknown inputs as I32 tensor content
+    control.Clear();
+    control.set_dtype(tensorflow::DataType::DT_INT32);
+    control.mutable_tensor_shape()->add_dim()->set_size(1);
+    const int32_t end = 2;
+    control.mutable_tensor_content()->assign(reinterpret_cast<const char*>(&end), sizeof(end));
+    ASSERT_EQ(extractSequenceProcessingSpec(request, extracted), StatusCode::OK);
+    EXPECT_EQ(extracted.control, END);
+}
+
+TEST(SequenceProcessingSpec, RejectInvalidValues) {
+    PredictRequest request;
+    SequenceProcessingSpec extracted;
+    auto& control = (*request.mutable_inputs())[SEQUENCE_CONTROL_INPUT];
+    control.set_dtype(tensorflow::DataType::DT_UINT32);
+    control.add_uint32_val(3);
+    EXPECT_EQ(extractSequenceProcessingSpec(request, extracted), StatusCode::INVALID_SEQUENCE_CONTROL_INPUT);
+    control.set_uint32_val(0, 1);
+    control.add_uint32_val(1);
+    EXPECT_EQ(extractSequenceProcessingSpec(request, extracted), StatusCode::INVALID_SEQUENCE_CONTROL_INPUT);
+    control.Clear();
+    control.set_dtype(tensorflow::DataType::DT_FLOAT);
+    control.add_float_val(1);
+    EXPECT_EQ(extractSequenceProcessingSpec(request, extracted), StatusCode::INVALID_SEQUENCE_CONTROL_INPUT);
+    request.mutable_inputs()->erase(SEQUENCE_CONTROL_INPUT);
+
+    auto& id = (*request.mutable_inputs())[SEQUENCE_ID_INPUT];
+    id.set_dtype(tensorflow::DataType::DT_INT64);
+    id.add_int64_val(-5);
+    EXPECT_EQ(extractSequenceProcessingSpec(request, extracted), StatusCode::INVALID_SEQUENCE_CONTROL_INPUT);
+}
+
+TEST(SequenceProcessingSpec, SequenceIdOutput) {
+    PredictResponse response;
+    addSequenceIdOutput(&response, 42);
+    const auto& output = response.outputs().at(SEQUENCE_ID_INPUT);
+    EXPECT_EQ(output.dtype(), tensorflow::DataType::DT_UINT64);
+    ASSERT_EQ(output.tensor_shape().dim_size(), 1);
+    EXPECT_EQ(output.tensor_shape().dim(0).size(), 1);
+    ASSERT_EQ(output.tensor_content().size(), sizeof(uint64_t));
+    EXPECT_EQ(*reinterpret_cast<const uint64_t*>(output.tensor_content().data()), 42);
+}
+
+TEST(SequenceManager, StartContinueEnd) {
+    SequenceManager manager(10, std::chrono::seconds(60));
+    std::shared_ptr<Sequence> sequence;
+    EXPECT_EQ(manager.acquire(spec(NONE, 0), sequence), StatusCode::SEQUENCE_ID_NOT_PROVIDED);
+    EXPECT_EQ(manager.acquire(spec(NONE, 7), sequence), StatusCode::SEQUENCE_MISSING);
+
+    ASSERT_EQ(manager.acquire(spec(START, 7), sequence), StatusCode::OK);
+    EXPECT_EQ(sequence->getId(), 7);
+    manager.release(spec(START, 7), *sequence, true);
+    EXPECT_EQ(manager.getSequencesCount(), 1);
+    std::shared_ptr<Sequence> other;
+    EXPECT_EQ(manager.acquire(spec(START, 7), other), StatusCode::SEQUENCE_ALREADY_EXISTS);
+
+    ASSERT_EQ(manager.acquire(spec(NONE, 7), other), StatusCode::OK);
+    EXPECT_EQ(other, sequence);
+    ASSERT_EQ(manager.acquire(spec(END, 7), other), StatusCode::OK);
+    manager.release(spec(END, 7), *other, true);
+    EXPECT_TRUE(sequence->isTerminated());
+    EXPECT_EQ(manager.getSequencesCount(), 0);
+    EXPECT_EQ(manager.acquire(spec(NONE, 7), other), StatusCode::SEQUENCE_MISSING);
+}
+
+TEST(SequenceManager, GeneratedIdsSkipOnesInUse) {
+    SequenceManager manager(10, std::chrono::seconds(60));
+    std::shared_ptr<Sequence> chosen, first, second;
+    ASSERT_EQ(manager.acquire(spec(START, 1), chosen), StatusCode::OK);
+    ASSERT_EQ(manager.acquire(spec(START, 0), first), StatusCode::OK);
+    ASSERT_EQ(manager.acquire(spec(START, 0), second), StatusCode::OK);
+    EXPECT_EQ(first->getId(), 2);
+    EXPECT_EQ(second->getId(), 3);
+}
+
+TEST(SequenceManager, FailedStartIsRemoved) {
+    SequenceManager manager(10, std::chrono::seconds(60));
+    std::shared_ptr<Sequence> sequence;
+    ASSERT_EQ(manager.acquire(spec(START, 5), sequence), StatusCode::OK);
+    manager.release(spec(START, 5), *sequence, false);
+    EXPECT_EQ(manager.getSequencesCount(), 0);
+    // Failure in the middle of sequence keeps it, state is only updated after successful inference
+    ASSERT_EQ(manager.acquire(spec(START, 5), sequence), StatusCode::OK);
+    manager.release(spec(START, 5), *sequence, true);
+    manager.release(spec(NONE, 5), *sequence, false);
+    EXPECT_EQ(manager.getSequencesCount(), 1);
+}
+
+TEST(SequenceManager, LimitEvictsIdleSequencesFirst) {
+    SequenceManager manager(2, std::chrono::seconds(1));
+    std::shared_ptr<Sequence> first, second, third;
+    ASSERT_EQ(manager.acquire(spec(START, 1), first), StatusCode::OK);
+    ASSERT_EQ(manager.acquire(spec(START, 2), second), StatusCode::OK);
+    EXPECT_EQ(manager.acquire(spec(START, 3), third), StatusCode::MAX_SEQUENCE_NUMBER_REACHED);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+    {
+        // Sequence being processed is not removed
+        std::unique_lock<std::mutex> lock(second->getMutex());
+        ASSERT_EQ(manager.acquire(spec(START, 3), third), StatusCode::OK);
+    }
+    EXPECT_TRUE(first->isTerminated());
+    EXPECT_FALSE(second->isTerminated());
+    EXPECT_EQ(manager.getSequencesCount(), 2);
+    EXPECT_EQ(manager.acquire(spec(NONE, 1), first), StatusCode::SEQUENCE_MISSING);
+}
+
+TEST(SequenceManager, IdleSequencesAreRemoved) {
+    SequenceManager manager(10, std::chrono::seconds(1));
+    std::shared_ptr<Sequence> idle, active;
+    ASSERT_EQ(manager.acquire(spec(START, 1), idle), StatusCode::OK);
+    ASSERT_EQ(manager.acquire(spec(START, 2), active), StatusCode::OK);
+    std::this_thread::sleep_for(std::chrono::milliseconds(600));
+    ASSERT_EQ(manager.acquire(spec(NONE, 2), active), StatusCode::OK);
+    std::this_thread::sleep_for(std::chrono::milliseconds(600));
+    EXPECT_EQ(manager.removeIdleSequences(), 1);
+    EXPECT_TRUE(idle->isTerminated());
+    EXPECT_EQ(manager.getSequencesCount(), 1);
+
+    SequenceManager withoutTimeout(10, std::chrono::seconds(0));
+    ASSERT_EQ(withoutTimeout.acquire(spec(START, 1), idle), StatusCode::OK);
+    EXPECT_EQ(withoutTimeout.removeIdleSequences(), 0);
+}
@@ -259,3 +259,39 @@ INSTANTIATE_TEST_SUITE_P(
     SerializeTFGRPCPredictResponseNegative,
     ::testing::ValuesIn(UNSUPPORTED_OUTPUT_PRECISIONS),
     ::testing::PrintToStringParamName());
+
+TEST(SerializeTFTensorProtoConversion, FP16IsConvertedToFloat) {
+    std::vector<uint16_t> data{0x3c00, 0xc000, 0x3800};
+    auto networkOutput = std::make_shared<ovms::TensorInfo>("output", Precision::FP16, shape_t{1, 3}, Layout::NC);
+    auto blob = make_shared_blob<uint16_t>(networkOutput->getTensorDesc(), data.data());
+    TensorProto responseOutput;
+    ASSERT_EQ(serializeBlobToTensorProto(responseOutput, networkOutput, blob), ovms::StatusCode::OK);
+    EXPECT_EQ(responseOutput.dtype(), tensorflow::DataType::DT_FLOAT);
+    ASSERT_EQ(responseOutput.tensor_content().size(), data.size() * sizeof(float));
+    auto actual = reinterpret_cast<const float*>(responseOutput.tensor_content().data());
+    EXPECT_EQ(std::vector<float>(actual, actual + data.size()), (std::vector<float>{1.0, -2.0, 0.5}));
+}
+
+TEST(SerializeTFTensorProtoConversion, U16IsConvertedToUint32) {
+    std::vector<uint16_t> data{0, 1, 65535};
+    auto networkOutput = std::make_shared<ovms::TensorInfo>("output", Precision::U16, shape_t{1, 3}, Layout::NC);
+    auto blob = make_shared_blob<uint16_t>(networkOutput->getTensorDesc(), data.data());
+    TensorProto responseOutput;
+    ASSERT_EQ(serializeBlobToTensorProto(responseOutput, networkOutput, blob), ovms::StatusCode::OK);
+    EXPECT_EQ(responseOutput.dtype(), tensorflow::DataType::DT_UINT32);
+    ASSERT_EQ(responseOutput.tensor_content().size(), data.size() * sizeof(uint32_t));
+    auto actual = reinterpret_cast<const uint32_t*>(responseOutput.tensor_content().data());
+    EXPECT_EQ(std::vector<uint32_t>(actual, actual + data.size()), (std::vector<uint32_t>{0, 1, 65535}));
+}
+
+TEST(SerializeTFTensorProtoConversion, I64IsNarrowedToInt32) {
+    std::vector<int64_t> data{-3, 0, 100000};
+    auto networkOutput = std::make_shared<ovms::TensorInfo>("output", Precision::I64, shape_t{1, 3}, Layout::NC);
+    auto blob = make_shared_blob<int64_t>(networkOutput->getTensorDesc(), data.data());
+    TensorProto responseOutput;
+    ASSERT_EQ(serializeBlobToTensorProto(responseOutput, networkOutput, blob), ovms::StatusCode::OK);
+    EXPECT_EQ(responseOutput.dtype(), tensorflow::DataType::DT_INT32);
+    ASSERT_EQ(responseOutput.tensor_content().size(), data.size() * sizeof(int32_t));
+    auto actual = reinterpret_cast<const int32_t*>(responseOutput.tensor_content().data());
+    EXPECT_EQ(std::vector<int32_t>(actual, actual + data.size()), (std::vector<int32_t>{-3, 0, 100000}));
+}
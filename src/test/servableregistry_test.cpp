@@ -0,0 +1,185 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../modelmanager.hpp"
+#include "../servableregistry.hpp"
+#include "mockmodelinstancechangingstates.hpp"
+#include "test_utils.hpp"
+
+using namespace ovms;
+
+namespace {
+
+ServableEntry modelEntry(const std::string& name, const std::vector<model_version_t>& versions, model_version_t defaultVersion) {
+    ServableEntry entry;
+    entry.isModel = true;
+    for (auto version : versions) {
+        entry.versions[version] = std::make_shared<ModelInstance>(name, version);
+    }
+    if (defaultVersion != 0) {
+        entry.defaultInstance = entry.versions.at(defaultVersion);
+    }
+    return entry;
+}
+
+class ModelManagerWithChangingStatesModels : public ConstructorEnabledModelManager {
+public:
+    std::shared_ptr<Model> modelFactory(const std::string& name) override {
+        return std::make_shared<MockModelWithInstancesJustChangingStates>(name);
+    }
+};
+
+}  // namespace
+
+TEST(ServableRegistry, EmptyRegistryHasNoServables) {
+    ServableRegistry registry;
+    std::shared_ptr<ModelInstance> instance;
+    EXPECT_EQ(registry.findModelInstance("dummy", 0, instance), StatusCode::MODEL_NAME_MISSING);
+    EXPECT_FALSE(registry.modelExists("dummy"));
+    EXPECT_EQ(registry.findPipelineDefinition("dummy"), nullptr);
+    EXPECT_EQ(registry.getServablesCount(), 0);
+}
+
+TEST(ServableRegistry, FindModelInstances) {
+    ServableRegistry registry;
+    ServableRegistry::servables_t servables;
+    servables["dummy"] = modelEntry("dummy", {1, 2}, 2);
+    servables["unavailable"] = modelEntry("unavailable", {1}, 0);
+    registry.publish(std::move(servables));
+
+    std::shared_ptr<ModelInstance> instance;
+    ASSERT_EQ(registry.findModelInstance("dummy", 0, instance), StatusCode::OK);
+    EXPECT_EQ(instance->getVersion(), 2);
+    ASSERT_EQ(registry.findModelInstance("dummy", 1, instance), StatusCode::OK);
+    EXPECT_EQ(instance->getVersion(), 1);
+    EXPECT_EQ(registry.findModelInstance("dummy", 3, instance), StatusCode::MODEL_VERSION_MISSING);
+    EXPECT_EQ(registry.findModelInstance("unavailable", 0, instance), StatusCode::MODEL_VERSION_MISSING);
+    EXPECT_EQ(registry.findModelInstance("missing", 0, instance), StatusCode::MODEL_NAME_MISSING);
+    EXPECT_TRUE(registry.modelExists("unavailable"));
+}
+
+TEST(ServableRegistry, FindPipelineDefinition) {
+    ServableRegistry registry;
+    PipelineDefinition definition("pipeline", {}, {});
+    ServableRegistry::servables_t servables;
+    servables["pipeline"].pipelineDefinition = &definition;
+    registry.publish(std::move(servables));
+
+    EXPECT_EQ(registry.findPipelineDefinition("pipeline"), &definition);
+    EXPECT_TRUE(registry.pipelineDefinitionExists("pipeline"));
+    EXPECT_FALSE(registry.modelExists("pipeline"));
+    std::shared_ptr<ModelInstance> instance;
+    EXPECT_EQ(registry.findModelInstance("pipeline", 0, instance), StatusCode::MODEL_NAME_MISSING);
+}
+
+TEST(ServableRegistry, InstanceOutlivesReplacedSnapshot) {
+    ServableRegistry registry;
+    ServableRegistry::servables_t servables;
+    servables["dummy"] = modelEntry("dummy", {1}, 1);
+    registry.publish(std::move(servables));
+    std::shared_ptr<ModelInstance> instance;
+    ASSERT_EQ(registry.findModelInstance("dummy", 0, instance), StatusCode::OK);
+
+    registry.publish({});
+    EXPECT_FALSE(registry.modelExists("dummy"));
+    EXPECT_EQ(registry.getServablesCount(), 0);
+    EXPECT_EQ(instance->getName(), "dummy");
+    EXPECT_EQ(instance->getVersion(), 1);
+}
+
+TEST(ServableRegistry, RegistriesUsedByTheSameThreadAreSeparate) {
+    ServableRegistry first, second;
+    ServableRegistry::servables_t servables;
+    servables["first"] = modelEntry("first", {1}, 1);
+    first.publish(std::move(servables));
+    servables.clear();
+    servables["second"] = modelEntry("second", {1}, 1);
+    second.publish(std::move(servables));
+
+    for (int i = 0; i < 2; i++) {
+        EXPECT_TRUE(first.modelExists("first"));
+        EXPECT_FALSE(first.modelExists("second"));
+        EXPECT_TRUE(second.modelExists("second"));
+        EXPECT_FALSE(second.modelExists("first"));
+    }
+}
+
+TEST(ServableRegistry, ReadersSeeConsistentSnapshotsDuringPublishing) {
+    ServableRegistry registry;
+    const size_t publishesCount = 500;
+    std::atomic<bool> publishing{true};
+    std::atomic<size_t> inconsistent{0};
+    std::vector<std::thread> readers;
+    for (size_t i = 0; i < 4; i++) {
+        readers.emplace_back([&]() {
+            model_version_t lastSeen = 0;
+            while (publishing) {
+                std::shared_ptr<ModelInstance> instance;
+                if (!registry.findModelInstance("dummy", 0, instance).ok()) {
+                    continue;
+                }
+                // Each snapshot has all versions up to the default one and versions never go back
+                std::shared_ptr<ModelInstance> first;
+                if (instance->getVersion() < lastSeen || !registry.findModelInstance("dummy", 1, first).ok()) {
+                    inconsistent++;
+                }
+                lastSeen = instance->getVersion();
+            }
+        });
+    }
+    std::vector<model_version_t> versions;
+    for (size_t i = 1; i <= publishesCount; i++) {
+        versions.push_back(i);
+        ServableRegistry::servables_t servables;
+        servables["dummy"] = modelEntry("dummy", versions, i);
+        registry.publish(std::move(servables));
+    }
+    publishing = false;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(inconsistent, 0);
+    std::shared_ptr<ModelInstance> instance;
+    ASSERT_EQ(registry.findModelInstance("dummy", 0, instance), StatusCode::OK);
+    EXPECT_EQ(instance->getVersion(), publishesCount);
+}
+
+TEST(ServableRegistry, ModelManagerPublishesVersionChanges) {
+    ModelManagerWithChangingStatesModels manager;
+    const auto& registry = manager.getServableRegistry();
+    ModelConfig config = DUMMY_MODEL_CONFIG;
+    ASSERT_EQ(manager.reloadModelWithVersions(config), StatusCode::OK);
+
+    std::shared_ptr<ModelInstance> instance;
+    ASSERT_EQ(registry.findModelInstance("dummy", 0, instance), StatusCode::OK);
+    EXPECT_EQ(instance->getVersion(), 1);
+    EXPECT_EQ(instance, manager.findModelInstance("dummy"));
+
+    manager.findModelByName("dummy")->retireAllVersions();
+    EXPECT_TRUE(registry.modelExists("dummy"));
+    EXPECT_EQ(registry.findModelInstance("dummy", 0, instance), StatusCode::MODEL_VERSION_MISSING);
+    // Retired instance is still known, its state tells that it is no longer loaded
+    ASSERT_EQ(registry.findModelInstance("dummy", 1, instance), StatusCode::OK);
+    EXPECT_EQ(instance->getStatus().getState(), ModelVersionState::END);
+}
@@ -0,0 +1,171 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <limits>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "../shared_memory.hpp"
+
+using namespace ovms;
+
+class SharedMemoryTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        int fd = shm_open(segmentKey, O_CREAT | O_RDWR, 0600);
+        ASSERT_NE(fd, -1);
+        ASSERT_EQ(ftruncate(fd, segmentSize), 0);
+        data = static_cast<float*>(mmap(nullptr, segmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0));
+        close(fd);
+        ASSERT_NE(data, MAP_FAILED);
+        for (size_t i = 0; i < segmentSize / sizeof(float); i++) {
+            data[i] = static_cast<float>(i);
+        }
+        tensorInfo = std::make_shared<TensorInfo>("b", InferenceEngine::Precision::FP32, shape_t{1, 10}, InferenceEngine::Layout::NC);
+    }
+
+    void TearDown() override {
+        SharedMemoryManager::getInstance().unregisterRegion(regionName);
+        munmap(data, segmentSize);
+        shm_unlink(segmentKey);
+    }
+
+    tensorflow::TensorProto makeReference(const std::string& region, size_t offset) {
+        tensorflow::TensorProto proto;
+        proto.set_dtype(tensorflow::DataType::DT_FLOAT);
+        proto.mutable_tensor_shape()->add_dim()->set_size(1);
+        proto.mutable_tensor_shape()->add_dim()->set_size(10);
+        auto handle = proto.add_resource_handle_val();
+        handle->set_device(SHARED_MEMORY_DEVICE);
+        handle->set_container(region);
+        handle->set_hash_code(offset);
+        return proto;
+    }
+
+    const char* segmentKey = "/ovms_shared_memory_test";
+    const char* regionName = "test_region";
+    const size_t segmentSize = 4096;
+    float* data = nullptr;
+    std::shared_ptr<TensorInfo> tensorInfo;
+};
+
+TEST_F(SharedMemoryTest, RegisterAndUnregister) {
+    auto& manager = SharedMemoryManager::getInstance();
+    EXPECT_EQ(manager.registerRegion(regionName, segmentKey, 0, segmentSize), StatusCode::OK);
+    EXPECT_EQ(manager.registerRegion(regionName, segmentKey, 0, segmentSize), StatusCode::SHARED_MEMORY_REGION_ALREADY_EXISTS);
+    EXPECT_NE(manager.findRegionByName(regionName), nullptr);
+    EXPECT_EQ(manager.unregisterRegion(regionName), StatusCode::OK);
+    EXPECT_EQ(manager.findRegionByName(regionName), nullptr);
+    EXPECT_EQ(manager.unregisterRegion(regionName), StatusCode::SHARED_MEMORY_REGION_MISSING);
+}
+
+TEST_F(SharedMemoryTest, RegisterMissingSegmentFails) {
+    EXPECT_EQ(SharedMemoryManager::getInstance().registerRegion(regionName, "/ovms_not_existing_segment", 0, segmentSize),
+        StatusCode::SHARED_MEMORY_REGION_MAPPING_FAILED);
+}
+
+TEST_F(SharedMemoryTest, RegisterExceedingSegmentFails) {
+    EXPECT_EQ(SharedMemoryManager::getInstance().registerRegion(regionName, segmentKey, 64, segmentSize),
+        StatusCode::SHARED_MEMORY_REGION_OUT_OF_BOUNDS);
+}
+
+TEST_F(SharedMemoryTest, RegisterWithOverflowingRangeFails) {
+    auto& manager = SharedMemoryManager::getInstance();
+    const size_t max = std::numeric_limits<size_t>::max();
+    EXPECT_EQ(manager.registerRegion(regionName, segmentKey, 64, max - 32), StatusCode::SHARED_MEMORY_REGION_OUT_OF_BOUNDS);
+    EXPECT_EQ(manager.registerRegion(regionName, segmentKey, max, 1), StatusCode::SHARED_MEMORY_REGION_OUT_OF_BOUNDS);
+    EXPECT_EQ(manager.registerRegion(regionName, segmentKey, segmentSize + 1, 0), StatusCode::SHARED_MEMORY_REGION_OUT_OF_BOUNDS);
+}
+
+TEST_F(SharedMemoryTest, RegisterSegmentWithoutAllowedPrefixFails) {
+    auto& manager = SharedMemoryManager::getInstance();
+    EXPECT_EQ(manager.registerRegion(regionName, "/other_segment", 0, segmentSize), StatusCode::SHARED_MEMORY_KEY_NOT_ALLOWED);
+    EXPECT_EQ(manager.registerRegion(regionName, "/ovms_", 0, segmentSize), StatusCode::SHARED_MEMORY_KEY_NOT_ALLOWED);
+    EXPECT_EQ(manager.registerRegion(regionName, "/ovms_/../other_segment", 0, segmentSize), StatusCode::SHARED_MEMORY_KEY_NOT_ALLOWED);
+    EXPECT_EQ(manager.findRegionByName(regionName), nullptr);
+
+    manager.setAllowedKeyPrefix("/ovms_shared");
+    EXPECT_EQ(manager.registerRegion(regionName, segmentKey, 0, segmentSize), StatusCode::OK);
+    EXPECT_EQ(manager.unregisterRegion(regionName), StatusCode::OK);
+    manager.setAllowedKeyPrefix("/ovms_other");
+    EXPECT_EQ(manager.registerRegion(regionName, segmentKey, 0, segmentSize), StatusCode::SHARED_MEMORY_KEY_NOT_ALLOWED);
+    manager.setAllowedKeyPrefix(DEFAULT_SHARED_MEMORY_KEY_PREFIX);
+}
+
+TEST_F(SharedMemoryTest, BlobWrapsSharedMemoryWithoutCopy) {
+    auto& manager = SharedMemoryManager::getInstance();
+    const size_t regionOffset = 64;
+    ASSERT_EQ(manager.registerRegion(regionName, segmentKey, regionOffset, segmentSize - regionOffset), StatusCode::OK);
+    auto proto = makeReference(regionName, 8 * sizeof(float));
+    ASSERT_TRUE(isSharedMemoryReference(proto));
+
+    InferenceEngine::Blob::Ptr blob;
+    ASSERT_EQ(manager.createBlob(proto, tensorInfo, blob), StatusCode::OK);
+    ASSERT_NE(blob, nullptr);
+    EXPECT_EQ(blob->byteSize(), 10 * sizeof(float));
+
+    // Region and tensor offsets are both applied, data is the same memory
+    float* blobData = blob->buffer().as<float*>();
+    EXPECT_EQ(blobData[0], data[regionOffset / sizeof(float) + 8]);
+    blobData[0] = -1.0;
+    EXPECT_EQ(data[regionOffset / sizeof(float) + 8], -1.0);
+
+    // Blob keeps region mapped after unregistering
+    ASSERT_EQ(manager.unregisterRegion(regionName), StatusCode::OK);
+    EXPECT_EQ(blobData[1], data[regionOffset / sizeof(float) + 9]);
+}
+
+TEST_F(SharedMemoryTest, BlobOutOfRegionBoundsFails) {
+    auto& manager = SharedMemoryManager::getInstance();
+    ASSERT_EQ(manager.registerRegion(regionName, segmentKey, 0, 16 * sizeof(float)), StatusCode::OK);
+    InferenceEngine::Blob::Ptr blob;
+    EXPECT_EQ(manager.createBlob(makeReference(regionName, 7 * sizeof(float)), tensorInfo, blob), StatusCode::SHARED_MEMORY_REGION_OUT_OF_BOUNDS);
+    EXPECT_EQ(manager.createBlob(makeReference(regionName, 6 * sizeof(float)), tensorInfo, blob), StatusCode::OK);
+}
+
+TEST_F(SharedMemoryTest, BlobFromMissingRegionFails) {
+    InferenceEngine::Blob::Ptr blob;
+    EXPECT_EQ(SharedMemoryManager::getInstance().createBlob(makeReference("not_registered", 0), tensorInfo, blob),
+        StatusCode::SHARED_MEMORY_REGION_MISSING);
+}
+
+TEST(SharedMemoryOutputs, SplitRequest) {
+    tensor_map_t outputsInfo;
+    outputsInfo["a"] = std::make_shared<TensorInfo>("a", InferenceEngine::Precision::FP32, shape_t{1, 10});
+    tensorflow::serving::PredictRequest request;
+    request.mutable_model_spec()->set_name("dummy");
+    (*request.mutable_inputs())["b"].set_dtype(tensorflow::DataType::DT_FLOAT);
+    EXPECT_FALSE(hasSharedMemoryOutputs(request, outputsInfo));
+
+    auto handle = (*request.mutable_inputs())["a"].add_resource_handle_val();
+    handle->set_device(SHARED_MEMORY_DEVICE);
+    handle->set_container("region");
+    EXPECT_TRUE(hasSharedMemoryOutputs(request, outputsInfo));
+
+    tensorflow::serving::PredictRequest inputsRequest;
+    std::map<std::string, tensorflow::TensorProto> destinations;
+    splitSharedMemoryOutputs(request, outputsInfo, inputsRequest, destinations);
+    EXPECT_EQ(inputsRequest.model_spec().name(), "dummy");
+    EXPECT_EQ(inputsRequest.inputs_size(), 1);
+    EXPECT_EQ(inputsRequest.inputs().count("b"), 1u);
+    ASSERT_EQ(destinations.size(), 1u);
+    EXPECT_EQ(destinations.at("a").resource_handle_val(0).container(), "region");
+}
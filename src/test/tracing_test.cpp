@@ -0,0 +1,127 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <rapidjson/document.h>
+
+#include "../tracing.hpp"
+
+using namespace ovms;
+
+class TracingTest : public ::testing::Test {
+protected:
+    void TearDown() override {
+        Tracer::getInstance().configure(0, 0);
+    }
+
+    rapidjson::Document dumpTraces() {
+        std::string output;
+        Tracer::getInstance().writeChromeTrace(output);
+        rapidjson::Document document;
+        document.Parse(output.c_str());
+        return document;
+    }
+};
+
+TEST_F(TracingTest, DisabledTracerDoesNotSample) {
+    Tracer tracer;
+    EXPECT_EQ(tracer.startTrace("trace-id"), nullptr);
+    EXPECT_EQ(tracer.startTrace(""), nullptr);
+}
+
+TEST_F(TracingTest, RequestsAreSampledByIntervalOrTraceId) {
+    Tracer tracer;
+    tracer.configure(100, 0);
+    EXPECT_EQ(tracer.startTrace(""), nullptr);
+    auto trace = tracer.startTrace("abc");
+    ASSERT_NE(trace, nullptr);
+    EXPECT_EQ(trace->getId(), "abc");
+
+    tracer.configure(100, 3);
+    size_t sampled = 0;
+    for (size_t i = 0; i < 9; i++) {
+        if (tracer.startTrace("")) {
+            sampled++;
+        }
+    }
+    EXPECT_EQ(sampled, 3);
+}
+
+TEST_F(TracingTest, SpansAreNotRecordedWithoutTrace) {
+    Tracer::getInstance().configure(100, 0);
+    {
+        RequestTraceScope scope("request", "");
+        ScopedSpan span("inference");
+        EXPECT_EQ(getCurrentTrace(), nullptr);
+    }
+    EXPECT_EQ(Tracer::getInstance().getSpansCount(), 0);
+}
+
+TEST_F(TracingTest, SpansOfRequestAreExportedAsChromeTrace) {
+    Tracer::getInstance().configure(100, 0);
+    {
+        RequestTraceScope scope("request", "trace-1");
+        ASSERT_NE(getCurrentTrace(), nullptr);
+        {
+            ScopedSpan span("node:", std::string("dummy"));
+        }
+        ScopedSpan finishedEarly("deserialization");
+        finishedEarly.finish();
+        Trace* trace = getCurrentTrace();
+        std::thread worker([trace]() {
+            TraceContextGuard guard(trace);
+            ScopedSpan span("prediction");
+        });
+        worker.join();
+    }
+    EXPECT_EQ(getCurrentTrace(), nullptr);
+    EXPECT_EQ(Tracer::getInstance().getSpansCount(), 4);
+
+    auto document = dumpTraces();
+    ASSERT_FALSE(document.HasParseError());
+    const auto& events = document["traceEvents"];
+    ASSERT_TRUE(events.IsArray());
+    // Process name metadata and 4 spans
+    ASSERT_EQ(events.Size(), 5);
+    EXPECT_STREQ(events[0]["ph"].GetString(), "M");
+    EXPECT_STREQ(events[0]["args"]["name"].GetString(), "trace trace-1");
+    std::vector<std::string> names;
+    for (rapidjson::SizeType i = 1; i < events.Size(); i++) {
+        EXPECT_STREQ(events[i]["ph"].GetString(), "X");
+        EXPECT_STREQ(events[i]["args"]["trace_id"].GetString(), "trace-1");
+        EXPECT_EQ(events[i]["pid"].GetUint64(), events[0]["pid"].GetUint64());
+        names.push_back(events[i]["name"].GetString());
+    }
+    EXPECT_THAT(names, ::testing::UnorderedElementsAre("request", "node:dummy", "deserialization", "prediction"));
+}
+
+TEST_F(TracingTest, OldestTracesAreDroppedWhenBufferIsFull) {
+    Tracer::getInstance().configure(4, 0);
+    for (auto id : {"first", "second", "third"}) {
+        RequestTraceScope scope("request", id);
+        ScopedSpan span("inference");
+    }
+    EXPECT_EQ(Tracer::getInstance().getSpansCount(), 4);
+    auto document = dumpTraces();
+    const auto& events = document["traceEvents"];
+    ASSERT_EQ(events.Size(), 6);
+    EXPECT_STREQ(events[0]["args"]["name"].GetString(), "trace second");
+    EXPECT_STREQ(events[3]["args"]["name"].GetString(), "trace third");
+}
@@ -0,0 +1,179 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "tracing.hpp"
+
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+namespace ovms {
+
+static thread_local Trace* currentTrace = nullptr;
+
+static uint32_t getThreadId() {
+    static std::atomic<uint32_t> nextThreadId{1};
+    static thread_local uint32_t threadId = nextThreadId++;
+    return threadId;
+}
+
+void Trace::addSpan(std::string name, clock::time_point start, clock::time_point end) {
+    const uint32_t threadId = getThreadId();
+    std::unique_lock<std::mutex> lock(mutex);
+    spans.push_back(TraceSpan{std::move(name), start, end - start, threadId});
+}
+
+std::vector<TraceSpan> Trace::getSpans() {
+    std::unique_lock<std::mutex> lock(mutex);
+    return spans;
+}
+
+std::shared_ptr<Trace> Tracer::startTrace(std::string_view traceId) {
+    if (!isEnabled()) {
+        return nullptr;
+    }
+    if (traceId.empty()) {
+        if (samplingInterval == 0 || requestsCount++ % samplingInterval != 0) {
+            return nullptr;
+        }
+    }
+    const uint64_t sequence = nextSequence++;
+    return std::make_shared<Trace>(sequence, traceId.empty() ? std::to_string(sequence) : std::string(traceId));
+}
+
+void Tracer::finishTrace(const std::shared_ptr<Trace>& trace) {
+    FinishedTrace finished{trace->getSequence(), trace->getId(), trace->getSpans()};
+    std::unique_lock<std::mutex> lock(mutex);
+    spansCount += finished.spans.size();
+    traces.push_back(std::move(finished));
+    while (spansCount > bufferSize) {
+        spansCount -= traces.front().spans.size();
+        traces.pop_front();
+    }
+}
+
+size_t Tracer::getSpansCount() {
+    std::unique_lock<std::mutex> lock(mutex);
+    return spansCount;
+}
+
+void Tracer::writeChromeTrace(std::string& output) {
+    using std::chrono::duration_cast;
+    using std::chrono::microseconds;
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    writer.StartObject();
+    writer.Key("traceEvents");
+    writer.StartArray();
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        for (const auto& trace : traces) {
+            writer.StartObject();
+            writer.Key("name");
+            writer.String("process_name");
+            writer.Key("ph");
+            writer.String("M");
+            writer.Key("pid");
+            writer.Uint64(trace.sequence);
+            writer.Key("args");
+            writer.StartObject();
+            writer.Key("name");
+            writer.String(("trace " + trace.id).c_str());
+            writer.EndObject();
+            writer.EndObject();
+            for (const auto& span : trace.spans) {
+                writer.StartObject();
+                writer.Key("name");
+                writer.String(span.name.c_str());
+                writer.Key("cat");
+                writer.String("ovms");
+                writer.Key("ph");
+                writer.String("X");
+                writer.Key("ts");
+                writer.Int64(duration_cast<microseconds>(span.start.time_since_epoch()).count());
+                writer.Key("dur");
+                writer.Int64(duration_cast<microseconds>(span.duration).count());
+                writer.Key("pid");
+                writer.Uint64(trace.sequence);
+                writer.Key("tid");
+                writer.Uint(span.threadId);
+                writer.Key("args");
+                writer.StartObject();
+                writer.Key("trace_id");
+                writer.String(trace.id.c_str());
+                writer.EndObject();
+                writer.EndObject();
+            }
+        }
+    }
+    writer.EndArray();
+    writer.Key("displayTimeUnit");
+    writer.String("ms");
+    writer.EndObject();
+    output = buffer.GetString();
+}
+
+Trace* getCurrentTrace() {
+    return currentTrace;
+}
+
+TraceContextGuard::TraceContextGuard(Trace* trace) :
+    previous(currentTrace) {
+    currentTrace = trace;
+}
+
+TraceContextGuard::~TraceContextGuard() {
+    currentTrace = previous;
+}
+
+ScopedSpan::ScopedSpan(const char* name) :
+    trace(currentTrace) {
+    if (trace) {
+        this->name = name;
+        start = Trace::clock::now();
+    }
+}
+
+ScopedSpan::ScopedSpan(const char* prefix, const std::string& name) :
+    trace(currentTrace) {
+    if (trace) {
+        this->name = std::string(prefix) + name;
+        start = Trace::clock::now();
+    }
+}
+
+void ScopedSpan::finish() {
+    if (trace) {
+        trace->addSpan(std::move(name), start, Trace::clock::now());
+        trace = nullptr;
+    }
+}
+
+RequestTraceScope::RequestTraceScope(const char* name, std::string_view traceId) :
+    trace(Tracer::getInstance().startTrace(traceId)) {
+    if (trace) {
+        contextGuard = std::make_unique<TraceContextGuard>(trace.get());
+        span = std::make_unique<ScopedSpan>(name);
+    }
+}
+
+RequestTraceScope::~RequestTraceScope() {
+    if (trace) {
+        span.reset();
+        Tracer::getInstance().finishTrace(trace);
+        contextGuard.reset();
+    }
+}
+
+}  // namespace ovms
@@ -0,0 +1,174 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace ovms {
+
+const std::string TRACE_HEADER = "ovms-trace-id";
+
+/**
+ * @brief Timed part of request processing
+ */
+struct TraceSpan {
+    std::string name;
+    std::chrono::steady_clock::time_point start;
+    std::chrono::steady_clock::duration duration;
+    uint32_t threadId;
+};
+
+/**
+ * @brief Spans of a single sampled request. Spans may be added from multiple threads.
+ */
+class Trace {
+public:
+    using clock = std::chrono::steady_clock;
+
+    Trace(uint64_t sequence, std::string id) :
+        sequence(sequence),
+        id(std::move(id)) {}
+
+    uint64_t getSequence() const { return sequence; }
+    const std::string& getId() const { return id; }
+
+    void addSpan(std::string name, clock::time_point start, clock::time_point end);
+
+    std::vector<TraceSpan> getSpans();
+
+private:
+    const uint64_t sequence;
+    const std::string id;
+    std::mutex mutex;
+    std::vector<TraceSpan> spans;
+};
+
+/**
+ * @brief Samples requests for tracing and keeps spans of finished traces in a bounded buffer,
+ * oldest traces are dropped when the buffer is full. Tracing is disabled with buffer size 0.
+ */
+class Tracer {
+public:
+    static Tracer& getInstance() {
+        static Tracer instance;
+        return instance;
+    }
+
+    /**
+     * @brief Must not be called while requests are traced
+     *
+     * @param bufferSize maximum number of spans kept, 0 disables tracing
+     * @param samplingInterval every N-th request is traced, 0 traces only requests with trace id header
+     */
+    void configure(size_t bufferSize, uint32_t samplingInterval) {
+        this->bufferSize = bufferSize;
+        this->samplingInterval = samplingInterval;
+    }
+
+    bool isEnabled() const { return bufferSize > 0; }
+
+    /**
+     * @brief Returns trace when request is sampled, requests with trace id are always sampled
+     */
+    std::shared_ptr<Trace> startTrace(std::string_view traceId);
+
+    void finishTrace(const std::shared_ptr<Trace>& trace);
+
+    /**
+     * @brief Serializes buffered traces in Chrome trace event format, each trace is presented as a separate process
+     */
+    void writeChromeTrace(std::string& output);
+
+    size_t getSpansCount();
+
+private:
+    struct FinishedTrace {
+        uint64_t sequence;
+        std::string id;
+        std::vector<TraceSpan> spans;
+    };
+
+    size_t bufferSize = 0;
+    uint32_t samplingInterval = 0;
+    std::atomic<uint64_t> requestsCount{0};
+    std::atomic<uint64_t> nextSequence{1};
+
+    std::mutex mutex;
+    std::deque<FinishedTrace> traces;
+    size_t spansCount = 0;
+};
+
+/**
+ * @brief Trace of request processed by the calling thread, null when request is not sampled
+ */
+Trace* getCurrentTrace();
+
+/**
+ * @brief Makes trace current for the calling thread for its lifetime, used to continue trace in worker threads
+ */
+class TraceContextGuard {
+public:
+    explicit TraceContextGuard(Trace* trace);
+    ~TraceContextGuard();
+
+private:
+    Trace* previous;
+};
+
+/**
+ * @brief Records span in the current trace. With no current trace nothing is measured.
+ */
+class ScopedSpan {
+public:
+    explicit ScopedSpan(const char* name);
+    ScopedSpan(const char* prefix, const std::string& name);
+    ~ScopedSpan() { finish(); }
+
+    /**
+     * @brief Ends span before the end of scope
+     */
+    void finish();
+
+private:
+    Trace* trace;
+    std::string name;
+    Trace::clock::time_point start;
+};
+
+/**
+ * @brief Starts trace of a request and its top level span, finishes them at the end of scope
+ */
+class RequestTraceScope {
+public:
+    RequestTraceScope(const char* name, std::string_view traceId);
+    ~RequestTraceScope();
+
+private:
+    std::shared_ptr<Trace> trace;
+    std::unique_ptr<TraceContextGuard> contextGuard;
+    std::unique_ptr<ScopedSpan> span;
+};
+
+}  // namespace ovms
@@ -43,6 +43,11 @@ parser.add_argument('--grpc_port',
                     required=False,
                     default=9178,
                     help='Specify port to grpc service. default: 9178')
+parser.add_argument('--grpc_unix_socket',
+                    required=False,
+                    default=None,
+                    help='Specify path of unix domain socket to grpc service. '
+                    'If set, grpc_address and grpc_port are ignored. default: None')
 parser.add_argument('--input_name',
                     required=False,
                     default='input',
@@ -83,9 +88,12 @@ args = parser.parse_args()
 
 accurracy_measuring_mode = args.labels_numpy_path is not None
 
-channel = grpc.insecure_channel("{}:{}".format(
-    args.grpc_address,
-    args.grpc_port))
+if args.grpc_unix_socket is not None:
+    channel = grpc.insecure_channel("unix:{}".format(args.grpc_unix_socket))
+else:
+    channel = grpc.insecure_channel("{}:{}".format(
+        args.grpc_address,
+        args.grpc_port))
 
 stub = prediction_service_pb2_grpc.PredictionServiceStub(channel)
 